@@ -66,6 +66,22 @@
 #define HYBRIDCLR_ENABLE_STRACKTRACE IL2CPP_ENABLE_STACKTRACE_SENTRIES
 #endif
 
+// count runtime instruction pairs, used to choose superinstructions. see tools/superinstruction.
+#ifndef HYBRIDCLR_ENABLE_OPCODE_PROFILER
+#define HYBRIDCLR_ENABLE_OPCODE_PROFILER 0
+#endif
+
+// dispatch interpreter instructions by computed goto(labels as values) instead of switch.
+// only gcc and clang support it, other compilers fallback to switch.
+// opcode profiler records at the head of the dispatch loop, so it also requires switch.
+#ifndef HYBRIDCLR_ENABLE_COMPUTED_GOTO_DISPATCH
+#define HYBRIDCLR_ENABLE_COMPUTED_GOTO_DISPATCH 1
+#endif
+#if HYBRIDCLR_ENABLE_COMPUTED_GOTO_DISPATCH && ((!defined(__GNUC__) && !defined(__clang__)) || HYBRIDCLR_ENABLE_OPCODE_PROFILER)
+#undef HYBRIDCLR_ENABLE_COMPUTED_GOTO_DISPATCH
+#define HYBRIDCLR_ENABLE_COMPUTED_GOTO_DISPATCH 0
+#endif
+
 #if UNITY_ENGINE_TUANJIE
 #define HYBRIDCLR_MALLOC(size) IL2CPP_MALLOC(size, IL2CPP_MEM_META_POOL)
 #define HYBRIDCLR_MALLOC_ALIGNED(size, alignment) IL2CPP_MALLOC_ALIGNED(size, alignment, IL2CPP_MEM_META_POOL)
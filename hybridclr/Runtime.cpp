@@ -12,6 +12,7 @@
 #include "interpreter/InterpreterModule.h"
 #include "metadata/MetadataModule.h"
 #include "transform/TransformModule.h"
+#include "transform/PreJitScheduler.h"
 
 
 namespace hybridclr
@@ -24,4 +25,9 @@ namespace hybridclr
 		interpreter::InterpreterModule::Initialize();
 		transform::TransformModule::Initialize();
 	}
+
+	void Runtime::Shutdown()
+	{
+		transform::PreJitScheduler::Shutdown();
+	}
 }
\ No newline at end of file
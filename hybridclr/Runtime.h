@@ -9,5 +9,7 @@ namespace hybridclr
 	{
 	public:
 		static void Initialize();
+		// called before il2cpp shuts down, while managed threads can still be detached
+		static void Shutdown();
 	};
 }
\ No newline at end of file
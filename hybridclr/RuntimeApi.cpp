@@ -5,11 +5,18 @@
 #include "vm/Array.h"
 #include "vm/Exception.h"
 #include "vm/Class.h"
+#include "vm/Image.h"
+#include "vm/Reflection.h"
+#include "utils/StringUtils.h"
 
 #include "metadata/MetadataModule.h"
+#include "metadata/Assembly.h"
 #include "metadata/MetadataUtil.h"
 #include "metadata/UnifiedMetadataProvider.h"
 #include "interpreter/InterpreterModule.h"
+#include "interpreter/OpcodeProfiler.h"
+#include "transform/PreJitScheduler.h"
+#include "transform/TransformCache.h"
 #include "RuntimeConfig.h"
 
 namespace hybridclr
@@ -22,6 +29,14 @@ namespace hybridclr
 		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::SetRuntimeOption(HybridCLR.RuntimeOptionId,System.Int32)", (Il2CppMethodPointer)SetRuntimeOption);
 		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::PreJitClass(System.Type)", (Il2CppMethodPointer)PreJitClass);
 		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::PreJitMethod(System.Reflection.MethodInfo)", (Il2CppMethodPointer)PreJitMethod);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::PreJitAssemblyAsync(System.Reflection.Assembly)", (Il2CppMethodPointer)PreJitAssemblyAsync);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::PreJitMethodsAsync(System.Reflection.MethodInfo[])", (Il2CppMethodPointer)PreJitMethodsAsync);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::GetPreJitTaskProgress(System.Int32)", (Il2CppMethodPointer)GetPreJitTaskProgress);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::IsPreJitTaskCompleted(System.Int32)", (Il2CppMethodPointer)IsPreJitTaskCompleted);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::SetTransformCacheDirectory(System.String)", (Il2CppMethodPointer)SetTransformCacheDirectory);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::SaveTransformCache()", (Il2CppMethodPointer)SaveTransformCache);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::LoadAssemblyFromFile(System.String,System.String)", (Il2CppMethodPointer)LoadAssemblyFromFile);
+		il2cpp::vm::InternalCalls::Add("HybridCLR.RuntimeApi::DumpOpcodePairHistogram(System.String)", (Il2CppMethodPointer)DumpOpcodePairHistogram);
 	}
 
 	int32_t RuntimeApi::LoadMetadataForAOTAssembly(Il2CppArray* dllBytes, int32_t mode)
@@ -75,7 +90,7 @@ namespace hybridclr
 		return true;
 	}
 
-	int32_t PreJitMethod0(const MethodInfo* methodInfo)
+	static bool IsPreJitable(const MethodInfo* methodInfo)
 	{
 		if (!methodInfo->isInterpterImpl)
 		{
@@ -100,12 +115,142 @@ namespace hybridclr
 				return false;
 			}
 		}
+		return true;
+	}
 
-		return interpreter::InterpreterModule::GetInterpMethodInfo(methodInfo) != nullptr;
+	int32_t PreJitMethod0(const MethodInfo* methodInfo)
+	{
+		if (!IsPreJitable(methodInfo))
+		{
+			return false;
+		}
+		// prejitted methods skip the baseline tier
+		return interpreter::InterpreterModule::GetInterpMethodInfo(methodInfo, interpreter::ExecutionTier::Optimized) != nullptr;
 	}
 
 	int32_t RuntimeApi::PreJitMethod(Il2CppReflectionMethod* method)
 	{
 		return PreJitMethod0(method->method);
 	}
+
+	static void AddPreJitMethod(std::vector<const MethodInfo*>& methods, const MethodInfo* methodInfo)
+	{
+		const interpreter::InterpMethodInfo* imi = (const interpreter::InterpMethodInfo*)methodInfo->interpData;
+		if (IsPreJitable(methodInfo) && !(interpreter::IsTransformedInterpData(imi) && imi->tier == interpreter::ExecutionTier::Optimized))
+		{
+			methods.push_back(methodInfo);
+		}
+	}
+
+	int32_t RuntimeApi::PreJitAssemblyAsync(Il2CppReflectionAssembly* assembly)
+	{
+		if (!assembly)
+		{
+			il2cpp::vm::Exception::RaiseNullReferenceException();
+		}
+		const Il2CppImage* image = assembly->assembly->image;
+		std::vector<const MethodInfo*> methods;
+		for (uint32_t i = 0, n = il2cpp::vm::Image::GetNumTypes(image); i < n; i++)
+		{
+			Il2CppClass* klass = const_cast<Il2CppClass*>(il2cpp::vm::Image::GetType(image, i));
+			if (!klass || klass->is_generic)
+			{
+				continue;
+			}
+			// klass->methods is set up by Class::Init
+			il2cpp::vm::Class::Init(klass);
+			for (uint16_t j = 0; j < klass->method_count; j++)
+			{
+				AddPreJitMethod(methods, klass->methods[j]);
+			}
+		}
+		return transform::PreJitScheduler::Schedule(methods);
+	}
+
+	int32_t RuntimeApi::PreJitMethodsAsync(Il2CppArray* methodArr)
+	{
+		if (!methodArr)
+		{
+			il2cpp::vm::Exception::RaiseNullReferenceException();
+		}
+		std::vector<const MethodInfo*> methods;
+		for (il2cpp_array_size_t i = 0, n = il2cpp::vm::Array::GetLength(methodArr); i < n; i++)
+		{
+			Il2CppReflectionMethod* method = il2cpp_array_get(methodArr, Il2CppReflectionMethod*, i);
+			if (method)
+			{
+				AddPreJitMethod(methods, method->method);
+			}
+		}
+		return transform::PreJitScheduler::Schedule(methods);
+	}
+
+	static void GetPreJitTaskProgress0(int32_t taskId, int32_t& finishedMethodCount, int32_t& methodCount)
+	{
+		if (!transform::PreJitScheduler::GetTaskProgress(taskId, finishedMethodCount, methodCount))
+		{
+			TEMP_FORMAT(taskIdStr, "%d", taskId);
+			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetArgumentException(taskIdStr, "invalid prejit task id"));
+		}
+	}
+
+	float RuntimeApi::GetPreJitTaskProgress(int32_t taskId)
+	{
+		int32_t finishedMethodCount;
+		int32_t methodCount;
+		GetPreJitTaskProgress0(taskId, finishedMethodCount, methodCount);
+		return methodCount > 0 ? (float)finishedMethodCount / methodCount : 1.0f;
+	}
+
+	int32_t RuntimeApi::IsPreJitTaskCompleted(int32_t taskId)
+	{
+		int32_t finishedMethodCount;
+		int32_t methodCount;
+		GetPreJitTaskProgress0(taskId, finishedMethodCount, methodCount);
+		return finishedMethodCount == methodCount;
+	}
+
+	void RuntimeApi::SetTransformCacheDirectory(Il2CppString* dir)
+	{
+		// null disables the cache
+		if (!dir)
+		{
+			transform::TransformCache::SetCacheDirectory(nullptr);
+			return;
+		}
+		std::string stdDir = il2cpp::utils::StringUtils::Utf16ToUtf8(dir->chars);
+		transform::TransformCache::SetCacheDirectory(stdDir.c_str());
+	}
+
+	int32_t RuntimeApi::SaveTransformCache()
+	{
+		return transform::TransformCache::Save();
+	}
+
+	Il2CppReflectionAssembly* RuntimeApi::LoadAssemblyFromFile(Il2CppString* assemblyPath, Il2CppString* symbolStorePath)
+	{
+		if (!assemblyPath)
+		{
+			il2cpp::vm::Exception::RaiseNullReferenceException();
+		}
+		std::string stdAssemblyPath = il2cpp::utils::StringUtils::Utf16ToUtf8(assemblyPath->chars);
+		// null means no pdb
+		std::string stdSymbolStorePath = symbolStorePath ? il2cpp::utils::StringUtils::Utf16ToUtf8(symbolStorePath->chars) : std::string();
+		const Il2CppAssembly* ass = metadata::Assembly::LoadFromFile(stdAssemblyPath.c_str(), symbolStorePath ? stdSymbolStorePath.c_str() : nullptr);
+		return il2cpp::vm::Reflection::GetAssemblyObject(ass);
+	}
+
+	int32_t RuntimeApi::DumpOpcodePairHistogram(Il2CppString* path)
+	{
+		if (!path)
+		{
+			il2cpp::vm::Exception::RaiseNullReferenceException();
+		}
+#if HYBRIDCLR_ENABLE_OPCODE_PROFILER
+		std::string stdPath = il2cpp::utils::StringUtils::Utf16ToUtf8(path->chars);
+		return interpreter::OpcodeProfiler::DumpPairHistogram(stdPath.c_str());
+#else
+		return false;
+#endif
+	}
 }
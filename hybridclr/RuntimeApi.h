@@ -17,5 +17,16 @@ namespace hybridclr
 
 		static int32_t PreJitClass(Il2CppReflectionType* type);
 		static int32_t PreJitMethod(Il2CppReflectionMethod* method);
+		static int32_t PreJitAssemblyAsync(Il2CppReflectionAssembly* assembly);
+		static int32_t PreJitMethodsAsync(Il2CppArray* methods);
+		static float GetPreJitTaskProgress(int32_t taskId);
+		static int32_t IsPreJitTaskCompleted(int32_t taskId);
+
+		static void SetTransformCacheDirectory(Il2CppString* dir);
+		static int32_t SaveTransformCache();
+
+		static Il2CppReflectionAssembly* LoadAssemblyFromFile(Il2CppString* assemblyPath, Il2CppString* symbolStorePath);
+
+		static int32_t DumpOpcodePairHistogram(Il2CppString* path);
 	};
 }
\ No newline at end of file
@@ -10,6 +10,13 @@ namespace hybridclr
 	static int32_t s_maxMethodBodyCacheSize = 1024;
 	static int32_t s_maxMethodInlineDepth = 3;
 	static int32_t s_maxInlineableMethodBodySize = 32;
+	static int32_t s_enableIROptimizer = 1;
+	// <= 0 means processor count - 1
+	static int32_t s_preJitWorkerCount = 0;
+	// <= 0 disables tiered execution, methods are optimized on first transform
+	static int32_t s_tierUpCallCount = 30;
+	// <= 0 disables counting of loop iterations
+	static int32_t s_tierUpBackEdgeCount = 1000;
 
 
 
@@ -27,6 +34,16 @@ namespace hybridclr
 			return s_maxMethodBodyCacheSize;
 		case RuntimeOptionId::MaxMethodInlineDepth:
 			return s_maxMethodInlineDepth;
+		case RuntimeOptionId::MaxInlineableMethodBodySize:
+			return s_maxInlineableMethodBodySize;
+		case RuntimeOptionId::EnableIROptimizer:
+			return s_enableIROptimizer;
+		case RuntimeOptionId::PreJitWorkerCount:
+			return s_preJitWorkerCount;
+		case RuntimeOptionId::TierUpCallCount:
+			return s_tierUpCallCount;
+		case RuntimeOptionId::TierUpBackEdgeCount:
+			return s_tierUpBackEdgeCount;
 		default:
 		{
 			TEMP_FORMAT(optionIdStr, "%d", optionId);
@@ -55,6 +72,21 @@ namespace hybridclr
 		case RuntimeOptionId::MaxMethodInlineDepth:
 			s_maxMethodInlineDepth = value;
 			break;
+		case RuntimeOptionId::MaxInlineableMethodBodySize:
+			s_maxInlineableMethodBodySize = value;
+			break;
+		case RuntimeOptionId::EnableIROptimizer:
+			s_enableIROptimizer = value;
+			break;
+		case RuntimeOptionId::PreJitWorkerCount:
+			s_preJitWorkerCount = value;
+			break;
+		case RuntimeOptionId::TierUpCallCount:
+			s_tierUpCallCount = value;
+			break;
+		case RuntimeOptionId::TierUpBackEdgeCount:
+			s_tierUpBackEdgeCount = value;
+			break;
 		default:
 		{
 			TEMP_FORMAT(optionIdStr, "%d", optionId);
@@ -94,4 +126,29 @@ namespace hybridclr
 		return s_maxInlineableMethodBodySize;
 	}
 
+	bool RuntimeConfig::IsIROptimizerEnabled()
+	{
+		return s_enableIROptimizer != 0;
+	}
+
+	int32_t RuntimeConfig::GetPreJitWorkerCount()
+	{
+		return s_preJitWorkerCount;
+	}
+
+	int32_t RuntimeConfig::GetTierUpCallCount()
+	{
+		return s_tierUpCallCount;
+	}
+
+	int32_t RuntimeConfig::GetTierUpBackEdgeCount()
+	{
+		return s_tierUpBackEdgeCount;
+	}
+
+	bool RuntimeConfig::IsTieredExecutionEnabled()
+	{
+		return s_tierUpCallCount > 0;
+	}
+
 }
@@ -12,6 +12,10 @@ namespace hybridclr
 		MaxMethodBodyCacheSize = 4,
 		MaxMethodInlineDepth = 5,
 		MaxInlineableMethodBodySize = 6,
+		EnableIROptimizer = 7,
+		PreJitWorkerCount = 8,
+		TierUpCallCount = 9,
+		TierUpBackEdgeCount = 10,
 	};
 
 	class RuntimeConfig
@@ -28,6 +32,11 @@ namespace hybridclr
 		static int32_t GetMaxMethodBodyCacheSize();
 		static int32_t GetMaxMethodInlineDepth();
 		static int32_t GetMaxInlineableMethodBodySize();
+		static bool IsIROptimizerEnabled();
+		static int32_t GetPreJitWorkerCount();
+		static int32_t GetTierUpCallCount();
+		static int32_t GetTierUpBackEdgeCount();
+		static bool IsTieredExecutionEnabled();
 	};
 }
 
@@ -3,6 +3,7 @@
 #include "codegen/il2cpp-codegen.h"
 
 #include "Interpreter.h"
+#include "InterpreterModule.h"
 #include "MemoryUtil.h"
 #include "../metadata/InterpreterImage.h"
 #include "../metadata/MetadataModule.h"
@@ -26,31 +27,33 @@ namespace interpreter
 #define POP_STACK_FRAME() 
 #endif
 
-	InterpFrame* InterpFrameGroup::EnterFrameFromInterpreter(const MethodInfo* method, StackObject* argBase)
+	InterpFrame* InterpFrameGroup::EnterFrameFromInterpreter(const MethodInfo* method, const InterpMethodInfo* imi, StackObject* argBase)
 	{
 #if HYBRIDCLR_ENABLE_PROFILER
 		il2cpp_codegen_profiler_method_enter(method);
 #endif
-		const InterpMethodInfo* imi = (const InterpMethodInfo*)method->interpData;
 		int32_t oldStackTop = _machineState.GetStackTop();
 		StackObject* stackBasePtr = _machineState.AllocStackSlot(imi->maxStackSize - imi->argStackObjectSize);
 		InterpFrame* newFrame = _machineState.PushFrame();
-		*newFrame = { method, argBase, oldStackTop, nullptr, nullptr, nullptr, 0, 0, _machineState.GetLocalPoolBottomIdx() };
+		*newFrame = { method, imi, argBase, oldStackTop, nullptr, nullptr, nullptr, 0, 0, _machineState.GetLocalPoolBottomIdx() };
+		if (DecreaseTierUpCountdown(imi->callCountdown))
+		{
+			InterpreterModule::RequestTierUp(method);
+		}
 		PUSH_STACK_FRAME(method, (uintptr_t)newFrame);
 		return newFrame;
 	}
 
 
-	InterpFrame* InterpFrameGroup::EnterFrameFromNative(const MethodInfo* method, StackObject* argBase)
+	InterpFrame* InterpFrameGroup::EnterFrameFromNative(const MethodInfo* method, const InterpMethodInfo* imi, StackObject* argBase)
 	{
 #if HYBRIDCLR_ENABLE_PROFILER
 		il2cpp_codegen_profiler_method_enter(method);
 #endif
-		const InterpMethodInfo* imi = (const InterpMethodInfo*)method->interpData;
 		int32_t oldStackTop = _machineState.GetStackTop();
 		StackObject* stackBasePtr = _machineState.AllocStackSlot(imi->maxStackSize);
 		InterpFrame* newFrame = _machineState.PushFrame();
-		*newFrame = { method, stackBasePtr, oldStackTop, nullptr, nullptr, nullptr, 0, 0, _machineState.GetLocalPoolBottomIdx() };
+		*newFrame = { method, imi, stackBasePtr, oldStackTop, nullptr, nullptr, nullptr, 0, 0, _machineState.GetLocalPoolBottomIdx() };
 
 		// if not prepare arg stack. copy from args
 		if (imi->args)
@@ -58,10 +61,26 @@ namespace interpreter
 			IL2CPP_ASSERT(imi->argCount == metadata::GetActualArgumentNum(method));
 			CopyStackObject(stackBasePtr, argBase, imi->argStackObjectSize);
 		}
+		if (DecreaseTierUpCountdown(imi->callCountdown))
+		{
+			InterpreterModule::RequestTierUp(method);
+		}
 		PUSH_STACK_FRAME(method, (uintptr_t)newFrame);
 		return newFrame;
 	}
 
+	void InterpFrameGroup::ReplaceFrameCode(InterpFrame* frame, const InterpMethodInfo* imi)
+	{
+		IL2CPP_ASSERT(frame == _machineState.GetTopFrame());
+		// the extended stack is released with the frame, LeaveFrame restores oldStackTop
+		int32_t frameEndIdx = (int32_t)(frame->stackBasePtr - _machineState.GetStackBasePtr()) + (int32_t)imi->maxStackSize;
+		if (frameEndIdx > _machineState.GetStackTop())
+		{
+			_machineState.AllocStackSlot(frameEndIdx - _machineState.GetStackTop());
+		}
+		frame->imi = imi;
+	}
+
 	InterpFrame* InterpFrameGroup::LeaveFrame()
 	{
 		IL2CPP_ASSERT(_machineState.GetFrameTopIdx() > _frameBaseIdx);
@@ -96,7 +115,7 @@ namespace interpreter
 	static void SetupStackFrameInfo(const InterpFrame* frame, Il2CppStackFrameInfo& stackFrame)
 	{
 		const MethodInfo* method = frame->method;
-		const InterpMethodInfo* imi = (const InterpMethodInfo*)method->interpData;
+		const InterpMethodInfo* imi = frame->imi;
 		const byte* actualIp = (const byte*)frame->ip;
 
 		stackFrame.method = method;
@@ -121,6 +140,104 @@ namespace interpreter
 		pdbImage->SetupStackFrameInfo(method, actualIp, stackFrame);
 	}
 
+	std::pair<char*, size_t> MachineState::GetGCRootData(void* root)
+	{
+		MachineState* machineState = (MachineState*)root;
+		if (!machineState->_stackBase || machineState->_stackTopIdx <= 0)
+		{
+			return std::make_pair(nullptr, 0);
+		}
+		int32_t rootCount;
+		if (!machineState->CollectGCRootSlots(rootCount))
+		{
+			return std::make_pair((char*)machineState->_stackBase, machineState->_stackTopIdx * sizeof(StackObject));
+		}
+		return std::make_pair((char*)machineState->_gcRootMemory.GetBase(), rootCount * sizeof(StackObject));
+	}
+
+	// a dynamic root is a single range, so the slots to scan are copied to _gcRootMemory. args and locals of a frame
+	// are filtered by the ref slot map of its code. its eval stack and slots outside of frames are copied as they are.
+	// it runs with the world stopped and must not allocate from the heap, only pages of _gcRootMemory are committed.
+	// returns false if the frames look inconsistent or out of memory, then the whole live range is scanned.
+	bool MachineState::CollectGCRootSlots(int32_t& rootCount)
+	{
+		rootCount = 0;
+		StackObject* roots = (StackObject*)_gcRootMemory.GetBase();
+		if (!roots)
+		{
+			return false;
+		}
+		int32_t committedRootCount = (int32_t)(_gcRootMemory.GetBottomCommittedSize() / sizeof(StackObject));
+		auto addSlot = [&](int32_t idx) -> bool
+		{
+			void* value = _stackBase[idx].ptr;
+			if (!value)
+			{
+				return true;
+			}
+			if (rootCount == committedRootCount)
+			{
+				if (!_gcRootMemory.CommitBottom((size_t)(rootCount + 1) * sizeof(StackObject)))
+				{
+					return false;
+				}
+				committedRootCount = (int32_t)(_gcRootMemory.GetBottomCommittedSize() / sizeof(StackObject));
+			}
+			roots[rootCount++].ptr = value;
+			return true;
+		};
+		auto addSlotRange = [&](int32_t beginIdx, int32_t endIdx) -> bool
+		{
+			for (int32_t idx = beginIdx; idx < endIdx; idx++)
+			{
+				if (!addSlot(idx))
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+
+		// the top frame may be half initialized by PushFrame or ReplaceFrameCode, its slots are copied as they are
+		int32_t trustedFrameCount = std::max(_frameTopIdx - 1, 0);
+		int32_t coveredIdx = 0;
+		for (int32_t i = 0; i < trustedFrameCount; i++)
+		{
+			const InterpFrame* frame = _frameBase + i;
+			const InterpMethodInfo* imi = frame->imi;
+			int32_t baseIdx = (int32_t)(frame->stackBasePtr - _stackBase);
+			int32_t mappedEndIdx = baseIdx + (int32_t)imi->evalStackBaseOffset;
+			int32_t endIdx = baseIdx + (int32_t)imi->maxStackSize;
+			if (i + 1 < trustedFrameCount)
+			{
+				// args of a call from the interpreter and the slots above them belong to the callee
+				endIdx = std::min(endIdx, (int32_t)(_frameBase[i + 1].stackBasePtr - _stackBase));
+			}
+			if (baseIdx < coveredIdx || mappedEndIdx > endIdx || endIdx > _stackTopIdx)
+			{
+				return false;
+			}
+			if (!addSlotRange(coveredIdx, baseIdx))
+			{
+				return false;
+			}
+			const uint8_t* refSlotMap = imi->refSlotMap;
+			for (int32_t j = 0, n = (int32_t)imi->evalStackBaseOffset; j < n; j++)
+			{
+				if ((refSlotMap[j / 8] & (1 << (j % 8))) && !addSlot(baseIdx + j))
+				{
+					return false;
+				}
+			}
+			if (!addSlotRange(mappedEndIdx, endIdx))
+			{
+				return false;
+			}
+			coveredIdx = endIdx;
+		}
+		return addSlotRange(coveredIdx, _stackTopIdx);
+	}
+
 	void MachineState::CollectFrames(il2cpp::vm::StackFrames* stackFrames)
 	{
 		if (_frameTopIdx <= 0)
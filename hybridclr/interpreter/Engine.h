@@ -30,9 +30,13 @@ namespace interpreter
 			_stackBase = nullptr;
 			_stackTopIdx = 0;
 			_localPoolBottomIdx = -1;
+			_stackLimitIdx = -1;
+			_stackCommittedTopIdx = 0;
+			_localPoolCommittedBottomIdx = 0;
 
 			_frameBase = nullptr;
 			_frameCount = -1;
+			_frameCommittedCount = 0;
 			_frameTopIdx = 0;
 
 			_exceptionFlowBase = nullptr;
@@ -46,11 +50,12 @@ namespace interpreter
 			{
 				//il2cpp::gc::GarbageCollector::FreeFixed(_stackBase);
 				il2cpp::gc::GarbageCollector::UnregisterDynamicRoot(this);
-				HYBRIDCLR_FREE(_stackBase);
+				_stackMemory.Release();
+				_gcRootMemory.Release();
 			}
 			if (_frameBase)
 			{
-				HYBRIDCLR_FREE(_frameBase);
+				_frameMemory.Release();
 			}
 			if (_exceptionFlowBase)
 			{
@@ -58,18 +63,8 @@ namespace interpreter
 			}
 		}
 
-		static std::pair<char*, size_t> GetGCRootData(void* root)
-		{
-			MachineState* machineState = (MachineState*)root;
-			if (machineState->_stackBase && machineState->_stackTopIdx > 0)
-			{
-				return std::make_pair((char*)machineState->_stackBase, machineState->_stackTopIdx * sizeof(StackObject));
-			}
-			else
-			{
-				return std::make_pair(nullptr, 0);
-			}
-		}
+		// only the live range [0, _stackTopIdx) is scanned, it always lies in the committed pages
+		static std::pair<char*, size_t> GetGCRootData(void* root);
 
 		StackObject* AllocArgments(int32_t argCount)
 		{
@@ -88,16 +83,9 @@ namespace interpreter
 
 		StackObject* AllocStackSlot(int32_t slotNum)
 		{
-			if (_stackTopIdx + slotNum > _localPoolBottomIdx)
+			if (_stackTopIdx + slotNum > _stackLimitIdx)
 			{
-				if (!_stackBase)
-				{
-					InitEvalStack();
-				}
-				if (_stackTopIdx + slotNum > _localPoolBottomIdx)
-				{
-					il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocStackSlot"));
-				}
+				GrowEvalStack(_stackTopIdx + slotNum);
 			}
 			StackObject* dataPtr = _stackBase + _stackTopIdx;
 			_stackTopIdx += slotNum;
@@ -112,18 +100,25 @@ namespace interpreter
 			IL2CPP_ASSERT(size % 8 == 0);
 			int32_t slotNum = (int32_t)(size / 8);
 			IL2CPP_ASSERT(slotNum > 0);
+			if (!_stackBase)
+			{
+				InitEvalStack();
+			}
 			if (_stackTopIdx + slotNum > _localPoolBottomIdx)
 			{
-				if (!_stackBase)
-				{
-					InitEvalStack();
-				}
-				if (_stackTopIdx + slotNum > _localPoolBottomIdx)
+				il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocLocalloc"));
+			}
+			int32_t newBottomIdx = _localPoolBottomIdx - slotNum;
+			if (newBottomIdx < _localPoolCommittedBottomIdx)
+			{
+				if (!_stackMemory.CommitTop((size_t)(_stackSize - newBottomIdx) * sizeof(StackObject)))
 				{
-					il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocLocalloc"));
+					il2cpp::vm::Exception::RaiseOutOfMemoryException();
 				}
+				_localPoolCommittedBottomIdx = _stackSize - (int32_t)(_stackMemory.GetTopCommittedSize() / sizeof(StackObject));
 			}
-			_localPoolBottomIdx -= slotNum;
+			_localPoolBottomIdx = newBottomIdx;
+			_stackLimitIdx = std::min(_stackLimitIdx, newBottomIdx);
 			return _stackBase + _localPoolBottomIdx;
 		}
 
@@ -145,20 +140,15 @@ namespace interpreter
 		void SetLocalPoolBottomIdx(int32_t idx)
 		{
 			_localPoolBottomIdx = idx;
+			// a raised bottom leaves _stackLimitIdx lower than needed, GrowEvalStack catches up
+			_stackLimitIdx = std::min(_stackLimitIdx, idx);
 		}
 
 		InterpFrame* PushFrame()
 		{
-			if (_frameTopIdx >= _frameCount)
+			if (_frameTopIdx >= _frameCommittedCount)
 			{
-				if (!_frameBase)
-				{
-					InitFrames();
-				}
-				else
-				{
-					il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocFrame"));
-				}
+				GrowFrames();
 			}
 			return _frameBase + _frameTopIdx++;
 		}
@@ -249,22 +239,80 @@ namespace interpreter
 	private:
 
 
+		// the configured sizes are only reserved. the eval stack is committed upward from the bottom and
+		// the localloc pool downward from the top, frames upward, a chunk at a time.
 		void InitEvalStack()
 		{
-			_stackSize = (int32_t)RuntimeConfig::GetInterpreterThreadObjectStackSize();
-			_stackBase = (StackObject*)HYBRIDCLR_MALLOC_ZERO(RuntimeConfig::GetInterpreterThreadObjectStackSize() * sizeof(StackObject));
+			if (!_stackMemory.Reserve(RuntimeConfig::GetInterpreterThreadObjectStackSize() * sizeof(StackObject)))
+			{
+				il2cpp::vm::Exception::RaiseOutOfMemoryException();
+			}
+			_stackSize = (int32_t)(_stackMemory.GetSize() / sizeof(StackObject));
+			_stackBase = (StackObject*)_stackMemory.GetBase();
 			_stackTopIdx = 0;
 			_localPoolBottomIdx = _stackSize;
+			_stackCommittedTopIdx = 0;
+			_localPoolCommittedBottomIdx = _stackSize;
+			_stackLimitIdx = 0;
+			// GetGCRootData falls back to scanning the whole live range if it fails
+			_gcRootMemory.Reserve(_stackMemory.GetSize());
 			il2cpp::gc::GarbageCollector::RegisterDynamicRoot(this, GetGCRootData);
 		}
 
+		// slow path of AllocStackSlot, makes [0, topIdx) usable
+		void GrowEvalStack(int32_t topIdx)
+		{
+			if (!_stackBase)
+			{
+				InitEvalStack();
+			}
+			if (topIdx > _localPoolBottomIdx)
+			{
+				il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocStackSlot"));
+			}
+			if (topIdx > _stackCommittedTopIdx)
+			{
+				if (!_stackMemory.CommitBottom((size_t)topIdx * sizeof(StackObject)))
+				{
+					il2cpp::vm::Exception::RaiseOutOfMemoryException();
+				}
+				_stackCommittedTopIdx = (int32_t)(_stackMemory.GetBottomCommittedSize() / sizeof(StackObject));
+			}
+			_stackLimitIdx = std::min(_stackCommittedTopIdx, _localPoolBottomIdx);
+		}
+
+		bool CollectGCRootSlots(int32_t& rootCount);
+
 		void InitFrames()
 		{
-			_frameBase = (InterpFrame*)HYBRIDCLR_CALLOC(RuntimeConfig::GetInterpreterThreadFrameStackSize(), sizeof(InterpFrame));
-			_frameCount = (int32_t)RuntimeConfig::GetInterpreterThreadFrameStackSize();
+			if (!_frameMemory.Reserve(RuntimeConfig::GetInterpreterThreadFrameStackSize() * sizeof(InterpFrame)))
+			{
+				il2cpp::vm::Exception::RaiseOutOfMemoryException();
+			}
+			_frameBase = (InterpFrame*)_frameMemory.GetBase();
+			_frameCount = (int32_t)(_frameMemory.GetSize() / sizeof(InterpFrame));
+			_frameCommittedCount = 0;
 			_frameTopIdx = 0;
 		}
 
+		// slow path of PushFrame
+		void GrowFrames()
+		{
+			if (!_frameBase)
+			{
+				InitFrames();
+			}
+			if (_frameTopIdx >= _frameCount)
+			{
+				il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetStackOverflowException("AllocFrame"));
+			}
+			if (!_frameMemory.CommitBottom((size_t)(_frameTopIdx + 1) * sizeof(InterpFrame)))
+			{
+				il2cpp::vm::Exception::RaiseOutOfMemoryException();
+			}
+			_frameCommittedCount = std::min((int32_t)(_frameMemory.GetBottomCommittedSize() / sizeof(InterpFrame)), _frameCount);
+		}
+
 		void InitExceptionFlows()
 		{
 			_exceptionFlowBase = (ExceptionFlowInfo*)HYBRIDCLR_CALLOC(RuntimeConfig::GetInterpreterThreadExceptionFlowSize(), sizeof(ExceptionFlowInfo));
@@ -276,10 +324,20 @@ namespace interpreter
 		int32_t _stackSize;
 		int32_t _stackTopIdx;
 		int32_t _localPoolBottomIdx;
+		// slots [0, _stackCommittedTopIdx) and [_localPoolCommittedBottomIdx, _stackSize) are committed
+		int32_t _stackCommittedTopIdx;
+		int32_t _localPoolCommittedBottomIdx;
+		// not above _stackCommittedTopIdx and _localPoolBottomIdx, the only bound checked by the fast path of AllocStackSlot
+		int32_t _stackLimitIdx;
+		ReservedMemory _stackMemory;
+		// slots reported to the gc by the last GetGCRootData
+		ReservedMemory _gcRootMemory;
 
 		InterpFrame* _frameBase;
 		int32_t _frameTopIdx;
 		int32_t _frameCount;
+		int32_t _frameCommittedCount;
+		ReservedMemory _frameMemory;
 
 		ExceptionFlowInfo* _exceptionFlowBase;
 		int32_t _exceptionFlowTopIdx;
@@ -327,12 +385,15 @@ namespace interpreter
 			}
 		}
 
-		InterpFrame* EnterFrameFromInterpreter(const MethodInfo* method, StackObject* argBase);
+		InterpFrame* EnterFrameFromInterpreter(const MethodInfo* method, const InterpMethodInfo* imi, StackObject* argBase);
 
-		InterpFrame* EnterFrameFromNative(const MethodInfo* method, StackObject* argBase);
+		InterpFrame* EnterFrameFromNative(const MethodInfo* method, const InterpMethodInfo* imi, StackObject* argBase);
 
 		InterpFrame* LeaveFrame();
 
+		// on stack replacement. the top frame continues with other code of its method, see OsrEntry.
+		void ReplaceFrameCode(InterpFrame* frame, const InterpMethodInfo* imi);
+
 		void* AllocLoc(size_t originSize, bool fillZero)
 		{
 			if (originSize == 0)
@@ -193,6 +193,24 @@ namespace interpreter
 		8,
 		8,
 		8,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
 		8,
 		8,
 		8,
@@ -245,6 +263,26 @@ namespace interpreter
 		8,
 		8,
 		8,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
 		8,
 		8,
 		8,
@@ -290,9 +328,52 @@ namespace interpreter
 		16,
 		16,
 		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
 		8,
 		16,
 		16,
+		16,
+		8,
+		16,
 		8,
 		8,
 		16,
@@ -632,6 +713,14 @@ namespace interpreter
 		8,
 		8,
 		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
 		16,
 		16,
 		8,
@@ -668,6 +757,53 @@ namespace interpreter
 		8,
 		8,
 		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
+		16,
 		16,
 		16,
 		16,
@@ -752,6 +888,7 @@ namespace interpreter
 		8,
 		16,
 		16,
+		16,
 		8,
 		8,
 		16,
@@ -787,6 +924,23 @@ namespace interpreter
 		8,
 		8,
 		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		16,
+		8,
+		8,
+		8,
+		8,
+		8,
 		16,
 		16,
 		8,
@@ -852,6 +1006,30 @@ namespace interpreter
 		8,
 
         //!!!}}INST_SIZE
+
+        //!!!{{SUPERINSTRUCTION_INST_SIZE
+		8,
+		8,
+		8,
+		8,
+		8,
+		16,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+		8,
+        //!!!}}SUPERINSTRUCTION_INST_SIZE
     };
+
+    const uint32_t g_instructionCount = (uint32_t)(sizeof(g_instructionSizes) / sizeof(g_instructionSizes[0]));
+    static_assert(sizeof(g_instructionSizes) / sizeof(g_instructionSizes[0]) == (size_t)HiOpcodeEnum::__HiInstructionCount, "instruction size table doesn't match HiOpcodeEnum");
 }
 }
\ No newline at end of file
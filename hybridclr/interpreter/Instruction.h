@@ -19,6 +19,7 @@ namespace interpreter
 	};
 
 	extern uint16_t g_instructionSizes[];
+	extern const uint32_t g_instructionCount;
 
 	enum class HiOpcodeEnum : uint16_t
 	{
@@ -209,6 +210,24 @@ namespace interpreter
 		BinOpVarVarVar_Mul_f8,
 		BinOpVarVarVar_Div_f8,
 		BinOpVarVarVar_Rem_f8,
+		BinOpVarVarConst_Add_i4,
+		BinOpVarVarConst_Sub_i4,
+		BinOpVarVarConst_Mul_i4,
+		BinOpVarVarConst_And_i4,
+		BinOpVarVarConst_Or_i4,
+		BinOpVarVarConst_Xor_i4,
+		BinOpVarVarConst_Add_i8,
+		BinOpVarVarConst_Sub_i8,
+		BinOpVarVarConst_Mul_i8,
+		BinOpVarVarConst_And_i8,
+		BinOpVarVarConst_Or_i8,
+		BinOpVarVarConst_Xor_i8,
+		BinOpVarVarConst_Add_f4,
+		BinOpVarVarConst_Sub_f4,
+		BinOpVarVarConst_Mul_f4,
+		BinOpVarVarConst_Add_f8,
+		BinOpVarVarConst_Sub_f8,
+		BinOpVarVarConst_Mul_f8,
 		BinOpOverflowVarVarVar_Add_i4,
 		BinOpOverflowVarVarVar_Sub_i4,
 		BinOpOverflowVarVarVar_Mul_i4,
@@ -261,6 +280,26 @@ namespace interpreter
 		CompOpVarVarVar_CltUn_i8,
 		CompOpVarVarVar_CltUn_f4,
 		CompOpVarVarVar_CltUn_f8,
+		CompOpVarVarConst_Ceq_i4,
+		CompOpVarVarConst_Ceq_i8,
+		CompOpVarVarConst_Ceq_f4,
+		CompOpVarVarConst_Ceq_f8,
+		CompOpVarVarConst_Cgt_i4,
+		CompOpVarVarConst_Cgt_i8,
+		CompOpVarVarConst_Cgt_f4,
+		CompOpVarVarConst_Cgt_f8,
+		CompOpVarVarConst_CgtUn_i4,
+		CompOpVarVarConst_CgtUn_i8,
+		CompOpVarVarConst_CgtUn_f4,
+		CompOpVarVarConst_CgtUn_f8,
+		CompOpVarVarConst_Clt_i4,
+		CompOpVarVarConst_Clt_i8,
+		CompOpVarVarConst_Clt_f4,
+		CompOpVarVarConst_Clt_f8,
+		CompOpVarVarConst_CltUn_i4,
+		CompOpVarVarConst_CltUn_i8,
+		CompOpVarVarConst_CltUn_f4,
+		CompOpVarVarConst_CltUn_f8,
 		BranchUncondition_4,
 		BranchTrueVar_i4,
 		BranchTrueVar_i8,
@@ -306,8 +345,51 @@ namespace interpreter
 		BranchVarVar_CleUn_i8,
 		BranchVarVar_CleUn_f4,
 		BranchVarVar_CleUn_f8,
+		BranchVarConst_Ceq_i4,
+		BranchVarConst_Ceq_i8,
+		BranchVarConst_Ceq_f4,
+		BranchVarConst_Ceq_f8,
+		BranchVarConst_CneUn_i4,
+		BranchVarConst_CneUn_i8,
+		BranchVarConst_CneUn_f4,
+		BranchVarConst_CneUn_f8,
+		BranchVarConst_Cgt_i4,
+		BranchVarConst_Cgt_i8,
+		BranchVarConst_Cgt_f4,
+		BranchVarConst_Cgt_f8,
+		BranchVarConst_CgtUn_i4,
+		BranchVarConst_CgtUn_i8,
+		BranchVarConst_CgtUn_f4,
+		BranchVarConst_CgtUn_f8,
+		BranchVarConst_Cge_i4,
+		BranchVarConst_Cge_i8,
+		BranchVarConst_Cge_f4,
+		BranchVarConst_Cge_f8,
+		BranchVarConst_CgeUn_i4,
+		BranchVarConst_CgeUn_i8,
+		BranchVarConst_CgeUn_f4,
+		BranchVarConst_CgeUn_f8,
+		BranchVarConst_Clt_i4,
+		BranchVarConst_Clt_i8,
+		BranchVarConst_Clt_f4,
+		BranchVarConst_Clt_f8,
+		BranchVarConst_CltUn_i4,
+		BranchVarConst_CltUn_i8,
+		BranchVarConst_CltUn_f4,
+		BranchVarConst_CltUn_f8,
+		BranchVarConst_Cle_i4,
+		BranchVarConst_Cle_i8,
+		BranchVarConst_Cle_f4,
+		BranchVarConst_Cle_f8,
+		BranchVarConst_CleUn_i4,
+		BranchVarConst_CleUn_i8,
+		BranchVarConst_CleUn_f4,
+		BranchVarConst_CleUn_f8,
 		BranchJump,
 		BranchSwitch,
+		BranchSwitchBinarySearch,
+		BranchClassNotEqualVar,
+		LoopHeader,
 		NewClassVar,
 		NewClassVar_Ctor_0,
 		NewClassVar_NotCtor,
@@ -641,6 +723,14 @@ namespace interpreter
 		LdfldVarVar_u4,
 		LdfldVarVar_i8,
 		LdfldVarVar_u8,
+		LdfldVarVar_i1_NoCheck,
+		LdfldVarVar_u1_NoCheck,
+		LdfldVarVar_i2_NoCheck,
+		LdfldVarVar_u2_NoCheck,
+		LdfldVarVar_i4_NoCheck,
+		LdfldVarVar_u4_NoCheck,
+		LdfldVarVar_i8_NoCheck,
+		LdfldVarVar_u8_NoCheck,
 		LdfldVarVar_size_8,
 		LdfldVarVar_size_12,
 		LdfldVarVar_size_16,
@@ -677,6 +767,15 @@ namespace interpreter
 		StfldVarVar_i8,
 		StfldVarVar_u8,
 		StfldVarVar_ref,
+		StfldVarVar_i1_NoCheck,
+		StfldVarVar_u1_NoCheck,
+		StfldVarVar_i2_NoCheck,
+		StfldVarVar_u2_NoCheck,
+		StfldVarVar_i4_NoCheck,
+		StfldVarVar_u4_NoCheck,
+		StfldVarVar_i8_NoCheck,
+		StfldVarVar_u8_NoCheck,
+		StfldVarVar_ref_NoCheck,
 		StfldVarVar_size_8,
 		StfldVarVar_size_12,
 		StfldVarVar_size_16,
@@ -705,6 +804,23 @@ namespace interpreter
 		LdsfldVarVar_size_32,
 		LdsfldVarVar_n_2,
 		LdsfldVarVar_n_4,
+		LdsfldInitedVarVar_i1,
+		LdsfldInitedVarVar_u1,
+		LdsfldInitedVarVar_i2,
+		LdsfldInitedVarVar_u2,
+		LdsfldInitedVarVar_i4,
+		LdsfldInitedVarVar_u4,
+		LdsfldInitedVarVar_i8,
+		LdsfldInitedVarVar_u8,
+		LdsfldInitedVarVar_size_8,
+		LdsfldInitedVarVar_size_12,
+		LdsfldInitedVarVar_size_16,
+		LdsfldInitedVarVar_size_20,
+		LdsfldInitedVarVar_size_24,
+		LdsfldInitedVarVar_size_28,
+		LdsfldInitedVarVar_size_32,
+		LdsfldInitedVarVar_n_2,
+		LdsfldInitedVarVar_n_4,
 		StsfldVarVar_i1,
 		StsfldVarVar_u1,
 		StsfldVarVar_i2,
@@ -725,7 +841,28 @@ namespace interpreter
 		StsfldVarVar_n_4,
 		StsfldVarVar_WriteBarrier_n_2,
 		StsfldVarVar_WriteBarrier_n_4,
+		StsfldInitedVarVar_i1,
+		StsfldInitedVarVar_u1,
+		StsfldInitedVarVar_i2,
+		StsfldInitedVarVar_u2,
+		StsfldInitedVarVar_i4,
+		StsfldInitedVarVar_u4,
+		StsfldInitedVarVar_i8,
+		StsfldInitedVarVar_u8,
+		StsfldInitedVarVar_ref,
+		StsfldInitedVarVar_size_8,
+		StsfldInitedVarVar_size_12,
+		StsfldInitedVarVar_size_16,
+		StsfldInitedVarVar_size_20,
+		StsfldInitedVarVar_size_24,
+		StsfldInitedVarVar_size_28,
+		StsfldInitedVarVar_size_32,
+		StsfldInitedVarVar_n_2,
+		StsfldInitedVarVar_n_4,
+		StsfldInitedVarVar_WriteBarrier_n_2,
+		StsfldInitedVarVar_WriteBarrier_n_4,
 		LdsfldaVarVar,
+		LdsfldaInitedVarVar,
 		LdsfldaFromFieldDataVarVar,
 		LdthreadlocalaVarVar,
 		LdthreadlocalVarVar_i1,
@@ -767,6 +904,7 @@ namespace interpreter
 		StthreadlocalVarVar_WriteBarrier_n_4,
 		CheckThrowIfNullVar,
 		InitClassStaticCtor,
+		InitClassStaticCtorInited,
 		NewArrVarVar,
 		GetArrayLengthVarVar,
 		GetArrayElementAddressAddrVarVar,
@@ -779,6 +917,14 @@ namespace interpreter
 		GetArrayElementVarVar_u4,
 		GetArrayElementVarVar_i8,
 		GetArrayElementVarVar_u8,
+		GetArrayElementVarVar_i1_NoCheck,
+		GetArrayElementVarVar_u1_NoCheck,
+		GetArrayElementVarVar_i2_NoCheck,
+		GetArrayElementVarVar_u2_NoCheck,
+		GetArrayElementVarVar_i4_NoCheck,
+		GetArrayElementVarVar_u4_NoCheck,
+		GetArrayElementVarVar_i8_NoCheck,
+		GetArrayElementVarVar_u8_NoCheck,
 		GetArrayElementVarVar_size_1,
 		GetArrayElementVarVar_size_2,
 		GetArrayElementVarVar_size_4,
@@ -798,7 +944,16 @@ namespace interpreter
 		SetArrayElementVarVar_u4,
 		SetArrayElementVarVar_i8,
 		SetArrayElementVarVar_u8,
+		SetArrayElementVarVar_i1_NoCheck,
+		SetArrayElementVarVar_u1_NoCheck,
+		SetArrayElementVarVar_i2_NoCheck,
+		SetArrayElementVarVar_u2_NoCheck,
+		SetArrayElementVarVar_i4_NoCheck,
+		SetArrayElementVarVar_u4_NoCheck,
+		SetArrayElementVarVar_i8_NoCheck,
+		SetArrayElementVarVar_u8_NoCheck,
 		SetArrayElementVarVar_ref,
+		SetArrayElementVarVar_ref_NoTypeCheck,
 		SetArrayElementVarVar_size_12,
 		SetArrayElementVarVar_size_16,
 		SetArrayElementVarVar_n,
@@ -868,6 +1023,31 @@ namespace interpreter
 		MethodBaseGetCurrentMethod,
 
 		//!!!}}OPCODE
+
+		// fused instructions generated by tools/superinstruction/gen_superinstructions.py
+		//!!!{{SUPERINSTRUCTION_OPCODE
+		SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4__LdlocVarVar,
+		SuperInst_LdlocVarVar__LdlocVarVar__BranchVarVar_Clt_i4,
+		SuperInst_LdlocVarVar__LdlocVarVar,
+		SuperInst_BinOpVarVarVar_Add_i4__LdlocVarVar,
+		SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4,
+		SuperInst_BinOpVarVarConst_Add_i4__LdlocVarVar,
+		SuperInst_LdlocVarVar__BranchVarVar_Clt_i4,
+		SuperInst_LdlocVarVar__GetArrayElementVarVar_i4,
+		SuperInst_GetArrayElementVarVar_i4__BinOpVarVarVar_Add_i4,
+		SuperInst_GetArrayElementVarVar_i4_NoCheck__BinOpVarVarVar_Add_i4,
+		SuperInst_LdlocVarVar__BranchVarConst_Clt_i4,
+		SuperInst_LdlocVarVar__LdfldVarVar_i4,
+		SuperInst_LdlocVarVar__BranchTrueVar_i4,
+		SuperInst_LdlocVarVar__BranchFalseVar_i4,
+		SuperInst_CompOpVarVarVar_Clt_i4__LdlocVarVar,
+		SuperInst_LdlocVarVar__BinOpVarVarVar_Add_i4,
+		SuperInst_BinOpVarVarVar_Add_f4__LdlocVarVar,
+		SuperInst_BinOpVarVarVar_Mul_f4__LdlocVarVar,
+		//!!!}}SUPERINSTRUCTION_OPCODE
+
+		// number of opcodes, not an instruction. tables indexed by opcode are checked against it.
+		__HiInstructionCount,
 	};
 
 	struct IRCommon
@@ -2519,6 +2699,222 @@ namespace interpreter
 	};
 
 
+	struct IRBinOpVarVarConst_Add_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Sub_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Mul_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_And_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Or_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Xor_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Add_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t op2;
+	};
+
+
+	struct IRBinOpVarVarConst_Sub_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t op2;
+	};
+
+
+	struct IRBinOpVarVarConst_Mul_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t op2;
+	};
+
+
+	struct IRBinOpVarVarConst_And_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t op2;
+	};
+
+
+	struct IRBinOpVarVarConst_Or_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t op2;
+	};
+
+
+	struct IRBinOpVarVarConst_Xor_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t op2;
+	};
+
+
+	struct IRBinOpVarVarConst_Add_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Sub_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Mul_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBinOpVarVarConst_Add_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		double op2;
+	};
+
+
+	struct IRBinOpVarVarConst_Sub_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		double op2;
+	};
+
+
+	struct IRBinOpVarVarConst_Mul_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t op1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		double op2;
+	};
+
+
 	struct IRBinOpOverflowVarVarVar_Add_i4 : IRCommon
 	{
 		uint16_t ret;
@@ -2945,49 +3341,61 @@ namespace interpreter
 	};
 
 
-	struct IRBranchUncondition_4 : IRCommon
-	{
-		uint8_t __pad2;
-		uint8_t __pad3;
-		int32_t offset;
-	};
-
-
-	struct IRBranchTrueVar_i4 : IRCommon
+	struct IRCompOpVarVarConst_Ceq_i4 : IRCommon
 	{
-		uint16_t op;
-		int32_t offset;
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRBranchTrueVar_i8 : IRCommon
+	struct IRCompOpVarVarConst_Ceq_i8 : IRCommon
 	{
-		uint16_t op;
-		int32_t offset;
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t c2;
 	};
 
 
-	struct IRBranchFalseVar_i4 : IRCommon
+	struct IRCompOpVarVarConst_Ceq_f4 : IRCommon
 	{
-		uint16_t op;
-		int32_t offset;
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		float c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRBranchFalseVar_i8 : IRCommon
+	struct IRCompOpVarVarConst_Ceq_f8 : IRCommon
 	{
-		uint16_t op;
-		int32_t offset;
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		double c2;
 	};
 
 
-	struct IRBranchVarVar_Ceq_i4 : IRCommon
+	struct IRCompOpVarVarConst_Cgt_i4 : IRCommon
 	{
-		uint16_t op1;
-		uint16_t op2;
+		uint16_t ret;
+		uint16_t c1;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		int32_t offset;
+		int32_t c2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -2995,27 +3403,23 @@ namespace interpreter
 	};
 
 
-	struct IRBranchVarVar_Ceq_i8 : IRCommon
+	struct IRCompOpVarVarConst_Cgt_i8 : IRCommon
 	{
-		uint16_t op1;
-		uint16_t op2;
+		uint16_t ret;
+		uint16_t c1;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		int32_t offset;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		int64_t c2;
 	};
 
 
-	struct IRBranchVarVar_Ceq_f4 : IRCommon
+	struct IRCompOpVarVarConst_Cgt_f4 : IRCommon
 	{
-		uint16_t op1;
-		uint16_t op2;
+		uint16_t ret;
+		uint16_t c1;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		int32_t offset;
+		float c2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -3023,16 +3427,248 @@ namespace interpreter
 	};
 
 
-	struct IRBranchVarVar_Ceq_f8 : IRCommon
+	struct IRCompOpVarVarConst_Cgt_f8 : IRCommon
 	{
-		uint16_t op1;
-		uint16_t op2;
+		uint16_t ret;
+		uint16_t c1;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		int32_t offset;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
+		double c2;
+	};
+
+
+	struct IRCompOpVarVarConst_CgtUn_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCompOpVarVarConst_CgtUn_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t c2;
+	};
+
+
+	struct IRCompOpVarVarConst_CgtUn_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		float c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCompOpVarVarConst_CgtUn_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		double c2;
+	};
+
+
+	struct IRCompOpVarVarConst_Clt_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCompOpVarVarConst_Clt_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t c2;
+	};
+
+
+	struct IRCompOpVarVarConst_Clt_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		float c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCompOpVarVarConst_Clt_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		double c2;
+	};
+
+
+	struct IRCompOpVarVarConst_CltUn_i4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCompOpVarVarConst_CltUn_i8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int64_t c2;
+	};
+
+
+	struct IRCompOpVarVarConst_CltUn_f4 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		float c2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCompOpVarVarConst_CltUn_f8 : IRCommon
+	{
+		uint16_t ret;
+		uint16_t c1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		double c2;
+	};
+
+
+	struct IRBranchUncondition_4 : IRCommon
+	{
+		uint8_t __pad2;
+		uint8_t __pad3;
+		int32_t offset;
+	};
+
+
+	struct IRBranchTrueVar_i4 : IRCommon
+	{
+		uint16_t op;
+		int32_t offset;
+	};
+
+
+	struct IRBranchTrueVar_i8 : IRCommon
+	{
+		uint16_t op;
+		int32_t offset;
+	};
+
+
+	struct IRBranchFalseVar_i4 : IRCommon
+	{
+		uint16_t op;
+		int32_t offset;
+	};
+
+
+	struct IRBranchFalseVar_i8 : IRCommon
+	{
+		uint16_t op;
+		int32_t offset;
+	};
+
+
+	struct IRBranchVarVar_Ceq_i4 : IRCommon
+	{
+		uint16_t op1;
+		uint16_t op2;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBranchVarVar_Ceq_i8 : IRCommon
+	{
+		uint16_t op1;
+		uint16_t op2;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBranchVarVar_Ceq_f4 : IRCommon
+	{
+		uint16_t op1;
+		uint16_t op2;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRBranchVarVar_Ceq_f8 : IRCommon
+	{
+		uint16_t op1;
+		uint16_t op2;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		int32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
 		uint8_t __pad15;
 	};
 
@@ -3541,19 +4177,31 @@ namespace interpreter
 	};
 
 
-	struct IRBranchJump : IRCommon
+	struct IRBranchVarConst_Ceq_i4 : IRCommon
 	{
-		uint8_t __pad2;
-		uint8_t __pad3;
-		uint32_t token;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRBranchSwitch : IRCommon
+	struct IRBranchVarConst_Ceq_i8 : IRCommon
 	{
-		uint16_t value;
-		uint32_t caseNum;
-		uint32_t caseOffsets;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
+	};
+
+
+	struct IRBranchVarConst_Ceq_f4 : IRCommon
+	{
+		uint16_t op1;
+		int32_t offset;
+		float op2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -3561,66 +4209,59 @@ namespace interpreter
 	};
 
 
-	struct IRNewClassVar : IRCommon
+	struct IRBranchVarConst_Ceq_f8 : IRCommon
 	{
-		uint16_t obj;
-		uint32_t managed2NativeMethod;
-		uint32_t method;
-		uint32_t argIdxs;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRNewClassVar_Ctor_0 : IRCommon
+	struct IRBranchVarConst_CneUn_i4 : IRCommon
 	{
-		uint16_t obj;
-		uint32_t method;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRNewClassVar_NotCtor : IRCommon
+	struct IRBranchVarConst_CneUn_i8 : IRCommon
 	{
-		uint16_t obj;
-		uint32_t klass;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRNewValueTypeVar : IRCommon
+	struct IRBranchVarConst_CneUn_f4 : IRCommon
 	{
-		uint16_t obj;
-		uint32_t managed2NativeMethod;
-		uint32_t method;
-		uint32_t argIdxs;
-	};
-
-
-	struct IRNewValueTypeVar_Ctor_0 : IRCommon
-	{
-		uint16_t obj;
-		uint16_t size;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRNewClassInterpVar : IRCommon
+	struct IRBranchVarConst_CneUn_f8 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t argBase;
-		uint16_t argStackObjectNum;
-		uint16_t ctorFrameBase;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRNewClassInterpVar_Ctor_0 : IRCommon
+	struct IRBranchVarConst_Cgt_i4 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t ctorFrameBase;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t method;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -3628,35 +4269,19 @@ namespace interpreter
 	};
 
 
-	struct IRNewValueTypeInterpVar : IRCommon
-	{
-		uint16_t obj;
-		uint16_t argBase;
-		uint16_t argStackObjectNum;
-		uint16_t ctorFrameBase;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
-	};
-
-
-	struct IRAdjustValueTypeRefVar : IRCommon
+	struct IRBranchVarConst_Cgt_i8 : IRCommon
 	{
-		uint16_t data;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRBoxRefVarVar : IRCommon
+	struct IRBranchVarConst_Cgt_f4 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t klass;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -3664,13 +4289,19 @@ namespace interpreter
 	};
 
 
-	struct IRLdvirftnVarVar : IRCommon
+	struct IRBranchVarConst_Cgt_f8 : IRCommon
 	{
-		uint16_t resultMethod;
-		uint16_t obj;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t virtualMethod;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
+	};
+
+
+	struct IRBranchVarConst_CgtUn_i4 : IRCommon
+	{
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -3678,210 +4309,199 @@ namespace interpreter
 	};
 
 
-	struct IRRetVar_ret_1 : IRCommon
+	struct IRBranchVarConst_CgtUn_i8 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRRetVar_ret_2 : IRCommon
+	struct IRBranchVarConst_CgtUn_f4 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRRetVar_ret_4 : IRCommon
+	struct IRBranchVarConst_CgtUn_f8 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRRetVar_ret_8 : IRCommon
+	struct IRBranchVarConst_Cge_i4 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRRetVar_ret_12 : IRCommon
+	struct IRBranchVarConst_Cge_i8 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRRetVar_ret_16 : IRCommon
+	struct IRBranchVarConst_Cge_f4 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRRetVar_ret_20 : IRCommon
+	struct IRBranchVarConst_Cge_f8 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRRetVar_ret_24 : IRCommon
+	struct IRBranchVarConst_CgeUn_i4 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRRetVar_ret_28 : IRCommon
+	struct IRBranchVarConst_CgeUn_i8 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRRetVar_ret_32 : IRCommon
+	struct IRBranchVarConst_CgeUn_f4 : IRCommon
 	{
-		uint16_t ret;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRRetVar_ret_n : IRCommon
+	struct IRBranchVarConst_CgeUn_f8 : IRCommon
 	{
-		uint16_t ret;
-		uint32_t size;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRRetVar_void : IRCommon
+	struct IRBranchVarConst_Clt_i4 : IRCommon
 	{
-		uint8_t __pad2;
-		uint8_t __pad3;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallNativeInstance_void : IRCommon
+	struct IRBranchVarConst_Clt_i8 : IRCommon
 	{
-		uint8_t __pad2;
-		uint8_t __pad3;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRCallNativeInstance_ret : IRCommon
+	struct IRBranchVarConst_Clt_f4 : IRCommon
 	{
-		uint16_t ret;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallNativeInstance_ret_expand : IRCommon
+	struct IRBranchVarConst_Clt_f8 : IRCommon
 	{
-		uint8_t retLocationType;
-		uint8_t __pad3;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRCallNativeStatic_void : IRCommon
+	struct IRBranchVarConst_CltUn_i4 : IRCommon
 	{
-		uint8_t __pad2;
-		uint8_t __pad3;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallNativeStatic_ret : IRCommon
+	struct IRBranchVarConst_CltUn_i8 : IRCommon
 	{
-		uint16_t ret;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRCallNativeStatic_ret_expand : IRCommon
+	struct IRBranchVarConst_CltUn_f4 : IRCommon
 	{
-		uint8_t retLocationType;
-		uint8_t __pad3;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallInterp_void : IRCommon
+	struct IRBranchVarConst_CltUn_f8 : IRCommon
 	{
-		uint16_t argBase;
-		uint32_t methodInfo;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRCallInterp_ret : IRCommon
+	struct IRBranchVarConst_Cle_i4 : IRCommon
 	{
-		uint16_t argBase;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t methodInfo;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -3889,56 +4509,59 @@ namespace interpreter
 	};
 
 
-	struct IRCallVirtual_void : IRCommon
+	struct IRBranchVarConst_Cle_i8 : IRCommon
 	{
-		uint8_t __pad2;
-		uint8_t __pad3;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
 	};
 
 
-	struct IRCallVirtual_ret : IRCommon
+	struct IRBranchVarConst_Cle_f4 : IRCommon
 	{
-		uint16_t ret;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint16_t op1;
+		int32_t offset;
+		float op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallVirtual_ret_expand : IRCommon
+	struct IRBranchVarConst_Cle_f8 : IRCommon
 	{
-		uint8_t retLocationType;
-		uint8_t __pad3;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t managed2NativeMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRCallInterpVirtual_void : IRCommon
+	struct IRBranchVarConst_CleUn_i4 : IRCommon
 	{
-		uint16_t argBase;
-		uint32_t method;
+		uint16_t op1;
+		int32_t offset;
+		int32_t op2;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallInterpVirtual_ret : IRCommon
+	struct IRBranchVarConst_CleUn_i8 : IRCommon
 	{
-		uint16_t argBase;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t method;
+		uint16_t op1;
+		int32_t offset;
+		int64_t op2;
+	};
+
+
+	struct IRBranchVarConst_CleUn_f4 : IRCommon
+	{
+		uint16_t op1;
+		int32_t offset;
+		float op2;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -3946,177 +4569,123 @@ namespace interpreter
 	};
 
 
-	struct IRCallInd_void : IRCommon
+	struct IRBranchVarConst_CleUn_f8 : IRCommon
 	{
-		uint8_t isMethodInfoPointer;
-		uint8_t __pad3;
-		uint32_t managed2NativeMethod;
-		uint32_t managed2NativeFunctionPointerMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint16_t op1;
+		int32_t offset;
+		double op2;
 	};
 
 
-	struct IRCallInd_ret : IRCommon
+	struct IRBranchJump : IRCommon
 	{
-		uint8_t isMethodInfoPointer;
+		uint8_t __pad2;
 		uint8_t __pad3;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t managed2NativeMethod;
-		uint32_t managed2NativeFunctionPointerMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint32_t token;
 	};
 
 
-	struct IRCallInd_ret_expand : IRCommon
+	struct IRBranchSwitch : IRCommon
 	{
-		uint8_t isMethodInfoPointer;
-		uint8_t retLocationType;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t managed2NativeMethod;
-		uint32_t managed2NativeFunctionPointerMethod;
-		uint32_t methodInfo;
-		uint32_t argIdxs;
+		uint16_t value;
+		uint32_t caseNum;
+		uint32_t caseOffsets;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallPInvoke_void : IRCommon
+	struct IRBranchSwitchBinarySearch : IRCommon
 	{
-		uint8_t __pad2;
-		uint8_t __pad3;
-		uint32_t managed2NativeFunctionPointerMethod;
-		uint32_t pinvokeMethodPointer;
-		uint32_t argIdxs;
+		uint16_t value;
+		uint32_t caseNum;
+		uint32_t caseRanges;
+		uint32_t caseOffsets;
 	};
 
 
-	struct IRCallPInvoke_ret : IRCommon
+	struct IRBranchClassNotEqualVar : IRCommon
 	{
-		uint16_t ret;
-		uint32_t managed2NativeFunctionPointerMethod;
-		uint32_t pinvokeMethodPointer;
-		uint32_t argIdxs;
+		uint16_t obj;
+		int32_t offset;
+		uint32_t klass;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallPInvoke_ret_expand : IRCommon
+	struct IRLoopHeader : IRCommon
 	{
-		uint8_t retLocationType;
+		uint8_t __pad2;
 		uint8_t __pad3;
-		uint16_t ret;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t managed2NativeFunctionPointerMethod;
-		uint32_t pinvokeMethodPointer;
-		uint32_t argIdxs;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint32_t ilOffset;
 	};
 
 
-	struct IRCallDelegateInvoke_void : IRCommon
+	struct IRNewClassVar : IRCommon
 	{
-		uint16_t invokeParamCount;
-		uint32_t managed2NativeStaticMethod;
-		uint32_t managed2NativeInstanceMethod;
+		uint16_t obj;
+		uint32_t managed2NativeMethod;
+		uint32_t method;
 		uint32_t argIdxs;
 	};
 
 
-	struct IRCallDelegateInvoke_ret : IRCommon
+	struct IRNewClassVar_Ctor_0 : IRCommon
 	{
-		uint16_t ret;
-		uint16_t invokeParamCount;
-		uint16_t retTypeStackObjectSize;
-		uint32_t managed2NativeStaticMethod;
-		uint32_t managed2NativeInstanceMethod;
-		uint32_t argIdxs;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint16_t obj;
+		uint32_t method;
 	};
 
 
-	struct IRCallDelegateInvoke_ret_expand : IRCommon
+	struct IRNewClassVar_NotCtor : IRCommon
 	{
-		uint8_t retLocationType;
-		uint8_t __pad3;
-		uint16_t ret;
-		uint16_t invokeParamCount;
-		uint32_t managed2NativeStaticMethod;
-		uint32_t managed2NativeInstanceMethod;
-		uint32_t argIdxs;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint16_t obj;
+		uint32_t klass;
 	};
 
 
-	struct IRCallDelegateBeginInvoke : IRCommon
+	struct IRNewValueTypeVar : IRCommon
 	{
-		uint16_t result;
-		uint32_t methodInfo;
+		uint16_t obj;
+		uint32_t managed2NativeMethod;
+		uint32_t method;
 		uint32_t argIdxs;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
-	};
-
-
-	struct IRCallDelegateEndInvoke_void : IRCommon
-	{
-		uint16_t asyncResult;
-		uint32_t methodInfo;
 	};
 
 
-	struct IRCallDelegateEndInvoke_ret : IRCommon
+	struct IRNewValueTypeVar_Ctor_0 : IRCommon
 	{
-		uint16_t asyncResult;
-		uint16_t ret;
+		uint16_t obj;
+		uint16_t size;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t methodInfo;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRNewDelegate : IRCommon
+	struct IRNewClassInterpVar : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
-		uint16_t method;
-		uint32_t klass;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t argBase;
+		uint16_t argStackObjectNum;
+		uint16_t ctorFrameBase;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
 	};
 
 
-	struct IRCtorDelegate : IRCommon
+	struct IRNewClassInterpVar_Ctor_0 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
-		uint16_t method;
-		uint32_t ctor;
+		uint16_t ctorFrameBase;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -4124,34 +4693,35 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_v_0 : IRCommon
+	struct IRNewValueTypeInterpVar : IRCommon
 	{
-		uint16_t self;
-		uint32_t method;
-	};
-
-
-	struct IRCallCommonNativeInstance_i1_0 : IRCommon
+		uint16_t obj;
+		uint16_t argBase;
+		uint16_t argStackObjectNum;
+		uint16_t ctorFrameBase;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRAdjustValueTypeRefVar : IRCommon
 	{
-		uint16_t self;
-		uint16_t ret;
+		uint16_t data;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_0 : IRCommon
+	struct IRBoxRefVarVar : IRCommon
 	{
-		uint16_t self;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -4159,13 +4729,13 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i2_0 : IRCommon
+	struct IRLdvirftnVarVar : IRCommon
 	{
-		uint16_t self;
-		uint16_t ret;
+		uint16_t resultMethod;
+		uint16_t obj;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
+		uint32_t virtualMethod;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -4173,245 +4743,1100 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u2_0 : IRCommon
+	struct IRRetVar_ret_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_0 : IRCommon
+	struct IRRetVar_ret_2 : IRCommon
 	{
-		uint16_t self;
 		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_0 : IRCommon
+	struct IRRetVar_ret_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_0 : IRCommon
+	struct IRRetVar_ret_8 : IRCommon
 	{
-		uint16_t self;
 		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_0 : IRCommon
+	struct IRRetVar_ret_12 : IRCommon
 	{
-		uint16_t self;
 		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i4_1 : IRCommon
+	struct IRRetVar_ret_16 : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
+		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i4_2 : IRCommon
+	struct IRRetVar_ret_20 : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i4_3 : IRCommon
+	struct IRRetVar_ret_24 : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i4_4 : IRCommon
+	struct IRRetVar_ret_28 : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint32_t method;
+		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i8_1 : IRCommon
+	struct IRRetVar_ret_32 : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
+		uint16_t ret;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i8_2 : IRCommon
+	struct IRRetVar_ret_n : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t ret;
+		uint32_t size;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i8_3 : IRCommon
+	struct IRRetVar_void : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint8_t __pad2;
+		uint8_t __pad3;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_i8_4 : IRCommon
+	struct IRCallNativeInstance_void : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint32_t method;
+		uint8_t __pad2;
+		uint8_t __pad3;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f4_1 : IRCommon
+	struct IRCallNativeInstance_ret : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
+		uint16_t ret;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallNativeInstance_ret_expand : IRCommon
+	{
+		uint8_t retLocationType;
+		uint8_t __pad3;
+		uint16_t ret;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f4_2 : IRCommon
+	struct IRCallNativeStatic_void : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint8_t __pad2;
+		uint8_t __pad3;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f4_3 : IRCommon
+	struct IRCallNativeStatic_ret : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t ret;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f4_4 : IRCommon
+	struct IRCallNativeStatic_ret_expand : IRCommon
 	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
+		uint8_t retLocationType;
+		uint8_t __pad3;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallInterp_void : IRCommon
+	{
+		uint16_t argBase;
+		uint32_t methodInfo;
+	};
+
+
+	struct IRCallInterp_ret : IRCommon
+	{
+		uint16_t argBase;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t methodInfo;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallVirtual_void : IRCommon
+	{
+		uint8_t __pad2;
+		uint8_t __pad3;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallVirtual_ret : IRCommon
+	{
+		uint16_t ret;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallVirtual_ret_expand : IRCommon
+	{
+		uint8_t retLocationType;
+		uint8_t __pad3;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t managed2NativeMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallInterpVirtual_void : IRCommon
+	{
+		uint16_t argBase;
+		uint32_t method;
+	};
+
+
+	struct IRCallInterpVirtual_ret : IRCommon
+	{
+		uint16_t argBase;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallInd_void : IRCommon
+	{
+		uint8_t isMethodInfoPointer;
+		uint8_t __pad3;
+		uint32_t managed2NativeMethod;
+		uint32_t managed2NativeFunctionPointerMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallInd_ret : IRCommon
+	{
+		uint8_t isMethodInfoPointer;
+		uint8_t __pad3;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t managed2NativeMethod;
+		uint32_t managed2NativeFunctionPointerMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallInd_ret_expand : IRCommon
+	{
+		uint8_t isMethodInfoPointer;
+		uint8_t retLocationType;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t managed2NativeMethod;
+		uint32_t managed2NativeFunctionPointerMethod;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallPInvoke_void : IRCommon
+	{
+		uint8_t __pad2;
+		uint8_t __pad3;
+		uint32_t managed2NativeFunctionPointerMethod;
+		uint32_t pinvokeMethodPointer;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallPInvoke_ret : IRCommon
+	{
+		uint16_t ret;
+		uint32_t managed2NativeFunctionPointerMethod;
+		uint32_t pinvokeMethodPointer;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallPInvoke_ret_expand : IRCommon
+	{
+		uint8_t retLocationType;
+		uint8_t __pad3;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t managed2NativeFunctionPointerMethod;
+		uint32_t pinvokeMethodPointer;
+		uint32_t argIdxs;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallDelegateInvoke_void : IRCommon
+	{
+		uint16_t invokeParamCount;
+		uint32_t managed2NativeStaticMethod;
+		uint32_t managed2NativeInstanceMethod;
+		uint32_t argIdxs;
+	};
+
+
+	struct IRCallDelegateInvoke_ret : IRCommon
+	{
+		uint16_t ret;
+		uint16_t invokeParamCount;
+		uint16_t retTypeStackObjectSize;
+		uint32_t managed2NativeStaticMethod;
+		uint32_t managed2NativeInstanceMethod;
+		uint32_t argIdxs;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallDelegateInvoke_ret_expand : IRCommon
+	{
+		uint8_t retLocationType;
+		uint8_t __pad3;
+		uint16_t ret;
+		uint16_t invokeParamCount;
+		uint32_t managed2NativeStaticMethod;
+		uint32_t managed2NativeInstanceMethod;
+		uint32_t argIdxs;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallDelegateBeginInvoke : IRCommon
+	{
+		uint16_t result;
+		uint32_t methodInfo;
+		uint32_t argIdxs;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallDelegateEndInvoke_void : IRCommon
+	{
+		uint16_t asyncResult;
+		uint32_t methodInfo;
+	};
+
+
+	struct IRCallDelegateEndInvoke_ret : IRCommon
+	{
+		uint16_t asyncResult;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t methodInfo;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRNewDelegate : IRCommon
+	{
+		uint16_t dst;
+		uint16_t obj;
+		uint16_t method;
+		uint32_t klass;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCtorDelegate : IRCommon
+	{
+		uint16_t dst;
+		uint16_t obj;
+		uint16_t method;
+		uint32_t ctor;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_0 : IRCommon
+	{
+		uint16_t self;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_i1_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_i2_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_u2_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_i8_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_f4_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_f8_0 : IRCommon
+	{
+		uint16_t self;
+		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i4_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i4_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i4_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i4_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i8_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i8_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i8_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_i8_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f4_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f4_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f4_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f4_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f8_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f8_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f8_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_v_f8_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i4_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t ret;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i4_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i4_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i4_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
+		uint8_t __pad14;
+		uint8_t __pad15;
+		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i8_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t ret;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i8_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i8_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_i8_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
+		uint8_t __pad14;
+		uint8_t __pad15;
+		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f4_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t ret;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f4_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f4_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f4_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
+		uint8_t __pad14;
+		uint8_t __pad15;
+		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f8_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t ret;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f8_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f8_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_u1_f8_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
+		uint8_t __pad14;
+		uint8_t __pad15;
+		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_i4_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t ret;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_i4_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_i4_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_i4_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
 		uint16_t param3;
+		uint16_t ret;
+		uint8_t __pad14;
+		uint8_t __pad15;
+		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_i8_1 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t ret;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_i8_2 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f8_1 : IRCommon
+	struct IRCallCommonNativeInstance_i4_i8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
 		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_i8_4 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
 		uint8_t __pad14;
 		uint8_t __pad15;
+		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f8_2 : IRCommon
+	struct IRCallCommonNativeInstance_i4_f4_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
+		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -4420,30 +5845,48 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f8_3 : IRCommon
+	struct IRCallCommonNativeInstance_i4_f4_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
+		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_v_f8_4 : IRCommon
+	struct IRCallCommonNativeInstance_i4_f4_3 : IRCommon
+	{
+		uint16_t self;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeInstance_i4_f4_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
 		uint16_t param3;
+		uint16_t ret;
+		uint8_t __pad14;
+		uint8_t __pad15;
 		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i4_1 : IRCommon
+	struct IRCallCommonNativeInstance_i4_f8_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4456,7 +5899,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i4_2 : IRCommon
+	struct IRCallCommonNativeInstance_i4_f8_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4468,7 +5911,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i4_3 : IRCommon
+	struct IRCallCommonNativeInstance_i4_f8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4479,7 +5922,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i4_4 : IRCommon
+	struct IRCallCommonNativeInstance_i4_f8_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4497,7 +5940,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i8_1 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i4_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4510,7 +5953,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i8_2 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i4_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4522,7 +5965,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i8_3 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i4_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4533,7 +5976,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_i8_4 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i4_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4551,7 +5994,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f4_1 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i8_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4564,7 +6007,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f4_2 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i8_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4576,7 +6019,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f4_3 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4587,7 +6030,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f4_4 : IRCommon
+	struct IRCallCommonNativeInstance_i8_i8_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4605,7 +6048,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f8_1 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f4_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4618,7 +6061,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f8_2 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f4_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4630,7 +6073,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f8_3 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f4_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4641,7 +6084,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_u1_f8_4 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f4_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4659,7 +6102,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i4_1 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f8_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4672,7 +6115,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i4_2 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f8_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4684,7 +6127,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i4_3 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4695,7 +6138,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i4_4 : IRCommon
+	struct IRCallCommonNativeInstance_i8_f8_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4713,7 +6156,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i8_1 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i4_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4726,7 +6169,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i8_2 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i4_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4738,7 +6181,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i8_3 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i4_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4749,7 +6192,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_i8_4 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i4_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4767,7 +6210,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f4_1 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i8_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4780,7 +6223,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f4_2 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i8_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4792,7 +6235,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f4_3 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4803,7 +6246,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f4_4 : IRCommon
+	struct IRCallCommonNativeInstance_f4_i8_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4821,7 +6264,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f8_1 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f4_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4834,7 +6277,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f8_2 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f4_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4846,7 +6289,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f8_3 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f4_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4857,7 +6300,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i4_f8_4 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f4_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4875,7 +6318,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i4_1 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f8_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4888,7 +6331,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i4_2 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f8_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4900,7 +6343,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i4_3 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4911,7 +6354,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i4_4 : IRCommon
+	struct IRCallCommonNativeInstance_f4_f8_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4929,7 +6372,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i8_1 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i4_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4942,7 +6385,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i8_2 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i4_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4954,7 +6397,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i8_3 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i4_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4965,7 +6408,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_i8_4 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i4_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4983,7 +6426,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f4_1 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i8_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -4996,7 +6439,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f4_2 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i8_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5008,7 +6451,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f4_3 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5019,7 +6462,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f4_4 : IRCommon
+	struct IRCallCommonNativeInstance_f8_i8_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5037,7 +6480,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f8_1 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f4_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5050,7 +6493,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f8_2 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f4_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5062,7 +6505,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f8_3 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f4_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5073,7 +6516,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_i8_f8_4 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f4_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5091,7 +6534,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i4_1 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f8_1 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5104,7 +6547,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i4_2 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f8_2 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5116,7 +6559,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i4_3 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f8_3 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5127,7 +6570,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i4_4 : IRCommon
+	struct IRCallCommonNativeInstance_f8_f8_4 : IRCommon
 	{
 		uint16_t self;
 		uint16_t param0;
@@ -5137,19 +6580,104 @@ namespace interpreter
 		uint16_t ret;
 		uint8_t __pad14;
 		uint8_t __pad15;
-		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint32_t method;
+		uint8_t __pad20;
+		uint8_t __pad21;
+		uint8_t __pad22;
+		uint8_t __pad23;
+	};
+
+
+	struct IRCallCommonNativeStatic_v_0 : IRCommon
+	{
+		uint8_t __pad2;
+		uint8_t __pad3;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_i1_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_u1_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_i2_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_u2_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_i4_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_i8_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_f4_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_f8_0 : IRCommon
+	{
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_v_i4_1 : IRCommon
+	{
+		uint16_t param0;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_v_i4_2 : IRCommon
+	{
+		uint16_t param0;
+		uint16_t param1;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i8_1 : IRCommon
+	struct IRCallCommonNativeStatic_v_i4_3 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t ret;
+		uint16_t param1;
+		uint16_t param2;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5158,52 +6686,44 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i8_2 : IRCommon
+	struct IRCallCommonNativeStatic_v_i4_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t ret;
+		uint16_t param2;
+		uint16_t param3;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i8_3 : IRCommon
+	struct IRCallCommonNativeStatic_v_i8_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_i8_4 : IRCommon
+	struct IRCallCommonNativeStatic_v_i8_2 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
 		uint8_t __pad14;
 		uint8_t __pad15;
-		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f4_1 : IRCommon
+	struct IRCallCommonNativeStatic_v_i8_3 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t ret;
+		uint16_t param1;
+		uint16_t param2;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5212,52 +6732,44 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f4_2 : IRCommon
+	struct IRCallCommonNativeStatic_v_i8_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t ret;
+		uint16_t param2;
+		uint16_t param3;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f4_3 : IRCommon
+	struct IRCallCommonNativeStatic_v_f4_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f4_4 : IRCommon
+	struct IRCallCommonNativeStatic_v_f4_2 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
 		uint8_t __pad14;
 		uint8_t __pad15;
-		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f8_1 : IRCommon
+	struct IRCallCommonNativeStatic_v_f4_3 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t ret;
+		uint16_t param1;
+		uint16_t param2;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5266,52 +6778,44 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f8_2 : IRCommon
+	struct IRCallCommonNativeStatic_v_f4_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t ret;
+		uint16_t param2;
+		uint16_t param3;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f8_3 : IRCommon
+	struct IRCallCommonNativeStatic_v_f8_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f4_f8_4 : IRCommon
+	struct IRCallCommonNativeStatic_v_f8_2 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
 		uint8_t __pad14;
 		uint8_t __pad15;
-		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_i4_1 : IRCommon
+	struct IRCallCommonNativeStatic_v_f8_3 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t ret;
+		uint16_t param1;
+		uint16_t param2;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5320,51 +6824,36 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_i4_2 : IRCommon
+	struct IRCallCommonNativeStatic_v_f8_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t ret;
+		uint16_t param2;
+		uint16_t param3;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_i4_3 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i4_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
 		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
 		uint32_t method;
-	};
-
-
-	struct IRCallCommonNativeInstance_f8_i4_4 : IRCommon
-	{
-		uint16_t self;
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
+		uint8_t __pad12;
+		uint8_t __pad13;
 		uint8_t __pad14;
 		uint8_t __pad15;
-		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_i8_1 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i4_2 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
+		uint16_t param1;
 		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
@@ -5374,11 +6863,11 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_i8_2 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i4_3 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
+		uint16_t param2;
 		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
@@ -5386,39 +6875,35 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_i8_3 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i4_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
+		uint16_t param3;
 		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_i8_4 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i8_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
 		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
 		uint8_t __pad14;
 		uint8_t __pad15;
-		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f4_1 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i8_2 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
+		uint16_t param1;
 		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
@@ -5428,11 +6913,11 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f4_2 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i8_3 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
+		uint16_t param2;
 		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
@@ -5440,39 +6925,35 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f4_3 : IRCommon
+	struct IRCallCommonNativeStatic_u1_i8_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
+		uint16_t param3;
 		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f4_4 : IRCommon
+	struct IRCallCommonNativeStatic_u1_f4_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
 		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
 		uint8_t __pad14;
 		uint8_t __pad15;
-		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f8_1 : IRCommon
+	struct IRCallCommonNativeStatic_u1_f4_2 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
+		uint16_t param1;
 		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
@@ -5482,11 +6963,11 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f8_2 : IRCommon
+	struct IRCallCommonNativeStatic_u1_f4_3 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
+		uint16_t param2;
 		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
@@ -5494,110 +6975,171 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f8_3 : IRCommon
+	struct IRCallCommonNativeStatic_u1_f4_4 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
+		uint16_t param3;
 		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeInstance_f8_f8_4 : IRCommon
+	struct IRCallCommonNativeStatic_u1_f8_1 : IRCommon
 	{
-		uint16_t self;
 		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
 		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
 		uint8_t __pad14;
 		uint8_t __pad15;
+	};
+
+
+	struct IRCallCommonNativeStatic_u1_f8_2 : IRCommon
+	{
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t ret;
 		uint32_t method;
-		uint8_t __pad20;
-		uint8_t __pad21;
-		uint8_t __pad22;
-		uint8_t __pad23;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_0 : IRCommon
+	struct IRCallCommonNativeStatic_u1_f8_3 : IRCommon
 	{
-		uint8_t __pad2;
-		uint8_t __pad3;
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_i1_0 : IRCommon
+	struct IRCallCommonNativeStatic_u1_f8_4 : IRCommon
 	{
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
 		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_0 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i4_1 : IRCommon
 	{
+		uint16_t param0;
 		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
 		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_i2_0 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i4_2 : IRCommon
 	{
+		uint16_t param0;
+		uint16_t param1;
 		uint16_t ret;
 		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_u2_0 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i4_3 : IRCommon
 	{
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
 		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_0 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i4_4 : IRCommon
 	{
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
 		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_0 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i8_1 : IRCommon
 	{
+		uint16_t param0;
 		uint16_t ret;
+		uint8_t __pad6;
+		uint8_t __pad7;
 		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_0 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i8_2 : IRCommon
 	{
+		uint16_t param0;
+		uint16_t param1;
 		uint16_t ret;
 		uint32_t method;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_0 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i8_3 : IRCommon
 	{
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
 		uint16_t ret;
+		uint8_t __pad10;
+		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i4_1 : IRCommon
+	struct IRCallCommonNativeStatic_i4_i8_4 : IRCommon
 	{
 		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i4_2 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f4_1 : IRCommon
 	{
 		uint16_t param0;
-		uint16_t param1;
+		uint16_t ret;
 		uint8_t __pad6;
 		uint8_t __pad7;
 		uint32_t method;
@@ -5608,11 +7150,11 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i4_3 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f4_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
+		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5621,29 +7163,33 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i4_4 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f4_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
-		uint16_t param3;
+		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i8_1 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f4_4 : IRCommon
 	{
 		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i8_2 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f8_1 : IRCommon
 	{
 		uint16_t param0;
-		uint16_t param1;
+		uint16_t ret;
 		uint8_t __pad6;
 		uint8_t __pad7;
 		uint32_t method;
@@ -5654,11 +7200,11 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i8_3 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f8_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
+		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5667,29 +7213,33 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_i8_4 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f8_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
-		uint16_t param3;
+		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f4_1 : IRCommon
+	struct IRCallCommonNativeStatic_i4_f8_4 : IRCommon
 	{
 		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f4_2 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i4_1 : IRCommon
 	{
 		uint16_t param0;
-		uint16_t param1;
+		uint16_t ret;
 		uint8_t __pad6;
 		uint8_t __pad7;
 		uint32_t method;
@@ -5700,11 +7250,11 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f4_3 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i4_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
+		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5713,29 +7263,33 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f4_4 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i4_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
-		uint16_t param3;
+		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f8_1 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i4_4 : IRCommon
 	{
 		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f8_2 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i8_1 : IRCommon
 	{
 		uint16_t param0;
-		uint16_t param1;
+		uint16_t ret;
 		uint8_t __pad6;
 		uint8_t __pad7;
 		uint32_t method;
@@ -5746,11 +7300,11 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f8_3 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i8_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
-		uint16_t param2;
+		uint16_t ret;
 		uint32_t method;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -5759,19 +7313,30 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_v_f8_4 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i8_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
 		uint16_t param2;
-		uint16_t param3;
+		uint16_t ret;
 		uint8_t __pad10;
 		uint8_t __pad11;
 		uint32_t method;
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i4_1 : IRCommon
+	struct IRCallCommonNativeStatic_i8_i8_4 : IRCommon
+	{
+		uint16_t param0;
+		uint16_t param1;
+		uint16_t param2;
+		uint16_t param3;
+		uint16_t ret;
+		uint32_t method;
+	};
+
+
+	struct IRCallCommonNativeStatic_i8_f4_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -5785,7 +7350,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i4_2 : IRCommon
+	struct IRCallCommonNativeStatic_i8_f4_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5798,7 +7363,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i4_3 : IRCommon
+	struct IRCallCommonNativeStatic_i8_f4_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5810,7 +7375,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i4_4 : IRCommon
+	struct IRCallCommonNativeStatic_i8_f4_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5821,7 +7386,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i8_1 : IRCommon
+	struct IRCallCommonNativeStatic_i8_f8_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -5835,7 +7400,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i8_2 : IRCommon
+	struct IRCallCommonNativeStatic_i8_f8_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5848,7 +7413,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i8_3 : IRCommon
+	struct IRCallCommonNativeStatic_i8_f8_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5860,7 +7425,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_i8_4 : IRCommon
+	struct IRCallCommonNativeStatic_i8_f8_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5871,7 +7436,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f4_1 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i4_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -5885,7 +7450,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f4_2 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i4_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5898,7 +7463,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f4_3 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i4_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5910,7 +7475,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f4_4 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i4_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5921,7 +7486,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f8_1 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i8_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -5935,7 +7500,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f8_2 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i8_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5948,7 +7513,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f8_3 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i8_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5960,7 +7525,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_u1_f8_4 : IRCommon
+	struct IRCallCommonNativeStatic_f4_i8_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5971,7 +7536,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i4_1 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f4_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -5985,7 +7550,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i4_2 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f4_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -5998,7 +7563,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i4_3 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f4_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6010,7 +7575,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i4_4 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f4_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6021,7 +7586,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i8_1 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f8_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -6035,7 +7600,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i8_2 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f8_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6048,7 +7613,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i8_3 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f8_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6060,7 +7625,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_i8_4 : IRCommon
+	struct IRCallCommonNativeStatic_f4_f8_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6071,7 +7636,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f4_1 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i4_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -6085,7 +7650,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f4_2 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i4_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6098,7 +7663,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f4_3 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i4_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6110,7 +7675,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f4_4 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i4_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6121,7 +7686,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f8_1 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i8_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -6135,7 +7700,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f8_2 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i8_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6148,7 +7713,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f8_3 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i8_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6160,7 +7725,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i4_f8_4 : IRCommon
+	struct IRCallCommonNativeStatic_f8_i8_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6171,7 +7736,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i4_1 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f4_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -6185,7 +7750,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i4_2 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f4_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6198,7 +7763,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i4_3 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f4_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6210,7 +7775,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i4_4 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f4_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6221,7 +7786,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i8_1 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f8_1 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t ret;
@@ -6235,7 +7800,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i8_2 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f8_2 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6248,7 +7813,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i8_3 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f8_3 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6260,7 +7825,7 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_i8_4 : IRCommon
+	struct IRCallCommonNativeStatic_f8_f8_4 : IRCommon
 	{
 		uint16_t param0;
 		uint16_t param1;
@@ -6271,13 +7836,41 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f4_1 : IRCommon
+	struct IRBoxVarVar : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t data;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
+		uint32_t klass;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRUnBoxVarVar : IRCommon
+	{
+		uint16_t addr;
+		uint16_t obj;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t klass;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRUnBoxAnyVarVar : IRCommon
+	{
+		uint16_t dst;
+		uint16_t obj;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6285,49 +7878,34 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f4_2 : IRCommon
+	struct IRCastclassVar : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t obj;
+		uint32_t klass;
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f4_3 : IRCommon
+	struct IRIsInstVar : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t obj;
+		uint32_t klass;
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f4_4 : IRCommon
+	struct IRLdtokenVar : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t runtimeHandle;
+		uint32_t token;
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f8_1 : IRCommon
+	struct IRMakeRefVarVar : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t data;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6335,12 +7913,22 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f8_2 : IRCommon
+	struct IRRefAnyTypeVarVar : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t typedRef;
+		uint8_t __pad6;
+		uint8_t __pad7;
+	};
+
+
+	struct IRRefAnyValueVarVar : IRCommon
+	{
+		uint16_t addr;
+		uint16_t typedRef;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6348,136 +7936,120 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f8_3 : IRCommon
+	struct IRCpobjVarVar_ref : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_i8_f8_4 : IRCommon
+	struct IRCpobjVarVar_1 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i4_1 : IRCommon
+	struct IRCpobjVarVar_2 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i4_2 : IRCommon
+	struct IRCpobjVarVar_4 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i4_3 : IRCommon
+	struct IRCpobjVarVar_8 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i4_4 : IRCommon
+	struct IRCpobjVarVar_12 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i8_1 : IRCommon
+	struct IRCpobjVarVar_16 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i8_2 : IRCommon
+	struct IRCpobjVarVar_20 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i8_3 : IRCommon
+	struct IRCpobjVarVar_24 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_i8_4 : IRCommon
+	struct IRCpobjVarVar_28 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f4_1 : IRCommon
+	struct IRCpobjVarVar_32 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
+	};
+
+
+	struct IRCpobjVarVar_n_2 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+		uint16_t size;
+	};
+
+
+	struct IRCpobjVarVar_n_4 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t size;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6485,12 +8057,21 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f4_2 : IRCommon
+	struct IRCpobjVarVar_WriteBarrier_n_2 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint16_t size;
+	};
+
+
+	struct IRCpobjVarVar_WriteBarrier_n_4 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t size;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6498,149 +8079,112 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f4_3 : IRCommon
+	struct IRLdobjVarVar_ref : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f4_4 : IRCommon
+	struct IRLdobjVarVar_1 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f8_1 : IRCommon
+	struct IRLdobjVarVar_2 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f8_2 : IRCommon
+	struct IRLdobjVarVar_4 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f8_3 : IRCommon
+	struct IRLdobjVarVar_8 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f4_f8_4 : IRCommon
+	struct IRLdobjVarVar_12 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i4_1 : IRCommon
+	struct IRLdobjVarVar_16 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i4_2 : IRCommon
+	struct IRLdobjVarVar_20 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i4_3 : IRCommon
+	struct IRLdobjVarVar_24 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i4_4 : IRCommon
+	struct IRLdobjVarVar_28 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i8_1 : IRCommon
+	struct IRLdobjVarVar_32 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i8_2 : IRCommon
+	struct IRLdobjVarVar_n_4 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t size;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6648,136 +8192,112 @@ namespace interpreter
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i8_3 : IRCommon
+	struct IRStobjVarVar_ref : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_i8_4 : IRCommon
+	struct IRStobjVarVar_1 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f4_1 : IRCommon
+	struct IRStobjVarVar_2 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f4_2 : IRCommon
+	struct IRStobjVarVar_4 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f4_3 : IRCommon
+	struct IRStobjVarVar_8 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f4_4 : IRCommon
+	struct IRStobjVarVar_12 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f8_1 : IRCommon
+	struct IRStobjVarVar_16 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t ret;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f8_2 : IRCommon
+	struct IRStobjVarVar_20 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t ret;
-		uint32_t method;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f8_3 : IRCommon
+	struct IRStobjVarVar_24 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t ret;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRCallCommonNativeStatic_f8_f8_4 : IRCommon
+	struct IRStobjVarVar_28 : IRCommon
 	{
-		uint16_t param0;
-		uint16_t param1;
-		uint16_t param2;
-		uint16_t param3;
-		uint16_t ret;
-		uint32_t method;
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
+	};
+
+
+	struct IRStobjVarVar_32 : IRCommon
+	{
+		uint16_t dst;
+		uint16_t src;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRBoxVarVar : IRCommon
+	struct IRStobjVarVar_n_4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t data;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t klass;
+		uint32_t size;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6785,13 +8305,13 @@ namespace interpreter
 	};
 
 
-	struct IRUnBoxVarVar : IRCommon
+	struct IRStobjVarVar_WriteBarrier_n_4 : IRCommon
 	{
-		uint16_t addr;
-		uint16_t obj;
+		uint16_t dst;
+		uint16_t src;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t klass;
+		uint32_t size;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -6799,327 +8319,347 @@ namespace interpreter
 	};
 
 
-	struct IRUnBoxAnyVarVar : IRCommon
+	struct IRInitobjVar_ref : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t klass;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCastclassVar : IRCommon
+	struct IRInitobjVar_1 : IRCommon
 	{
 		uint16_t obj;
-		uint32_t klass;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRIsInstVar : IRCommon
+	struct IRInitobjVar_2 : IRCommon
 	{
 		uint16_t obj;
-		uint32_t klass;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRLdtokenVar : IRCommon
+	struct IRInitobjVar_4 : IRCommon
 	{
-		uint16_t runtimeHandle;
-		uint32_t token;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
 	};
 
 
-	struct IRMakeRefVarVar : IRCommon
+	struct IRInitobjVar_8 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t data;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t klass;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRRefAnyTypeVarVar : IRCommon
+	struct IRInitobjVar_12 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t typedRef;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
 	};
 
 
-	struct IRRefAnyValueVarVar : IRCommon
+	struct IRInitobjVar_16 : IRCommon
 	{
-		uint16_t addr;
-		uint16_t typedRef;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
-		uint32_t klass;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRCpobjVarVar_ref : IRCommon
+	struct IRInitobjVar_20 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t src;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
 	};
 
 
-	struct IRCpobjVarVar_1 : IRCommon
+	struct IRInitobjVar_24 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t src;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
 	};
 
 
-	struct IRCpobjVarVar_2 : IRCommon
+	struct IRInitobjVar_28 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t src;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
 	};
 
 
-	struct IRCpobjVarVar_4 : IRCommon
+	struct IRInitobjVar_32 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t src;
+		uint16_t obj;
+		uint8_t __pad4;
+		uint8_t __pad5;
 		uint8_t __pad6;
 		uint8_t __pad7;
 	};
 
 
-	struct IRCpobjVarVar_8 : IRCommon
+	struct IRInitobjVar_n_2 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t src;
+		uint16_t obj;
+		uint16_t size;
 		uint8_t __pad6;
 		uint8_t __pad7;
 	};
 
 
-	struct IRCpobjVarVar_12 : IRCommon
+	struct IRInitobjVar_n_4 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t src;
+		uint16_t obj;
+		uint32_t size;
+	};
+
+
+	struct IRInitobjVar_WriteBarrier_n_2 : IRCommon
+	{
+		uint16_t obj;
+		uint16_t size;
 		uint8_t __pad6;
 		uint8_t __pad7;
 	};
 
 
-	struct IRCpobjVarVar_16 : IRCommon
+	struct IRInitobjVar_WriteBarrier_n_4 : IRCommon
+	{
+		uint16_t obj;
+		uint32_t size;
+	};
+
+
+	struct IRLdstrVar : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint32_t str;
 	};
 
 
-	struct IRCpobjVarVar_20 : IRCommon
+	struct IRLdfldVarVar_i1 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRCpobjVarVar_24 : IRCommon
+	struct IRLdfldVarVar_u1 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRCpobjVarVar_28 : IRCommon
+	struct IRLdfldVarVar_i2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRCpobjVarVar_32 : IRCommon
+	struct IRLdfldVarVar_u2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRCpobjVarVar_n_2 : IRCommon
+	struct IRLdfldVarVar_i4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint16_t size;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRCpobjVarVar_n_4 : IRCommon
+	struct IRLdfldVarVar_u4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t size;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRCpobjVarVar_WriteBarrier_n_2 : IRCommon
+	struct IRLdfldVarVar_i8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint16_t size;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRCpobjVarVar_WriteBarrier_n_4 : IRCommon
+	struct IRLdfldVarVar_u8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t size;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_ref : IRCommon
+	struct IRLdfldVarVar_i1_NoCheck : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_1 : IRCommon
+	struct IRLdfldVarVar_u1_NoCheck : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_2 : IRCommon
+	struct IRLdfldVarVar_i2_NoCheck : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_4 : IRCommon
+	struct IRLdfldVarVar_u2_NoCheck : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_8 : IRCommon
+	struct IRLdfldVarVar_i4_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRLdfldVarVar_u4_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRLdfldVarVar_i8_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRLdfldVarVar_u8_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t obj;
+		uint16_t offset;
+	};
+
+
+	struct IRLdfldVarVar_size_8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_12 : IRCommon
+	struct IRLdfldVarVar_size_12 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_16 : IRCommon
+	struct IRLdfldVarVar_size_16 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_20 : IRCommon
+	struct IRLdfldVarVar_size_20 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_24 : IRCommon
+	struct IRLdfldVarVar_size_24 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_28 : IRCommon
+	struct IRLdfldVarVar_size_28 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_32 : IRCommon
+	struct IRLdfldVarVar_size_32 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRLdobjVarVar_n_4 : IRCommon
+	struct IRLdfldVarVar_n_2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t size;
+		uint16_t obj;
+		uint16_t offset;
+		uint16_t size;
+		uint8_t __pad10;
+		uint8_t __pad11;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7127,407 +8667,380 @@ namespace interpreter
 	};
 
 
-	struct IRStobjVarVar_ref : IRCommon
+	struct IRLdfldVarVar_n_4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
+		uint32_t size;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStobjVarVar_1 : IRCommon
+	struct IRLdfldValueTypeVarVar_i1 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_2 : IRCommon
+	struct IRLdfldValueTypeVarVar_u1 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_4 : IRCommon
+	struct IRLdfldValueTypeVarVar_i2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_8 : IRCommon
+	struct IRLdfldValueTypeVarVar_u2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_12 : IRCommon
+	struct IRLdfldValueTypeVarVar_i4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_16 : IRCommon
+	struct IRLdfldValueTypeVarVar_u4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_20 : IRCommon
+	struct IRLdfldValueTypeVarVar_i8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_24 : IRCommon
+	struct IRLdfldValueTypeVarVar_u8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_28 : IRCommon
+	struct IRLdfldValueTypeVarVar_size_8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_32 : IRCommon
+	struct IRLdfldValueTypeVarVar_size_12 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_n_4 : IRCommon
+	struct IRLdfldValueTypeVarVar_size_16 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t size;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRStobjVarVar_WriteBarrier_n_4 : IRCommon
+	struct IRLdfldValueTypeVarVar_size_20 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t src;
-		uint8_t __pad6;
-		uint8_t __pad7;
-		uint32_t size;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint16_t obj;
+		uint16_t offset;
 	};
 
 
-	struct IRInitobjVar_ref : IRCommon
+	struct IRLdfldValueTypeVarVar_size_24 : IRCommon
 	{
+		uint16_t dst;
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
 	};
 
 
-	struct IRInitobjVar_1 : IRCommon
+	struct IRLdfldValueTypeVarVar_size_28 : IRCommon
 	{
+		uint16_t dst;
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
 	};
 
 
-	struct IRInitobjVar_2 : IRCommon
+	struct IRLdfldValueTypeVarVar_size_32 : IRCommon
 	{
+		uint16_t dst;
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
 	};
 
 
-	struct IRInitobjVar_4 : IRCommon
+	struct IRLdfldValueTypeVarVar_n_2 : IRCommon
 	{
+		uint16_t dst;
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t size;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRInitobjVar_8 : IRCommon
+	struct IRLdfldValueTypeVarVar_n_4 : IRCommon
 	{
+		uint16_t dst;
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint32_t size;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRInitobjVar_12 : IRCommon
+	struct IRLdfldaVarVar : IRCommon
 	{
+		uint16_t dst;
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
 	};
 
 
-	struct IRInitobjVar_16 : IRCommon
+	struct IRStfldVarVar_i1 : IRCommon
 	{
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_20 : IRCommon
+	struct IRStfldVarVar_u1 : IRCommon
 	{
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_24 : IRCommon
+	struct IRStfldVarVar_i2 : IRCommon
 	{
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_28 : IRCommon
+	struct IRStfldVarVar_u2 : IRCommon
 	{
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_32 : IRCommon
+	struct IRStfldVarVar_i4 : IRCommon
 	{
 		uint16_t obj;
-		uint8_t __pad4;
-		uint8_t __pad5;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_n_2 : IRCommon
+	struct IRStfldVarVar_u4 : IRCommon
 	{
 		uint16_t obj;
-		uint16_t size;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_n_4 : IRCommon
+	struct IRStfldVarVar_i8 : IRCommon
 	{
 		uint16_t obj;
-		uint32_t size;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_WriteBarrier_n_2 : IRCommon
+	struct IRStfldVarVar_u8 : IRCommon
 	{
 		uint16_t obj;
-		uint16_t size;
-		uint8_t __pad6;
-		uint8_t __pad7;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRInitobjVar_WriteBarrier_n_4 : IRCommon
+	struct IRStfldVarVar_ref : IRCommon
 	{
 		uint16_t obj;
-		uint32_t size;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdstrVar : IRCommon
+	struct IRStfldVarVar_i1_NoCheck : IRCommon
 	{
-		uint16_t dst;
-		uint32_t str;
+		uint16_t obj;
+		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_i1 : IRCommon
+	struct IRStfldVarVar_u1_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_u1 : IRCommon
+	struct IRStfldVarVar_i2_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_i2 : IRCommon
+	struct IRStfldVarVar_u2_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_u2 : IRCommon
+	struct IRStfldVarVar_i4_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_i4 : IRCommon
+	struct IRStfldVarVar_u4_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_u4 : IRCommon
+	struct IRStfldVarVar_i8_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_i8 : IRCommon
+	struct IRStfldVarVar_u8_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_u8 : IRCommon
+	struct IRStfldVarVar_ref_NoCheck : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_size_8 : IRCommon
+	struct IRStfldVarVar_size_8 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_size_12 : IRCommon
+	struct IRStfldVarVar_size_12 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_size_16 : IRCommon
+	struct IRStfldVarVar_size_16 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_size_20 : IRCommon
+	struct IRStfldVarVar_size_20 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_size_24 : IRCommon
+	struct IRStfldVarVar_size_24 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_size_28 : IRCommon
+	struct IRStfldVarVar_size_28 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_size_32 : IRCommon
+	struct IRStfldVarVar_size_32 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 	};
 
 
-	struct IRLdfldVarVar_n_2 : IRCommon
+	struct IRStfldVarVar_n_2 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 		uint16_t size;
 		uint8_t __pad10;
 		uint8_t __pad11;
@@ -7538,11 +9051,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdfldVarVar_n_4 : IRCommon
+	struct IRStfldVarVar_n_4 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
 		uint32_t size;
 		uint8_t __pad12;
 		uint8_t __pad13;
@@ -7551,134 +9064,195 @@ namespace interpreter
 	};
 
 
-	struct IRLdfldValueTypeVarVar_i1 : IRCommon
+	struct IRStfldVarVar_WriteBarrier_n_2 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
+		uint16_t size;
+		uint8_t __pad10;
+		uint8_t __pad11;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_u1 : IRCommon
+	struct IRStfldVarVar_WriteBarrier_n_4 : IRCommon
 	{
-		uint16_t dst;
 		uint16_t obj;
 		uint16_t offset;
+		uint16_t data;
+		uint32_t size;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_i2 : IRCommon
+	struct IRLdsfldVarVar_i1 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_u2 : IRCommon
+	struct IRLdsfldVarVar_u1 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_i4 : IRCommon
+	struct IRLdsfldVarVar_i2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_u4 : IRCommon
+	struct IRLdsfldVarVar_u2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_i8 : IRCommon
+	struct IRLdsfldVarVar_i4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_u8 : IRCommon
+	struct IRLdsfldVarVar_u4 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_size_8 : IRCommon
+	struct IRLdsfldVarVar_i8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_size_12 : IRCommon
+	struct IRLdsfldVarVar_u8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_size_16 : IRCommon
+	struct IRLdsfldVarVar_size_8 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_size_20 : IRCommon
+	struct IRLdsfldVarVar_size_12 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_size_24 : IRCommon
+	struct IRLdsfldVarVar_size_16 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_size_28 : IRCommon
+	struct IRLdsfldVarVar_size_20 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_size_32 : IRCommon
+	struct IRLdsfldVarVar_size_24 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRLdfldValueTypeVarVar_n_2 : IRCommon
+	struct IRLdsfldVarVar_size_28 : IRCommon
 	{
-		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t size;
-		uint8_t __pad10;
-		uint8_t __pad11;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7686,12 +9260,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdfldValueTypeVarVar_n_4 : IRCommon
+	struct IRLdsfldVarVar_size_32 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
-		uint32_t size;
+		uint32_t klass;
+		uint32_t offset;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7699,163 +9272,231 @@ namespace interpreter
 	};
 
 
-	struct IRLdfldaVarVar : IRCommon
+	struct IRLdsfldVarVar_n_2 : IRCommon
 	{
 		uint16_t dst;
-		uint16_t obj;
-		uint16_t offset;
+		uint16_t size;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t klass;
+		uint32_t offset;
 	};
 
 
-	struct IRStfldVarVar_i1 : IRCommon
+	struct IRLdsfldVarVar_n_4 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint32_t size;
 	};
 
 
-	struct IRStfldVarVar_u1 : IRCommon
+	struct IRLdsfldInitedVarVar_i1 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_i2 : IRCommon
+	struct IRLdsfldInitedVarVar_u1 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_u2 : IRCommon
+	struct IRLdsfldInitedVarVar_i2 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_i4 : IRCommon
+	struct IRLdsfldInitedVarVar_u2 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_u4 : IRCommon
+	struct IRLdsfldInitedVarVar_i4 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_i8 : IRCommon
+	struct IRLdsfldInitedVarVar_u4 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_u8 : IRCommon
+	struct IRLdsfldInitedVarVar_i8 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_ref : IRCommon
+	struct IRLdsfldInitedVarVar_u8 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_size_8 : IRCommon
+	struct IRLdsfldInitedVarVar_size_8 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_size_12 : IRCommon
+	struct IRLdsfldInitedVarVar_size_12 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_size_16 : IRCommon
+	struct IRLdsfldInitedVarVar_size_16 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_size_20 : IRCommon
+	struct IRLdsfldInitedVarVar_size_20 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_size_24 : IRCommon
+	struct IRLdsfldInitedVarVar_size_24 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_size_28 : IRCommon
+	struct IRLdsfldInitedVarVar_size_28 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_size_32 : IRCommon
+	struct IRLdsfldInitedVarVar_size_32 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
 	};
 
 
-	struct IRStfldVarVar_n_2 : IRCommon
+	struct IRLdsfldInitedVarVar_n_2 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
 		uint16_t size;
-		uint8_t __pad10;
-		uint8_t __pad11;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint32_t klass;
+		uint32_t offset;
 	};
 
 
-	struct IRStfldVarVar_n_4 : IRCommon
+	struct IRLdsfldInitedVarVar_n_4 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
-		uint16_t data;
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
 		uint32_t size;
+	};
+
+
+	struct IRStsfldVarVar_i1 : IRCommon
+	{
+		uint16_t data;
+		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7863,14 +9504,11 @@ namespace interpreter
 	};
 
 
-	struct IRStfldVarVar_WriteBarrier_n_2 : IRCommon
+	struct IRStsfldVarVar_u1 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
 		uint16_t data;
-		uint16_t size;
-		uint8_t __pad10;
-		uint8_t __pad11;
+		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7878,12 +9516,11 @@ namespace interpreter
 	};
 
 
-	struct IRStfldVarVar_WriteBarrier_n_4 : IRCommon
+	struct IRStsfldVarVar_i2 : IRCommon
 	{
-		uint16_t obj;
-		uint16_t offset;
 		uint16_t data;
-		uint32_t size;
+		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7891,11 +9528,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_i1 : IRCommon
+	struct IRStsfldVarVar_u2 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7903,11 +9540,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_u1 : IRCommon
+	struct IRStsfldVarVar_i4 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7915,11 +9552,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_i2 : IRCommon
-	{
-		uint16_t dst;
-		uint32_t klass;
+	struct IRStsfldVarVar_u4 : IRCommon
+	{
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7927,11 +9564,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_u2 : IRCommon
+	struct IRStsfldVarVar_i8 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7939,11 +9576,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_i4 : IRCommon
+	struct IRStsfldVarVar_u8 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7951,11 +9588,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_u4 : IRCommon
+	struct IRStsfldVarVar_ref : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7963,11 +9600,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_i8 : IRCommon
+	struct IRStsfldVarVar_size_8 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7975,11 +9612,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_u8 : IRCommon
+	struct IRStsfldVarVar_size_12 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7987,11 +9624,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_size_8 : IRCommon
+	struct IRStsfldVarVar_size_16 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -7999,11 +9636,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_size_12 : IRCommon
+	struct IRStsfldVarVar_size_20 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -8011,11 +9648,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_size_16 : IRCommon
+	struct IRStsfldVarVar_size_24 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -8023,11 +9660,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_size_20 : IRCommon
+	struct IRStsfldVarVar_size_28 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -8035,11 +9672,11 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_size_24 : IRCommon
+	struct IRStsfldVarVar_size_32 : IRCommon
 	{
-		uint16_t dst;
-		uint32_t klass;
+		uint16_t data;
 		uint32_t offset;
+		uint32_t klass;
 		uint8_t __pad12;
 		uint8_t __pad13;
 		uint8_t __pad14;
@@ -8047,33 +9684,29 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_size_28 : IRCommon
+	struct IRStsfldVarVar_n_2 : IRCommon
 	{
-		uint16_t dst;
+		uint16_t data;
+		uint16_t size;
+		uint8_t __pad6;
+		uint8_t __pad7;
 		uint32_t klass;
 		uint32_t offset;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
 	};
 
 
-	struct IRLdsfldVarVar_size_32 : IRCommon
+	struct IRStsfldVarVar_n_4 : IRCommon
 	{
-		uint16_t dst;
+		uint16_t data;
 		uint32_t klass;
 		uint32_t offset;
-		uint8_t __pad12;
-		uint8_t __pad13;
-		uint8_t __pad14;
-		uint8_t __pad15;
+		uint32_t size;
 	};
 
 
-	struct IRLdsfldVarVar_n_2 : IRCommon
+	struct IRStsfldVarVar_WriteBarrier_n_2 : IRCommon
 	{
-		uint16_t dst;
+		uint16_t data;
 		uint16_t size;
 		uint8_t __pad6;
 		uint8_t __pad7;
@@ -8082,16 +9715,16 @@ namespace interpreter
 	};
 
 
-	struct IRLdsfldVarVar_n_4 : IRCommon
+	struct IRStsfldVarVar_WriteBarrier_n_4 : IRCommon
 	{
-		uint16_t dst;
+		uint16_t data;
 		uint32_t klass;
 		uint32_t offset;
 		uint32_t size;
 	};
 
 
-	struct IRStsfldVarVar_i1 : IRCommon
+	struct IRStsfldInitedVarVar_i1 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8103,7 +9736,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_u1 : IRCommon
+	struct IRStsfldInitedVarVar_u1 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8115,7 +9748,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_i2 : IRCommon
+	struct IRStsfldInitedVarVar_i2 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8127,7 +9760,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_u2 : IRCommon
+	struct IRStsfldInitedVarVar_u2 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8139,7 +9772,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_i4 : IRCommon
+	struct IRStsfldInitedVarVar_i4 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8151,7 +9784,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_u4 : IRCommon
+	struct IRStsfldInitedVarVar_u4 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8163,7 +9796,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_i8 : IRCommon
+	struct IRStsfldInitedVarVar_i8 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8175,7 +9808,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_u8 : IRCommon
+	struct IRStsfldInitedVarVar_u8 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8187,7 +9820,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_ref : IRCommon
+	struct IRStsfldInitedVarVar_ref : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8199,7 +9832,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_size_8 : IRCommon
+	struct IRStsfldInitedVarVar_size_8 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8211,7 +9844,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_size_12 : IRCommon
+	struct IRStsfldInitedVarVar_size_12 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8223,7 +9856,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_size_16 : IRCommon
+	struct IRStsfldInitedVarVar_size_16 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8235,7 +9868,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_size_20 : IRCommon
+	struct IRStsfldInitedVarVar_size_20 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8247,7 +9880,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_size_24 : IRCommon
+	struct IRStsfldInitedVarVar_size_24 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8259,7 +9892,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_size_28 : IRCommon
+	struct IRStsfldInitedVarVar_size_28 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8271,7 +9904,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_size_32 : IRCommon
+	struct IRStsfldInitedVarVar_size_32 : IRCommon
 	{
 		uint16_t data;
 		uint32_t offset;
@@ -8283,7 +9916,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_n_2 : IRCommon
+	struct IRStsfldInitedVarVar_n_2 : IRCommon
 	{
 		uint16_t data;
 		uint16_t size;
@@ -8294,7 +9927,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_n_4 : IRCommon
+	struct IRStsfldInitedVarVar_n_4 : IRCommon
 	{
 		uint16_t data;
 		uint32_t klass;
@@ -8303,7 +9936,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_WriteBarrier_n_2 : IRCommon
+	struct IRStsfldInitedVarVar_WriteBarrier_n_2 : IRCommon
 	{
 		uint16_t data;
 		uint16_t size;
@@ -8314,7 +9947,7 @@ namespace interpreter
 	};
 
 
-	struct IRStsfldVarVar_WriteBarrier_n_4 : IRCommon
+	struct IRStsfldInitedVarVar_WriteBarrier_n_4 : IRCommon
 	{
 		uint16_t data;
 		uint32_t klass;
@@ -8335,6 +9968,18 @@ namespace interpreter
 	};
 
 
+	struct IRLdsfldaInitedVarVar : IRCommon
+	{
+		uint16_t dst;
+		uint32_t klass;
+		uint32_t offset;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
 	struct IRLdsfldaFromFieldDataVarVar : IRCommon
 	{
 		uint16_t dst;
@@ -8808,6 +10453,18 @@ namespace interpreter
 	};
 
 
+	struct IRInitClassStaticCtorInited : IRCommon
+	{
+		uint8_t __pad2;
+		uint8_t __pad3;
+		uint8_t __pad4;
+		uint8_t __pad5;
+		uint8_t __pad6;
+		uint8_t __pad7;
+		uint64_t klass;
+	};
+
+
 	struct IRNewArrVarVar : IRCommon
 	{
 		uint16_t arr;
@@ -8916,6 +10573,70 @@ namespace interpreter
 	};
 
 
+	struct IRGetArrayElementVarVar_i1_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
+	struct IRGetArrayElementVarVar_u1_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
+	struct IRGetArrayElementVarVar_i2_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
+	struct IRGetArrayElementVarVar_u2_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
+	struct IRGetArrayElementVarVar_i4_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
+	struct IRGetArrayElementVarVar_u4_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
+	struct IRGetArrayElementVarVar_i8_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
+	struct IRGetArrayElementVarVar_u8_NoCheck : IRCommon
+	{
+		uint16_t dst;
+		uint16_t arr;
+		uint16_t index;
+	};
+
+
 	struct IRGetArrayElementVarVar_size_1 : IRCommon
 	{
 		uint16_t dst;
@@ -9068,7 +10789,84 @@ namespace interpreter
 	};
 
 
+	struct IRSetArrayElementVarVar_i1_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
+	struct IRSetArrayElementVarVar_u1_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
+	struct IRSetArrayElementVarVar_i2_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
+	struct IRSetArrayElementVarVar_u2_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
+	struct IRSetArrayElementVarVar_i4_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
+	struct IRSetArrayElementVarVar_u4_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
+	struct IRSetArrayElementVarVar_i8_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
+	struct IRSetArrayElementVarVar_u8_NoCheck : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+	};
+
+
 	struct IRSetArrayElementVarVar_ref : IRCommon
+	{
+		uint16_t arr;
+		uint16_t index;
+		uint16_t ele;
+		uint32_t typeCheckCache;
+		uint8_t __pad12;
+		uint8_t __pad13;
+		uint8_t __pad14;
+		uint8_t __pad15;
+	};
+
+
+	struct IRSetArrayElementVarVar_ref_NoTypeCheck : IRCommon
 	{
 		uint16_t arr;
 		uint16_t index;
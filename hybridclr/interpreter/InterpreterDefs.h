@@ -62,6 +62,8 @@ namespace hybridclr
 		struct InterpFrame
 		{
 			const MethodInfo* method;
+			// code executed by the frame. method->interpData may be replaced while the frame runs, see ClassHierarchy.
+			const InterpMethodInfo* imi;
 			StackObject* stackBasePtr;
 			int32_t oldStackTop;
 			void* ret;
@@ -102,6 +104,21 @@ namespace hybridclr
 			uint16_t stackObjectSize;
 		};
 
+		enum class ExecutionTier : uint8_t
+		{
+			// fast to transform, no inlining and IR optimization. counts calls and loop iterations to find hot methods.
+			Baseline,
+			Optimized,
+		};
+
+		// a loop header of optimized code where a frame running baseline code of the same method can continue.
+		// args and locals have the same offsets in both codes and the eval stack is empty at loop headers.
+		struct OsrEntry
+		{
+			uint32_t ilOffset;
+			uint32_t codeOffset;
+		};
+
 		struct InterpMethodInfo
 		{
 			byte* codes;
@@ -118,6 +135,59 @@ namespace hybridclr
 			uint32_t localVarBaseOffset;
 			uint32_t evalStackBaseOffset;
 			uint32_t exClauseCount;
+			ExecutionTier tier;
+			// countdowns to tier up of baseline code, 0 for optimized code. see DecreaseTierUpCountdown.
+			int32_t callCountdown;
+			int32_t backEdgeCountdown;
+			// sorted by ilOffset, only optimized code has entries
+			const OsrEntry* osrEntries;
+			uint32_t osrEntryCount;
+			// bit i is set if slot i of args and locals may hold a managed reference, covers [0, evalStackBaseOffset).
+			// slots of the eval stack are retyped by instructions and are always scanned conservatively. see MachineState::GetGCRootData
+			const uint8_t* refSlotMap;
+		};
+
+		// returns true once when the countdown reaches 0.
+		// decremented without synchronization, a lost update just delays the tier up a bit.
+		inline bool DecreaseTierUpCountdown(const int32_t& countdown)
+		{
+			int32_t& value = const_cast<int32_t&>(countdown);
+			return value > 0 && --value == 0;
+		}
+
+		// MethodInfo::interpData of a method that is being transformed by some thread, see InterpreterModule::GetInterpMethodInfo
+		const uintptr_t kTransformingInterpData = 1;
+
+		inline bool IsTransformedInterpData(const void* interpData)
+		{
+			return (uintptr_t)interpData > kTransformingInterpData;
+		}
+
+		// per call site cache of virtual method resolution, allocated in InterpMethodInfo::resolveDatas.
+		// entries are filled once and never replaced: a slot is claimed by CAS on klasses[i], then targets[i] is set.
+		// a reader that finds its klass but a null target just takes the slow path.
+		// when all entries are used the site turns megamorphic and always does the full lookup.
+		struct VirtualCallInlineCache
+		{
+			static const int32_t kMaxEntryCount = 4;
+
+			const MethodInfo* method;
+			Il2CppClass* volatile klasses[kMaxEntryCount];
+			MethodInfo* volatile targets[kMaxEntryCount];
+			volatile uint32_t megamorphic;
 		};
+
+		const int32_t kVirtualCallInlineCacheResolveDataSlotCount = (int32_t)((sizeof(VirtualCallInlineCache) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+
+		// per store site cache of the element type check of stelem.ref, allocated in InterpMethodInfo::resolveDatas.
+		// holds a single (array klass, element klass) pair that passed the check. like VirtualCallInlineCache the entry
+		// is claimed by CAS on arrKlass and never replaced, so a matching eleKlass always belongs to arrKlass.
+		struct ArrayStoreTypeCheckCache
+		{
+			Il2CppClass* volatile arrKlass;
+			Il2CppClass* volatile eleKlass;
+		};
+
+		const int32_t kArrayStoreTypeCheckCacheResolveDataSlotCount = (int32_t)((sizeof(ArrayStoreTypeCheckCache) + sizeof(uint64_t) - 1) / sizeof(uint64_t));
 	}
 }
\ No newline at end of file
@@ -12,14 +12,20 @@
 #include "vm/Class.h"
 #include "vm/Object.h"
 #include "vm/Method.h"
+#include "os/Atomic.h"
+#include "os/Event.h"
+#include "os/Thread.h"
 
 #include "../metadata/MetadataModule.h"
 #include "../metadata/MetadataUtil.h"
 #include "../metadata/InterpreterImage.h"
 #include "../transform/Transform.h"
+#include "../transform/PreJitScheduler.h"
+#include "../RuntimeConfig.h"
 
 #include "MethodBridge.h"
 #include "InterpreterUtil.h"
+#include "OpcodeProfiler.h"
 
 namespace hybridclr
 {
@@ -27,17 +33,31 @@ namespace interpreter
 {
 	il2cpp::os::ThreadLocalValue InterpreterModule::s_machineState;
 
-	static Il2CppHashMap<const char*, Managed2NativeCallMethod, CStringHash, CStringEqualTo> s_managed2natives;
-	static Il2CppHashMap<const char*, Il2CppMethodPointer, CStringHash, CStringEqualTo> s_native2manageds;
-	static Il2CppHashMap<const char*, Il2CppMethodPointer, CStringHash, CStringEqualTo> s_adjustThunks;
+	static SignatureIdTable<Managed2NativeCallMethod> s_managed2natives;
+	static SignatureIdTable<Il2CppMethodPointer> s_native2manageds;
+	static SignatureIdTable<Il2CppMethodPointer> s_adjustThunks;
 	static Il2CppHashMap<const char*, const char*, CStringHash, CStringEqualTo> s_fullName2signature;
 
+	// signature ids of MethodInfo and Il2CppMethodDefinition, keyed by the pointer tagged with the call flag in bit 0.
+	// entries are immutable and never freed. the map owns them and is only touched under the lock,
+	// lookups go through a direct mapped cache of entry pointers that is read without lock.
+	struct MethodSignatureIdEntry
+	{
+		uintptr_t key;
+		SignatureId id;
+	};
+
+	constexpr size_t kMethodSignatureIdCacheSize = 4096;
+	static MethodSignatureIdEntry* volatile s_methodSignatureIdCache[kMethodSignatureIdCacheSize];
+	static Il2CppHashMap<uintptr_t, MethodSignatureIdEntry*, il2cpp::utils::PassThroughHash<uintptr_t>> s_methodSignatureIds;
+	static baselib::ReentrantLock s_methodSignatureIdLock;
+
 	static Il2CppHashMap<const MethodInfo*, const ReversePInvokeInfo*, il2cpp::utils::PointerHash<MethodInfo>> s_methodInfo2ReverseInfos;
 	static Il2CppHashMap<Il2CppMethodPointer, const ReversePInvokeInfo*, il2cpp::utils::PassThroughHash<Il2CppMethodPointer>> s_methodPointer2ReverseInfos;
-	static Il2CppHashMap<const char*, int32_t, CStringHash, CStringEqualTo> s_methodSig2Indexs;
+	static Il2CppHashMap<SignatureId, int32_t, SignatureIdHash> s_methodSig2Indexs;
 	static std::vector<ReversePInvokeInfo> s_reverseInfos;
 
-	static Il2CppHashMap<const char*, Managed2NativeFunctionPointerCallMethod, CStringHash, CStringEqualTo> s_managed2nativeFunctionPointers;
+	static SignatureIdTable<Managed2NativeFunctionPointerCallMethod> s_managed2nativeFunctionPointers;
 
 	static std::unordered_map<void*, bool> s_functionPointerMap;
 
@@ -70,10 +90,11 @@ namespace interpreter
 				break;
 			}
 			s_reverseInfos.push_back({ i, data.methodPointer, nullptr });
-			auto it = s_methodSig2Indexs.find(data.methodSig);
+			SignatureId sigId = ComputeSignatureId(data.methodSig);
+			auto it = s_methodSig2Indexs.find(sigId);
 			if (it == s_methodSig2Indexs.end())
 			{
-				s_methodSig2Indexs.insert({ data.methodSig, i });
+				s_methodSig2Indexs.insert({ sigId, i });
 			}
 		}
 		s_methodInfo2ReverseInfos.resize(s_reverseInfos.size() * 2);
@@ -115,7 +136,8 @@ namespace interpreter
 			return it->second->methodPointer;
 		}
 
-		auto it2 = s_methodSig2Indexs.find(sigName);
+		SignatureId sigId = ComputeSignatureId(sigName);
+		auto it2 = s_methodSig2Indexs.find(sigId);
 		if (it2 == s_methodSig2Indexs.end())
 		{
 			TEMP_FORMAT(methodSigBuf, "GetReversePInvokeWrapper fail. not find wrapper of method:%s", GetMethodNameWithSignature(method).c_str());
@@ -129,7 +151,7 @@ namespace interpreter
 			RaiseExecutionEngineException(methodSigBuf);
 		}
 
-		s_methodSig2Indexs[sigName] = wrapperIndex + 1;
+		s_methodSig2Indexs[sigId] = wrapperIndex + 1;
 
 		ReversePInvokeInfo& rpi = s_reverseInfos[wrapperIndex];
 		rpi.methodInfo = method;
@@ -137,36 +159,22 @@ namespace interpreter
 		return rpi.methodPointer;
 	}
 
-	static void InitMethodBridge()
+	template<typename StubInfo, typename MethodPointer>
+	static void BuildSignatureIdTable(const StubInfo* stubs, SignatureIdTable<MethodPointer>& table)
 	{
-		for (size_t i = 0; ; i++)
+		std::vector<std::pair<SignatureId, MethodPointer>> entries;
+		for (size_t i = 0; stubs[i].signature; i++)
 		{
-			const Managed2NativeMethodInfo& method = g_managed2nativeStub[i];
-			if (!method.signature)
-			{
-				break;
-			}
-			s_managed2natives.insert({ method.signature, method.method });
-		}
-		for (size_t i = 0; ; i++)
-		{
-			const Native2ManagedMethodInfo& method = g_native2managedStub[i];
-			if (!method.signature)
-			{
-				break;
-			}
-			s_native2manageds.insert({ method.signature, method.method });
+			entries.push_back({ ComputeSignatureId(stubs[i].signature), stubs[i].method });
 		}
+		table.Build(entries);
+	}
 
-		for (size_t i = 0; ; i++)
-		{
-			const NativeAdjustThunkMethodInfo& method = g_adjustThunkStub[i];
-			if (!method.signature)
-			{
-				break;
-			}
-			s_adjustThunks.insert({ method.signature, method.method });
-		}
+	static void InitMethodBridge()
+	{
+		BuildSignatureIdTable(g_managed2nativeStub, s_managed2natives);
+		BuildSignatureIdTable(g_native2managedStub, s_native2manageds);
+		BuildSignatureIdTable(g_adjustThunkStub, s_adjustThunks);
 		for (size_t i = 0; ; i++)
 		{
 			const FullName2Signature& nameSig = g_fullName2SignatureStub[i];
@@ -176,6 +184,7 @@ namespace interpreter
 			}
 			s_fullName2signature.insert({ nameSig.fullName, nameSig.signature });
 		}
+		std::vector<std::pair<SignatureId, Managed2NativeFunctionPointerCallMethod>> functionPointerEntries;
 		for (size_t i = 0; ; i++)
 		{
 			const Managed2NativeFunctionPointerCallData& method = g_managed2NativeFunctionPointerCallStub[i];
@@ -183,14 +192,18 @@ namespace interpreter
 			{
 				break;
 			}
-			s_managed2nativeFunctionPointers.insert({ method.methodSig, method.methodPointer });
+			functionPointerEntries.push_back({ ComputeSignatureId(method.methodSig), method.methodPointer });
 		}
+		s_managed2nativeFunctionPointers.Build(functionPointerEntries);
 	}
 
 	void InterpreterModule::Initialize()
 	{
 		InitMethodBridge();
 		InitReversePInvokeInfo();
+#if HYBRIDCLR_ENABLE_OPCODE_PROFILER
+		OpcodeProfiler::Initialize();
+#endif
 	}
 
 	void InterpreterModule::NotSupportNative2Managed()
@@ -229,31 +242,64 @@ namespace interpreter
 		il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetExecutionEngineException("NotSupportManaged2NativeFunctionMethod"));
 	}
 
+	// the signature of a method never changes, it's computed once for every method and call flag.
+	template<typename T>
+	static SignatureId GetMethodSignatureId(const T* method, bool call)
+	{
+		uintptr_t key = (uintptr_t)method | (call ? 1 : 0);
+		MethodSignatureIdEntry* volatile& cacheSlot = s_methodSignatureIdCache[(key ^ (key >> 4) ^ (key >> 16)) % kMethodSignatureIdCacheSize];
+		MethodSignatureIdEntry* entry = cacheSlot;
+		if (entry && entry->key == key)
+		{
+			return entry->id;
+		}
+		{
+			il2cpp::os::FastAutoLock lock(&s_methodSignatureIdLock);
+			auto it = s_methodSignatureIds.find(key);
+			entry = it != s_methodSignatureIds.end() ? it->second : nullptr;
+		}
+		if (!entry)
+		{
+			char sigName[kMaxSignatureNameLength];
+			ComputeSignature(method, call, sigName, sizeof(sigName) - 1);
+			SignatureId sigId = ComputeSignatureId(sigName);
+
+			il2cpp::os::FastAutoLock lock(&s_methodSignatureIdLock);
+			auto it = s_methodSignatureIds.find(key);
+			if (it != s_methodSignatureIds.end())
+			{
+				entry = it->second;
+			}
+			else
+			{
+				entry = (MethodSignatureIdEntry*)HYBRIDCLR_MALLOC(sizeof(MethodSignatureIdEntry));
+				entry->key = key;
+				entry->id = sigId;
+				s_methodSignatureIds.insert({ key, entry });
+			}
+		}
+		// the entry must be fully written before another thread can see it in the cache
+		il2cpp::os::Atomic::FullMemoryBarrier();
+		cacheSlot = entry;
+		return entry->id;
+	}
+
 	template<typename T>
 	const Managed2NativeCallMethod GetManaged2NativeMethod(const T* method, bool forceStatic)
 	{
-		char sigName[kMaxSignatureNameLength];
-		ComputeSignature(method, !forceStatic, sigName, sizeof(sigName) - 1);
-		auto it = s_managed2natives.find(sigName);
-		return it != s_managed2natives.end() ? it->second : nullptr;
+		return s_managed2natives.Find(GetMethodSignatureId(method, !forceStatic), nullptr);
 	}
 
 	template<typename T>
 	const Il2CppMethodPointer GetNative2ManagedMethod(const T* method, bool forceStatic)
 	{
-		char sigName[kMaxSignatureNameLength];
-		ComputeSignature(method, !forceStatic, sigName, sizeof(sigName) - 1);
-		auto it = s_native2manageds.find(sigName);
-		return it != s_native2manageds.end() ? it->second : InterpreterModule::NotSupportNative2Managed;
+		return s_native2manageds.Find(GetMethodSignatureId(method, !forceStatic), (Il2CppMethodPointer)InterpreterModule::NotSupportNative2Managed);
 	}
 
 	template<typename T>
 	const Il2CppMethodPointer GetNativeAdjustMethodMethod(const T* method, bool forceStatic)
 	{
-		char sigName[kMaxSignatureNameLength];
-		ComputeSignature(method, !forceStatic, sigName, sizeof(sigName) - 1);
-		auto it = s_adjustThunks.find(sigName);
-		return it != s_adjustThunks.end() ? it->second : InterpreterModule::NotSupportAdjustorThunk;
+		return s_adjustThunks.Find(GetMethodSignatureId(method, !forceStatic), (Il2CppMethodPointer)InterpreterModule::NotSupportAdjustorThunk);
 	}
 
 	static void RaiseMethodNotSupportException(const MethodInfo* method, const char* desc)
@@ -373,18 +419,14 @@ namespace interpreter
 		{
 			return Managed2NativeCallByReflectionInvoke;
 		}
-		char sigName[kMaxSignatureNameLength];
-		ComputeSignature(method, !forceStatic, sigName, sizeof(sigName) - 1);
-		auto it = s_managed2natives.find(sigName);
-		return it != s_managed2natives.end() ? it->second : Managed2NativeCallByReflectionInvoke;
+		return s_managed2natives.Find(GetMethodSignatureId(method, !forceStatic), Managed2NativeCallByReflectionInvoke);
 	}
 
 	Managed2NativeCallMethod InterpreterModule::GetManaged2NativeMethodPointer(const metadata::ResolveStandAloneMethodSig& method)
 	{
 		char sigName[kMaxSignatureNameLength];
 		ComputeSignature(method.returnType, method.params, metadata::IsPrologHasThis(method.flags), sigName, sizeof(sigName) - 1);
-		auto it = s_managed2natives.find(sigName);
-		return it != s_managed2natives.end() ? it->second : Managed2NativeCallByReflectionInvoke;
+		return s_managed2natives.Find(ComputeSignatureId(sigName), Managed2NativeCallByReflectionInvoke);
 	}
 
 	Managed2NativeFunctionPointerCallMethod InterpreterModule::GetManaged2NativeFunctionPointerMethodPointer(const MethodInfo* method, Il2CppCallConvention callConvention)
@@ -392,8 +434,7 @@ namespace interpreter
 		char sigName[kMaxSignatureNameLength];
 		sigName[0] = 'A' + callConvention;
 		ComputeSignature(method, false, sigName + 1, sizeof(sigName) - 1);
-		auto it = s_managed2nativeFunctionPointers.find(sigName);
-		return it != s_managed2nativeFunctionPointers.end() ? it->second : NotSupportManaged2NativeFunctionMethod;
+		return s_managed2nativeFunctionPointers.Find(ComputeSignatureId(sigName), NotSupportManaged2NativeFunctionMethod);
 	}
 
 	Managed2NativeFunctionPointerCallMethod InterpreterModule::GetManaged2NativeFunctionPointerMethodPointer(const metadata::ResolveStandAloneMethodSig& method)
@@ -402,8 +443,7 @@ namespace interpreter
 		char sigName[kMaxSignatureNameLength];
 		sigName[0] = 'A' + callConvention;
 		ComputeSignature(method.returnType, method.params, metadata::IsPrologHasThis(method.flags), sigName + 1, sizeof(sigName) - 1);
-		auto it = s_managed2nativeFunctionPointers.find(sigName);
-		return it != s_managed2nativeFunctionPointers.end() ? it->second : NotSupportManaged2NativeFunctionMethod;
+		return s_managed2nativeFunctionPointers.Find(ComputeSignatureId(sigName), NotSupportManaged2NativeFunctionMethod);
 	}
 
 	static void RaiseExecutionEngineExceptionMethodIsNotFound(const MethodInfo* method)
@@ -418,7 +458,11 @@ namespace interpreter
 	
 	static void InterpreterInvoke(Il2CppMethodPointer methodPointer, const MethodInfo* method, void* __this, void** __args, void* __ret)
 	{
-		InterpMethodInfo* imi = method->interpData ? (InterpMethodInfo*)method->interpData : InterpreterModule::GetInterpMethodInfo(method);
+		InterpMethodInfo* imi = (InterpMethodInfo*)method->interpData;
+		if (!IsTransformedInterpData(imi))
+		{
+			imi = InterpreterModule::GetInterpMethodInfo(method);
+		}
 		bool isInstanceMethod = metadata::IsInstanceMethod(method);
 		StackObject* args = (StackObject*)alloca(sizeof(StackObject) * imi->argStackObjectSize);
 		if (isInstanceMethod)
@@ -511,7 +555,11 @@ namespace interpreter
 	#else
 	static void* InterpreterInvoke(Il2CppMethodPointer methodPointer, const MethodInfo* method, void* __this, void** __args)
 	{
-		InterpMethodInfo* imi = method->interpData ? (InterpMethodInfo*)method->interpData : InterpreterModule::GetInterpMethodInfo(method);
+		InterpMethodInfo* imi = (InterpMethodInfo*)method->interpData;
+		if (!IsTransformedInterpData(imi))
+		{
+			imi = InterpreterModule::GetInterpMethodInfo(method);
+		}
 		StackObject* args = (StackObject*)alloca(sizeof(StackObject) * imi->argStackObjectSize);
 		bool isInstanceMethod = metadata::IsInstanceMethod(method);
 		if (isInstanceMethod)
@@ -634,20 +682,190 @@ namespace interpreter
 
 	InterpMethodInfo* InterpreterModule::GetInterpMethodInfo(const MethodInfo* methodInfo)
 	{
-		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		return GetInterpMethodInfo(methodInfo, RuntimeConfig::IsTieredExecutionEnabled() ? ExecutionTier::Baseline : ExecutionTier::Optimized);
+	}
+
+	void InterpreterModule::RequestTierUp(const MethodInfo* methodInfo)
+	{
+		transform::PreJitScheduler::ScheduleTierUp(methodInfo);
+	}
+
+	// a transform of a method, the first one or a tier up. other threads asking for the method wait for it.
+	struct PendingTransform
+	{
+		uint64_t ownerThreadId;
+		// the owner and the waiters, guarded by s_pendingTransformLock. the last one deletes it.
+		int32_t refCount;
+		// set by the owner before it releases g_MetadataLock, it never takes g_MetadataLock again until finished
+		bool translated;
+		// manual reset, set once the owner gives up the claim
+		il2cpp::os::Event finishedEvent;
 
-		if (methodInfo->interpData)
+		PendingTransform(uint64_t threadId) : ownerThreadId(threadId), refCount(1), translated(false), finishedEvent(true, false)
 		{
-			return (InterpMethodInfo*)methodInfo->interpData;
 		}
+	};
+
+	// a method is claimed by adding its PendingTransform under the lock. the first transform changes interpData to
+	// kTransformingInterpData together with it, a tier up keeps the baseline code running meanwhile. so a thread
+	// that finds kTransformingInterpData under the lock finds the PendingTransform of its owner too.
+	static baselib::ReentrantLock s_pendingTransformLock;
+	static std::unordered_map<const MethodInfo*, PendingTransform*> s_pendingTransforms;
+
+	static void ReleasePendingTransform(PendingTransform* pending)
+	{
+		il2cpp::os::FastAutoLock lock(&s_pendingTransformLock);
+		if (--pending->refCount == 0)
+		{
+			pending->~PendingTransform();
+			HYBRIDCLR_FREE(pending);
+		}
+	}
+
+	static void FinishPendingTransform(const MethodInfo* method, PendingTransform* pending)
+	{
+		{
+			il2cpp::os::FastAutoLock lock(&s_pendingTransformLock);
+			auto it = s_pendingTransforms.find(method);
+			IL2CPP_ASSERT(it != s_pendingTransforms.end() && it->second == pending);
+			s_pendingTransforms.erase(it);
+			pending->finishedEvent.Set();
+		}
+		ReleasePendingTransform(pending);
+	}
+
+	// releases the claim. a first transform resets interpData, unless the method was published meanwhile.
+	static void AbandonPendingTransform(MethodInfo* method, PendingTransform* pending, const void* expectedInterpData)
+	{
+		if (expectedInterpData == (void*)kTransformingInterpData)
+		{
+			il2cpp::os::Atomic::CompareExchangePointer<void>(&method->interpData, nullptr, (void*)kTransformingInterpData);
+		}
+		FinishPendingTransform(method, pending);
+	}
+
+	InterpMethodInfo* InterpreterModule::GetInterpMethodInfo(const MethodInfo* methodInfo, ExecutionTier tier)
+	{
 		IL2CPP_ASSERT(methodInfo->isInterpterImpl);
+		MethodInfo* method = const_cast<MethodInfo*>(methodInfo);
+		uint64_t threadId = il2cpp::os::Thread::CurrentThreadId();
+		// a thread that adds the PendingTransform of a method owns its transform, others wait for it. so a tier up runs
+		// once too, even if it's requested by several threads.
+		// the owner claims and translates the method in one hold of g_MetadataLock, image caches read by the transform
+		// are only guarded by it. optimizing, laying out and publishing run without it, so different methods are
+		// lowered by different threads in parallel.
+		// a waiter checks the claim under g_MetadataLock too, so it always finds the method translated and waiting
+		// never needs g_MetadataLock. callers may hold g_MetadataLock.
+		for (;;)
+		{
+			void* interpData = method->interpData;
+			if (IsTransformedInterpData(interpData) && ((InterpMethodInfo*)interpData)->tier >= tier)
+			{
+				return (InterpMethodInfo*)interpData;
+			}
 
-		il2cpp::vm::Class::Init(methodInfo->klass);
-		InterpMethodInfo* imi = transform::HiTransform::Transform(methodInfo);
-		il2cpp::os::Atomic::FullMemoryBarrier();
-		const_cast<MethodInfo*>(methodInfo)->interpData = imi;
-		return imi;
+			transform::HiTransform hiTransform(methodInfo, tier);
+			PendingTransform* pending;
+			bool isOwner;
+			{
+				il2cpp::os::FastAutoLock metadataLock(&il2cpp::vm::g_MetadataLock);
+				{
+					il2cpp::os::FastAutoLock lock(&s_pendingTransformLock);
+					auto it = s_pendingTransforms.find(method);
+					isOwner = it == s_pendingTransforms.end();
+					if (isOwner)
+					{
+						// the result is published only if interpData is still the baseline code or kTransformingInterpData
+						interpData = method->interpData;
+						if (IsTransformedInterpData(interpData))
+						{
+							if (((InterpMethodInfo*)interpData)->tier >= tier)
+							{
+								continue;
+							}
+						}
+						else
+						{
+							// only owners publish, nothing else changes interpData from nullptr
+							IL2CPP_ASSERT(interpData == nullptr);
+							interpData = (void*)kTransformingInterpData;
+							il2cpp::os::Atomic::ExchangePointer<void>(&method->interpData, interpData);
+						}
+						pending = new (HYBRIDCLR_MALLOC(sizeof(PendingTransform))) PendingTransform(threadId);
+						s_pendingTransforms[method] = pending;
+					}
+					else
+					{
+						pending = it->second;
+						// the owner claimed and translated in one hold of g_MetadataLock, which this thread holds now
+						IL2CPP_ASSERT(pending->ownerThreadId == threadId || pending->translated);
+						if (pending->ownerThreadId != threadId)
+						{
+							++pending->refCount;
+						}
+					}
+				}
+
+				if (isOwner)
+				{
+					try
+					{
+						il2cpp::vm::Class::Init(methodInfo->klass);
+						hiTransform.Translate();
+					}
+					catch (...)
+					{
+						AbandonPendingTransform(method, pending, interpData);
+						throw;
+					}
+					pending->translated = true;
+				}
+			}
+
+			if (!isOwner)
+			{
+				if (pending->ownerThreadId == threadId)
+				{
+					// called again by the owner while translating, e.g. by a static constructor run during the transform.
+					// waiting would never end. the baseline code of a tier up is run, otherwise the method is transformed
+					// here and the outer transform finds it published. a failure leaves the claim to the outer transform.
+					interpData = method->interpData;
+					if (IsTransformedInterpData(interpData))
+					{
+						return (InterpMethodInfo*)interpData;
+					}
+					InterpMethodInfo* imi = transform::HiTransform::Transform(methodInfo, tier, interpData);
+					if (imi)
+					{
+						return imi;
+					}
+					continue;
+				}
+				pending->finishedEvent.Wait();
+				ReleasePendingTransform(pending);
+				continue;
+			}
+
+			metadata::PublishInterpDataResult publishResult;
+			try
+			{
+				publishResult = hiTransform.Publish(interpData);
+			}
+			catch (...)
+			{
+				AbandonPendingTransform(method, pending, interpData);
+				throw;
+			}
+			// a subclass loaded meanwhile fails the publishing, the claim can't be kept while taking g_MetadataLock
+			// again, a waiter may hold it. claim and translate again.
+			// the baseline code may have been reset by ClassHierarchy while tiering up, or a first transform replaced
+			// by a nested transform of the owner, look again.
+			AbandonPendingTransform(method, pending, interpData);
+			if (publishResult == metadata::PublishInterpDataResult::Published)
+			{
+				return hiTransform.GetResult();
+			}
+		}
 	}
 }
 }
-
@@ -6,6 +6,7 @@
 #include "MethodBridge.h"
 #include "Engine.h"
 #include "../metadata/Image.h"
+#include "../transform/TemporaryMemoryArena.h"
 
 namespace hybridclr
 {
@@ -38,9 +39,16 @@ namespace interpreter
 				delete state;
 				s_machineState.SetValue(nullptr);
 			}
+			transform::TemporaryMemoryArena::FreeThreadLocalArena();
 		}
 
+		// transforms to baseline code if tiered execution is enabled
 		static InterpMethodInfo* GetInterpMethodInfo(const MethodInfo* methodInfo);
+		// transforms or tiers up the method until its code is at least of the tier
+		static InterpMethodInfo* GetInterpMethodInfo(const MethodInfo* methodInfo, ExecutionTier tier);
+		// called when countdowns of baseline code reach 0. the method is tiered up on a background thread,
+		// frames running the baseline code keep running it.
+		static void RequestTierUp(const MethodInfo* methodInfo);
 
 		static Il2CppMethodPointer GetMethodPointer(const Il2CppMethodDefinition* method);
 		static Il2CppMethodPointer GetMethodPointer(const MethodInfo* method);
@@ -13,6 +13,7 @@
 #include "vm/Thread.h"
 #include "vm/Runtime.h"
 #include "vm/Reflection.h"
+#include "os/Atomic.h"
 #include "metadata/GenericMetadata.h"
 #if HYBRIDCLR_UNITY_2020_OR_NEW
 #include "vm-utils/icalls/mscorlib/System.Threading/Interlocked.h"
@@ -28,6 +29,7 @@
 #include "MemoryUtil.h"
 #include "InterpreterModule.h"
 #include "InterpreterUtil.h"
+#include "OpcodeProfiler.h"
 #include "gc/WriteBarrier.h"
 
 using namespace hybridclr::metadata;
@@ -587,6 +589,30 @@ namespace interpreter
 	inline bool CompareCltUn(double a, double b) { return a < b; }
 	inline bool CompareCleUn(double a, double b) { return a <= b; }
 
+	// ranges are sorted and disjoint pairs of low and high value. returns index of the range containing value, -1 if none.
+	inline int32_t FindSwitchCaseRange(const int32_t* ranges, uint32_t rangeNum, int32_t value)
+	{
+		uint32_t low = 0;
+		uint32_t high = rangeNum;
+		while (low < high)
+		{
+			uint32_t mid = (low + high) / 2;
+			if (value < ranges[mid * 2])
+			{
+				high = mid;
+			}
+			else if (value > ranges[mid * 2 + 1])
+			{
+				low = mid + 1;
+			}
+			else
+			{
+				return (int32_t)mid;
+			}
+		}
+		return -1;
+	}
+
 #pragma endregion
 
 #pragma region object
@@ -655,6 +681,28 @@ namespace interpreter
 		}
 	}
 
+	inline void CheckArrayElementTypeCompatibleCached(Il2CppArray* arr, Il2CppObject* ele, ArrayStoreTypeCheckCache* cache)
+	{
+		if (!ele)
+		{
+			return;
+		}
+		Il2CppClass* arrKlass = arr->klass;
+		Il2CppClass* eleKlass = ele->klass;
+		if (eleKlass == arrKlass->element_class || (cache->arrKlass == arrKlass && cache->eleKlass == eleKlass))
+		{
+			return;
+		}
+		if (!il2cpp::vm::Class::IsAssignableFrom(arrKlass->element_class, eleKlass))
+		{
+			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetArrayTypeMismatchException());
+		}
+		if (cache->arrKlass == nullptr && il2cpp::os::Atomic::CompareExchangePointer<Il2CppClass>(&cache->arrKlass, arrKlass, nullptr) == nullptr)
+		{
+			cache->eleKlass = eleKlass;
+		}
+	}
+
 	inline MethodInfo* GET_OBJECT_VIRTUAL_METHOD(Il2CppObject* obj, const MethodInfo* method)
 	{
 		CHECK_NOT_NULL_THROW(obj);
@@ -682,6 +730,63 @@ namespace interpreter
 		return const_cast<MethodInfo*>(result);
 	}
 
+	static IL2CPP_NO_INLINE MethodInfo* GetObjectVirtualMethodCacheMiss(Il2CppObject* obj, VirtualCallInlineCache* cache)
+	{
+		Il2CppClass* klass = obj->klass;
+		if (cache->megamorphic)
+		{
+			return GET_OBJECT_VIRTUAL_METHOD(obj, cache->method);
+		}
+		for (int32_t i = 1; i < VirtualCallInlineCache::kMaxEntryCount; i++)
+		{
+			Il2CppClass* entryKlass = cache->klasses[i];
+			if (entryKlass == nullptr)
+			{
+				break;
+			}
+			if (entryKlass == klass)
+			{
+				MethodInfo* target = cache->targets[i];
+				if (target)
+				{
+					return target;
+				}
+				break;
+			}
+		}
+		MethodInfo* target = GET_OBJECT_VIRTUAL_METHOD(obj, cache->method);
+		for (int32_t i = 0; i < VirtualCallInlineCache::kMaxEntryCount; i++)
+		{
+			Il2CppClass* oldKlass = il2cpp::os::Atomic::CompareExchangePointer<Il2CppClass>(&cache->klasses[i], klass, nullptr);
+			if (oldKlass == nullptr)
+			{
+				cache->targets[i] = target;
+				return target;
+			}
+			if (oldKlass == klass)
+			{
+				// filled by another thread
+				return target;
+			}
+		}
+		cache->megamorphic = 1;
+		return target;
+	}
+
+	inline MethodInfo* GET_OBJECT_VIRTUAL_METHOD_CACHED(Il2CppObject* obj, VirtualCallInlineCache* cache)
+	{
+		CHECK_NOT_NULL_THROW(obj);
+		if (cache->klasses[0] == obj->klass)
+		{
+			MethodInfo* target = cache->targets[0];
+			if (target)
+			{
+				return target;
+			}
+		}
+		return GetObjectVirtualMethodCacheMiss(obj, cache);
+	}
+
 #define GET_OBJECT_INTERFACE_METHOD(obj, intfKlass, slot) (MethodInfo*)nullptr
 
 	inline void* HiUnbox(Il2CppObject* obj, Il2CppClass* klass)
@@ -1265,16 +1370,20 @@ namespace interpreter
 }
 
 #define LOAD_PREV_FRAME() { \
-	imi = (const InterpMethodInfo*)frame->method->interpData; \
+	imi = frame->imi; \
 	ip = frame->ip; \
 	ipBase = imi->codes; \
 	localVarBase = frame->stackBasePtr; \
 }
 
 #define PREPARE_NEW_FRAME_FROM_NATIVE(newMethodInfo, argBasePtr, retPtr) { \
-	imi = newMethodInfo->interpData ? (InterpMethodInfo*)newMethodInfo->interpData : InterpreterModule::GetInterpMethodInfo(newMethodInfo); \
+	imi = (InterpMethodInfo*)newMethodInfo->interpData; \
+	if (!IsTransformedInterpData(imi)) \
+	{ \
+		imi = InterpreterModule::GetInterpMethodInfo(newMethodInfo); \
+	} \
 	RuntimeInitClassCCtorWithoutInitClass(newMethodInfo); \
-	frame = interpFrameGroup.EnterFrameFromNative(newMethodInfo, argBasePtr); \
+	frame = interpFrameGroup.EnterFrameFromNative(newMethodInfo, imi, argBasePtr); \
 	frame->ret = retPtr; \
 	ip = ipBase = imi->codes; \
 	frame->ip = (byte*)ip; \
@@ -1282,9 +1391,13 @@ namespace interpreter
 }
 
 #define PREPARE_NEW_FRAME_FROM_INTERPRETER(newMethodInfo, argBasePtr, retPtr) { \
-	imi = newMethodInfo->interpData ? (InterpMethodInfo*)newMethodInfo->interpData : InterpreterModule::GetInterpMethodInfo(newMethodInfo); \
+	imi = (InterpMethodInfo*)newMethodInfo->interpData; \
+	if (!IsTransformedInterpData(imi)) \
+	{ \
+		imi = InterpreterModule::GetInterpMethodInfo(newMethodInfo); \
+	} \
 	RuntimeInitClassCCtorWithoutInitClass(newMethodInfo); \
-	frame = interpFrameGroup.EnterFrameFromInterpreter(newMethodInfo, argBasePtr); \
+	frame = interpFrameGroup.EnterFrameFromInterpreter(newMethodInfo, imi, argBasePtr); \
 	frame->ret = retPtr; \
 	ip = ipBase = imi->codes; \
 	frame->ip = (byte*)ip; \
@@ -1662,8 +1775,44 @@ else \
 
 #pragma endregion 
 
+#pragma region dispatch
+
+#if HYBRIDCLR_ENABLE_COMPUTED_GOTO_DISPATCH
+	// every handler ends with its own indirect jump instead of sharing the one of the switch,
+	// so the branch predictor can learn the opcode that usually follows each opcode.
+#define HI_OPCODE_CASE(op) case HiOpcodeEnum::op: HI_LABEL_##op:
+#define HI_DISPATCH_NEXT() goto *s_dispatchTable[(uint16_t)*(HiOpcodeEnum*)ip]
+#else
+#define HI_OPCODE_CASE(op) case HiOpcodeEnum::op:
+#define HI_DISPATCH_NEXT() continue
+#endif
+
+#pragma endregion
+
+#pragma region quicken
+
+	// once the cctor has finished, rewrite the current instruction to its variant without class init check.
+	// only the opcode is rewritten and both variants read the same operands, so other threads running
+	// the same instruction see either the old or the new variant, and both are correct.
+#define QUICKEN_AFTER_CCTOR_FINISH(klass, quickenedOp) { \
+	if (IS_CCTOR_FINISH_OR_NO_CCTOR(klass)) \
+	{ \
+		*(volatile HiOpcodeEnum*)ip = HiOpcodeEnum::quickenedOp; \
+	} \
+}
+
+#pragma endregion
+
 const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
+	static const OsrEntry* FindOsrEntry(const InterpMethodInfo* imi, uint32_t ilOffset)
+	{
+		const OsrEntry* end = imi->osrEntries + imi->osrEntryCount;
+		const OsrEntry* entry = std::lower_bound(imi->osrEntries, end, ilOffset,
+			[](const OsrEntry& e, uint32_t offset) { return e.ilOffset < offset; });
+		return entry != end && entry->ilOffset == ilOffset ? entry : nullptr;
+	}
+
 	void Interpreter::Execute(const MethodInfo* methodInfo, StackObject* args, void* ret)
 	{
 		MachineState& machine = InterpreterModule::GetCurrentThreadMachineState();
@@ -1677,6 +1826,1037 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
 		Il2CppException* lastUnwindException;
 		StackObject* tempRet = nullptr;
+#if HYBRIDCLR_ENABLE_OPCODE_PROFILER
+		HiOpcodeEnum prevOpcode = HiOpcodeEnum::None;
+#endif
+
+#if HYBRIDCLR_ENABLE_COMPUTED_GOTO_DISPATCH
+		// indexed by HiOpcodeEnum, must be kept in the same order as the enum.
+		static void* const s_dispatchTable[] =
+		{
+			//!!!{{DISPATCH_TABLE
+			&&HI_LABEL_None,
+			&&HI_LABEL_InitLocals_n_2,
+			&&HI_LABEL_InitLocals_n_4,
+			&&HI_LABEL_InitLocals_size_8,
+			&&HI_LABEL_InitLocals_size_16,
+			&&HI_LABEL_InitLocals_size_24,
+			&&HI_LABEL_InitLocals_size_32,
+			&&HI_LABEL_InitInlineLocals_n_2,
+			&&HI_LABEL_InitInlineLocals_n_4,
+			&&HI_LABEL_InitInlineLocals_size_8,
+			&&HI_LABEL_InitInlineLocals_size_16,
+			&&HI_LABEL_InitInlineLocals_size_24,
+			&&HI_LABEL_InitInlineLocals_size_32,
+			&&HI_LABEL_LdlocVarVar,
+			&&HI_LABEL_LdlocExpandVarVar_i1,
+			&&HI_LABEL_LdlocExpandVarVar_u1,
+			&&HI_LABEL_LdlocExpandVarVar_i2,
+			&&HI_LABEL_LdlocExpandVarVar_u2,
+			&&HI_LABEL_LdlocVarVarSize,
+			&&HI_LABEL_LdlocVarAddress,
+			&&HI_LABEL_LdcVarConst_1,
+			&&HI_LABEL_LdcVarConst_2,
+			&&HI_LABEL_LdcVarConst_4,
+			&&HI_LABEL_LdcVarConst_8,
+			&&HI_LABEL_LdnullVar,
+			&&HI_LABEL_LdindVarVar_i1,
+			&&HI_LABEL_LdindVarVar_u1,
+			&&HI_LABEL_LdindVarVar_i2,
+			&&HI_LABEL_LdindVarVar_u2,
+			&&HI_LABEL_LdindVarVar_i4,
+			&&HI_LABEL_LdindVarVar_u4,
+			&&HI_LABEL_LdindVarVar_i8,
+			&&HI_LABEL_LdindVarVar_f4,
+			&&HI_LABEL_LdindVarVar_f8,
+			&&HI_LABEL_StindVarVar_i1,
+			&&HI_LABEL_StindVarVar_i2,
+			&&HI_LABEL_StindVarVar_i4,
+			&&HI_LABEL_StindVarVar_i8,
+			&&HI_LABEL_StindVarVar_f4,
+			&&HI_LABEL_StindVarVar_f8,
+			&&HI_LABEL_StindVarVar_ref,
+			&&HI_LABEL_LocalAllocVarVar_n_2,
+			&&HI_LABEL_LocalAllocVarVar_n_4,
+			&&HI_LABEL_InitblkVarVarVar,
+			&&HI_LABEL_CpblkVarVar,
+			&&HI_LABEL_MemoryBarrier,
+			&&HI_LABEL_ConvertVarVar_i4_i1,
+			&&HI_LABEL_ConvertVarVar_i4_u1,
+			&&HI_LABEL_ConvertVarVar_i4_i2,
+			&&HI_LABEL_ConvertVarVar_i4_u2,
+			&&HI_LABEL_ConvertVarVar_i4_i4,
+			&&HI_LABEL_ConvertVarVar_i4_u4,
+			&&HI_LABEL_ConvertVarVar_i4_i8,
+			&&HI_LABEL_ConvertVarVar_i4_u8,
+			&&HI_LABEL_ConvertVarVar_i4_f4,
+			&&HI_LABEL_ConvertVarVar_i4_f8,
+			&&HI_LABEL_ConvertVarVar_u4_i1,
+			&&HI_LABEL_ConvertVarVar_u4_u1,
+			&&HI_LABEL_ConvertVarVar_u4_i2,
+			&&HI_LABEL_ConvertVarVar_u4_u2,
+			&&HI_LABEL_ConvertVarVar_u4_i4,
+			&&HI_LABEL_ConvertVarVar_u4_u4,
+			&&HI_LABEL_ConvertVarVar_u4_i8,
+			&&HI_LABEL_ConvertVarVar_u4_u8,
+			&&HI_LABEL_ConvertVarVar_u4_f4,
+			&&HI_LABEL_ConvertVarVar_u4_f8,
+			&&HI_LABEL_ConvertVarVar_i8_i1,
+			&&HI_LABEL_ConvertVarVar_i8_u1,
+			&&HI_LABEL_ConvertVarVar_i8_i2,
+			&&HI_LABEL_ConvertVarVar_i8_u2,
+			&&HI_LABEL_ConvertVarVar_i8_i4,
+			&&HI_LABEL_ConvertVarVar_i8_u4,
+			&&HI_LABEL_ConvertVarVar_i8_i8,
+			&&HI_LABEL_ConvertVarVar_i8_u8,
+			&&HI_LABEL_ConvertVarVar_i8_f4,
+			&&HI_LABEL_ConvertVarVar_i8_f8,
+			&&HI_LABEL_ConvertVarVar_u8_i1,
+			&&HI_LABEL_ConvertVarVar_u8_u1,
+			&&HI_LABEL_ConvertVarVar_u8_i2,
+			&&HI_LABEL_ConvertVarVar_u8_u2,
+			&&HI_LABEL_ConvertVarVar_u8_i4,
+			&&HI_LABEL_ConvertVarVar_u8_u4,
+			&&HI_LABEL_ConvertVarVar_u8_i8,
+			&&HI_LABEL_ConvertVarVar_u8_u8,
+			&&HI_LABEL_ConvertVarVar_u8_f4,
+			&&HI_LABEL_ConvertVarVar_u8_f8,
+			&&HI_LABEL_ConvertVarVar_f4_i1,
+			&&HI_LABEL_ConvertVarVar_f4_u1,
+			&&HI_LABEL_ConvertVarVar_f4_i2,
+			&&HI_LABEL_ConvertVarVar_f4_u2,
+			&&HI_LABEL_ConvertVarVar_f4_i4,
+			&&HI_LABEL_ConvertVarVar_f4_u4,
+			&&HI_LABEL_ConvertVarVar_f4_i8,
+			&&HI_LABEL_ConvertVarVar_f4_u8,
+			&&HI_LABEL_ConvertVarVar_f4_f4,
+			&&HI_LABEL_ConvertVarVar_f4_f8,
+			&&HI_LABEL_ConvertVarVar_f8_i1,
+			&&HI_LABEL_ConvertVarVar_f8_u1,
+			&&HI_LABEL_ConvertVarVar_f8_i2,
+			&&HI_LABEL_ConvertVarVar_f8_u2,
+			&&HI_LABEL_ConvertVarVar_f8_i4,
+			&&HI_LABEL_ConvertVarVar_f8_u4,
+			&&HI_LABEL_ConvertVarVar_f8_i8,
+			&&HI_LABEL_ConvertVarVar_f8_u8,
+			&&HI_LABEL_ConvertVarVar_f8_f4,
+			&&HI_LABEL_ConvertVarVar_f8_f8,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_i1,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_u1,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_i2,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_u2,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_i4,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_u4,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_i8,
+			&&HI_LABEL_ConvertOverflowVarVar_i4_u8,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_i1,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_u1,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_i2,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_u2,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_i4,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_u4,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_i8,
+			&&HI_LABEL_ConvertOverflowVarVar_u4_u8,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_i1,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_u1,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_i2,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_u2,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_i4,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_u4,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_i8,
+			&&HI_LABEL_ConvertOverflowVarVar_i8_u8,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_i1,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_u1,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_i2,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_u2,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_i4,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_u4,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_i8,
+			&&HI_LABEL_ConvertOverflowVarVar_u8_u8,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_i1,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_u1,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_i2,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_u2,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_i4,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_u4,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_i8,
+			&&HI_LABEL_ConvertOverflowVarVar_f4_u8,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_i1,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_u1,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_i2,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_u2,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_i4,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_u4,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_i8,
+			&&HI_LABEL_ConvertOverflowVarVar_f8_u8,
+			&&HI_LABEL_BinOpVarVarVar_Add_i4,
+			&&HI_LABEL_BinOpVarVarVar_Sub_i4,
+			&&HI_LABEL_BinOpVarVarVar_Mul_i4,
+			&&HI_LABEL_BinOpVarVarVar_MulUn_i4,
+			&&HI_LABEL_BinOpVarVarVar_Div_i4,
+			&&HI_LABEL_BinOpVarVarVar_DivUn_i4,
+			&&HI_LABEL_BinOpVarVarVar_Rem_i4,
+			&&HI_LABEL_BinOpVarVarVar_RemUn_i4,
+			&&HI_LABEL_BinOpVarVarVar_And_i4,
+			&&HI_LABEL_BinOpVarVarVar_Or_i4,
+			&&HI_LABEL_BinOpVarVarVar_Xor_i4,
+			&&HI_LABEL_BinOpVarVarVar_Add_i8,
+			&&HI_LABEL_BinOpVarVarVar_Sub_i8,
+			&&HI_LABEL_BinOpVarVarVar_Mul_i8,
+			&&HI_LABEL_BinOpVarVarVar_MulUn_i8,
+			&&HI_LABEL_BinOpVarVarVar_Div_i8,
+			&&HI_LABEL_BinOpVarVarVar_DivUn_i8,
+			&&HI_LABEL_BinOpVarVarVar_Rem_i8,
+			&&HI_LABEL_BinOpVarVarVar_RemUn_i8,
+			&&HI_LABEL_BinOpVarVarVar_And_i8,
+			&&HI_LABEL_BinOpVarVarVar_Or_i8,
+			&&HI_LABEL_BinOpVarVarVar_Xor_i8,
+			&&HI_LABEL_BinOpVarVarVar_Add_f4,
+			&&HI_LABEL_BinOpVarVarVar_Sub_f4,
+			&&HI_LABEL_BinOpVarVarVar_Mul_f4,
+			&&HI_LABEL_BinOpVarVarVar_Div_f4,
+			&&HI_LABEL_BinOpVarVarVar_Rem_f4,
+			&&HI_LABEL_BinOpVarVarVar_Add_f8,
+			&&HI_LABEL_BinOpVarVarVar_Sub_f8,
+			&&HI_LABEL_BinOpVarVarVar_Mul_f8,
+			&&HI_LABEL_BinOpVarVarVar_Div_f8,
+			&&HI_LABEL_BinOpVarVarVar_Rem_f8,
+			&&HI_LABEL_BinOpVarVarConst_Add_i4,
+			&&HI_LABEL_BinOpVarVarConst_Sub_i4,
+			&&HI_LABEL_BinOpVarVarConst_Mul_i4,
+			&&HI_LABEL_BinOpVarVarConst_And_i4,
+			&&HI_LABEL_BinOpVarVarConst_Or_i4,
+			&&HI_LABEL_BinOpVarVarConst_Xor_i4,
+			&&HI_LABEL_BinOpVarVarConst_Add_i8,
+			&&HI_LABEL_BinOpVarVarConst_Sub_i8,
+			&&HI_LABEL_BinOpVarVarConst_Mul_i8,
+			&&HI_LABEL_BinOpVarVarConst_And_i8,
+			&&HI_LABEL_BinOpVarVarConst_Or_i8,
+			&&HI_LABEL_BinOpVarVarConst_Xor_i8,
+			&&HI_LABEL_BinOpVarVarConst_Add_f4,
+			&&HI_LABEL_BinOpVarVarConst_Sub_f4,
+			&&HI_LABEL_BinOpVarVarConst_Mul_f4,
+			&&HI_LABEL_BinOpVarVarConst_Add_f8,
+			&&HI_LABEL_BinOpVarVarConst_Sub_f8,
+			&&HI_LABEL_BinOpVarVarConst_Mul_f8,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Add_i4,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Sub_i4,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Mul_i4,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Add_i8,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Sub_i8,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Mul_i8,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Add_u4,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Sub_u4,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Mul_u4,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Add_u8,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Sub_u8,
+			&&HI_LABEL_BinOpOverflowVarVarVar_Mul_u8,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shl_i4_i4,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shr_i4_i4,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_ShrUn_i4_i4,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shl_i4_i8,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shr_i4_i8,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_ShrUn_i4_i8,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shl_i8_i4,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shr_i8_i4,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_ShrUn_i8_i4,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shl_i8_i8,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_Shr_i8_i8,
+			&&HI_LABEL_BitShiftBinOpVarVarVar_ShrUn_i8_i8,
+			&&HI_LABEL_UnaryOpVarVar_Neg_i4,
+			&&HI_LABEL_UnaryOpVarVar_Not_i4,
+			&&HI_LABEL_UnaryOpVarVar_Neg_i8,
+			&&HI_LABEL_UnaryOpVarVar_Not_i8,
+			&&HI_LABEL_UnaryOpVarVar_Neg_f4,
+			&&HI_LABEL_UnaryOpVarVar_Neg_f8,
+			&&HI_LABEL_CheckFiniteVar_f4,
+			&&HI_LABEL_CheckFiniteVar_f8,
+			&&HI_LABEL_CompOpVarVarVar_Ceq_i4,
+			&&HI_LABEL_CompOpVarVarVar_Ceq_i8,
+			&&HI_LABEL_CompOpVarVarVar_Ceq_f4,
+			&&HI_LABEL_CompOpVarVarVar_Ceq_f8,
+			&&HI_LABEL_CompOpVarVarVar_Cgt_i4,
+			&&HI_LABEL_CompOpVarVarVar_Cgt_i8,
+			&&HI_LABEL_CompOpVarVarVar_Cgt_f4,
+			&&HI_LABEL_CompOpVarVarVar_Cgt_f8,
+			&&HI_LABEL_CompOpVarVarVar_CgtUn_i4,
+			&&HI_LABEL_CompOpVarVarVar_CgtUn_i8,
+			&&HI_LABEL_CompOpVarVarVar_CgtUn_f4,
+			&&HI_LABEL_CompOpVarVarVar_CgtUn_f8,
+			&&HI_LABEL_CompOpVarVarVar_Clt_i4,
+			&&HI_LABEL_CompOpVarVarVar_Clt_i8,
+			&&HI_LABEL_CompOpVarVarVar_Clt_f4,
+			&&HI_LABEL_CompOpVarVarVar_Clt_f8,
+			&&HI_LABEL_CompOpVarVarVar_CltUn_i4,
+			&&HI_LABEL_CompOpVarVarVar_CltUn_i8,
+			&&HI_LABEL_CompOpVarVarVar_CltUn_f4,
+			&&HI_LABEL_CompOpVarVarVar_CltUn_f8,
+			&&HI_LABEL_CompOpVarVarConst_Ceq_i4,
+			&&HI_LABEL_CompOpVarVarConst_Ceq_i8,
+			&&HI_LABEL_CompOpVarVarConst_Ceq_f4,
+			&&HI_LABEL_CompOpVarVarConst_Ceq_f8,
+			&&HI_LABEL_CompOpVarVarConst_Cgt_i4,
+			&&HI_LABEL_CompOpVarVarConst_Cgt_i8,
+			&&HI_LABEL_CompOpVarVarConst_Cgt_f4,
+			&&HI_LABEL_CompOpVarVarConst_Cgt_f8,
+			&&HI_LABEL_CompOpVarVarConst_CgtUn_i4,
+			&&HI_LABEL_CompOpVarVarConst_CgtUn_i8,
+			&&HI_LABEL_CompOpVarVarConst_CgtUn_f4,
+			&&HI_LABEL_CompOpVarVarConst_CgtUn_f8,
+			&&HI_LABEL_CompOpVarVarConst_Clt_i4,
+			&&HI_LABEL_CompOpVarVarConst_Clt_i8,
+			&&HI_LABEL_CompOpVarVarConst_Clt_f4,
+			&&HI_LABEL_CompOpVarVarConst_Clt_f8,
+			&&HI_LABEL_CompOpVarVarConst_CltUn_i4,
+			&&HI_LABEL_CompOpVarVarConst_CltUn_i8,
+			&&HI_LABEL_CompOpVarVarConst_CltUn_f4,
+			&&HI_LABEL_CompOpVarVarConst_CltUn_f8,
+			&&HI_LABEL_BranchUncondition_4,
+			&&HI_LABEL_BranchTrueVar_i4,
+			&&HI_LABEL_BranchTrueVar_i8,
+			&&HI_LABEL_BranchFalseVar_i4,
+			&&HI_LABEL_BranchFalseVar_i8,
+			&&HI_LABEL_BranchVarVar_Ceq_i4,
+			&&HI_LABEL_BranchVarVar_Ceq_i8,
+			&&HI_LABEL_BranchVarVar_Ceq_f4,
+			&&HI_LABEL_BranchVarVar_Ceq_f8,
+			&&HI_LABEL_BranchVarVar_CneUn_i4,
+			&&HI_LABEL_BranchVarVar_CneUn_i8,
+			&&HI_LABEL_BranchVarVar_CneUn_f4,
+			&&HI_LABEL_BranchVarVar_CneUn_f8,
+			&&HI_LABEL_BranchVarVar_Cgt_i4,
+			&&HI_LABEL_BranchVarVar_Cgt_i8,
+			&&HI_LABEL_BranchVarVar_Cgt_f4,
+			&&HI_LABEL_BranchVarVar_Cgt_f8,
+			&&HI_LABEL_BranchVarVar_CgtUn_i4,
+			&&HI_LABEL_BranchVarVar_CgtUn_i8,
+			&&HI_LABEL_BranchVarVar_CgtUn_f4,
+			&&HI_LABEL_BranchVarVar_CgtUn_f8,
+			&&HI_LABEL_BranchVarVar_Cge_i4,
+			&&HI_LABEL_BranchVarVar_Cge_i8,
+			&&HI_LABEL_BranchVarVar_Cge_f4,
+			&&HI_LABEL_BranchVarVar_Cge_f8,
+			&&HI_LABEL_BranchVarVar_CgeUn_i4,
+			&&HI_LABEL_BranchVarVar_CgeUn_i8,
+			&&HI_LABEL_BranchVarVar_CgeUn_f4,
+			&&HI_LABEL_BranchVarVar_CgeUn_f8,
+			&&HI_LABEL_BranchVarVar_Clt_i4,
+			&&HI_LABEL_BranchVarVar_Clt_i8,
+			&&HI_LABEL_BranchVarVar_Clt_f4,
+			&&HI_LABEL_BranchVarVar_Clt_f8,
+			&&HI_LABEL_BranchVarVar_CltUn_i4,
+			&&HI_LABEL_BranchVarVar_CltUn_i8,
+			&&HI_LABEL_BranchVarVar_CltUn_f4,
+			&&HI_LABEL_BranchVarVar_CltUn_f8,
+			&&HI_LABEL_BranchVarVar_Cle_i4,
+			&&HI_LABEL_BranchVarVar_Cle_i8,
+			&&HI_LABEL_BranchVarVar_Cle_f4,
+			&&HI_LABEL_BranchVarVar_Cle_f8,
+			&&HI_LABEL_BranchVarVar_CleUn_i4,
+			&&HI_LABEL_BranchVarVar_CleUn_i8,
+			&&HI_LABEL_BranchVarVar_CleUn_f4,
+			&&HI_LABEL_BranchVarVar_CleUn_f8,
+			&&HI_LABEL_BranchVarConst_Ceq_i4,
+			&&HI_LABEL_BranchVarConst_Ceq_i8,
+			&&HI_LABEL_BranchVarConst_Ceq_f4,
+			&&HI_LABEL_BranchVarConst_Ceq_f8,
+			&&HI_LABEL_BranchVarConst_CneUn_i4,
+			&&HI_LABEL_BranchVarConst_CneUn_i8,
+			&&HI_LABEL_BranchVarConst_CneUn_f4,
+			&&HI_LABEL_BranchVarConst_CneUn_f8,
+			&&HI_LABEL_BranchVarConst_Cgt_i4,
+			&&HI_LABEL_BranchVarConst_Cgt_i8,
+			&&HI_LABEL_BranchVarConst_Cgt_f4,
+			&&HI_LABEL_BranchVarConst_Cgt_f8,
+			&&HI_LABEL_BranchVarConst_CgtUn_i4,
+			&&HI_LABEL_BranchVarConst_CgtUn_i8,
+			&&HI_LABEL_BranchVarConst_CgtUn_f4,
+			&&HI_LABEL_BranchVarConst_CgtUn_f8,
+			&&HI_LABEL_BranchVarConst_Cge_i4,
+			&&HI_LABEL_BranchVarConst_Cge_i8,
+			&&HI_LABEL_BranchVarConst_Cge_f4,
+			&&HI_LABEL_BranchVarConst_Cge_f8,
+			&&HI_LABEL_BranchVarConst_CgeUn_i4,
+			&&HI_LABEL_BranchVarConst_CgeUn_i8,
+			&&HI_LABEL_BranchVarConst_CgeUn_f4,
+			&&HI_LABEL_BranchVarConst_CgeUn_f8,
+			&&HI_LABEL_BranchVarConst_Clt_i4,
+			&&HI_LABEL_BranchVarConst_Clt_i8,
+			&&HI_LABEL_BranchVarConst_Clt_f4,
+			&&HI_LABEL_BranchVarConst_Clt_f8,
+			&&HI_LABEL_BranchVarConst_CltUn_i4,
+			&&HI_LABEL_BranchVarConst_CltUn_i8,
+			&&HI_LABEL_BranchVarConst_CltUn_f4,
+			&&HI_LABEL_BranchVarConst_CltUn_f8,
+			&&HI_LABEL_BranchVarConst_Cle_i4,
+			&&HI_LABEL_BranchVarConst_Cle_i8,
+			&&HI_LABEL_BranchVarConst_Cle_f4,
+			&&HI_LABEL_BranchVarConst_Cle_f8,
+			&&HI_LABEL_BranchVarConst_CleUn_i4,
+			&&HI_LABEL_BranchVarConst_CleUn_i8,
+			&&HI_LABEL_BranchVarConst_CleUn_f4,
+			&&HI_LABEL_BranchVarConst_CleUn_f8,
+			&&HI_LABEL_BranchJump,
+			&&HI_LABEL_BranchSwitch,
+			&&HI_LABEL_BranchSwitchBinarySearch,
+			&&HI_LABEL_BranchClassNotEqualVar,
+			&&HI_LABEL_LoopHeader,
+			&&HI_LABEL_NewClassVar,
+			&&HI_LABEL_NewClassVar_Ctor_0,
+			&&HI_LABEL_NewClassVar_NotCtor,
+			&&HI_LABEL_NewValueTypeVar,
+			&&HI_LABEL_NewValueTypeVar_Ctor_0,
+			&&HI_LABEL_NewClassInterpVar,
+			&&HI_LABEL_NewClassInterpVar_Ctor_0,
+			&&HI_LABEL_NewValueTypeInterpVar,
+			&&HI_LABEL_AdjustValueTypeRefVar,
+			&&HI_LABEL_BoxRefVarVar,
+			&&HI_LABEL_LdvirftnVarVar,
+			&&HI_LABEL_RetVar_ret_1,
+			&&HI_LABEL_RetVar_ret_2,
+			&&HI_LABEL_RetVar_ret_4,
+			&&HI_LABEL_RetVar_ret_8,
+			&&HI_LABEL_RetVar_ret_12,
+			&&HI_LABEL_RetVar_ret_16,
+			&&HI_LABEL_RetVar_ret_20,
+			&&HI_LABEL_RetVar_ret_24,
+			&&HI_LABEL_RetVar_ret_28,
+			&&HI_LABEL_RetVar_ret_32,
+			&&HI_LABEL_RetVar_ret_n,
+			&&HI_LABEL_RetVar_void,
+			&&HI_LABEL_CallNativeInstance_void,
+			&&HI_LABEL_CallNativeInstance_ret,
+			&&HI_LABEL_CallNativeInstance_ret_expand,
+			&&HI_LABEL_CallNativeStatic_void,
+			&&HI_LABEL_CallNativeStatic_ret,
+			&&HI_LABEL_CallNativeStatic_ret_expand,
+			&&HI_LABEL_CallInterp_void,
+			&&HI_LABEL_CallInterp_ret,
+			&&HI_LABEL_CallVirtual_void,
+			&&HI_LABEL_CallVirtual_ret,
+			&&HI_LABEL_CallVirtual_ret_expand,
+			&&HI_LABEL_CallInterpVirtual_void,
+			&&HI_LABEL_CallInterpVirtual_ret,
+			&&HI_LABEL_CallInd_void,
+			&&HI_LABEL_CallInd_ret,
+			&&HI_LABEL_CallInd_ret_expand,
+			&&HI_LABEL_CallPInvoke_void,
+			&&HI_LABEL_CallPInvoke_ret,
+			&&HI_LABEL_CallPInvoke_ret_expand,
+			&&HI_LABEL_CallDelegateInvoke_void,
+			&&HI_LABEL_CallDelegateInvoke_ret,
+			&&HI_LABEL_CallDelegateInvoke_ret_expand,
+			&&HI_LABEL_CallDelegateBeginInvoke,
+			&&HI_LABEL_CallDelegateEndInvoke_void,
+			&&HI_LABEL_CallDelegateEndInvoke_ret,
+			&&HI_LABEL_NewDelegate,
+			&&HI_LABEL_CtorDelegate,
+			&&HI_LABEL_CallCommonNativeInstance_v_0,
+			&&HI_LABEL_CallCommonNativeInstance_i1_0,
+			&&HI_LABEL_CallCommonNativeInstance_u1_0,
+			&&HI_LABEL_CallCommonNativeInstance_i2_0,
+			&&HI_LABEL_CallCommonNativeInstance_u2_0,
+			&&HI_LABEL_CallCommonNativeInstance_i4_0,
+			&&HI_LABEL_CallCommonNativeInstance_i8_0,
+			&&HI_LABEL_CallCommonNativeInstance_f4_0,
+			&&HI_LABEL_CallCommonNativeInstance_f8_0,
+			&&HI_LABEL_CallCommonNativeInstance_v_i4_1,
+			&&HI_LABEL_CallCommonNativeInstance_v_i4_2,
+			&&HI_LABEL_CallCommonNativeInstance_v_i4_3,
+			&&HI_LABEL_CallCommonNativeInstance_v_i4_4,
+			&&HI_LABEL_CallCommonNativeInstance_v_i8_1,
+			&&HI_LABEL_CallCommonNativeInstance_v_i8_2,
+			&&HI_LABEL_CallCommonNativeInstance_v_i8_3,
+			&&HI_LABEL_CallCommonNativeInstance_v_i8_4,
+			&&HI_LABEL_CallCommonNativeInstance_v_f4_1,
+			&&HI_LABEL_CallCommonNativeInstance_v_f4_2,
+			&&HI_LABEL_CallCommonNativeInstance_v_f4_3,
+			&&HI_LABEL_CallCommonNativeInstance_v_f4_4,
+			&&HI_LABEL_CallCommonNativeInstance_v_f8_1,
+			&&HI_LABEL_CallCommonNativeInstance_v_f8_2,
+			&&HI_LABEL_CallCommonNativeInstance_v_f8_3,
+			&&HI_LABEL_CallCommonNativeInstance_v_f8_4,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i4_1,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i4_2,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i4_3,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i4_4,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i8_1,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i8_2,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i8_3,
+			&&HI_LABEL_CallCommonNativeInstance_u1_i8_4,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f4_1,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f4_2,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f4_3,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f4_4,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f8_1,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f8_2,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f8_3,
+			&&HI_LABEL_CallCommonNativeInstance_u1_f8_4,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i4_1,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i4_2,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i4_3,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i4_4,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i8_1,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i8_2,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i8_3,
+			&&HI_LABEL_CallCommonNativeInstance_i4_i8_4,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f4_1,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f4_2,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f4_3,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f4_4,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f8_1,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f8_2,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f8_3,
+			&&HI_LABEL_CallCommonNativeInstance_i4_f8_4,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i4_1,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i4_2,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i4_3,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i4_4,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i8_1,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i8_2,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i8_3,
+			&&HI_LABEL_CallCommonNativeInstance_i8_i8_4,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f4_1,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f4_2,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f4_3,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f4_4,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f8_1,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f8_2,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f8_3,
+			&&HI_LABEL_CallCommonNativeInstance_i8_f8_4,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i4_1,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i4_2,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i4_3,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i4_4,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i8_1,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i8_2,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i8_3,
+			&&HI_LABEL_CallCommonNativeInstance_f4_i8_4,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f4_1,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f4_2,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f4_3,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f4_4,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f8_1,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f8_2,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f8_3,
+			&&HI_LABEL_CallCommonNativeInstance_f4_f8_4,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i4_1,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i4_2,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i4_3,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i4_4,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i8_1,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i8_2,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i8_3,
+			&&HI_LABEL_CallCommonNativeInstance_f8_i8_4,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f4_1,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f4_2,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f4_3,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f4_4,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f8_1,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f8_2,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f8_3,
+			&&HI_LABEL_CallCommonNativeInstance_f8_f8_4,
+			&&HI_LABEL_CallCommonNativeStatic_v_0,
+			&&HI_LABEL_CallCommonNativeStatic_i1_0,
+			&&HI_LABEL_CallCommonNativeStatic_u1_0,
+			&&HI_LABEL_CallCommonNativeStatic_i2_0,
+			&&HI_LABEL_CallCommonNativeStatic_u2_0,
+			&&HI_LABEL_CallCommonNativeStatic_i4_0,
+			&&HI_LABEL_CallCommonNativeStatic_i8_0,
+			&&HI_LABEL_CallCommonNativeStatic_f4_0,
+			&&HI_LABEL_CallCommonNativeStatic_f8_0,
+			&&HI_LABEL_CallCommonNativeStatic_v_i4_1,
+			&&HI_LABEL_CallCommonNativeStatic_v_i4_2,
+			&&HI_LABEL_CallCommonNativeStatic_v_i4_3,
+			&&HI_LABEL_CallCommonNativeStatic_v_i4_4,
+			&&HI_LABEL_CallCommonNativeStatic_v_i8_1,
+			&&HI_LABEL_CallCommonNativeStatic_v_i8_2,
+			&&HI_LABEL_CallCommonNativeStatic_v_i8_3,
+			&&HI_LABEL_CallCommonNativeStatic_v_i8_4,
+			&&HI_LABEL_CallCommonNativeStatic_v_f4_1,
+			&&HI_LABEL_CallCommonNativeStatic_v_f4_2,
+			&&HI_LABEL_CallCommonNativeStatic_v_f4_3,
+			&&HI_LABEL_CallCommonNativeStatic_v_f4_4,
+			&&HI_LABEL_CallCommonNativeStatic_v_f8_1,
+			&&HI_LABEL_CallCommonNativeStatic_v_f8_2,
+			&&HI_LABEL_CallCommonNativeStatic_v_f8_3,
+			&&HI_LABEL_CallCommonNativeStatic_v_f8_4,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i4_1,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i4_2,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i4_3,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i4_4,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i8_1,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i8_2,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i8_3,
+			&&HI_LABEL_CallCommonNativeStatic_u1_i8_4,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f4_1,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f4_2,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f4_3,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f4_4,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f8_1,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f8_2,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f8_3,
+			&&HI_LABEL_CallCommonNativeStatic_u1_f8_4,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i4_1,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i4_2,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i4_3,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i4_4,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i8_1,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i8_2,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i8_3,
+			&&HI_LABEL_CallCommonNativeStatic_i4_i8_4,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f4_1,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f4_2,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f4_3,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f4_4,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f8_1,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f8_2,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f8_3,
+			&&HI_LABEL_CallCommonNativeStatic_i4_f8_4,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i4_1,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i4_2,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i4_3,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i4_4,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i8_1,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i8_2,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i8_3,
+			&&HI_LABEL_CallCommonNativeStatic_i8_i8_4,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f4_1,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f4_2,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f4_3,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f4_4,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f8_1,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f8_2,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f8_3,
+			&&HI_LABEL_CallCommonNativeStatic_i8_f8_4,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i4_1,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i4_2,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i4_3,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i4_4,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i8_1,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i8_2,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i8_3,
+			&&HI_LABEL_CallCommonNativeStatic_f4_i8_4,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f4_1,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f4_2,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f4_3,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f4_4,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f8_1,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f8_2,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f8_3,
+			&&HI_LABEL_CallCommonNativeStatic_f4_f8_4,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i4_1,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i4_2,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i4_3,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i4_4,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i8_1,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i8_2,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i8_3,
+			&&HI_LABEL_CallCommonNativeStatic_f8_i8_4,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f4_1,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f4_2,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f4_3,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f4_4,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f8_1,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f8_2,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f8_3,
+			&&HI_LABEL_CallCommonNativeStatic_f8_f8_4,
+			&&HI_LABEL_BoxVarVar,
+			&&HI_LABEL_UnBoxVarVar,
+			&&HI_LABEL_UnBoxAnyVarVar,
+			&&HI_LABEL_CastclassVar,
+			&&HI_LABEL_IsInstVar,
+			&&HI_LABEL_LdtokenVar,
+			&&HI_LABEL_MakeRefVarVar,
+			&&HI_LABEL_RefAnyTypeVarVar,
+			&&HI_LABEL_RefAnyValueVarVar,
+			&&HI_LABEL_CpobjVarVar_ref,
+			&&HI_LABEL_CpobjVarVar_1,
+			&&HI_LABEL_CpobjVarVar_2,
+			&&HI_LABEL_CpobjVarVar_4,
+			&&HI_LABEL_CpobjVarVar_8,
+			&&HI_LABEL_CpobjVarVar_12,
+			&&HI_LABEL_CpobjVarVar_16,
+			&&HI_LABEL_CpobjVarVar_20,
+			&&HI_LABEL_CpobjVarVar_24,
+			&&HI_LABEL_CpobjVarVar_28,
+			&&HI_LABEL_CpobjVarVar_32,
+			&&HI_LABEL_CpobjVarVar_n_2,
+			&&HI_LABEL_CpobjVarVar_n_4,
+			&&HI_LABEL_CpobjVarVar_WriteBarrier_n_2,
+			&&HI_LABEL_CpobjVarVar_WriteBarrier_n_4,
+			&&HI_LABEL_LdobjVarVar_ref,
+			&&HI_LABEL_LdobjVarVar_1,
+			&&HI_LABEL_LdobjVarVar_2,
+			&&HI_LABEL_LdobjVarVar_4,
+			&&HI_LABEL_LdobjVarVar_8,
+			&&HI_LABEL_LdobjVarVar_12,
+			&&HI_LABEL_LdobjVarVar_16,
+			&&HI_LABEL_LdobjVarVar_20,
+			&&HI_LABEL_LdobjVarVar_24,
+			&&HI_LABEL_LdobjVarVar_28,
+			&&HI_LABEL_LdobjVarVar_32,
+			&&HI_LABEL_LdobjVarVar_n_4,
+			&&HI_LABEL_StobjVarVar_ref,
+			&&HI_LABEL_StobjVarVar_1,
+			&&HI_LABEL_StobjVarVar_2,
+			&&HI_LABEL_StobjVarVar_4,
+			&&HI_LABEL_StobjVarVar_8,
+			&&HI_LABEL_StobjVarVar_12,
+			&&HI_LABEL_StobjVarVar_16,
+			&&HI_LABEL_StobjVarVar_20,
+			&&HI_LABEL_StobjVarVar_24,
+			&&HI_LABEL_StobjVarVar_28,
+			&&HI_LABEL_StobjVarVar_32,
+			&&HI_LABEL_StobjVarVar_n_4,
+			&&HI_LABEL_StobjVarVar_WriteBarrier_n_4,
+			&&HI_LABEL_InitobjVar_ref,
+			&&HI_LABEL_InitobjVar_1,
+			&&HI_LABEL_InitobjVar_2,
+			&&HI_LABEL_InitobjVar_4,
+			&&HI_LABEL_InitobjVar_8,
+			&&HI_LABEL_InitobjVar_12,
+			&&HI_LABEL_InitobjVar_16,
+			&&HI_LABEL_InitobjVar_20,
+			&&HI_LABEL_InitobjVar_24,
+			&&HI_LABEL_InitobjVar_28,
+			&&HI_LABEL_InitobjVar_32,
+			&&HI_LABEL_InitobjVar_n_2,
+			&&HI_LABEL_InitobjVar_n_4,
+			&&HI_LABEL_InitobjVar_WriteBarrier_n_2,
+			&&HI_LABEL_InitobjVar_WriteBarrier_n_4,
+			&&HI_LABEL_LdstrVar,
+			&&HI_LABEL_LdfldVarVar_i1,
+			&&HI_LABEL_LdfldVarVar_u1,
+			&&HI_LABEL_LdfldVarVar_i2,
+			&&HI_LABEL_LdfldVarVar_u2,
+			&&HI_LABEL_LdfldVarVar_i4,
+			&&HI_LABEL_LdfldVarVar_u4,
+			&&HI_LABEL_LdfldVarVar_i8,
+			&&HI_LABEL_LdfldVarVar_u8,
+			&&HI_LABEL_LdfldVarVar_i1_NoCheck,
+			&&HI_LABEL_LdfldVarVar_u1_NoCheck,
+			&&HI_LABEL_LdfldVarVar_i2_NoCheck,
+			&&HI_LABEL_LdfldVarVar_u2_NoCheck,
+			&&HI_LABEL_LdfldVarVar_i4_NoCheck,
+			&&HI_LABEL_LdfldVarVar_u4_NoCheck,
+			&&HI_LABEL_LdfldVarVar_i8_NoCheck,
+			&&HI_LABEL_LdfldVarVar_u8_NoCheck,
+			&&HI_LABEL_LdfldVarVar_size_8,
+			&&HI_LABEL_LdfldVarVar_size_12,
+			&&HI_LABEL_LdfldVarVar_size_16,
+			&&HI_LABEL_LdfldVarVar_size_20,
+			&&HI_LABEL_LdfldVarVar_size_24,
+			&&HI_LABEL_LdfldVarVar_size_28,
+			&&HI_LABEL_LdfldVarVar_size_32,
+			&&HI_LABEL_LdfldVarVar_n_2,
+			&&HI_LABEL_LdfldVarVar_n_4,
+			&&HI_LABEL_LdfldValueTypeVarVar_i1,
+			&&HI_LABEL_LdfldValueTypeVarVar_u1,
+			&&HI_LABEL_LdfldValueTypeVarVar_i2,
+			&&HI_LABEL_LdfldValueTypeVarVar_u2,
+			&&HI_LABEL_LdfldValueTypeVarVar_i4,
+			&&HI_LABEL_LdfldValueTypeVarVar_u4,
+			&&HI_LABEL_LdfldValueTypeVarVar_i8,
+			&&HI_LABEL_LdfldValueTypeVarVar_u8,
+			&&HI_LABEL_LdfldValueTypeVarVar_size_8,
+			&&HI_LABEL_LdfldValueTypeVarVar_size_12,
+			&&HI_LABEL_LdfldValueTypeVarVar_size_16,
+			&&HI_LABEL_LdfldValueTypeVarVar_size_20,
+			&&HI_LABEL_LdfldValueTypeVarVar_size_24,
+			&&HI_LABEL_LdfldValueTypeVarVar_size_28,
+			&&HI_LABEL_LdfldValueTypeVarVar_size_32,
+			&&HI_LABEL_LdfldValueTypeVarVar_n_2,
+			&&HI_LABEL_LdfldValueTypeVarVar_n_4,
+			&&HI_LABEL_LdfldaVarVar,
+			&&HI_LABEL_StfldVarVar_i1,
+			&&HI_LABEL_StfldVarVar_u1,
+			&&HI_LABEL_StfldVarVar_i2,
+			&&HI_LABEL_StfldVarVar_u2,
+			&&HI_LABEL_StfldVarVar_i4,
+			&&HI_LABEL_StfldVarVar_u4,
+			&&HI_LABEL_StfldVarVar_i8,
+			&&HI_LABEL_StfldVarVar_u8,
+			&&HI_LABEL_StfldVarVar_ref,
+			&&HI_LABEL_StfldVarVar_i1_NoCheck,
+			&&HI_LABEL_StfldVarVar_u1_NoCheck,
+			&&HI_LABEL_StfldVarVar_i2_NoCheck,
+			&&HI_LABEL_StfldVarVar_u2_NoCheck,
+			&&HI_LABEL_StfldVarVar_i4_NoCheck,
+			&&HI_LABEL_StfldVarVar_u4_NoCheck,
+			&&HI_LABEL_StfldVarVar_i8_NoCheck,
+			&&HI_LABEL_StfldVarVar_u8_NoCheck,
+			&&HI_LABEL_StfldVarVar_ref_NoCheck,
+			&&HI_LABEL_StfldVarVar_size_8,
+			&&HI_LABEL_StfldVarVar_size_12,
+			&&HI_LABEL_StfldVarVar_size_16,
+			&&HI_LABEL_StfldVarVar_size_20,
+			&&HI_LABEL_StfldVarVar_size_24,
+			&&HI_LABEL_StfldVarVar_size_28,
+			&&HI_LABEL_StfldVarVar_size_32,
+			&&HI_LABEL_StfldVarVar_n_2,
+			&&HI_LABEL_StfldVarVar_n_4,
+			&&HI_LABEL_StfldVarVar_WriteBarrier_n_2,
+			&&HI_LABEL_StfldVarVar_WriteBarrier_n_4,
+			&&HI_LABEL_LdsfldVarVar_i1,
+			&&HI_LABEL_LdsfldVarVar_u1,
+			&&HI_LABEL_LdsfldVarVar_i2,
+			&&HI_LABEL_LdsfldVarVar_u2,
+			&&HI_LABEL_LdsfldVarVar_i4,
+			&&HI_LABEL_LdsfldVarVar_u4,
+			&&HI_LABEL_LdsfldVarVar_i8,
+			&&HI_LABEL_LdsfldVarVar_u8,
+			&&HI_LABEL_LdsfldVarVar_size_8,
+			&&HI_LABEL_LdsfldVarVar_size_12,
+			&&HI_LABEL_LdsfldVarVar_size_16,
+			&&HI_LABEL_LdsfldVarVar_size_20,
+			&&HI_LABEL_LdsfldVarVar_size_24,
+			&&HI_LABEL_LdsfldVarVar_size_28,
+			&&HI_LABEL_LdsfldVarVar_size_32,
+			&&HI_LABEL_LdsfldVarVar_n_2,
+			&&HI_LABEL_LdsfldVarVar_n_4,
+			&&HI_LABEL_LdsfldInitedVarVar_i1,
+			&&HI_LABEL_LdsfldInitedVarVar_u1,
+			&&HI_LABEL_LdsfldInitedVarVar_i2,
+			&&HI_LABEL_LdsfldInitedVarVar_u2,
+			&&HI_LABEL_LdsfldInitedVarVar_i4,
+			&&HI_LABEL_LdsfldInitedVarVar_u4,
+			&&HI_LABEL_LdsfldInitedVarVar_i8,
+			&&HI_LABEL_LdsfldInitedVarVar_u8,
+			&&HI_LABEL_LdsfldInitedVarVar_size_8,
+			&&HI_LABEL_LdsfldInitedVarVar_size_12,
+			&&HI_LABEL_LdsfldInitedVarVar_size_16,
+			&&HI_LABEL_LdsfldInitedVarVar_size_20,
+			&&HI_LABEL_LdsfldInitedVarVar_size_24,
+			&&HI_LABEL_LdsfldInitedVarVar_size_28,
+			&&HI_LABEL_LdsfldInitedVarVar_size_32,
+			&&HI_LABEL_LdsfldInitedVarVar_n_2,
+			&&HI_LABEL_LdsfldInitedVarVar_n_4,
+			&&HI_LABEL_StsfldVarVar_i1,
+			&&HI_LABEL_StsfldVarVar_u1,
+			&&HI_LABEL_StsfldVarVar_i2,
+			&&HI_LABEL_StsfldVarVar_u2,
+			&&HI_LABEL_StsfldVarVar_i4,
+			&&HI_LABEL_StsfldVarVar_u4,
+			&&HI_LABEL_StsfldVarVar_i8,
+			&&HI_LABEL_StsfldVarVar_u8,
+			&&HI_LABEL_StsfldVarVar_ref,
+			&&HI_LABEL_StsfldVarVar_size_8,
+			&&HI_LABEL_StsfldVarVar_size_12,
+			&&HI_LABEL_StsfldVarVar_size_16,
+			&&HI_LABEL_StsfldVarVar_size_20,
+			&&HI_LABEL_StsfldVarVar_size_24,
+			&&HI_LABEL_StsfldVarVar_size_28,
+			&&HI_LABEL_StsfldVarVar_size_32,
+			&&HI_LABEL_StsfldVarVar_n_2,
+			&&HI_LABEL_StsfldVarVar_n_4,
+			&&HI_LABEL_StsfldVarVar_WriteBarrier_n_2,
+			&&HI_LABEL_StsfldVarVar_WriteBarrier_n_4,
+			&&HI_LABEL_StsfldInitedVarVar_i1,
+			&&HI_LABEL_StsfldInitedVarVar_u1,
+			&&HI_LABEL_StsfldInitedVarVar_i2,
+			&&HI_LABEL_StsfldInitedVarVar_u2,
+			&&HI_LABEL_StsfldInitedVarVar_i4,
+			&&HI_LABEL_StsfldInitedVarVar_u4,
+			&&HI_LABEL_StsfldInitedVarVar_i8,
+			&&HI_LABEL_StsfldInitedVarVar_u8,
+			&&HI_LABEL_StsfldInitedVarVar_ref,
+			&&HI_LABEL_StsfldInitedVarVar_size_8,
+			&&HI_LABEL_StsfldInitedVarVar_size_12,
+			&&HI_LABEL_StsfldInitedVarVar_size_16,
+			&&HI_LABEL_StsfldInitedVarVar_size_20,
+			&&HI_LABEL_StsfldInitedVarVar_size_24,
+			&&HI_LABEL_StsfldInitedVarVar_size_28,
+			&&HI_LABEL_StsfldInitedVarVar_size_32,
+			&&HI_LABEL_StsfldInitedVarVar_n_2,
+			&&HI_LABEL_StsfldInitedVarVar_n_4,
+			&&HI_LABEL_StsfldInitedVarVar_WriteBarrier_n_2,
+			&&HI_LABEL_StsfldInitedVarVar_WriteBarrier_n_4,
+			&&HI_LABEL_LdsfldaVarVar,
+			&&HI_LABEL_LdsfldaInitedVarVar,
+			&&HI_LABEL_LdsfldaFromFieldDataVarVar,
+			&&HI_LABEL_LdthreadlocalaVarVar,
+			&&HI_LABEL_LdthreadlocalVarVar_i1,
+			&&HI_LABEL_LdthreadlocalVarVar_u1,
+			&&HI_LABEL_LdthreadlocalVarVar_i2,
+			&&HI_LABEL_LdthreadlocalVarVar_u2,
+			&&HI_LABEL_LdthreadlocalVarVar_i4,
+			&&HI_LABEL_LdthreadlocalVarVar_u4,
+			&&HI_LABEL_LdthreadlocalVarVar_i8,
+			&&HI_LABEL_LdthreadlocalVarVar_u8,
+			&&HI_LABEL_LdthreadlocalVarVar_size_8,
+			&&HI_LABEL_LdthreadlocalVarVar_size_12,
+			&&HI_LABEL_LdthreadlocalVarVar_size_16,
+			&&HI_LABEL_LdthreadlocalVarVar_size_20,
+			&&HI_LABEL_LdthreadlocalVarVar_size_24,
+			&&HI_LABEL_LdthreadlocalVarVar_size_28,
+			&&HI_LABEL_LdthreadlocalVarVar_size_32,
+			&&HI_LABEL_LdthreadlocalVarVar_n_2,
+			&&HI_LABEL_LdthreadlocalVarVar_n_4,
+			&&HI_LABEL_StthreadlocalVarVar_i1,
+			&&HI_LABEL_StthreadlocalVarVar_u1,
+			&&HI_LABEL_StthreadlocalVarVar_i2,
+			&&HI_LABEL_StthreadlocalVarVar_u2,
+			&&HI_LABEL_StthreadlocalVarVar_i4,
+			&&HI_LABEL_StthreadlocalVarVar_u4,
+			&&HI_LABEL_StthreadlocalVarVar_i8,
+			&&HI_LABEL_StthreadlocalVarVar_u8,
+			&&HI_LABEL_StthreadlocalVarVar_ref,
+			&&HI_LABEL_StthreadlocalVarVar_size_8,
+			&&HI_LABEL_StthreadlocalVarVar_size_12,
+			&&HI_LABEL_StthreadlocalVarVar_size_16,
+			&&HI_LABEL_StthreadlocalVarVar_size_20,
+			&&HI_LABEL_StthreadlocalVarVar_size_24,
+			&&HI_LABEL_StthreadlocalVarVar_size_28,
+			&&HI_LABEL_StthreadlocalVarVar_size_32,
+			&&HI_LABEL_StthreadlocalVarVar_n_2,
+			&&HI_LABEL_StthreadlocalVarVar_n_4,
+			&&HI_LABEL_StthreadlocalVarVar_WriteBarrier_n_2,
+			&&HI_LABEL_StthreadlocalVarVar_WriteBarrier_n_4,
+			&&HI_LABEL_CheckThrowIfNullVar,
+			&&HI_LABEL_InitClassStaticCtor,
+			&&HI_LABEL_InitClassStaticCtorInited,
+			&&HI_LABEL_NewArrVarVar,
+			&&HI_LABEL_GetArrayLengthVarVar,
+			&&HI_LABEL_GetArrayElementAddressAddrVarVar,
+			&&HI_LABEL_GetArrayElementAddressCheckAddrVarVar,
+			&&HI_LABEL_GetArrayElementVarVar_i1,
+			&&HI_LABEL_GetArrayElementVarVar_u1,
+			&&HI_LABEL_GetArrayElementVarVar_i2,
+			&&HI_LABEL_GetArrayElementVarVar_u2,
+			&&HI_LABEL_GetArrayElementVarVar_i4,
+			&&HI_LABEL_GetArrayElementVarVar_u4,
+			&&HI_LABEL_GetArrayElementVarVar_i8,
+			&&HI_LABEL_GetArrayElementVarVar_u8,
+			&&HI_LABEL_GetArrayElementVarVar_i1_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_u1_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_i2_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_u2_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_i4_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_u4_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_i8_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_u8_NoCheck,
+			&&HI_LABEL_GetArrayElementVarVar_size_1,
+			&&HI_LABEL_GetArrayElementVarVar_size_2,
+			&&HI_LABEL_GetArrayElementVarVar_size_4,
+			&&HI_LABEL_GetArrayElementVarVar_size_8,
+			&&HI_LABEL_GetArrayElementVarVar_size_12,
+			&&HI_LABEL_GetArrayElementVarVar_size_16,
+			&&HI_LABEL_GetArrayElementVarVar_size_20,
+			&&HI_LABEL_GetArrayElementVarVar_size_24,
+			&&HI_LABEL_GetArrayElementVarVar_size_28,
+			&&HI_LABEL_GetArrayElementVarVar_size_32,
+			&&HI_LABEL_GetArrayElementVarVar_n,
+			&&HI_LABEL_SetArrayElementVarVar_i1,
+			&&HI_LABEL_SetArrayElementVarVar_u1,
+			&&HI_LABEL_SetArrayElementVarVar_i2,
+			&&HI_LABEL_SetArrayElementVarVar_u2,
+			&&HI_LABEL_SetArrayElementVarVar_i4,
+			&&HI_LABEL_SetArrayElementVarVar_u4,
+			&&HI_LABEL_SetArrayElementVarVar_i8,
+			&&HI_LABEL_SetArrayElementVarVar_u8,
+			&&HI_LABEL_SetArrayElementVarVar_i1_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_u1_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_i2_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_u2_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_i4_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_u4_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_i8_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_u8_NoCheck,
+			&&HI_LABEL_SetArrayElementVarVar_ref,
+			&&HI_LABEL_SetArrayElementVarVar_ref_NoTypeCheck,
+			&&HI_LABEL_SetArrayElementVarVar_size_12,
+			&&HI_LABEL_SetArrayElementVarVar_size_16,
+			&&HI_LABEL_SetArrayElementVarVar_n,
+			&&HI_LABEL_SetArrayElementVarVar_WriteBarrier_n,
+			&&HI_LABEL_NewMdArrVarVar_length,
+			&&HI_LABEL_NewMdArrVarVar_length_bound,
+			&&HI_LABEL_GetMdArrElementVarVar_i1,
+			&&HI_LABEL_GetMdArrElementVarVar_u1,
+			&&HI_LABEL_GetMdArrElementVarVar_i2,
+			&&HI_LABEL_GetMdArrElementVarVar_u2,
+			&&HI_LABEL_GetMdArrElementVarVar_i4,
+			&&HI_LABEL_GetMdArrElementVarVar_u4,
+			&&HI_LABEL_GetMdArrElementVarVar_i8,
+			&&HI_LABEL_GetMdArrElementVarVar_u8,
+			&&HI_LABEL_GetMdArrElementVarVar_n,
+			&&HI_LABEL_GetMdArrElementAddressVarVar,
+			&&HI_LABEL_SetMdArrElementVarVar_i1,
+			&&HI_LABEL_SetMdArrElementVarVar_u1,
+			&&HI_LABEL_SetMdArrElementVarVar_i2,
+			&&HI_LABEL_SetMdArrElementVarVar_u2,
+			&&HI_LABEL_SetMdArrElementVarVar_i4,
+			&&HI_LABEL_SetMdArrElementVarVar_u4,
+			&&HI_LABEL_SetMdArrElementVarVar_i8,
+			&&HI_LABEL_SetMdArrElementVarVar_u8,
+			&&HI_LABEL_SetMdArrElementVarVar_ref,
+			&&HI_LABEL_SetMdArrElementVarVar_n,
+			&&HI_LABEL_SetMdArrElementVarVar_WriteBarrier_n,
+			&&HI_LABEL_ThrowEx,
+			&&HI_LABEL_RethrowEx,
+			&&HI_LABEL_LeaveEx,
+			&&HI_LABEL_LeaveEx_Directly,
+			&&HI_LABEL_EndFilterEx,
+			&&HI_LABEL_EndFinallyEx,
+			&&HI_LABEL_NullableNewVarVar,
+			&&HI_LABEL_NullableCtorVarVar,
+			&&HI_LABEL_NullableHasValueVar,
+			&&HI_LABEL_NullableGetValueOrDefaultVarVar,
+			&&HI_LABEL_NullableGetValueOrDefaultVarVar_1,
+			&&HI_LABEL_NullableGetValueVarVar,
+			&&HI_LABEL_InterlockedCompareExchangeVarVarVarVar_i4,
+			&&HI_LABEL_InterlockedCompareExchangeVarVarVarVar_i8,
+			&&HI_LABEL_InterlockedCompareExchangeVarVarVarVar_pointer,
+			&&HI_LABEL_InterlockedExchangeVarVarVar_i4,
+			&&HI_LABEL_InterlockedExchangeVarVarVar_i8,
+			&&HI_LABEL_InterlockedExchangeVarVarVar_pointer,
+			&&HI_LABEL_NewSystemObjectVar,
+			&&HI_LABEL_NewVector2,
+			&&HI_LABEL_NewVector3_2,
+			&&HI_LABEL_NewVector3_3,
+			&&HI_LABEL_NewVector4_2,
+			&&HI_LABEL_NewVector4_3,
+			&&HI_LABEL_NewVector4_4,
+			&&HI_LABEL_CtorVector2,
+			&&HI_LABEL_CtorVector3_2,
+			&&HI_LABEL_CtorVector3_3,
+			&&HI_LABEL_CtorVector4_2,
+			&&HI_LABEL_CtorVector4_3,
+			&&HI_LABEL_CtorVector4_4,
+			&&HI_LABEL_ArrayGetGenericValueImpl,
+			&&HI_LABEL_ArraySetGenericValueImpl,
+			&&HI_LABEL_NewString,
+			&&HI_LABEL_NewString_2,
+			&&HI_LABEL_NewString_3,
+			&&HI_LABEL_UnsafeEnumCast,
+			&&HI_LABEL_GetEnumHashCode,
+			&&HI_LABEL_AssemblyGetExecutingAssembly,
+			&&HI_LABEL_MethodBaseGetCurrentMethod,
+
+			//!!!}}DISPATCH_TABLE
+			//!!!{{SUPERINSTRUCTION_DISPATCH_TABLE
+			&&HI_LABEL_SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4__LdlocVarVar,
+			&&HI_LABEL_SuperInst_LdlocVarVar__LdlocVarVar__BranchVarVar_Clt_i4,
+			&&HI_LABEL_SuperInst_LdlocVarVar__LdlocVarVar,
+			&&HI_LABEL_SuperInst_BinOpVarVarVar_Add_i4__LdlocVarVar,
+			&&HI_LABEL_SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4,
+			&&HI_LABEL_SuperInst_BinOpVarVarConst_Add_i4__LdlocVarVar,
+			&&HI_LABEL_SuperInst_LdlocVarVar__BranchVarVar_Clt_i4,
+			&&HI_LABEL_SuperInst_LdlocVarVar__GetArrayElementVarVar_i4,
+			&&HI_LABEL_SuperInst_GetArrayElementVarVar_i4__BinOpVarVarVar_Add_i4,
+			&&HI_LABEL_SuperInst_GetArrayElementVarVar_i4_NoCheck__BinOpVarVarVar_Add_i4,
+			&&HI_LABEL_SuperInst_LdlocVarVar__BranchVarConst_Clt_i4,
+			&&HI_LABEL_SuperInst_LdlocVarVar__LdfldVarVar_i4,
+			&&HI_LABEL_SuperInst_LdlocVarVar__BranchTrueVar_i4,
+			&&HI_LABEL_SuperInst_LdlocVarVar__BranchFalseVar_i4,
+			&&HI_LABEL_SuperInst_CompOpVarVarVar_Clt_i4__LdlocVarVar,
+			&&HI_LABEL_SuperInst_LdlocVarVar__BinOpVarVarVar_Add_i4,
+			&&HI_LABEL_SuperInst_BinOpVarVarVar_Add_f4__LdlocVarVar,
+			&&HI_LABEL_SuperInst_BinOpVarVarVar_Mul_f4__LdlocVarVar,
+			//!!!}}SUPERINSTRUCTION_DISPATCH_TABLE
+		};
+		static_assert(sizeof(s_dispatchTable) / sizeof(s_dispatchTable[0]) == (size_t)HiOpcodeEnum::__HiInstructionCount, "dispatch table doesn't match HiOpcodeEnum");
+#endif
 
 		PREPARE_NEW_FRAME_FROM_NATIVE(methodInfo, args, ret);
 
@@ -1685,360 +2865,364 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 		{
 			for (;;)
 			{
+#if HYBRIDCLR_ENABLE_OPCODE_PROFILER
+				OpcodeProfiler::RecordPair(prevOpcode, *(HiOpcodeEnum*)ip);
+				prevOpcode = *(HiOpcodeEnum*)ip;
+#endif
 				switch (*(HiOpcodeEnum*)ip)
 				{
 					// avoid decrement *ip when compute jump table,  boosts about 5% performance
-				case HiOpcodeEnum::None:
+				HI_OPCODE_CASE(None)
 				{
-					continue;
+					HI_DISPATCH_NEXT();
 				}
 #pragma region memory
 					//!!!{{MEMORY
-				case HiOpcodeEnum::InitLocals_n_2:
+				HI_OPCODE_CASE(InitLocals_n_2)
 				{
 					uint16_t __size = *(uint16_t*)(ip + 2);
 					InitDefaultN(localVarBase, __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitLocals_n_4:
+				HI_OPCODE_CASE(InitLocals_n_4)
 				{
 					uint32_t __size = *(uint32_t*)(ip + 4);
 					InitDefaultN(localVarBase, __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitLocals_size_8:
+				HI_OPCODE_CASE(InitLocals_size_8)
 				{
 					InitDefault8(localVarBase);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitLocals_size_16:
+				HI_OPCODE_CASE(InitLocals_size_16)
 				{
 					InitDefault16(localVarBase);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitLocals_size_24:
+				HI_OPCODE_CASE(InitLocals_size_24)
 				{
 					InitDefault24(localVarBase);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitLocals_size_32:
+				HI_OPCODE_CASE(InitLocals_size_32)
 				{
 					InitDefault32(localVarBase);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitInlineLocals_n_2:
+				HI_OPCODE_CASE(InitInlineLocals_n_2)
 				{
 					uint16_t __size = *(uint16_t*)(ip + 2);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					InitDefaultN(localVarBase + __offset, __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitInlineLocals_n_4:
+				HI_OPCODE_CASE(InitInlineLocals_n_4)
 				{
 					uint32_t __size = *(uint32_t*)(ip + 4);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
 					InitDefaultN(localVarBase + __offset, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitInlineLocals_size_8:
+				HI_OPCODE_CASE(InitInlineLocals_size_8)
 				{
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					InitDefault8(localVarBase + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitInlineLocals_size_16:
+				HI_OPCODE_CASE(InitInlineLocals_size_16)
 				{
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					InitDefault16(localVarBase + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitInlineLocals_size_24:
+				HI_OPCODE_CASE(InitInlineLocals_size_24)
 				{
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					InitDefault24(localVarBase + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitInlineLocals_size_32:
+				HI_OPCODE_CASE(InitInlineLocals_size_32)
 				{
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					InitDefault32(localVarBase + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocVarVar:
+				HI_OPCODE_CASE(LdlocVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocExpandVarVar_i1:
+				HI_OPCODE_CASE(LdlocExpandVarVar_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int8_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocExpandVarVar_u1:
+				HI_OPCODE_CASE(LdlocExpandVarVar_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint8_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocExpandVarVar_i2:
+				HI_OPCODE_CASE(LdlocExpandVarVar_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int16_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocExpandVarVar_u2:
+				HI_OPCODE_CASE(LdlocExpandVarVar_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint16_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocVarVarSize:
+				HI_OPCODE_CASE(LdlocVarVarSize)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memmove((void*)(localVarBase + __dst), (void*)(localVarBase + __src), __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdlocVarAddress:
+				HI_OPCODE_CASE(LdlocVarAddress)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(void**)(localVarBase + __dst)) = (void*)(localVarBase + __src);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_1:
+				HI_OPCODE_CASE(LdcVarConst_1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 4);
 					uint8_t __src = *(uint8_t*)(ip + 2);
 					(*(int32_t*)(localVarBase + __dst)) = __src;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_2:
+				HI_OPCODE_CASE(LdcVarConst_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = __src;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_4:
+				HI_OPCODE_CASE(LdcVarConst_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint32_t __src = *(uint32_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = __src;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdcVarConst_8:
+				HI_OPCODE_CASE(LdcVarConst_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint64_t __src = *(uint64_t*)(ip + 8);
 					(*(uint64_t*)(localVarBase + __dst)) = __src;
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdnullVar:
+				HI_OPCODE_CASE(LdnullVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					(*(void**)(localVarBase + __dst)) = nullptr;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i1:
+				HI_OPCODE_CASE(LdindVarVar_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int8_t*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_u1:
+				HI_OPCODE_CASE(LdindVarVar_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint8_t*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i2:
+				HI_OPCODE_CASE(LdindVarVar_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int16_t*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_u2:
+				HI_OPCODE_CASE(LdindVarVar_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint16_t*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i4:
+				HI_OPCODE_CASE(LdindVarVar_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(int32_t*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_u4:
+				HI_OPCODE_CASE(LdindVarVar_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (*(uint32_t*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_i8:
+				HI_OPCODE_CASE(LdindVarVar_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (*(int64_t*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_f4:
+				HI_OPCODE_CASE(LdindVarVar_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (*(float*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdindVarVar_f8:
+				HI_OPCODE_CASE(LdindVarVar_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (*(double*)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i1:
+				HI_OPCODE_CASE(StindVarVar_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int8_t*)*(void**)(localVarBase + __dst)) = (*(int8_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i2:
+				HI_OPCODE_CASE(StindVarVar_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int16_t*)*(void**)(localVarBase + __dst)) = (*(int16_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i4:
+				HI_OPCODE_CASE(StindVarVar_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)*(void**)(localVarBase + __dst)) = (*(int32_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_i8:
+				HI_OPCODE_CASE(StindVarVar_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)*(void**)(localVarBase + __dst)) = (*(int64_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_f4:
+				HI_OPCODE_CASE(StindVarVar_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)*(void**)(localVarBase + __dst)) = (*(float*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_f8:
+				HI_OPCODE_CASE(StindVarVar_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)*(void**)(localVarBase + __dst)) = (*(double*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StindVarVar_ref:
+				HI_OPCODE_CASE(StindVarVar_ref)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(Il2CppObject**)*(void**)(localVarBase + __dst)) = (*(Il2CppObject**)(localVarBase + __src));	HYBRIDCLR_SET_WRITE_BARRIER((void**)(*(void**)(localVarBase + __dst)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LocalAllocVarVar_n_2:
+				HI_OPCODE_CASE(LocalAllocVarVar_n_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 					(*(void**)(localVarBase + __dst)) = LOCAL_ALLOC((*(uint16_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LocalAllocVarVar_n_4:
+				HI_OPCODE_CASE(LocalAllocVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 					(*(void**)(localVarBase + __dst)) = LOCAL_ALLOC((*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitblkVarVarVar:
+				HI_OPCODE_CASE(InitblkVarVarVar)
 				{
 					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memset((*(void**)(localVarBase + __addr)), (*(uint8_t*)(localVarBase + __value)), (*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpblkVarVar:
+				HI_OPCODE_CASE(CpblkVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memmove((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)), (*(uint32_t*)(localVarBase + __size)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::MemoryBarrier:
+				HI_OPCODE_CASE(MemoryBarrier)
 				{
 					MEMORY_BARRIER();
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}MEMORY
@@ -2048,487 +3232,487 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
 #pragma region CONVERT
 		//!!!{{CONVERT
-				case HiOpcodeEnum::ConvertVarVar_i4_i1:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u1:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_i2:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u2:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_i4:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u4:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_i8:
+				HI_OPCODE_CASE(ConvertVarVar_i4_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_u8:
+				HI_OPCODE_CASE(ConvertVarVar_i4_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_f4:
+				HI_OPCODE_CASE(ConvertVarVar_i4_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i4_f8:
+				HI_OPCODE_CASE(ConvertVarVar_i4_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i1:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u1:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i2:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u2:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i4:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u4:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_i8:
+				HI_OPCODE_CASE(ConvertVarVar_u4_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_u8:
+				HI_OPCODE_CASE(ConvertVarVar_u4_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_f4:
+				HI_OPCODE_CASE(ConvertVarVar_u4_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u4_f8:
+				HI_OPCODE_CASE(ConvertVarVar_u4_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i1:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u1:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i2:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u2:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i4:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u4:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_i8:
+				HI_OPCODE_CASE(ConvertVarVar_i8_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_u8:
+				HI_OPCODE_CASE(ConvertVarVar_i8_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_f4:
+				HI_OPCODE_CASE(ConvertVarVar_i8_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_i8_f8:
+				HI_OPCODE_CASE(ConvertVarVar_i8_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i1:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u1:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i2:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u2:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i4:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u4:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_i8:
+				HI_OPCODE_CASE(ConvertVarVar_u8_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_u8:
+				HI_OPCODE_CASE(ConvertVarVar_u8_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_f4:
+				HI_OPCODE_CASE(ConvertVarVar_u8_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_u8_f8:
+				HI_OPCODE_CASE(ConvertVarVar_u8_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i1:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int8_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u1:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint8_t, int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i2:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int16_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u2:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint16_t, int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i4:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u4:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint32_t, int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_i8:
+				HI_OPCODE_CASE(ConvertVarVar_f4_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int64_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_u8:
+				HI_OPCODE_CASE(ConvertVarVar_f4_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint64_t, int64_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_f4:
+				HI_OPCODE_CASE(ConvertVarVar_f4_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f4_f8:
+				HI_OPCODE_CASE(ConvertVarVar_f4_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i1:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int8_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u1:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint8_t, int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i2:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int16_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u2:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint16_t, int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i4:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u4:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint32_t, int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_i8:
+				HI_OPCODE_CASE(ConvertVarVar_f8_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int64_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_u8:
+				HI_OPCODE_CASE(ConvertVarVar_f8_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint64_t, int64_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_f4:
+				HI_OPCODE_CASE(ConvertVarVar_f8_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = (float)((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertVarVar_f8_f8:
+				HI_OPCODE_CASE(ConvertVarVar_f8_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = (double)((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2539,9 +3723,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2552,9 +3736,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint8_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2565,9 +3749,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2578,9 +3762,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint16_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2591,9 +3775,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2604,9 +3788,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint32_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2617,9 +3801,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i4_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i4_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2630,9 +3814,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (uint64_t)(uint32_t)((*(int32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2643,9 +3827,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2656,9 +3840,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2669,9 +3853,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2682,9 +3866,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2695,9 +3879,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2708,9 +3892,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2721,9 +3905,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u4_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u4_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2734,9 +3918,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint32_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2747,9 +3931,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2760,9 +3944,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint8_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2773,9 +3957,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2786,9 +3970,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint16_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2799,9 +3983,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2812,9 +3996,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint32_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2825,9 +4009,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_i8_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_i8_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2838,9 +4022,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (uint64_t)(uint64_t)((*(int64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2851,9 +4035,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2864,9 +4048,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint8_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2877,9 +4061,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2890,9 +4074,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint16_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2903,9 +4087,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (int32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2916,9 +4100,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = (uint32_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2929,9 +4113,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (int64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_u8_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_u8_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2942,9 +4126,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = (uint64_t)((*(uint64_t*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2955,9 +4139,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int8_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2968,9 +4152,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint8_t, int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2981,9 +4165,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int16_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -2994,9 +4178,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint16_t, int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3007,9 +4191,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3020,9 +4204,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint32_t, int32_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3033,9 +4217,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int64_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f4_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f4_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3046,9 +4230,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint64_t, int64_t>((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3059,9 +4243,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int8_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u1:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3072,9 +4256,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint8_t, int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3085,9 +4269,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int16_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u2:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3098,9 +4282,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint16_t, int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3111,9 +4295,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u4:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3124,9 +4308,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint32_t, int32_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_i8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3137,9 +4321,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_double_to_int<int64_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ConvertOverflowVarVar_f8_u8:
+				HI_OPCODE_CASE(ConvertOverflowVarVar_f8_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -3150,7 +4334,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_codegen_cast_floating_point<uint64_t, int64_t>((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}CONVERT
@@ -3158,295 +4342,457 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
 #pragma region ARITH
 		//!!!{{ARITH
-				case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) - (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) * (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_MulUn_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_MulUn_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiMulUn((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiDiv((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_DivUn_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_DivUn_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiDivUn((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiRem((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_RemUn_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_RemUn_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiRemUn((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_And_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_And_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) & (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Or_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Or_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) | (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Xor_i4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Xor_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) ^ (*(int32_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Add_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) + (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) - (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) * (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_MulUn_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_MulUn_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiMulUn((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiDiv((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_DivUn_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_DivUn_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiDivUn((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiRem((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_RemUn_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_RemUn_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiRemUn((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_And_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_And_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) & (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Or_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Or_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) | (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Xor_i8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Xor_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) ^ (*(int64_t*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Add_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) + (*(float*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) - (*(float*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) * (*(float*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = HiDiv((*(float*)(localVarBase + __op1)), (*(float*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_f4:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(float*)(localVarBase + __ret)) = HiRem((*(float*)(localVarBase + __op1)), (*(float*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Add_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Add_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) + (*(double*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Sub_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Sub_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) - (*(double*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Mul_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Mul_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) * (*(double*)(localVarBase + __op2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Div_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Div_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = HiDiv((*(double*)(localVarBase + __op1)), (*(double*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpVarVarVar_Rem_f8:
+				HI_OPCODE_CASE(BinOpVarVarVar_Rem_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
 					uint16_t __op2 = *(uint16_t*)(ip + 6);
 					(*(double*)(localVarBase + __ret)) = HiRem((*(double*)(localVarBase + __op1)), (*(double*)(localVarBase + __op2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Add_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Sub_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) - __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Mul_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) * __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_And_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) & __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Or_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) | __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Xor_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) ^ __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Add_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) + __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Sub_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) - __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Mul_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) * __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_And_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) & __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Or_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) | __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Xor_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __op1)) ^ __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Add_f4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) + __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Sub_f4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) - __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Mul_f4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+					(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) * __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Add_f8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) + __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Sub_f8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) - __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BinOpVarVarConst_Mul_f8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __op1 = *(uint16_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+					(*(double*)(localVarBase + __ret)) = (*(double*)(localVarBase + __op1)) * __op2;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3462,9 +4808,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3480,9 +4826,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3498,9 +4844,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3516,9 +4862,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3534,9 +4880,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3552,9 +4898,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_u4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3570,9 +4916,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_u4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3588,9 +4934,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u4:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_u4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3606,9 +4952,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Add_u8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3624,9 +4970,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Sub_u8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3642,9 +4988,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u8:
+				HI_OPCODE_CASE(BinOpOverflowVarVarVar_Mul_u8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __op1 = *(uint16_t*)(ip + 4);
@@ -3660,177 +5006,177 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        il2cpp::vm::Exception::RaiseOverflowException();
 				    }
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i4_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) << (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i4_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) >> (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i4_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiShrUn((*(int32_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i4_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) << (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i4_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __value)) >> (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i4_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = HiShrUn((*(int32_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i8_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) << (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i8_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) >> (*(int32_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i4:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i8_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiShrUn((*(int64_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shl_i8_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) << (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_Shr_i8_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = (*(int64_t*)(localVarBase + __value)) >> (*(int64_t*)(localVarBase + __shiftAmount));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i8:
+				HI_OPCODE_CASE(BitShiftBinOpVarVarVar_ShrUn_i8_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __value = *(uint16_t*)(ip + 4);
 					uint16_t __shiftAmount = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __ret)) = HiShrUn((*(int64_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __shiftAmount)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_i4:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = - (*(int32_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Not_i4:
+				HI_OPCODE_CASE(UnaryOpVarVar_Not_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int32_t*)(localVarBase + __dst)) = ~ (*(int32_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_i8:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = - (*(int64_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Not_i8:
+				HI_OPCODE_CASE(UnaryOpVarVar_Not_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(int64_t*)(localVarBase + __dst)) = ~ (*(int64_t*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_f4:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_f4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(float*)(localVarBase + __dst)) = - (*(float*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnaryOpVarVar_Neg_f8:
+				HI_OPCODE_CASE(UnaryOpVarVar_Neg_f8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					(*(double*)(localVarBase + __dst)) = - (*(double*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CheckFiniteVar_f4:
+				HI_OPCODE_CASE(CheckFiniteVar_f4)
 				{
 					uint16_t __src = *(uint16_t*)(ip + 2);
 					HiCheckFinite((*(float*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CheckFiniteVar_f8:
+				HI_OPCODE_CASE(CheckFiniteVar_f8)
 				{
 					uint16_t __src = *(uint16_t*)(ip + 2);
 					HiCheckFinite((*(double*)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}ARITH
@@ -3838,285 +5184,465 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
 #pragma region COMPARE
 		//!!!{{COMPARE
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Ceq_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Ceq_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Cgt_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Cgt_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CgtUn_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_Clt_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_Clt_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_i4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_i8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(int64_t*)(localVarBase + __c1)), (*(int64_t*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_f4:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_f4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(float*)(localVarBase + __c1)), (*(float*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CompOpVarVarVar_CltUn_f8:
+				HI_OPCODE_CASE(CompOpVarVarVar_CltUn_f8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __c1 = *(uint16_t*)(ip + 4);
 					uint16_t __c2 = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(double*)(localVarBase + __c1)), (*(double*)(localVarBase + __c2)));
 				    ip += 8;
-				    continue;
-				}
-
-				//!!!}}COMPARE
-#pragma endregion
-
-#pragma region BRANCH
-		//!!!{{BRANCH
-				case HiOpcodeEnum::BranchUncondition_4:
-				{
-					int32_t __offset = *(int32_t*)(ip + 4);
-					ip = ipBase + __offset;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchTrueVar_i4:
+				HI_OPCODE_CASE(CompOpVarVarConst_Ceq_i4)
 				{
-					uint16_t __op = *(uint16_t*)(ip + 2);
-					int32_t __offset = *(int32_t*)(ip + 4);
-				    if ((*(int32_t*)(localVarBase + __op)))
-				    {
-				        ip = ipBase + __offset;
-				    }
-				    else
-				    {
-				        ip += 8;
-				    }
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int32_t __c2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(int32_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchTrueVar_i8:
+				HI_OPCODE_CASE(CompOpVarVarConst_Ceq_i8)
 				{
-					uint16_t __op = *(uint16_t*)(ip + 2);
-					int32_t __offset = *(int32_t*)(ip + 4);
-				    if ((*(int64_t*)(localVarBase + __op)))
-				    {
-				        ip = ipBase + __offset;
-				    }
-				    else
-				    {
-				        ip += 8;
-				    }
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int64_t __c2 = *(int64_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(int64_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchFalseVar_i4:
+				HI_OPCODE_CASE(CompOpVarVarConst_Ceq_f4)
 				{
-					uint16_t __op = *(uint16_t*)(ip + 2);
-					int32_t __offset = *(int32_t*)(ip + 4);
-				    if (!(*(int32_t*)(localVarBase + __op)))
-				    {
-				        ip = ipBase + __offset;
-				    }
-				    else
-				    {
-				        ip += 8;
-				    }
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					float __c2 = *(float*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(float*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchFalseVar_i8:
+				HI_OPCODE_CASE(CompOpVarVarConst_Ceq_f8)
 				{
-					uint16_t __op = *(uint16_t*)(ip + 2);
-					int32_t __offset = *(int32_t*)(ip + 4);
-				    if (!(*(int64_t*)(localVarBase + __op)))
-				    {
-				        ip = ipBase + __offset;
-				    }
-				    else
-				    {
-				        ip += 8;
-				    }
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					double __c2 = *(double*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCeq((*(double*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_i4:
+				HI_OPCODE_CASE(CompOpVarVarConst_Cgt_i4)
 				{
-					uint16_t __op1 = *(uint16_t*)(ip + 2);
-					uint16_t __op2 = *(uint16_t*)(ip + 4);
-					int32_t __offset = *(int32_t*)(ip + 8);
-				    if (CompareCeq((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2))))
-				    {
-				        ip = ipBase + __offset;
-				    }
-				    else
-				    {
-				        ip += 16;
-				    }
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int32_t __c2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(int32_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_i8:
+				HI_OPCODE_CASE(CompOpVarVarConst_Cgt_i8)
 				{
-					uint16_t __op1 = *(uint16_t*)(ip + 2);
-					uint16_t __op2 = *(uint16_t*)(ip + 4);
-					int32_t __offset = *(int32_t*)(ip + 8);
-				    if (CompareCeq((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2))))
-				    {
-				        ip = ipBase + __offset;
-				    }
-				    else
-				    {
-				        ip += 16;
-				    }
-				    continue;
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int64_t __c2 = *(int64_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(int64_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_f4:
+				HI_OPCODE_CASE(CompOpVarVarConst_Cgt_f4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					float __c2 = *(float*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(float*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_Cgt_f8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					double __c2 = *(double*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgt((*(double*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CgtUn_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int32_t __c2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(int32_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CgtUn_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int64_t __c2 = *(int64_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(int64_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CgtUn_f4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					float __c2 = *(float*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(float*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CgtUn_f8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					double __c2 = *(double*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCgtUn((*(double*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_Clt_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int32_t __c2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(int32_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_Clt_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int64_t __c2 = *(int64_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(int64_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_Clt_f4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					float __c2 = *(float*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(float*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_Clt_f8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					double __c2 = *(double*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(double*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CltUn_i4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int32_t __c2 = *(int32_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(int32_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CltUn_i8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					int64_t __c2 = *(int64_t*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(int64_t*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CltUn_f4)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					float __c2 = *(float*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(float*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(CompOpVarVarConst_CltUn_f8)
+				{
+					uint16_t __ret = *(uint16_t*)(ip + 2);
+					uint16_t __c1 = *(uint16_t*)(ip + 4);
+					double __c2 = *(double*)(ip + 8);
+					(*(int32_t*)(localVarBase + __ret)) = CompareCltUn((*(double*)(localVarBase + __c1)), __c2);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+
+				//!!!}}COMPARE
+#pragma endregion
+
+#pragma region BRANCH
+		//!!!{{BRANCH
+				HI_OPCODE_CASE(BranchUncondition_4)
+				{
+					int32_t __offset = *(int32_t*)(ip + 4);
+					ip = ipBase + __offset;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchTrueVar_i4)
+				{
+					uint16_t __op = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+				    if ((*(int32_t*)(localVarBase + __op)))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 8;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchTrueVar_i8)
+				{
+					uint16_t __op = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+				    if ((*(int64_t*)(localVarBase + __op)))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 8;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchFalseVar_i4)
+				{
+					uint16_t __op = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+				    if (!(*(int32_t*)(localVarBase + __op)))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 8;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchFalseVar_i8)
+				{
+					uint16_t __op = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+				    if (!(*(int64_t*)(localVarBase + __op)))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 8;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarVar_Ceq_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					uint16_t __op2 = *(uint16_t*)(ip + 4);
+					int32_t __offset = *(int32_t*)(ip + 8);
+				    if (CompareCeq((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2))))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarVar_Ceq_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					uint16_t __op2 = *(uint16_t*)(ip + 4);
+					int32_t __offset = *(int32_t*)(ip + 8);
+				    if (CompareCeq((*(int64_t*)(localVarBase + __op1)), (*(int64_t*)(localVarBase + __op2))))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarVar_Ceq_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4129,9 +5655,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Ceq_f8:
+				HI_OPCODE_CASE(BranchVarVar_Ceq_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4144,9 +5670,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4159,9 +5685,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4174,9 +5700,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4189,9 +5715,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CneUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CneUn_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4204,9 +5730,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4219,9 +5745,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_i8:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4234,9 +5760,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_f4:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4249,9 +5775,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cgt_f8:
+				HI_OPCODE_CASE(BranchVarVar_Cgt_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4264,9 +5790,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4279,9 +5805,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4294,9 +5820,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4309,9 +5835,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgtUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CgtUn_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4324,9 +5850,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_i4:
+				HI_OPCODE_CASE(BranchVarVar_Cge_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4339,9 +5865,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_i8:
+				HI_OPCODE_CASE(BranchVarVar_Cge_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4354,9 +5880,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_f4:
+				HI_OPCODE_CASE(BranchVarVar_Cge_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4369,9 +5895,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cge_f8:
+				HI_OPCODE_CASE(BranchVarVar_Cge_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4384,9 +5910,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4399,9 +5925,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4414,9 +5940,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4429,9 +5955,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CgeUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CgeUn_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4444,9 +5970,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_i4:
+				HI_OPCODE_CASE(BranchVarVar_Clt_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4459,9 +5985,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_i8:
+				HI_OPCODE_CASE(BranchVarVar_Clt_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4474,9 +6000,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_f4:
+				HI_OPCODE_CASE(BranchVarVar_Clt_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4489,9 +6015,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Clt_f8:
+				HI_OPCODE_CASE(BranchVarVar_Clt_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4504,9 +6030,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4519,9 +6045,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4534,9 +6060,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4549,9 +6075,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CltUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CltUn_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4564,9 +6090,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_i4:
+				HI_OPCODE_CASE(BranchVarVar_Cle_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4579,9 +6105,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_i8:
+				HI_OPCODE_CASE(BranchVarVar_Cle_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4594,9 +6120,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_f4:
+				HI_OPCODE_CASE(BranchVarVar_Cle_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4609,9 +6135,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_Cle_f8:
+				HI_OPCODE_CASE(BranchVarVar_Cle_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4624,9 +6150,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_i4:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_i4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4639,9 +6165,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_i8:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_i8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4654,9 +6180,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_f4:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_f4)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4669,9 +6195,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchVarVar_CleUn_f8:
+				HI_OPCODE_CASE(BranchVarVar_CleUn_f8)
 				{
 					uint16_t __op1 = *(uint16_t*)(ip + 2);
 					uint16_t __op2 = *(uint16_t*)(ip + 4);
@@ -4684,99 +6210,759 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    {
 				        ip = ipBase + __offset;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchJump:
+				HI_OPCODE_CASE(BranchVarConst_Ceq_i4)
 				{
-					uint32_t __token = *(uint32_t*)(ip + 4);
-					IL2CPP_ASSERT(false);
-				    ip += 8;
-				    continue;
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCeq((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BranchSwitch:
+				HI_OPCODE_CASE(BranchVarConst_Ceq_i8)
 				{
-				    uint16_t __value = *(uint16_t*)(ip + 2);
-				    uint32_t __caseNum = *(uint32_t*)(ip + 4);
-				    uint32_t __caseOffsets = *(uint32_t*)(ip + 8);
-				    uint32_t __idx = (*(uint32_t*)(localVarBase + __value));
-				    if (__idx < __caseNum)
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCeq((*(int64_t*)(localVarBase + __op1)), __op2))
 				    {
-				        ip = ipBase + ((uint32_t*)&imi->resolveDatas[__caseOffsets])[__idx];
+				        ip = ipBase + __offset;
 				    }
-				    else 
+				    else
 				    {
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-
-				//!!!}}BRANCH
-#pragma endregion
-
-#pragma region FUNCTION
-		//!!!{{FUNCTION
-				case HiOpcodeEnum::NewClassVar:
+				HI_OPCODE_CASE(BranchVarConst_Ceq_f4)
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					void* __managed2NativeMethod = ((void*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
-					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
-					uint32_t __argIdxs = *(uint32_t*)(ip + 12);
-				    frame->ip = ip + 2;
-				    uint16_t* _argIdxs = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
-				    Il2CppObject* _obj = il2cpp::vm::Object::New(__method->klass);
-				    *(Il2CppObject**)(localVarBase + _argIdxs[0]) = _obj;
-				    ((Managed2NativeCallMethod)__managed2NativeMethod)(__method, _argIdxs, localVarBase, nullptr);
-				    (*(Il2CppObject**)(localVarBase + __obj)) = _obj;
-				    ip += 16;
-				    continue;
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCeq((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassVar_Ctor_0:
+				HI_OPCODE_CASE(BranchVarConst_Ceq_f8)
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
-				    frame->ip = ip + 2;
-				    Il2CppObject* _obj = il2cpp::vm::Object::New(__method->klass);
-				    ((NativeClassCtor0)(__method->methodPointerCallByInterp))(_obj, __method);
-				    (*(Il2CppObject**)(localVarBase + __obj)) = _obj;
-				    ip += 8;
-				    continue;
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCeq((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassVar_NotCtor:
+				HI_OPCODE_CASE(BranchVarConst_CneUn_i4)
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
-				    frame->ip = ip + 2;
-				    (*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::New(__klass);
-				    ip += 8;
-				    continue;
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCneUn((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewValueTypeVar:
+				HI_OPCODE_CASE(BranchVarConst_CneUn_i8)
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					void* __managed2NativeMethod = ((void*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
-					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
-					uint32_t __argIdxs = *(uint32_t*)(ip + 12);
-				    frame->ip = ip + 2;
-				    uint16_t* _argIdxs = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
-				    int32_t _typeSize = GetTypeValueSize(__method->klass);
-				    // arg1, arg2, ..., argN, value type, __this
-				    StackObject* _frameBasePtr = localVarBase + _argIdxs[0];
-				    Il2CppObject* _this = (Il2CppObject*)(_frameBasePtr - GetStackSizeByByteSize(_typeSize));
-				    _frameBasePtr->ptr = _this;
-				    ((Managed2NativeCallMethod)__managed2NativeMethod)(__method, _argIdxs, localVarBase, nullptr);
-				    std::memmove((void*)(localVarBase + __obj), _this, _typeSize);
-				    ip += 16;
-				    continue;
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCneUn((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewValueTypeVar_Ctor_0:
+				HI_OPCODE_CASE(BranchVarConst_CneUn_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCneUn((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CneUn_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCneUn((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cgt_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCle((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cgt_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCle((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cgt_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCle((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cgt_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCle((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgtUn_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCleUn((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgtUn_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCleUn((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgtUn_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCleUn((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgtUn_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCleUn((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cge_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareClt((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cge_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareClt((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cge_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareClt((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cge_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareClt((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgeUn_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCltUn((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgeUn_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCltUn((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgeUn_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCltUn((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CgeUn_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCltUn((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Clt_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCge((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Clt_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCge((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Clt_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCge((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Clt_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCge((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CltUn_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCgeUn((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CltUn_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCgeUn((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CltUn_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCgeUn((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CltUn_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCgeUn((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cle_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCgt((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cle_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCgt((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cle_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCgt((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_Cle_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCgt((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CleUn_i4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int32_t __op2 = *(int32_t*)(ip + 8);
+				    if (CompareCgtUn((*(int32_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CleUn_i8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					int64_t __op2 = *(int64_t*)(ip + 8);
+				    if (CompareCgtUn((*(int64_t*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CleUn_f4)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					float __op2 = *(float*)(ip + 8);
+				    if (CompareCgtUn((*(float*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchVarConst_CleUn_f8)
+				{
+					uint16_t __op1 = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					double __op2 = *(double*)(ip + 8);
+				    if (CompareCgtUn((*(double*)(localVarBase + __op1)), __op2))
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchJump)
+				{
+					uint32_t __token = *(uint32_t*)(ip + 4);
+					IL2CPP_ASSERT(false);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchSwitch)
+				{
+				    uint16_t __value = *(uint16_t*)(ip + 2);
+				    uint32_t __caseNum = *(uint32_t*)(ip + 4);
+				    uint32_t __caseOffsets = *(uint32_t*)(ip + 8);
+				    uint32_t __idx = (*(uint32_t*)(localVarBase + __value));
+				    if (__idx < __caseNum)
+				    {
+				        ip = ipBase + ((uint32_t*)&imi->resolveDatas[__caseOffsets])[__idx];
+				    }
+				    else 
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchSwitchBinarySearch)
+				{
+				    uint16_t __value = *(uint16_t*)(ip + 2);
+				    uint32_t __caseNum = *(uint32_t*)(ip + 4);
+				    uint32_t __caseRanges = *(uint32_t*)(ip + 8);
+				    uint32_t __caseOffsets = *(uint32_t*)(ip + 12);
+				    int32_t __caseIdx = FindSwitchCaseRange((int32_t*)&imi->resolveDatas[__caseRanges], __caseNum, (*(int32_t*)(localVarBase + __value)));
+				    if (__caseIdx >= 0)
+				    {
+				        ip = ipBase + ((uint32_t*)&imi->resolveDatas[__caseOffsets])[__caseIdx];
+				    }
+				    else
+				    {
+				        ip += 16;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(BranchClassNotEqualVar)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					int32_t __offset = *(int32_t*)(ip + 4);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+				    Il2CppObject* _obj = (*(Il2CppObject**)(localVarBase + __obj));
+				    if (_obj && _obj->klass == __klass)
+				    {
+				        ip += 16;
+				    }
+				    else
+				    {
+				        ip = ipBase + __offset;
+				    }
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LoopHeader)
+				{
+					uint32_t __ilOffset = *(uint32_t*)(ip + 4);
+				    if (imi->backEdgeCountdown > 0)
+				    {
+				        if (DecreaseTierUpCountdown(imi->backEdgeCountdown))
+				        {
+				            InterpreterModule::RequestTierUp(frame->method);
+				        }
+				    }
+				    else
+				    {
+				        // the method has been tiered up, continue the loop in optimized code
+				        const InterpMethodInfo* __osrImi = (const InterpMethodInfo*)frame->method->interpData;
+				        const OsrEntry* __osrEntry;
+				        if (__osrImi != imi && IsTransformedInterpData(__osrImi) && frame->exFlowCount == 0 && (__osrEntry = FindOsrEntry(__osrImi, __ilOffset)))
+				        {
+				            interpFrameGroup.ReplaceFrameCode(frame, __osrImi);
+				            imi = __osrImi;
+				            ipBase = imi->codes;
+				            ip = ipBase + __osrEntry->codeOffset;
+				            HI_DISPATCH_NEXT();
+				        }
+				    }
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+
+				//!!!}}BRANCH
+#pragma endregion
+
+#pragma region FUNCTION
+		//!!!{{FUNCTION
+				HI_OPCODE_CASE(NewClassVar)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					void* __managed2NativeMethod = ((void*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __argIdxs = *(uint32_t*)(ip + 12);
+				    frame->ip = ip + 2;
+				    uint16_t* _argIdxs = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
+				    Il2CppObject* _obj = il2cpp::vm::Object::New(__method->klass);
+				    *(Il2CppObject**)(localVarBase + _argIdxs[0]) = _obj;
+				    ((Managed2NativeCallMethod)__managed2NativeMethod)(__method, _argIdxs, localVarBase, nullptr);
+				    (*(Il2CppObject**)(localVarBase + __obj)) = _obj;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(NewClassVar_Ctor_0)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+				    frame->ip = ip + 2;
+				    Il2CppObject* _obj = il2cpp::vm::Object::New(__method->klass);
+				    ((NativeClassCtor0)(__method->methodPointerCallByInterp))(_obj, __method);
+				    (*(Il2CppObject**)(localVarBase + __obj)) = _obj;
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(NewClassVar_NotCtor)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+				    frame->ip = ip + 2;
+				    (*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::New(__klass);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(NewValueTypeVar)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					void* __managed2NativeMethod = ((void*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __argIdxs = *(uint32_t*)(ip + 12);
+				    frame->ip = ip + 2;
+				    uint16_t* _argIdxs = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
+				    int32_t _typeSize = GetTypeValueSize(__method->klass);
+				    // arg1, arg2, ..., argN, value type, __this
+				    StackObject* _frameBasePtr = localVarBase + _argIdxs[0];
+				    Il2CppObject* _this = (Il2CppObject*)(_frameBasePtr - GetStackSizeByByteSize(_typeSize));
+				    _frameBasePtr->ptr = _this;
+				    ((Managed2NativeCallMethod)__managed2NativeMethod)(__method, _argIdxs, localVarBase, nullptr);
+				    std::memmove((void*)(localVarBase + __obj), _this, _typeSize);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(NewValueTypeVar_Ctor_0)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 				    InitDefaultN((void*)(localVarBase + __obj), __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassInterpVar:
+				HI_OPCODE_CASE(NewClassInterpVar)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 12)]);
@@ -4790,9 +6976,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    _frameBasePtr->obj = _newObj; // prepare this 
 				    (*(Il2CppObject**)(localVarBase + __obj)) = _newObj; // set must after move
 				    CALL_INTERP_VOID((ip + 16), __method, _frameBasePtr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewClassInterpVar_Ctor_0:
+				HI_OPCODE_CASE(NewClassInterpVar_Ctor_0)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
@@ -4803,9 +6989,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    _frameBasePtr->obj = _newObj; // prepare this 
 				    (*(Il2CppObject**)(localVarBase + __obj)) = _newObj;
 				    CALL_INTERP_VOID((ip + 16), __method, _frameBasePtr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewValueTypeInterpVar:
+				HI_OPCODE_CASE(NewValueTypeInterpVar)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 12)]);
@@ -4817,109 +7003,109 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_frameBasePtr + 1, (void*)(localVarBase + __argBase), __argStackObjectNum * sizeof(StackObject)); // move arg
 				    _frameBasePtr->ptr = (StackObject*)(void*)(localVarBase + __obj);
 				    CALL_INTERP_VOID((ip + 16), __method, _frameBasePtr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::AdjustValueTypeRefVar:
+				HI_OPCODE_CASE(AdjustValueTypeRefVar)
 				{
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    // ref => fake value type boxed object value. // fake obj = ref(value_type) - sizeof(Il2CppObject)
 				    StackObject* _thisSo = ((StackObject*)((void*)(localVarBase + __data)));
 				    _thisSo->obj -= 1;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::BoxRefVarVar:
+				HI_OPCODE_CASE(BoxRefVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(Il2CppObject**)(localVarBase + __dst)) = il2cpp::vm::Object::Box(__klass, (*(void**)(localVarBase + __src)));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdvirftnVarVar:
+				HI_OPCODE_CASE(LdvirftnVarVar)
 				{
 					uint16_t __resultMethod = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					MethodInfo* __virtualMethod = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(MethodInfo**)(localVarBase + __resultMethod)) = GET_OBJECT_VIRTUAL_METHOD((*(Il2CppObject**)(localVarBase + __obj)), __virtualMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_1:
+				HI_OPCODE_CASE(RetVar_ret_1)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(1, 8);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_2:
+				HI_OPCODE_CASE(RetVar_ret_2)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(2, 8);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_4:
+				HI_OPCODE_CASE(RetVar_ret_4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(4, 8);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_8:
+				HI_OPCODE_CASE(RetVar_ret_8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(8, 8);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_12:
+				HI_OPCODE_CASE(RetVar_ret_12)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(12, 12);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_16:
+				HI_OPCODE_CASE(RetVar_ret_16)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(16, 16);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_20:
+				HI_OPCODE_CASE(RetVar_ret_20)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(20, 20);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_24:
+				HI_OPCODE_CASE(RetVar_ret_24)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(24, 24);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_28:
+				HI_OPCODE_CASE(RetVar_ret_28)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(28, 28);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_32:
+				HI_OPCODE_CASE(RetVar_ret_32)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    SET_RET_AND_LEAVE_FRAME(32, 32);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_ret_n:
+				HI_OPCODE_CASE(RetVar_ret_n)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint32_t __size = *(uint32_t*)(ip + 4);
 				    std::memmove(frame->ret, (void*)(localVarBase + __ret), __size);
 					LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RetVar_void:
+				HI_OPCODE_CASE(RetVar_void)
 				{
 					LEAVE_FRAME();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNativeInstance_void:
+				HI_OPCODE_CASE(CallNativeInstance_void)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 4);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 8);
@@ -4929,9 +7115,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((localVarBase + _resolvedArgIdxs[0])->obj);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(((MethodInfo*)imi->resolveDatas[__methodInfo]), _resolvedArgIdxs, localVarBase, nullptr);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNativeInstance_ret:
+				HI_OPCODE_CASE(CallNativeInstance_ret)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 4);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 8);
@@ -4943,9 +7129,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _ret = (void*)(localVarBase + __ret);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(((MethodInfo*)imi->resolveDatas[__methodInfo]), _resolvedArgIdxs, localVarBase, _ret);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNativeInstance_ret_expand:
+				HI_OPCODE_CASE(CallNativeInstance_ret_expand)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 8);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 12);
@@ -4959,9 +7145,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(((MethodInfo*)imi->resolveDatas[__methodInfo]), _resolvedArgIdxs, localVarBase, _ret);
 				    ExpandLocationData2StackDataByType(_ret, (LocationDataType)__retLocationType);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNativeStatic_void:
+				HI_OPCODE_CASE(CallNativeStatic_void)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 4);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 8);
@@ -4971,9 +7157,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					RuntimeInitClassCCtorWithoutInitClass(_resolvedMethod);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(_resolvedMethod, ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase, nullptr);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNativeStatic_ret:
+				HI_OPCODE_CASE(CallNativeStatic_ret)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 4);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 8);
@@ -4985,9 +7171,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _ret = (void*)(localVarBase + __ret);
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(_resolvedMethod, ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase, _ret);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallNativeStatic_ret_expand:
+				HI_OPCODE_CASE(CallNativeStatic_ret_expand)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 8);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 12);
@@ -5001,9 +7187,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(_resolvedMethod, ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase, _ret);
 				    ExpandLocationData2StackDataByType(_ret, (LocationDataType)__retLocationType);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterp_void:
+				HI_OPCODE_CASE(CallInterp_void)
 				{
 					MethodInfo* __methodInfo = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint16_t __argBase = *(uint16_t*)(ip + 2);
@@ -5012,9 +7198,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 						CHECK_NOT_NULL_THROW((localVarBase + __argBase)->obj);
 					}
 					CALL_INTERP_VOID((ip + 8), __methodInfo, (StackObject*)(void*)(localVarBase + __argBase));
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterp_ret:
+				HI_OPCODE_CASE(CallInterp_ret)
 				{
 					MethodInfo* __methodInfo = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint16_t __argBase = *(uint16_t*)(ip + 2);
@@ -5024,16 +7210,16 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 						CHECK_NOT_NULL_THROW((localVarBase + __argBase)->obj);
 					}
 					CALL_INTERP_RET((ip + 16), __methodInfo, (StackObject*)(void*)(localVarBase + __argBase), (void*)(localVarBase + __ret));
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallVirtual_void:
+				HI_OPCODE_CASE(CallVirtual_void)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 4);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 8);
 					uint32_t __argIdxs = *(uint32_t*)(ip + 12);
 				    uint16_t* _argIdxData = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
 					StackObject* _objPtr = localVarBase + _argIdxData[0];
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD( _objPtr->obj, ((MethodInfo*)imi->resolveDatas[__methodInfo]));
+				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD_CACHED(_objPtr->obj, ((VirtualCallInlineCache*)&imi->resolveDatas[__methodInfo]));
 				    if (IS_CLASS_VALUE_TYPE(_actualMethod->klass))
 				    {
 				        _objPtr->obj += 1;
@@ -5052,9 +7238,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(_actualMethod, _argIdxData, localVarBase, nullptr);
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallVirtual_ret:
+				HI_OPCODE_CASE(CallVirtual_ret)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 4);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 8);
@@ -5062,7 +7248,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    uint16_t* _argIdxData = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
 					StackObject* _objPtr = localVarBase + _argIdxData[0];
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_objPtr->obj, ((MethodInfo*)imi->resolveDatas[__methodInfo]));
+				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD_CACHED(_objPtr->obj, ((VirtualCallInlineCache*)&imi->resolveDatas[__methodInfo]));
 				    void* _ret = (void*)(localVarBase + __ret);
 				    if (IS_CLASS_VALUE_TYPE(_actualMethod->klass))
 				    {
@@ -5082,9 +7268,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        ((Managed2NativeCallMethod)imi->resolveDatas[__managed2NativeMethod])(_actualMethod, _argIdxData, localVarBase, _ret);
 				        ip += 16;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallVirtual_ret_expand:
+				HI_OPCODE_CASE(CallVirtual_ret_expand)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 8);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 12);
@@ -5093,7 +7279,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint8_t __retLocationType = *(uint8_t*)(ip + 2);
 				    uint16_t* _argIdxData = ((uint16_t*)&imi->resolveDatas[__argIdxs]);
 					StackObject* _objPtr = localVarBase + _argIdxData[0];
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_objPtr->obj, ((MethodInfo*)imi->resolveDatas[__methodInfo]));
+				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD_CACHED(_objPtr->obj, ((VirtualCallInlineCache*)&imi->resolveDatas[__methodInfo]));
 				    void* _ret = (void*)(localVarBase + __ret);
 				    if (IS_CLASS_VALUE_TYPE(_actualMethod->klass))
 				    {
@@ -5114,36 +7300,36 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        ExpandLocationData2StackDataByType(_ret, (LocationDataType)__retLocationType);
 				        ip += 24;
 				    }
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterpVirtual_void:
+				HI_OPCODE_CASE(CallInterpVirtual_void)
 				{
-					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					VirtualCallInlineCache* __method = ((VirtualCallInlineCache*)&imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint16_t __argBase = *(uint16_t*)(ip + 2);
 				    StackObject* _argBasePtr = (StackObject*)(void*)(localVarBase + __argBase);
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_argBasePtr->obj, __method);
+				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD_CACHED(_argBasePtr->obj, __method);
 				    if (IS_CLASS_VALUE_TYPE(_actualMethod->klass))
 				    {
 				        _argBasePtr->obj += 1;
 				    }
 				    CALL_INTERP_VOID((ip + 8), _actualMethod, _argBasePtr);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInterpVirtual_ret:
+				HI_OPCODE_CASE(CallInterpVirtual_ret)
 				{
-					MethodInfo* __method = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					VirtualCallInlineCache* __method = ((VirtualCallInlineCache*)&imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint16_t __argBase = *(uint16_t*)(ip + 2);
 					uint16_t __ret = *(uint16_t*)(ip + 4);
 				    StackObject* _argBasePtr = (StackObject*)(void*)(localVarBase + __argBase);
-				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD(_argBasePtr->obj, __method);
+				    MethodInfo* _actualMethod = GET_OBJECT_VIRTUAL_METHOD_CACHED(_argBasePtr->obj, __method);
 				    if (IS_CLASS_VALUE_TYPE(_actualMethod->klass))
 				    {
 				        _argBasePtr->obj += 1;
 				    }
 				    CALL_INTERP_RET((ip + 16), _actualMethod, _argBasePtr, (void*)(localVarBase + __ret));
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInd_void:
+				HI_OPCODE_CASE(CallInd_void)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 4);
 					uint32_t __managed2NativeFunctionPointerMethod = *(uint32_t*)(ip + 8);
@@ -5170,7 +7356,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					    if (IsInterpreterImplement(_method))
 					    {
 				            CALL_INTERP_VOID((ip + 24), _method, _argBasePtr);
-				            continue;
+				            HI_DISPATCH_NEXT();
 					    }
 					    if (!InitAndGetInterpreterDirectlyCallMethodPointer(_method))
 					    {
@@ -5183,9 +7369,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        _nativeMethodPointer2(_methodPointer, _argIdxsPtr, localVarBase, nullptr);
 				    }
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInd_ret:
+				HI_OPCODE_CASE(CallInd_ret)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 8);
 					uint32_t __managed2NativeFunctionPointerMethod = *(uint32_t*)(ip + 12);
@@ -5214,7 +7400,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					    if (IsInterpreterImplement(_method))
 					    {
 				            CALL_INTERP_RET((ip + 24), _method, _argBasePtr, _ret);
-				            continue;
+				            HI_DISPATCH_NEXT();
 					    }
 					    if (!InitAndGetInterpreterDirectlyCallMethodPointer(_method))
 					    {
@@ -5227,9 +7413,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				        _nativeMethodPointer2(_methodPointer, _argIdxsPtr, localVarBase, _ret);
 				    }
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallInd_ret_expand:
+				HI_OPCODE_CASE(CallInd_ret_expand)
 				{
 					uint32_t __managed2NativeMethod = *(uint32_t*)(ip + 8);
 					uint32_t __managed2NativeFunctionPointerMethod = *(uint32_t*)(ip + 12);
@@ -5259,7 +7445,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					    if (IsInterpreterImplement(_method))
 					    {
 				            CALL_INTERP_RET((ip + 24), _method, _argBasePtr, _ret);
-				            continue;
+				            HI_DISPATCH_NEXT();
 					    }
 					    if (!InitAndGetInterpreterDirectlyCallMethodPointer(_method))
 					    {
@@ -5273,9 +7459,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    }
 				    ExpandLocationData2StackDataByType(_ret, (LocationDataType)__retLocationType);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallPInvoke_void:
+				HI_OPCODE_CASE(CallPInvoke_void)
 				{
 					uint32_t __managed2NativeFunctionPointerMethod = *(uint32_t*)(ip + 4);
 					uint32_t __pinvokeMethodPointer = *(uint32_t*)(ip + 8);
@@ -5287,9 +7473,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					StackObject* _argBasePtr = localVarBase + _argIdxsPtr[0];
 				    _managed2NativeFuncMethodPointer(_pinvokeMethodPointer, _argIdxsPtr, localVarBase, nullptr);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallPInvoke_ret:
+				HI_OPCODE_CASE(CallPInvoke_ret)
 				{
 					uint32_t __managed2NativeFunctionPointerMethod = *(uint32_t*)(ip + 4);
 					uint32_t __pinvokeMethodPointer = *(uint32_t*)(ip + 8);
@@ -5303,9 +7489,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					StackObject* _argBasePtr = localVarBase + _argIdxsPtr[0];
 				    _managed2NativeFuncMethodPointer(_pinvokeMethodPointer, _argIdxsPtr, localVarBase, _ret);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallPInvoke_ret_expand:
+				HI_OPCODE_CASE(CallPInvoke_ret_expand)
 				{
 					uint32_t __managed2NativeFunctionPointerMethod = *(uint32_t*)(ip + 8);
 					uint32_t __pinvokeMethodPointer = *(uint32_t*)(ip + 12);
@@ -5321,9 +7507,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    _managed2NativeFuncMethodPointer(_pinvokeMethodPointer, _argIdxsPtr, localVarBase, _ret);
 				    ExpandLocationData2StackDataByType(_ret, (LocationDataType)__retLocationType);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallDelegateInvoke_void:
+				HI_OPCODE_CASE(CallDelegateInvoke_void)
 				{
 					uint32_t __managed2NativeStaticMethod = *(uint32_t*)(ip + 4);
 					uint32_t __managed2NativeInstanceMethod = *(uint32_t*)(ip + 8);
@@ -5374,7 +7560,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 							}
 							}
 							CALL_INTERP_RET((ip + 16), method, _argBasePtr, _ret);
-							continue;
+							HI_DISPATCH_NEXT();
 						}
 						else
 						{
@@ -5399,9 +7585,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 						}
 					}
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallDelegateInvoke_ret:
+				HI_OPCODE_CASE(CallDelegateInvoke_ret)
 				{
 					uint32_t __managed2NativeStaticMethod = *(uint32_t*)(ip + 8);
 					uint32_t __managed2NativeInstanceMethod = *(uint32_t*)(ip + 12);
@@ -5456,7 +7642,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 							}
 							}
 							CALL_INTERP_RET((ip + 24), method, _argBasePtr, _ret);
-							continue;
+							HI_DISPATCH_NEXT();
 						}
 						else
 						{
@@ -5482,9 +7668,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					}
 					CopyStackObject((StackObject*)_ret, _tempRet, __retTypeStackObjectSize);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallDelegateInvoke_ret_expand:
+				HI_OPCODE_CASE(CallDelegateInvoke_ret_expand)
 				{
 					uint32_t __managed2NativeStaticMethod = *(uint32_t*)(ip + 8);
 					uint32_t __managed2NativeInstanceMethod = *(uint32_t*)(ip + 12);
@@ -5538,7 +7724,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 							}
 							}
 							CALL_INTERP_RET((ip + 24), method, _argBasePtr, _ret);
-							continue;
+							HI_DISPATCH_NEXT();
 						}
 						else
 						{
@@ -5564,9 +7750,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					}
 				    CopyLocationData2StackDataByType((StackObject*)_ret, _tempRet, (LocationDataType)__retLocationType);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallDelegateBeginInvoke:
+				HI_OPCODE_CASE(CallDelegateBeginInvoke)
 				{
 					uint16_t __result = *(uint16_t*)(ip + 2);
 					uint32_t __methodInfo = *(uint32_t*)(ip + 4);
@@ -5574,18 +7760,18 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    frame->ip = ip + 2;
 					(*(Il2CppObject**)(localVarBase + __result)) = InvokeDelegateBeginInvoke(((MethodInfo*)imi->resolveDatas[__methodInfo]), ((uint16_t*)&imi->resolveDatas[__argIdxs]), localVarBase);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallDelegateEndInvoke_void:
+				HI_OPCODE_CASE(CallDelegateEndInvoke_void)
 				{
 					uint32_t __methodInfo = *(uint32_t*)(ip + 4);
 					uint16_t __asyncResult = *(uint16_t*)(ip + 2);
 				    frame->ip = ip + 2;
 				    InvokeDelegateEndInvokeVoid(((MethodInfo*)imi->resolveDatas[__methodInfo]), (Il2CppAsyncResult*)(*(Il2CppObject**)(localVarBase + __asyncResult)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallDelegateEndInvoke_ret:
+				HI_OPCODE_CASE(CallDelegateEndInvoke_ret)
 				{
 					uint32_t __methodInfo = *(uint32_t*)(ip + 8);
 					uint16_t __asyncResult = *(uint16_t*)(ip + 2);
@@ -5593,9 +7779,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    frame->ip = ip + 2;
 				    InvokeDelegateEndInvokeRet(((MethodInfo*)imi->resolveDatas[__methodInfo]), (Il2CppAsyncResult*)(*(Il2CppObject**)(localVarBase + __asyncResult)), (void*)(localVarBase + __ret));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewDelegate:
+				HI_OPCODE_CASE(NewDelegate)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
@@ -5605,9 +7791,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    ConstructDelegate(del, (*(Il2CppObject**)(localVarBase + __obj)), (*(MethodInfo**)(localVarBase + __method)));
 				    (*(Il2CppObject**)(localVarBase + __dst)) = (Il2CppObject*)del;
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CtorDelegate:
+				HI_OPCODE_CASE(CtorDelegate)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					MethodInfo* __ctor = ((MethodInfo*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
@@ -5617,9 +7803,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    ConstructorDelegate2(__ctor, _del, (*(Il2CppObject**)(localVarBase + __obj)), (*(MethodInfo**)(localVarBase + __method)));
 				    (*(Il2CppObject**)(localVarBase + __dst)) = (Il2CppObject*)_del;
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5630,9 +7816,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i1_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i1_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5644,9 +7830,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int8_t(*_NativeMethod_)(void*, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5658,9 +7844,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i2_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i2_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5672,9 +7858,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int16_t(*_NativeMethod_)(void*, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u2_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u2_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5686,9 +7872,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint16_t(*_NativeMethod_)(void*, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5700,9 +7886,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5714,9 +7900,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5728,9 +7914,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_0:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5742,9 +7928,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5756,9 +7942,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5771,9 +7957,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int32_t, int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5787,9 +7973,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5804,9 +7990,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5818,9 +8004,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5833,9 +8019,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int64_t, int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5849,9 +8035,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5866,9 +8052,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5880,9 +8066,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5895,9 +8081,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, float, float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5911,9 +8097,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, float, float, float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5928,9 +8114,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, float, float, float, float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5942,9 +8128,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5957,9 +8143,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, double, double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5973,9 +8159,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, double, double, double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_v_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_v_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -5990,9 +8176,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(void*, double, double, double, double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6005,9 +8191,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6021,9 +8207,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6038,9 +8224,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6056,9 +8242,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6071,9 +8257,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6087,9 +8273,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6104,9 +8290,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6122,9 +8308,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6137,9 +8323,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6153,9 +8339,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6170,9 +8356,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6188,9 +8374,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, float, float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6203,9 +8389,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6219,9 +8405,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6236,9 +8422,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_u1_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_u1_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6254,9 +8440,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(void*, double, double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6269,9 +8455,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6285,9 +8471,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6302,9 +8488,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6320,9 +8506,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6335,9 +8521,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6351,9 +8537,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6368,9 +8554,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6386,9 +8572,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6401,9 +8587,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6417,9 +8603,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6434,9 +8620,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6452,9 +8638,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, float, float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6467,9 +8653,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6483,9 +8669,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6500,9 +8686,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i4_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i4_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6518,9 +8704,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(void*, double, double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6533,9 +8719,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6549,9 +8735,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int32_t, int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6566,9 +8752,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6584,9 +8770,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6599,9 +8785,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6615,9 +8801,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int64_t, int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6632,9 +8818,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6650,9 +8836,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6665,9 +8851,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6681,9 +8867,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, float, float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6698,9 +8884,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, float, float, float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6716,9 +8902,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, float, float, float, float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6731,9 +8917,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6747,9 +8933,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, double, double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6764,9 +8950,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, double, double, double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_i8_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_i8_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6782,9 +8968,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(void*, double, double, double, double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6797,9 +8983,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6813,9 +8999,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int32_t, int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6830,9 +9016,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6848,9 +9034,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6863,9 +9049,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6879,9 +9065,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int64_t, int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6896,9 +9082,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6914,9 +9100,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6929,9 +9115,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6945,9 +9131,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, float, float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6962,9 +9148,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, float, float, float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6980,9 +9166,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, float, float, float, float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -6995,9 +9181,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7011,9 +9197,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, double, double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7028,9 +9214,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, double, double, double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f4_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f4_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7046,9 +9232,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(void*, double, double, double, double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7061,9 +9247,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7077,9 +9263,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int32_t, int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7094,9 +9280,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7112,9 +9298,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7127,9 +9313,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7143,9 +9329,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int64_t, int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7160,9 +9346,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7178,9 +9364,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7193,9 +9379,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7209,9 +9395,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, float, float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7226,9 +9412,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, float, float, float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7244,9 +9430,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, float, float, float, float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7259,9 +9445,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7275,9 +9461,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, double, double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7292,9 +9478,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, double, double, double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeInstance_f8_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeInstance_f8_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 16);
 					uint16_t __self = *(uint16_t*)(ip + 2);
@@ -7310,9 +9496,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(void*, double, double, double, double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_self, (*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 24;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 				    frame->ip = ip + 2;
@@ -7321,9 +9507,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i1_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i1_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7333,9 +9519,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int8_t(*_NativeMethod_)(MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7345,9 +9531,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i2_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i2_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7357,9 +9543,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int16_t(*_NativeMethod_)(MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u2_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u2_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7369,9 +9555,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint16_t(*_NativeMethod_)(MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7381,9 +9567,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7393,9 +9579,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7405,9 +9591,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_0:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_0)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __ret = *(uint16_t*)(ip + 2);
@@ -7417,9 +9603,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)(_resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7429,9 +9615,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7442,9 +9628,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int32_t, int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7456,9 +9642,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int32_t, int32_t, int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7471,9 +9657,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7483,9 +9669,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7496,9 +9682,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int64_t, int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7510,9 +9696,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int64_t, int64_t, int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7525,9 +9711,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7537,9 +9723,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7550,9 +9736,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(float, float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7564,9 +9750,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(float, float, float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7579,9 +9765,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(float, float, float, float, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 4);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7591,9 +9777,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7604,9 +9790,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(double, double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7618,9 +9804,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(double, double, double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_v_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_v_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7633,9 +9819,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef void(*_NativeMethod_)(double, double, double, double, MethodInfo*);
 				    ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7646,9 +9832,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7660,9 +9846,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7675,9 +9861,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7691,9 +9877,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7704,9 +9890,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7718,9 +9904,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7733,9 +9919,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7749,9 +9935,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7762,9 +9948,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7776,9 +9962,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7791,9 +9977,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7807,9 +9993,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(float, float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7820,9 +10006,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7834,9 +10020,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7849,9 +10035,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_u1_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_u1_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7865,9 +10051,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef uint8_t(*_NativeMethod_)(double, double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7878,9 +10064,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7892,9 +10078,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7907,9 +10093,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7923,9 +10109,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7936,9 +10122,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7950,9 +10136,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7965,9 +10151,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7981,9 +10167,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -7994,9 +10180,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8008,9 +10194,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8023,9 +10209,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8039,9 +10225,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(float, float, float, float, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8052,9 +10238,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8066,9 +10252,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8081,9 +10267,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i4_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i4_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8097,9 +10283,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int32_t(*_NativeMethod_)(double, double, double, double, MethodInfo*);
 				    *(int32_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8110,9 +10296,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8124,9 +10310,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int32_t, int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8139,9 +10325,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8155,9 +10341,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8168,9 +10354,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8182,9 +10368,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int64_t, int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8197,9 +10383,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8213,9 +10399,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8226,9 +10412,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8240,9 +10426,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(float, float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8255,9 +10441,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(float, float, float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8271,9 +10457,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(float, float, float, float, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8284,9 +10470,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8298,9 +10484,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(double, double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8313,9 +10499,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(double, double, double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_i8_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_i8_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8329,9 +10515,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef int64_t(*_NativeMethod_)(double, double, double, double, MethodInfo*);
 				    *(int64_t*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8342,9 +10528,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8356,9 +10542,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int32_t, int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8371,9 +10557,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int32_t, int32_t, int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8387,9 +10573,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8400,9 +10586,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8414,9 +10600,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int64_t, int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8429,9 +10615,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int64_t, int64_t, int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8445,9 +10631,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8458,9 +10644,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8472,9 +10658,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(float, float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8487,9 +10673,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(float, float, float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8503,9 +10689,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(float, float, float, float, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8516,9 +10702,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8530,9 +10716,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(double, double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8545,9 +10731,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(double, double, double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f4_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f4_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8561,9 +10747,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef float(*_NativeMethod_)(double, double, double, double, MethodInfo*);
 				    *(float*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8574,9 +10760,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8588,9 +10774,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int32_t, int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8603,9 +10789,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int32_t, int32_t, int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8619,9 +10805,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int32_t, int32_t, int32_t, int32_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int32_t*)(localVarBase + __param0)), (*(int32_t*)(localVarBase + __param1)), (*(int32_t*)(localVarBase + __param2)), (*(int32_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8632,9 +10818,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8646,9 +10832,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int64_t, int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8661,9 +10847,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int64_t, int64_t, int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_i8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_i8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8677,9 +10863,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(int64_t, int64_t, int64_t, int64_t, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(int64_t*)(localVarBase + __param0)), (*(int64_t*)(localVarBase + __param1)), (*(int64_t*)(localVarBase + __param2)), (*(int64_t*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f4_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f4_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8690,9 +10876,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f4_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f4_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8704,9 +10890,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(float, float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f4_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f4_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8719,9 +10905,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(float, float, float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f4_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f4_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8735,9 +10921,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(float, float, float, float, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(float*)(localVarBase + __param0)), (*(float*)(localVarBase + __param1)), (*(float*)(localVarBase + __param2)), (*(float*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f8_1:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f8_1)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8748,9 +10934,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f8_2:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f8_2)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 8);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8762,9 +10948,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(double, double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f8_3:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f8_3)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8777,9 +10963,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(double, double, double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CallCommonNativeStatic_f8_f8_4:
+				HI_OPCODE_CASE(CallCommonNativeStatic_f8_f8_4)
 				{
 					uint32_t __method = *(uint32_t*)(ip + 12);
 					uint16_t __param0 = *(uint16_t*)(ip + 2);
@@ -8793,7 +10979,7 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    typedef double(*_NativeMethod_)(double, double, double, double, MethodInfo*);
 				    *(double*)(void*)(localVarBase + __ret) = ((_NativeMethod_)_resolvedMethod->methodPointerCallByInterp)((*(double*)(localVarBase + __param0)), (*(double*)(localVarBase + __param1)), (*(double*)(localVarBase + __param2)), (*(double*)(localVarBase + __param3)), _resolvedMethod);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}FUNCTION
@@ -8801,84 +10987,84 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
 #pragma region OBJECT
 		//!!!{{OBJECT
-				case HiOpcodeEnum::BoxVarVar:
+				HI_OPCODE_CASE(BoxVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __data = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(Il2CppObject**)(localVarBase + __dst)) = il2cpp::vm::Object::Box(__klass, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnBoxVarVar:
+				HI_OPCODE_CASE(UnBoxVarVar)
 				{
 					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(void**)(localVarBase + __addr)) = HiUnbox((*(Il2CppObject**)(localVarBase + __obj)), __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnBoxAnyVarVar:
+				HI_OPCODE_CASE(UnBoxAnyVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    HiUnboxAny2StackObject((*(Il2CppObject**)(localVarBase + __obj)), __klass, (void*)(localVarBase + __dst));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CastclassVar:
+				HI_OPCODE_CASE(CastclassVar)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint32_t __klass = *(uint32_t*)(ip + 4);
 				    HiCastClass((*(Il2CppObject**)(localVarBase + __obj)), ((Il2CppClass*)imi->resolveDatas[__klass]));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::IsInstVar:
+				HI_OPCODE_CASE(IsInstVar)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint32_t __klass = *(uint32_t*)(ip + 4);
 				    (*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::IsInst((*(Il2CppObject**)(localVarBase + __obj)), ((Il2CppClass*)imi->resolveDatas[__klass]));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdtokenVar:
+				HI_OPCODE_CASE(LdtokenVar)
 				{
 					uint16_t __runtimeHandle = *(uint16_t*)(ip + 2);
 					void* __token = ((void*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 				    (*(void**)(localVarBase + __runtimeHandle)) = __token;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::MakeRefVarVar:
+				HI_OPCODE_CASE(MakeRefVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __data = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(Il2CppTypedRef*)(localVarBase + __dst)) = MAKE_TYPEDREFERENCE(__klass, (*(void**)(localVarBase + __data)));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RefAnyTypeVarVar:
+				HI_OPCODE_CASE(RefAnyTypeVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __typedRef = *(uint16_t*)(ip + 4);
 				    (*(void**)(localVarBase + __dst)) = RefAnyType((*(Il2CppTypedRef*)(localVarBase + __typedRef)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RefAnyValueVarVar:
+				HI_OPCODE_CASE(RefAnyValueVarVar)
 				{
 					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __typedRef = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(void**)(localVarBase + __addr)) = RefAnyValue((*(Il2CppTypedRef*)(localVarBase + __typedRef)), __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_ref:
+				HI_OPCODE_CASE(CpobjVarVar_ref)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -8886,107 +11072,107 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    *_dstAddr_ = *(void**)(*(void**)(localVarBase + __src));
 				    HYBRIDCLR_SET_WRITE_BARRIER(_dstAddr_);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_1:
+				HI_OPCODE_CASE(CpobjVarVar_1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy1((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_2:
+				HI_OPCODE_CASE(CpobjVarVar_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy2((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_4:
+				HI_OPCODE_CASE(CpobjVarVar_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy4((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_8:
+				HI_OPCODE_CASE(CpobjVarVar_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy8((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_12:
+				HI_OPCODE_CASE(CpobjVarVar_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy12((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_16:
+				HI_OPCODE_CASE(CpobjVarVar_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy16((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_20:
+				HI_OPCODE_CASE(CpobjVarVar_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy20((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_24:
+				HI_OPCODE_CASE(CpobjVarVar_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy24((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_28:
+				HI_OPCODE_CASE(CpobjVarVar_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy28((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_32:
+				HI_OPCODE_CASE(CpobjVarVar_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy32((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_n_2:
+				HI_OPCODE_CASE(CpobjVarVar_n_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __size = *(uint16_t*)(ip + 6);
 					std::memmove((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)), __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_n_4:
+				HI_OPCODE_CASE(CpobjVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint32_t __size = *(uint32_t*)(ip + 8);
 					std::memmove((*(void**)(localVarBase + __dst)), (*(void**)(localVarBase + __src)), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_WriteBarrier_n_2:
+				HI_OPCODE_CASE(CpobjVarVar_WriteBarrier_n_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -8995,9 +11181,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_dstAddr_, (*(void**)(localVarBase + __src)), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_dstAddr_, __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CpobjVarVar_WriteBarrier_n_4:
+				HI_OPCODE_CASE(CpobjVarVar_WriteBarrier_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -9006,106 +11192,106 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_dstAddr_, (*(void**)(localVarBase + __src)), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_dstAddr_, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_ref:
+				HI_OPCODE_CASE(LdobjVarVar_ref)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					*(void**)(void*)(localVarBase + __dst) = (*(void**)*(void**)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_1:
+				HI_OPCODE_CASE(LdobjVarVar_1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy1((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_2:
+				HI_OPCODE_CASE(LdobjVarVar_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy2((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_4:
+				HI_OPCODE_CASE(LdobjVarVar_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy4((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_8:
+				HI_OPCODE_CASE(LdobjVarVar_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy8((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_12:
+				HI_OPCODE_CASE(LdobjVarVar_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy12((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_16:
+				HI_OPCODE_CASE(LdobjVarVar_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy16((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_20:
+				HI_OPCODE_CASE(LdobjVarVar_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy20((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_24:
+				HI_OPCODE_CASE(LdobjVarVar_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy24((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_28:
+				HI_OPCODE_CASE(LdobjVarVar_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy28((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_32:
+				HI_OPCODE_CASE(LdobjVarVar_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy32((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdobjVarVar_n_4:
+				HI_OPCODE_CASE(LdobjVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint32_t __size = *(uint32_t*)(ip + 8);
 					std::memmove((void*)(localVarBase + __dst), (*(void**)(localVarBase + __src)), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_ref:
+				HI_OPCODE_CASE(StobjVarVar_ref)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -9113,98 +11299,98 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    *_dstAddr_ = (*(Il2CppObject**)(localVarBase + __src));
 				    HYBRIDCLR_SET_WRITE_BARRIER(_dstAddr_);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_1:
+				HI_OPCODE_CASE(StobjVarVar_1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy1((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_2:
+				HI_OPCODE_CASE(StobjVarVar_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy2((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_4:
+				HI_OPCODE_CASE(StobjVarVar_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy4((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_8:
+				HI_OPCODE_CASE(StobjVarVar_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy8((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_12:
+				HI_OPCODE_CASE(StobjVarVar_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy12((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_16:
+				HI_OPCODE_CASE(StobjVarVar_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy16((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_20:
+				HI_OPCODE_CASE(StobjVarVar_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy20((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_24:
+				HI_OPCODE_CASE(StobjVarVar_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy24((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_28:
+				HI_OPCODE_CASE(StobjVarVar_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy28((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_32:
+				HI_OPCODE_CASE(StobjVarVar_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					Copy32((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_n_4:
+				HI_OPCODE_CASE(StobjVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint32_t __size = *(uint32_t*)(ip + 8);
 					std::memmove((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __src), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StobjVarVar_WriteBarrier_n_4:
+				HI_OPCODE_CASE(StobjVarVar_WriteBarrier_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
@@ -9213,9 +11399,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_dstAddr_, (void*)(localVarBase + __src), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_dstAddr_, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_ref:
+				HI_OPCODE_CASE(InitobjVar_ref)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 				    void* _objAddr_ = (*(void**)(localVarBase + __obj));
@@ -9223,203 +11409,275 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    *(void**)_objAddr_ = nullptr;
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_objAddr_);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_1:
+				HI_OPCODE_CASE(InitobjVar_1)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault1((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_2:
+				HI_OPCODE_CASE(InitobjVar_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault2((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_4:
+				HI_OPCODE_CASE(InitobjVar_4)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault4((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_8:
+				HI_OPCODE_CASE(InitobjVar_8)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault8((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_12:
+				HI_OPCODE_CASE(InitobjVar_12)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault12((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_16:
+				HI_OPCODE_CASE(InitobjVar_16)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault16((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_20:
+				HI_OPCODE_CASE(InitobjVar_20)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault20((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_24:
+				HI_OPCODE_CASE(InitobjVar_24)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault24((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_28:
+				HI_OPCODE_CASE(InitobjVar_28)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault28((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_32:
+				HI_OPCODE_CASE(InitobjVar_32)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					InitDefault32((*(void**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_n_2:
+				HI_OPCODE_CASE(InitobjVar_n_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 					InitDefaultN((*(void**)(localVarBase + __obj)), __size);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InitobjVar_n_4)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint32_t __size = *(uint32_t*)(ip + 4);
+					InitDefaultN((*(void**)(localVarBase + __obj)), __size);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InitobjVar_WriteBarrier_n_2)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __size = *(uint16_t*)(ip + 4);
+				    void* _objAddr_ = (*(void**)(localVarBase + __obj));
+				    InitDefaultN(_objAddr_, __size);
+				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_objAddr_, __size);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InitobjVar_WriteBarrier_n_4)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint32_t __size = *(uint32_t*)(ip + 4);
+				    void* _objAddr_ = (*(void**)(localVarBase + __obj));
+				    InitDefaultN(_objAddr_, __size);
+				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_objAddr_, __size);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdstrVar)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint32_t __str = *(uint32_t*)(ip + 4);
+				    (*(Il2CppString**)(localVarBase + __dst)) = ((Il2CppString*)imi->resolveDatas[__str]);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdfldVarVar_i1)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdfldVarVar_u1)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdfldVarVar_i2)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_n_4:
+				HI_OPCODE_CASE(LdfldVarVar_u2)
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					uint32_t __size = *(uint32_t*)(ip + 4);
-					InitDefaultN((*(void**)(localVarBase + __obj)), __size);
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_WriteBarrier_n_2:
+				HI_OPCODE_CASE(LdfldVarVar_i4)
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					uint16_t __size = *(uint16_t*)(ip + 4);
-				    void* _objAddr_ = (*(void**)(localVarBase + __obj));
-				    InitDefaultN(_objAddr_, __size);
-				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_objAddr_, __size);
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitobjVar_WriteBarrier_n_4:
+				HI_OPCODE_CASE(LdfldVarVar_u4)
 				{
-					uint16_t __obj = *(uint16_t*)(ip + 2);
-					uint32_t __size = *(uint32_t*)(ip + 4);
-				    void* _objAddr_ = (*(void**)(localVarBase + __obj));
-				    InitDefaultN(_objAddr_, __size);
-				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_objAddr_, __size);
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdstrVar:
+				HI_OPCODE_CASE(LdfldVarVar_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
-					uint32_t __str = *(uint32_t*)(ip + 4);
-				    (*(Il2CppString**)(localVarBase + __dst)) = ((Il2CppString*)imi->resolveDatas[__str]);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
+				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i1:
+				HI_OPCODE_CASE(LdfldVarVar_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdfldVarVar_i1_NoCheck)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __obj = *(uint16_t*)(ip + 4);
+					uint16_t __offset = *(uint16_t*)(ip + 6);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u1:
+				HI_OPCODE_CASE(LdfldVarVar_u1_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i2:
+				HI_OPCODE_CASE(LdfldVarVar_i2_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u2:
+				HI_OPCODE_CASE(LdfldVarVar_u2_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i4:
+				HI_OPCODE_CASE(LdfldVarVar_i4_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u4:
+				HI_OPCODE_CASE(LdfldVarVar_u4_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_i8:
+				HI_OPCODE_CASE(LdfldVarVar_i8_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_u8:
+				HI_OPCODE_CASE(LdfldVarVar_u8_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
-				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_8:
+				HI_OPCODE_CASE(LdfldVarVar_size_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9427,9 +11685,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy8((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_12:
+				HI_OPCODE_CASE(LdfldVarVar_size_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9437,9 +11695,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy12((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_16:
+				HI_OPCODE_CASE(LdfldVarVar_size_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9447,9 +11705,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy16((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_20:
+				HI_OPCODE_CASE(LdfldVarVar_size_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9457,9 +11715,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy20((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_24:
+				HI_OPCODE_CASE(LdfldVarVar_size_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9467,9 +11725,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy24((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_28:
+				HI_OPCODE_CASE(LdfldVarVar_size_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9477,9 +11735,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy28((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_size_32:
+				HI_OPCODE_CASE(LdfldVarVar_size_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9487,9 +11745,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy32((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_n_2:
+				HI_OPCODE_CASE(LdfldVarVar_n_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9498,9 +11756,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memmove((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldVarVar_n_4:
+				HI_OPCODE_CASE(LdfldVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9509,144 +11767,144 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memmove((void*)(localVarBase + __dst), (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i1:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(int8_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u1:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i2:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(int16_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u2:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i4:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(int32_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u4:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_i8:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __dst)) = *(int64_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_u8:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					(*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)((byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_8:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy8((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_12:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy12((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_16:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy16((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_20:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy20((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_24:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy24((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_28:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy28((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_size_32:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_size_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					uint16_t __offset = *(uint16_t*)(ip + 6);
 					Copy32((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_n_2:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_n_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9654,9 +11912,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __size = *(uint16_t*)(ip + 8);
 					std::memmove((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldValueTypeVarVar_n_4:
+				HI_OPCODE_CASE(LdfldValueTypeVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9664,9 +11922,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint32_t __size = *(uint32_t*)(ip + 8);
 					std::memmove((void*)(localVarBase + __dst), (byte*)(void*)(localVarBase + __obj) + __offset, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdfldaVarVar:
+				HI_OPCODE_CASE(LdfldaVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -9674,9 +11932,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    (*(void**)(localVarBase + __dst)) = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i1:
+				HI_OPCODE_CASE(StfldVarVar_i1)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9685,9 +11943,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(int8_t*)(_fieldAddr_) = (*(int8_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u1:
+				HI_OPCODE_CASE(StfldVarVar_u1)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9696,9 +11954,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(uint8_t*)(_fieldAddr_) = (*(uint8_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i2:
+				HI_OPCODE_CASE(StfldVarVar_i2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9707,9 +11965,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(int16_t*)(_fieldAddr_) = (*(int16_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u2:
+				HI_OPCODE_CASE(StfldVarVar_u2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9718,9 +11976,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(uint16_t*)(_fieldAddr_) = (*(uint16_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i4:
+				HI_OPCODE_CASE(StfldVarVar_i4)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9729,9 +11987,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(int32_t*)(_fieldAddr_) = (*(int32_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u4:
+				HI_OPCODE_CASE(StfldVarVar_u4)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9740,9 +11998,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(uint32_t*)(_fieldAddr_) = (*(uint32_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_i8:
+				HI_OPCODE_CASE(StfldVarVar_i8)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9751,9 +12009,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(int64_t*)(_fieldAddr_) = (*(int64_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_u8:
+				HI_OPCODE_CASE(StfldVarVar_u8)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9762,9 +12020,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(uint64_t*)(_fieldAddr_) = (*(uint64_t*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_ref:
+				HI_OPCODE_CASE(StfldVarVar_ref)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9773,9 +12031,99 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
 				    *(Il2CppObject**)(_fieldAddr_) = (*(Il2CppObject**)(localVarBase + __data));HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_i1_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(int8_t*)(_fieldAddr_) = (*(int8_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_u1_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(uint8_t*)(_fieldAddr_) = (*(uint8_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_i2_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(int16_t*)(_fieldAddr_) = (*(int16_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_u2_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(uint16_t*)(_fieldAddr_) = (*(uint16_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_i4_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(int32_t*)(_fieldAddr_) = (*(int32_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_u4_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(uint32_t*)(_fieldAddr_) = (*(uint32_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_i8_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(int64_t*)(_fieldAddr_) = (*(int64_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_u8_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(uint64_t*)(_fieldAddr_) = (*(uint64_t*)(localVarBase + __data));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StfldVarVar_ref_NoCheck)
+				{
+					uint16_t __obj = *(uint16_t*)(ip + 2);
+					uint16_t __offset = *(uint16_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 6);
+				    void* _fieldAddr_ = (uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset;
+				    *(Il2CppObject**)(_fieldAddr_) = (*(Il2CppObject**)(localVarBase + __data));HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_);
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_8:
+				HI_OPCODE_CASE(StfldVarVar_size_8)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9783,9 +12131,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy8((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_12:
+				HI_OPCODE_CASE(StfldVarVar_size_12)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9793,9 +12141,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy12((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_16:
+				HI_OPCODE_CASE(StfldVarVar_size_16)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9803,9 +12151,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy16((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_20:
+				HI_OPCODE_CASE(StfldVarVar_size_20)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9813,9 +12161,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy20((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_24:
+				HI_OPCODE_CASE(StfldVarVar_size_24)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9823,9 +12171,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy24((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_28:
+				HI_OPCODE_CASE(StfldVarVar_size_28)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9833,9 +12181,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy28((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_size_32:
+				HI_OPCODE_CASE(StfldVarVar_size_32)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9843,9 +12191,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    Copy32((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_n_2:
+				HI_OPCODE_CASE(StfldVarVar_n_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9854,9 +12202,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memmove((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_n_4:
+				HI_OPCODE_CASE(StfldVarVar_n_4)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9865,9 +12213,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    std::memmove((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_WriteBarrier_n_2:
+				HI_OPCODE_CASE(StfldVarVar_WriteBarrier_n_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9878,9 +12226,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StfldVarVar_WriteBarrier_n_4:
+				HI_OPCODE_CASE(StfldVarVar_WriteBarrier_n_4)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __offset = *(uint16_t*)(ip + 4);
@@ -9891,416 +12239,815 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_i1)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_i1);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_u1)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_u1);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_i2)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_i2);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_u2)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_u2);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_i4)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_i4);
+				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_u4)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_u4);
+				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_i8)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_i8);
+				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_u8)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_u8);
+				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)(((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_size_8)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_size_8);
+				    Copy8((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_size_12)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_size_12);
+				    Copy12((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_size_16)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_size_16);
+				    Copy16((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_size_20)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_size_20);
+				    Copy20((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_size_24)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_size_24);
+				    Copy24((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_size_28)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_size_28);
+				    Copy28((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_size_32)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_size_32);
+				    Copy32((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_n_2)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 12);
+					uint16_t __size = *(uint16_t*)(ip + 4);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_n_2);
+				    std::memmove((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldVarVar_n_4)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+					uint32_t __size = *(uint32_t*)(ip + 12);
+				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldInitedVarVar_n_4);
+				    std::memmove((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i1:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u1:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i2:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u2:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i4:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u4:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_i8:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_u8:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)(((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_8:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy8((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_12:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy12((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_16:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy16((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_20:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy20((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_24:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy24((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_28:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy28((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_size_32:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_size_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy32((void*)(localVarBase + __dst), ((byte*)__klass->static_fields) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_n_2:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_n_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 12);
 					uint16_t __size = *(uint16_t*)(ip + 4);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    std::memmove((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldVarVar_n_4:
+				HI_OPCODE_CASE(LdsfldInitedVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
 					uint32_t __size = *(uint32_t*)(ip + 12);
-				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    std::memmove((void*)(localVarBase + __dst), (((byte*)__klass->static_fields) + __offset), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i1:
+				HI_OPCODE_CASE(StsfldVarVar_i1)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_i1);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(int8_t*)(_fieldAddr_) = (*(int8_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u1:
+				HI_OPCODE_CASE(StsfldVarVar_u1)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_u1);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(uint8_t*)(_fieldAddr_) = (*(uint8_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i2:
+				HI_OPCODE_CASE(StsfldVarVar_i2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_i2);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(int16_t*)(_fieldAddr_) = (*(int16_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u2:
+				HI_OPCODE_CASE(StsfldVarVar_u2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_u2);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(uint16_t*)(_fieldAddr_) = (*(uint16_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i4:
+				HI_OPCODE_CASE(StsfldVarVar_i4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_i4);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(int32_t*)(_fieldAddr_) = (*(int32_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u4:
+				HI_OPCODE_CASE(StsfldVarVar_u4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_u4);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(uint32_t*)(_fieldAddr_) = (*(uint32_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_i8:
+				HI_OPCODE_CASE(StsfldVarVar_i8)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_i8);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(int64_t*)(_fieldAddr_) = (*(int64_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_u8:
+				HI_OPCODE_CASE(StsfldVarVar_u8)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_u8);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(uint64_t*)(_fieldAddr_) = (*(uint64_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_ref:
+				HI_OPCODE_CASE(StsfldVarVar_ref)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_ref);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    *(Il2CppObject**)(_fieldAddr_) = (*(Il2CppObject**)(localVarBase + __data));HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_8:
+				HI_OPCODE_CASE(StsfldVarVar_size_8)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_size_8);
 				    Copy8(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_12:
+				HI_OPCODE_CASE(StsfldVarVar_size_12)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_size_12);
 				    Copy12(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_16:
+				HI_OPCODE_CASE(StsfldVarVar_size_16)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_size_16);
 				    Copy16(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_20:
+				HI_OPCODE_CASE(StsfldVarVar_size_20)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_size_20);
 				    Copy20(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_24:
+				HI_OPCODE_CASE(StsfldVarVar_size_24)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_size_24);
 				    Copy24(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_28:
+				HI_OPCODE_CASE(StsfldVarVar_size_28)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_size_28);
 				    Copy28(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_size_32:
+				HI_OPCODE_CASE(StsfldVarVar_size_32)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_size_32);
 				    Copy32(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_n_2:
+				HI_OPCODE_CASE(StsfldVarVar_n_2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 12);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_n_2);
 				    std::memmove(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_n_4:
+				HI_OPCODE_CASE(StsfldVarVar_n_4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 					uint32_t __size = *(uint32_t*)(ip + 12);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_n_4);
 				    std::memmove(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_WriteBarrier_n_2:
+				HI_OPCODE_CASE(StsfldVarVar_WriteBarrier_n_2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 12);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 					uint16_t __size = *(uint16_t*)(ip + 4);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_WriteBarrier_n_2);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StsfldVarVar_WriteBarrier_n_4:
+				HI_OPCODE_CASE(StsfldVarVar_WriteBarrier_n_4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
 					uint16_t __data = *(uint16_t*)(ip + 2);
 					uint32_t __size = *(uint32_t*)(ip + 12);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, StsfldInitedVarVar_WriteBarrier_n_4);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
+				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i1)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(int8_t*)(_fieldAddr_) = (*(int8_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u1)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(uint8_t*)(_fieldAddr_) = (*(uint8_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i2)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(int16_t*)(_fieldAddr_) = (*(int16_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u2)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(uint16_t*)(_fieldAddr_) = (*(uint16_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i4)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(int32_t*)(_fieldAddr_) = (*(int32_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u4)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(uint32_t*)(_fieldAddr_) = (*(uint32_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_i8)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(int64_t*)(_fieldAddr_) = (*(int64_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_u8)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(uint64_t*)(_fieldAddr_) = (*(uint64_t*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_ref)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    *(Il2CppObject**)(_fieldAddr_) = (*(Il2CppObject**)(localVarBase + __data));HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_8)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    Copy8(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_12)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    Copy12(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_16)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    Copy16(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_20)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    Copy20(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_24)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    Copy24(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_28)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    Copy28(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_size_32)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 4);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+				    Copy32(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_n_2)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 12);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+					uint16_t __size = *(uint16_t*)(ip + 4);
+				    std::memmove(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_n_4)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+					uint32_t __size = *(uint32_t*)(ip + 12);
+				    std::memmove(((byte*)__klass->static_fields) + __offset, (void*)(localVarBase + __data), __size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_WriteBarrier_n_2)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+					uint32_t __offset = *(uint32_t*)(ip + 12);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+					uint16_t __size = *(uint16_t*)(ip + 4);
+				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
+				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
+				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(StsfldInitedVarVar_WriteBarrier_n_4)
+				{
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+					uint16_t __data = *(uint16_t*)(ip + 2);
+					uint32_t __size = *(uint32_t*)(ip + 12);
 				    void* _fieldAddr_ = ((byte*)__klass->static_fields) + __offset;
 				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldaVarVar:
+				HI_OPCODE_CASE(LdsfldaVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
+				    QUICKEN_AFTER_CCTOR_FINISH(__klass, LdsfldaInitedVarVar);
 				    (*(void**)(localVarBase + __dst)) = ((byte*)__klass->static_fields) + __offset;
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdsfldaFromFieldDataVarVar:
+				HI_OPCODE_CASE(LdsfldaInitedVarVar)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
+					uint32_t __offset = *(uint32_t*)(ip + 8);
+				    (*(void**)(localVarBase + __dst)) = ((byte*)__klass->static_fields) + __offset;
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(LdsfldaFromFieldDataVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					void* __src = ((void*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 				    (*(void**)(localVarBase + __dst)) = __src;
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalaVarVar:
+				HI_OPCODE_CASE(LdthreadlocalaVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10308,9 +13055,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(void**)(localVarBase + __dst)) = (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset;
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i1:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10318,9 +13065,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int8_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u1:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10328,9 +13075,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint8_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i2:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10338,9 +13085,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int16_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u2:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10348,9 +13095,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint16_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i4:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10358,9 +13105,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u4:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10368,9 +13115,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int32_t*)(localVarBase + __dst)) = *(uint32_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_i8:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_i8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10378,9 +13125,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int64_t*)(localVarBase + __dst)) = *(int64_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_u8:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_u8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10388,9 +13135,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    (*(int64_t*)(localVarBase + __dst)) = *(uint64_t*)((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_8:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10398,9 +13145,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy8((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_12:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10408,9 +13155,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy12((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_16:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10418,9 +13165,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy16((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_20:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10428,9 +13175,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy20((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_24:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10438,9 +13185,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy24((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_28:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10448,9 +13195,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy28((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_size_32:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_size_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10458,9 +13205,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy32((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_n_2:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_n_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
@@ -10469,9 +13216,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    std::memmove((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LdthreadlocalVarVar_n_4:
+				HI_OPCODE_CASE(LdthreadlocalVarVar_n_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
@@ -10480,9 +13227,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    std::memmove((void*)(localVarBase + __dst), (byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset, __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i1:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i1)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10491,9 +13238,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(int8_t*)_fieldAddr_ = (*(int8_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u1:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u1)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10502,9 +13249,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(uint8_t*)_fieldAddr_ = (*(uint8_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i2:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10513,9 +13260,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(int16_t*)_fieldAddr_ = (*(int16_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u2:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10524,9 +13271,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(uint16_t*)_fieldAddr_ = (*(uint16_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i4:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10535,9 +13282,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(int32_t*)_fieldAddr_ = (*(int32_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u4:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10546,9 +13293,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(uint32_t*)_fieldAddr_ = (*(uint32_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_i8:
+				HI_OPCODE_CASE(StthreadlocalVarVar_i8)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10557,9 +13304,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(int64_t*)_fieldAddr_ = (*(int64_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_u8:
+				HI_OPCODE_CASE(StthreadlocalVarVar_u8)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10568,9 +13315,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(uint64_t*)_fieldAddr_ = (*(uint64_t*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_ref:
+				HI_OPCODE_CASE(StthreadlocalVarVar_ref)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10579,9 +13326,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _fieldAddr_ = ((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset))) + __offset;
 				    *(Il2CppObject**)_fieldAddr_ = (*(Il2CppObject**)(localVarBase + __data));HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_8:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_8)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10589,9 +13336,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy8((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset)) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_12:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_12)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10599,9 +13346,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy12((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset)) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_16:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_16)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10609,9 +13356,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy16((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset)) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_20:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_20)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10619,9 +13366,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy20((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset)) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_24:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_24)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10629,9 +13376,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy24((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset)) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_28:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_28)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10639,9 +13386,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy28((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset)) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_size_32:
+				HI_OPCODE_CASE(StthreadlocalVarVar_size_32)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 4);
@@ -10649,9 +13396,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    Copy32((byte*)(il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset)) + __offset, (void*)(localVarBase + __data));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_n_2:
+				HI_OPCODE_CASE(StthreadlocalVarVar_n_2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 12);
@@ -10660,9 +13407,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    std::memmove((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_n_4:
+				HI_OPCODE_CASE(StthreadlocalVarVar_n_4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
@@ -10671,9 +13418,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    RuntimeInitClassCCtorWithoutInitClass(__klass);
 				    std::memmove((byte*)il2cpp::vm::Thread::GetThreadStaticData(__klass->thread_static_fields_offset) + __offset, (void*)(localVarBase + __data), __size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_WriteBarrier_n_2:
+				HI_OPCODE_CASE(StthreadlocalVarVar_WriteBarrier_n_2)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 					uint32_t __offset = *(uint32_t*)(ip + 12);
@@ -10684,9 +13431,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::StthreadlocalVarVar_WriteBarrier_n_4:
+				HI_OPCODE_CASE(StthreadlocalVarVar_WriteBarrier_n_4)
 				{
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 4)]);
 					uint32_t __offset = *(uint32_t*)(ip + 8);
@@ -10697,159 +13444,245 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    std::memmove(_fieldAddr_, (void*)(localVarBase + __data), __size);
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_fieldAddr_, (size_t)__size);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CheckThrowIfNullVar:
+				HI_OPCODE_CASE(CheckThrowIfNullVar)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 				    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InitClassStaticCtor)
+				{
+					uint64_t __klass = *(uint64_t*)(ip + 8);
+				    RuntimeInitClassCCtorWithoutInitClass((Il2CppClass*)(__klass));
+				    QUICKEN_AFTER_CCTOR_FINISH((Il2CppClass*)(__klass), InitClassStaticCtorInited);
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(InitClassStaticCtorInited)
+				{
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+
+				//!!!}}OBJECT
+#pragma endregion
+
+#pragma region ARRAY
+		//!!!{{ARRAY
+				HI_OPCODE_CASE(NewArrVarVar)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __size = *(uint16_t*)(ip + 4);
+					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+				    (*(Il2CppArray**)(localVarBase + __arr)) =  il2cpp::vm::Array::NewSpecific(__klass, (*(int32_t*)(localVarBase + __size)));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayLengthVarVar)
+				{
+					uint16_t __len = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
+				    (*(int64_t*)(localVarBase + __len)) = (int64_t)il2cpp::vm::Array::GetLength((*(Il2CppArray**)(localVarBase + __arr)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementAddressAddrVarVar)
+				{
+					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    (*(void**)(localVarBase + __addr)) = GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementAddressCheckAddrVarVar)
+				{
+					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+					Il2CppClass* __eleKlass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    CheckArrayElementTypeMatch(arr->klass, __eleKlass);
+				    (*(void**)(localVarBase + __addr)) = GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i1)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int8_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_u1)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint8_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(GetArrayElementVarVar_i2)
+				{
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int16_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InitClassStaticCtor:
+				HI_OPCODE_CASE(GetArrayElementVarVar_u2)
 				{
-					uint64_t __klass = *(uint64_t*)(ip + 8);
-				    RuntimeInitClassCCtorWithoutInitClass((Il2CppClass*)(__klass));
-				    ip += 16;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint16_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-
-				//!!!}}OBJECT
-#pragma endregion
-
-#pragma region ARRAY
-		//!!!{{ARRAY
-				case HiOpcodeEnum::NewArrVarVar:
+				HI_OPCODE_CASE(GetArrayElementVarVar_i4)
 				{
-					uint16_t __arr = *(uint16_t*)(ip + 2);
-					uint16_t __size = *(uint16_t*)(ip + 4);
-					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
-				    (*(Il2CppArray**)(localVarBase + __arr)) =  il2cpp::vm::Array::NewSpecific(__klass, (*(int32_t*)(localVarBase + __size)));
-				    ip += 16;
-				    continue;
+					uint16_t __dst = *(uint16_t*)(ip + 2);
+					uint16_t __arr = *(uint16_t*)(ip + 4);
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayLengthVarVar:
+				HI_OPCODE_CASE(GetArrayElementVarVar_u4)
 				{
-					uint16_t __len = *(uint16_t*)(ip + 2);
+					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
-				    CHECK_NOT_NULL_THROW((*(Il2CppArray**)(localVarBase + __arr)));
-				    (*(int64_t*)(localVarBase + __len)) = (int64_t)il2cpp::vm::Array::GetLength((*(Il2CppArray**)(localVarBase + __arr)));
+					uint16_t __index = *(uint16_t*)(ip + 6);
+				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint32_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementAddressAddrVarVar:
+				HI_OPCODE_CASE(GetArrayElementVarVar_i8)
 				{
-					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
-				    (*(void**)(localVarBase + __addr)) = GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
+				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int64_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementAddressCheckAddrVarVar:
+				HI_OPCODE_CASE(GetArrayElementVarVar_u8)
 				{
-					uint16_t __addr = *(uint16_t*)(ip + 2);
+					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
-					Il2CppClass* __eleKlass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
-				    CheckArrayElementTypeMatch(arr->klass, __eleKlass);
-				    (*(void**)(localVarBase + __addr)) = GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), il2cpp::vm::Array::GetElementSize(arr->klass));
-				    ip += 16;
-				    continue;
+				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint64_t, (*(int32_t*)(localVarBase + __index)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i1:
+				HI_OPCODE_CASE(GetArrayElementVarVar_i1_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int8_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u1:
+				HI_OPCODE_CASE(GetArrayElementVarVar_u1_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint8_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i2:
+				HI_OPCODE_CASE(GetArrayElementVarVar_i2_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int16_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u2:
+				HI_OPCODE_CASE(GetArrayElementVarVar_u2_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint16_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i4:
+				HI_OPCODE_CASE(GetArrayElementVarVar_i4_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u4:
+				HI_OPCODE_CASE(GetArrayElementVarVar_u4_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint32_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_i8:
+				HI_OPCODE_CASE(GetArrayElementVarVar_i8_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int64_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_u8:
+				HI_OPCODE_CASE(GetArrayElementVarVar_u8_NoCheck)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __index = *(uint16_t*)(ip + 6);
 				    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
-				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    (*(int64_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, uint64_t, (*(int32_t*)(localVarBase + __index)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_1:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10858,9 +13691,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy1((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 1));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_2:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_2)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10869,9 +13702,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy2((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 2));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_4:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_4)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10880,9 +13713,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy4((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 4));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_8:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_8)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10891,9 +13724,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy8((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 8));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_12:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_12)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10902,9 +13735,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy12((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 12));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_16:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_16)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10913,9 +13746,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy16((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 16));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_20:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_20)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10924,9 +13757,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy20((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 20));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_24:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_24)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10935,9 +13768,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy24((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 24));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_28:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_28)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10946,9 +13779,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy28((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 28));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_size_32:
+				HI_OPCODE_CASE(GetArrayElementVarVar_size_32)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10957,9 +13790,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy32((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), 32));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetArrayElementVarVar_n:
+				HI_OPCODE_CASE(GetArrayElementVarVar_n)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
@@ -10969,9 +13802,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    int32_t eleSize = il2cpp::vm::Array::GetElementSize(arr->klass);
 				    std::memmove((void*)(localVarBase + __dst), GET_ARRAY_ELEMENT_ADDRESS(arr, (*(int32_t*)(localVarBase + __index)), eleSize), eleSize);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i1:
+				HI_OPCODE_CASE(SetArrayElementVarVar_i1)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -10980,9 +13813,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int8_t, (*(int32_t*)(localVarBase + __index)), (*(int8_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u1:
+				HI_OPCODE_CASE(SetArrayElementVarVar_u1)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -10991,9 +13824,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint8_t, (*(int32_t*)(localVarBase + __index)), (*(uint8_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i2:
+				HI_OPCODE_CASE(SetArrayElementVarVar_i2)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11002,9 +13835,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int16_t, (*(int32_t*)(localVarBase + __index)), (*(int16_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u2:
+				HI_OPCODE_CASE(SetArrayElementVarVar_u2)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11013,9 +13846,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint16_t, (*(int32_t*)(localVarBase + __index)), (*(uint16_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i4:
+				HI_OPCODE_CASE(SetArrayElementVarVar_i4)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11024,9 +13857,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int32_t, (*(int32_t*)(localVarBase + __index)), (*(int32_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u4:
+				HI_OPCODE_CASE(SetArrayElementVarVar_u4)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11035,9 +13868,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint32_t, (*(int32_t*)(localVarBase + __index)), (*(uint32_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_i8:
+				HI_OPCODE_CASE(SetArrayElementVarVar_i8)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11046,9 +13879,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int64_t, (*(int32_t*)(localVarBase + __index)), (*(int64_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_u8:
+				HI_OPCODE_CASE(SetArrayElementVarVar_u8)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11057,21 +13890,105 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint64_t, (*(int32_t*)(localVarBase + __index)), (*(uint64_t*)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i1_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int8_t, (*(int32_t*)(localVarBase + __index)), (*(int8_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u1_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint8_t, (*(int32_t*)(localVarBase + __index)), (*(uint8_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i2_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int16_t, (*(int32_t*)(localVarBase + __index)), (*(int16_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u2_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint16_t, (*(int32_t*)(localVarBase + __index)), (*(uint16_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i4_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int32_t, (*(int32_t*)(localVarBase + __index)), (*(int32_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u4_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint32_t, (*(int32_t*)(localVarBase + __index)), (*(uint32_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_i8_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), int64_t, (*(int32_t*)(localVarBase + __index)), (*(int64_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_u8_NoCheck)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+				    il2cpp_array_set((*(Il2CppArray**)(localVarBase + __arr)), uint64_t, (*(int32_t*)(localVarBase + __index)), (*(uint64_t*)(localVarBase + __ele)));
+				    ip += 8;
+				    HI_DISPATCH_NEXT();
+				}
+				HI_OPCODE_CASE(SetArrayElementVarVar_ref)
+				{
+					uint16_t __arr = *(uint16_t*)(ip + 2);
+					uint16_t __index = *(uint16_t*)(ip + 4);
+					uint16_t __ele = *(uint16_t*)(ip + 6);
+					uint32_t __typeCheckCache = *(uint32_t*)(ip + 8);
+				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
+				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
+				    CheckArrayElementTypeCompatibleCached((*(Il2CppArray**)(localVarBase + __arr)), (*(Il2CppObject**)(localVarBase + __ele)), ((ArrayStoreTypeCheckCache*)&imi->resolveDatas[__typeCheckCache]));
+				    il2cpp_array_setref((*(Il2CppArray**)(localVarBase + __arr)), (*(int32_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
+				    ip += 16;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_ref:
+				HI_OPCODE_CASE(SetArrayElementVarVar_ref_NoTypeCheck)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
 					uint16_t __ele = *(uint16_t*)(ip + 6);
 				    Il2CppArray* _arr = (*(Il2CppArray**)(localVarBase + __arr));
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
-				    CheckArrayElementTypeCompatible((*(Il2CppArray**)(localVarBase + __arr)), (*(Il2CppObject**)(localVarBase + __ele)));
 				    il2cpp_array_setref((*(Il2CppArray**)(localVarBase + __arr)), (*(int32_t*)(localVarBase + __index)), (*(Il2CppObject**)(localVarBase + __ele)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_size_12:
+				HI_OPCODE_CASE(SetArrayElementVarVar_size_12)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11080,9 +13997,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy12(GET_ARRAY_ELEMENT_ADDRESS(_arr, (*(int32_t*)(localVarBase + __index)), 12), (void*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_size_16:
+				HI_OPCODE_CASE(SetArrayElementVarVar_size_16)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11091,9 +14008,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(_arr, (*(int32_t*)(localVarBase + __index)));
 				    Copy16(GET_ARRAY_ELEMENT_ADDRESS(_arr, (*(int32_t*)(localVarBase + __index)), 16), (void*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_n:
+				HI_OPCODE_CASE(SetArrayElementVarVar_n)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11103,9 +14020,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    int32_t _eleSize = il2cpp::vm::Array::GetElementSize(_arr->klass);
 				    SetArrayElementWithSize(_arr, _eleSize, (*(int32_t*)(localVarBase + __index)), (void*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetArrayElementVarVar_WriteBarrier_n:
+				HI_OPCODE_CASE(SetArrayElementVarVar_WriteBarrier_n)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11115,18 +14032,18 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    int32_t _eleSize = il2cpp::vm::Array::GetElementSize(_arr->klass);
 				    il2cpp_array_setrefwithsize(_arr, _eleSize, (*(int32_t*)(localVarBase + __index)), (void*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewMdArrVarVar_length:
+				HI_OPCODE_CASE(NewMdArrVarVar_length)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(Il2CppArray**)(localVarBase + __arr)) =  NewMdArray(__klass, (StackObject*)(void*)(localVarBase + __lengthIdxs), nullptr);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewMdArrVarVar_length_bound:
+				HI_OPCODE_CASE(NewMdArrVarVar_length_bound)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11134,99 +14051,99 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(Il2CppArray**)(localVarBase + __arr)) =  NewMdArray(__klass, (StackObject*)(void*)(localVarBase + __lengthIdxs), (StackObject*)(void*)(localVarBase + __lowerBoundIdxs));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_i1:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_i1)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementExpandToStack<int8_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_u1:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_u1)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementExpandToStack<uint8_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_i2:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_i2)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementExpandToStack<int16_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_u2:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_u2)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementExpandToStack<uint16_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_i4:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_i4)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementCopyToStack<int32_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_u4:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_u4)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementCopyToStack<uint32_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_i8:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_i8)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementCopyToStack<int64_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_u8:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_u8)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementCopyToStack<uint64_t>((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementVarVar_n:
+				HI_OPCODE_CASE(GetMdArrElementVarVar_n)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    GetMdArrayElementBySize((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __value));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetMdArrElementAddressVarVar:
+				HI_OPCODE_CASE(GetMdArrElementAddressVarVar)
 				{
 					uint16_t __addr = *(uint16_t*)(ip + 2);
 					uint16_t __arr = *(uint16_t*)(ip + 4);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 6);
 				    (*(void**)(localVarBase + __addr)) = GetMdArrayElementAddress((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_i1:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_i1)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11235,9 +14152,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(int8_t*)_addr = (*(int8_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_u1:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_u1)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11246,9 +14163,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(uint8_t*)_addr = (*(uint8_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_i2:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_i2)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11257,9 +14174,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(int16_t*)_addr = (*(int16_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_u2:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_u2)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11268,9 +14185,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(uint16_t*)_addr = (*(uint16_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_i4:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_i4)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11279,9 +14196,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(int32_t*)_addr = (*(int32_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_u4:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_u4)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11290,9 +14207,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(uint32_t*)_addr = (*(uint32_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_i8:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_i8)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11301,9 +14218,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(int64_t*)_addr = (*(int64_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_u8:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_u8)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11312,9 +14229,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    void* _addr = GetMdArrayElementAddress(_arr, (StackObject*)(void*)(localVarBase + __lengthIdxs));
 				    *(uint64_t*)_addr = (*(uint64_t*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_ref:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_ref)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
@@ -11325,25 +14242,25 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    *(Il2CppObject**)_addr = (*(Il2CppObject**)(localVarBase + __ele));
 				    HYBRIDCLR_SET_WRITE_BARRIER((void**)_addr);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_n:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_n)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __ele = *(uint16_t*)(ip + 6);
 				    SetMdArrayElement((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::SetMdArrElementVarVar_WriteBarrier_n:
+				HI_OPCODE_CASE(SetMdArrElementVarVar_WriteBarrier_n)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __lengthIdxs = *(uint16_t*)(ip + 4);
 					uint16_t __ele = *(uint16_t*)(ip + 6);
 				    SetMdArrayElementWriteBarrier((*(Il2CppArray**)(localVarBase + __arr)), (StackObject*)(void*)(localVarBase + __lengthIdxs), (void*)(localVarBase + __ele));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}ARRAY
@@ -11351,42 +14268,42 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
 #pragma region EXCEPTION
 		//!!!{{EXCEPTION
-				case HiOpcodeEnum::ThrowEx:
+				HI_OPCODE_CASE(ThrowEx)
 				{
 					uint16_t __exceptionObj = *(uint16_t*)(ip + 2);
 					uint16_t __firstHandlerIndex = *(uint16_t*)(ip + 4);
 					THROW_EX((Il2CppException*)(*(Il2CppObject**)(localVarBase + __exceptionObj)), __firstHandlerIndex);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::RethrowEx:
+				HI_OPCODE_CASE(RethrowEx)
 				{
 					RETHROW_EX();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LeaveEx:
+				HI_OPCODE_CASE(LeaveEx)
 				{
 					int32_t __target = *(int32_t*)(ip + 4);
 					uint16_t __firstHandlerIndex = *(uint16_t*)(ip + 2);
 					LEAVE_EX(__target, __firstHandlerIndex);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::LeaveEx_Directly:
+				HI_OPCODE_CASE(LeaveEx_Directly)
 				{
 					int32_t __target = *(int32_t*)(ip + 4);
 					LEAVE_EX_DIRECTLY(__target);
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::EndFilterEx:
+				HI_OPCODE_CASE(EndFilterEx)
 				{
 					uint16_t __value = *(uint16_t*)(ip + 2);
 					ENDFILTER_EX((*(bool*)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::EndFinallyEx:
+				HI_OPCODE_CASE(EndFinallyEx)
 				{
 					ENDFINALLY_EX();
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}EXCEPTION
@@ -11394,43 +14311,43 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 
 #pragma region instrinct
 		//!!!{{INSTRINCT
-				case HiOpcodeEnum::NullableNewVarVar:
+				HI_OPCODE_CASE(NullableNewVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __data = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    NewNullableValueType((void*)(localVarBase + __dst), (void*)(localVarBase + __data), __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableCtorVarVar:
+				HI_OPCODE_CASE(NullableCtorVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __data = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    InitNullableValueType((*(void**)(localVarBase + __dst)), (void*)(localVarBase + __data), __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableHasValueVar:
+				HI_OPCODE_CASE(NullableHasValueVar)
 				{
 					uint16_t __result = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    (*(uint32_t*)(localVarBase + __result)) = IsNullableHasValue((*(void**)(localVarBase + __obj)), __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableGetValueOrDefaultVarVar:
+				HI_OPCODE_CASE(NullableGetValueOrDefaultVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    GetNullableValueOrDefault2StackDataByType((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableGetValueOrDefaultVarVar_1:
+				HI_OPCODE_CASE(NullableGetValueOrDefaultVarVar_1)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
@@ -11438,18 +14355,18 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    GetNullableValueOrDefault2StackDataByType((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), (void*)(localVarBase + __defaultValue), __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NullableGetValueVarVar:
+				HI_OPCODE_CASE(NullableGetValueVarVar)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __obj = *(uint16_t*)(ip + 4);
 					Il2CppClass* __klass = ((Il2CppClass*)imi->resolveDatas[*(uint32_t*)(ip + 8)]);
 				    GetNullableValueOrDefault2StackDataByType((void*)(localVarBase + __dst), (*(void**)(localVarBase + __obj)), nullptr, __klass);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i4:
+				HI_OPCODE_CASE(InterlockedCompareExchangeVarVarVarVar_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __location = *(uint16_t*)(ip + 4);
@@ -11457,9 +14374,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __comparand = *(uint16_t*)(ip + 8);
 				    (*(int32_t*)(localVarBase + __ret)) = HiInterlockedCompareExchange((int32_t*)(*(void**)(localVarBase + __location)), (*(int32_t*)(localVarBase + __value)), (*(int32_t*)(localVarBase + __comparand)));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_i8:
+				HI_OPCODE_CASE(InterlockedCompareExchangeVarVarVarVar_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __location = *(uint16_t*)(ip + 4);
@@ -11467,9 +14384,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __comparand = *(uint16_t*)(ip + 8);
 				    (*(int64_t*)(localVarBase + __ret)) = HiInterlockedCompareExchange((int64_t*)(*(void**)(localVarBase + __location)), (*(int64_t*)(localVarBase + __value)), (*(int64_t*)(localVarBase + __comparand)));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedCompareExchangeVarVarVarVar_pointer:
+				HI_OPCODE_CASE(InterlockedCompareExchangeVarVarVarVar_pointer)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __location = *(uint16_t*)(ip + 4);
@@ -11477,61 +14394,61 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __comparand = *(uint16_t*)(ip + 8);
 				    (*(void**)(localVarBase + __ret)) = HiInterlockedCompareExchange((void**)(*(void**)(localVarBase + __location)), (*(void**)(localVarBase + __value)), (*(void**)(localVarBase + __comparand)));
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedExchangeVarVarVar_i4:
+				HI_OPCODE_CASE(InterlockedExchangeVarVarVar_i4)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __location = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    (*(int32_t*)(localVarBase + __ret)) = HiInterlockedExchange((int32_t*)(*(void**)(localVarBase + __location)), (*(int32_t*)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedExchangeVarVarVar_i8:
+				HI_OPCODE_CASE(InterlockedExchangeVarVarVar_i8)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __location = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    (*(int64_t*)(localVarBase + __ret)) = HiInterlockedExchange((int64_t*)(*(void**)(localVarBase + __location)), (*(int64_t*)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::InterlockedExchangeVarVarVar_pointer:
+				HI_OPCODE_CASE(InterlockedExchangeVarVarVar_pointer)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 					uint16_t __location = *(uint16_t*)(ip + 4);
 					uint16_t __value = *(uint16_t*)(ip + 6);
 				    (*(void**)(localVarBase + __ret)) = HiInterlockedExchange((void**)(*(void**)(localVarBase + __location)), (*(void**)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewSystemObjectVar:
+				HI_OPCODE_CASE(NewSystemObjectVar)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 				(*(Il2CppObject**)(localVarBase + __obj)) = il2cpp::vm::Object::New(il2cpp_defaults.object_class);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewVector2:
+				HI_OPCODE_CASE(NewVector2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
 					uint16_t __y = *(uint16_t*)(ip + 6);
 				    *(HtVector2f*)(void*)(localVarBase + __obj) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y))};
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewVector3_2:
+				HI_OPCODE_CASE(NewVector3_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
 					uint16_t __y = *(uint16_t*)(ip + 6);
 				    *(HtVector3f*)(void*)(localVarBase + __obj) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), 0};
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewVector3_3:
+				HI_OPCODE_CASE(NewVector3_3)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
@@ -11539,18 +14456,18 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __z = *(uint16_t*)(ip + 8);
 				    *(HtVector3f*)(void*)(localVarBase + __obj) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z))};
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewVector4_2:
+				HI_OPCODE_CASE(NewVector4_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
 					uint16_t __y = *(uint16_t*)(ip + 6);
 				    *(HtVector4f*)(void*)(localVarBase + __obj) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), 0, 0};
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewVector4_3:
+				HI_OPCODE_CASE(NewVector4_3)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
@@ -11558,9 +14475,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __z = *(uint16_t*)(ip + 8);
 				    *(HtVector4f*)(void*)(localVarBase + __obj) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z)), 0};
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewVector4_4:
+				HI_OPCODE_CASE(NewVector4_4)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
@@ -11569,27 +14486,27 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __w = *(uint16_t*)(ip + 10);
 				    *(HtVector4f*)(void*)(localVarBase + __obj) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z)), (*(float*)(localVarBase + __w))};
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CtorVector2:
+				HI_OPCODE_CASE(CtorVector2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
 					uint16_t __y = *(uint16_t*)(ip + 6);
 				    *(HtVector2f*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y))};
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CtorVector3_2:
+				HI_OPCODE_CASE(CtorVector3_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
 					uint16_t __y = *(uint16_t*)(ip + 6);
 				    *(HtVector3f*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), 0};
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CtorVector3_3:
+				HI_OPCODE_CASE(CtorVector3_3)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
@@ -11597,18 +14514,18 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __z = *(uint16_t*)(ip + 8);
 				    *(HtVector3f*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z))};
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CtorVector4_2:
+				HI_OPCODE_CASE(CtorVector4_2)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
 					uint16_t __y = *(uint16_t*)(ip + 6);
 				    *(HtVector4f*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), 0, 0};
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CtorVector4_3:
+				HI_OPCODE_CASE(CtorVector4_3)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
@@ -11616,9 +14533,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __z = *(uint16_t*)(ip + 8);
 				    *(HtVector4f*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z)), 0};
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::CtorVector4_4:
+				HI_OPCODE_CASE(CtorVector4_4)
 				{
 					uint16_t __obj = *(uint16_t*)(ip + 2);
 					uint16_t __x = *(uint16_t*)(ip + 4);
@@ -11627,9 +14544,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 					uint16_t __w = *(uint16_t*)(ip + 10);
 				    *(HtVector4f*)(*(void**)(localVarBase + __obj)) = {(*(float*)(localVarBase + __x)), (*(float*)(localVarBase + __y)), (*(float*)(localVarBase + __z)), (*(float*)(localVarBase + __w))};
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ArrayGetGenericValueImpl:
+				HI_OPCODE_CASE(ArrayGetGenericValueImpl)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11640,9 +14557,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    int32_t _eleSize = il2cpp::vm::Array::GetElementSize(_arr->klass);
 				    std::memmove((*(void**)(localVarBase + __value)), GET_ARRAY_ELEMENT_ADDRESS(_arr, _index, _eleSize), _eleSize);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::ArraySetGenericValueImpl:
+				HI_OPCODE_CASE(ArraySetGenericValueImpl)
 				{
 					uint16_t __arr = *(uint16_t*)(ip + 2);
 					uint16_t __index = *(uint16_t*)(ip + 4);
@@ -11653,9 +14570,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    int32_t _eleSize = il2cpp::vm::Array::GetElementSize(_arr->klass);
 				    il2cpp_array_setrefwithsize(_arr, _eleSize, _index, (*(void**)(localVarBase + __value)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewString:
+				HI_OPCODE_CASE(NewString)
 				{
 					uint16_t __str = *(uint16_t*)(ip + 2);
 					uint16_t __chars = *(uint16_t*)(ip + 4);
@@ -11663,9 +14580,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_THROW(_chars);
 				    (*(Il2CppString**)(localVarBase + __str)) = il2cpp::vm::String::NewUtf16((const Il2CppChar*)il2cpp::vm::Array::GetFirstElementAddress(_chars), il2cpp::vm::Array::GetLength(_chars));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewString_2:
+				HI_OPCODE_CASE(NewString_2)
 				{
 					uint16_t __str = *(uint16_t*)(ip + 2);
 					uint16_t __chars = *(uint16_t*)(ip + 4);
@@ -11677,9 +14594,9 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY2(_chars, _startIndex, _length);
 				    (*(Il2CppString**)(localVarBase + __str)) = il2cpp::vm::String::NewUtf16(((const Il2CppChar*)il2cpp::vm::Array::GetFirstElementAddress(_chars)) + _startIndex, _length);
 				    ip += 16;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::NewString_3:
+				HI_OPCODE_CASE(NewString_3)
 				{
 					uint16_t __str = *(uint16_t*)(ip + 2);
 					uint16_t __c = *(uint16_t*)(ip + 4);
@@ -11693,41 +14610,398 @@ const int32_t kMaxRetValueTypeStackObjectSize = 1024;
 				    Il2CppString* _str = (*(Il2CppString**)(localVarBase + __str)) = il2cpp::vm::String::NewSize(_count);
 				    std::fill_n(_str->chars, _count, _c);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::UnsafeEnumCast:
+				HI_OPCODE_CASE(UnsafeEnumCast)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 					uint16_t __srcType = *(uint16_t*)(ip + 6);
 				    (*(int32_t*)(localVarBase + __dst)) =  UnsafeEnumCast((void*)(localVarBase + __src), __srcType);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::GetEnumHashCode:
+				HI_OPCODE_CASE(GetEnumHashCode)
 				{
 					uint16_t __dst = *(uint16_t*)(ip + 2);
 					uint16_t __src = *(uint16_t*)(ip + 4);
 				    (*(int32_t*)(localVarBase + __dst)) = GetEnumLongHashCode((*(void**)(localVarBase + __src)));
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::AssemblyGetExecutingAssembly:
+				HI_OPCODE_CASE(AssemblyGetExecutingAssembly)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    (*(Il2CppObject**)(localVarBase + __ret)) = (Il2CppObject*)il2cpp::vm::Reflection::GetAssemblyObject(frame->method->klass->image->assembly);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
-				case HiOpcodeEnum::MethodBaseGetCurrentMethod:
+				HI_OPCODE_CASE(MethodBaseGetCurrentMethod)
 				{
 					uint16_t __ret = *(uint16_t*)(ip + 2);
 				    (*(Il2CppObject**)(localVarBase + __ret)) = (Il2CppObject*)il2cpp::vm::Reflection::GetMethodObject(frame->method, nullptr);
 				    ip += 8;
-				    continue;
+				    HI_DISPATCH_NEXT();
 				}
 
 				//!!!}}INSTRINCT
+#pragma endregion
+#pragma region superinstruction
+				//!!!{{SUPERINSTRUCTION
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4__LdlocVarVar)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						int32_t __op2 = *(int32_t*)(ip + 8);
+						(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + __op2;
+					    ip += 16;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__LdlocVarVar__BranchVarVar_Clt_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __op1 = *(uint16_t*)(ip + 2);
+						uint16_t __op2 = *(uint16_t*)(ip + 4);
+						int32_t __offset = *(int32_t*)(ip + 8);
+					    if (CompareCge((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2))))
+					    {
+					        ip += 16;
+					    }
+					    else
+					    {
+					        ip = ipBase + __offset;
+					    }
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__LdlocVarVar)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_BinOpVarVarVar_Add_i4__LdlocVarVar)
+				{
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						uint16_t __op2 = *(uint16_t*)(ip + 6);
+						(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + (*(int32_t*)(localVarBase + __op2));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						int32_t __op2 = *(int32_t*)(ip + 8);
+						(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + __op2;
+					    ip += 16;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_BinOpVarVarConst_Add_i4__LdlocVarVar)
+				{
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						int32_t __op2 = *(int32_t*)(ip + 8);
+						(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + __op2;
+					    ip += 16;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__BranchVarVar_Clt_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __op1 = *(uint16_t*)(ip + 2);
+						uint16_t __op2 = *(uint16_t*)(ip + 4);
+						int32_t __offset = *(int32_t*)(ip + 8);
+					    if (CompareCge((*(int32_t*)(localVarBase + __op1)), (*(int32_t*)(localVarBase + __op2))))
+					    {
+					        ip += 16;
+					    }
+					    else
+					    {
+					        ip = ipBase + __offset;
+					    }
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__GetArrayElementVarVar_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __arr = *(uint16_t*)(ip + 4);
+						uint16_t __index = *(uint16_t*)(ip + 6);
+					    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+					    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+					    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int32_t*)(localVarBase + __index)));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_GetArrayElementVarVar_i4__BinOpVarVarVar_Add_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __arr = *(uint16_t*)(ip + 4);
+						uint16_t __index = *(uint16_t*)(ip + 6);
+					    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+					    CHECK_NOT_NULL_AND_ARRAY_BOUNDARY(arr, (*(int32_t*)(localVarBase + __index)));
+					    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int32_t*)(localVarBase + __index)));
+					    ip += 8;
+					}
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						uint16_t __op2 = *(uint16_t*)(ip + 6);
+						(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + (*(int32_t*)(localVarBase + __op2));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_GetArrayElementVarVar_i4_NoCheck__BinOpVarVarVar_Add_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __arr = *(uint16_t*)(ip + 4);
+						uint16_t __index = *(uint16_t*)(ip + 6);
+					    Il2CppArray* arr = (*(Il2CppArray**)(localVarBase + __arr));
+					    (*(int32_t*)(localVarBase + __dst)) = il2cpp_array_get(arr, int32_t, (*(int32_t*)(localVarBase + __index)));
+					    ip += 8;
+					}
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						uint16_t __op2 = *(uint16_t*)(ip + 6);
+						(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + (*(int32_t*)(localVarBase + __op2));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__BranchVarConst_Clt_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __op1 = *(uint16_t*)(ip + 2);
+						int32_t __offset = *(int32_t*)(ip + 4);
+						int32_t __op2 = *(int32_t*)(ip + 8);
+					    if (CompareCge((*(int32_t*)(localVarBase + __op1)), __op2))
+					    {
+					        ip += 16;
+					    }
+					    else
+					    {
+					        ip = ipBase + __offset;
+					    }
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__LdfldVarVar_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __obj = *(uint16_t*)(ip + 4);
+						uint16_t __offset = *(uint16_t*)(ip + 6);
+					    CHECK_NOT_NULL_THROW((*(Il2CppObject**)(localVarBase + __obj)));
+					    (*(int32_t*)(localVarBase + __dst)) = *(int32_t*)((uint8_t*)(*(Il2CppObject**)(localVarBase + __obj)) + __offset);
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__BranchTrueVar_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __op = *(uint16_t*)(ip + 2);
+						int32_t __offset = *(int32_t*)(ip + 4);
+					    if ((*(int32_t*)(localVarBase + __op)))
+					    {
+					        ip = ipBase + __offset;
+					    }
+					    else
+					    {
+					        ip += 8;
+					    }
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__BranchFalseVar_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __op = *(uint16_t*)(ip + 2);
+						int32_t __offset = *(int32_t*)(ip + 4);
+					    if (!(*(int32_t*)(localVarBase + __op)))
+					    {
+					        ip = ipBase + __offset;
+					    }
+					    else
+					    {
+					        ip += 8;
+					    }
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_CompOpVarVarVar_Clt_i4__LdlocVarVar)
+				{
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __c1 = *(uint16_t*)(ip + 4);
+						uint16_t __c2 = *(uint16_t*)(ip + 6);
+						(*(int32_t*)(localVarBase + __ret)) = CompareClt((*(int32_t*)(localVarBase + __c1)), (*(int32_t*)(localVarBase + __c2)));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_LdlocVarVar__BinOpVarVarVar_Add_i4)
+				{
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					}
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						uint16_t __op2 = *(uint16_t*)(ip + 6);
+						(*(int32_t*)(localVarBase + __ret)) = (*(int32_t*)(localVarBase + __op1)) + (*(int32_t*)(localVarBase + __op2));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_BinOpVarVarVar_Add_f4__LdlocVarVar)
+				{
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						uint16_t __op2 = *(uint16_t*)(ip + 6);
+						(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) + (*(float*)(localVarBase + __op2));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				HI_OPCODE_CASE(SuperInst_BinOpVarVarVar_Mul_f4__LdlocVarVar)
+				{
+					{
+						uint16_t __ret = *(uint16_t*)(ip + 2);
+						uint16_t __op1 = *(uint16_t*)(ip + 4);
+						uint16_t __op2 = *(uint16_t*)(ip + 6);
+						(*(float*)(localVarBase + __ret)) = (*(float*)(localVarBase + __op1)) * (*(float*)(localVarBase + __op2));
+					    ip += 8;
+					}
+					{
+						uint16_t __dst = *(uint16_t*)(ip + 2);
+						uint16_t __src = *(uint16_t*)(ip + 4);
+						(*(uint64_t*)(localVarBase + __dst)) = (*(uint64_t*)(localVarBase + __src));
+					    ip += 8;
+					    HI_DISPATCH_NEXT();
+					}
+				}
+				//!!!}}SUPERINSTRUCTION
 #pragma endregion
 				default:
 					RaiseExecutionEngineException("");
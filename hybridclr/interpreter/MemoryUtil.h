@@ -1,4 +1,9 @@
 #pragma once
+#include <algorithm>
+
+#include "Baselib.h"
+#include "C/Baselib_Memory.h"
+
 #include "InterpreterDefs.h"
 
 namespace hybridclr
@@ -225,5 +230,122 @@ namespace interpreter
 	{
 		std::memset(dst, 0, size);
 	}
+
+	// address space reserved up front and committed in chunks from both ends on demand, so that a big
+	// thread stack only costs the pages it has touched. committed pages are zero filled and never move.
+	// pages between the two committed ends stay inaccessible and act as guard pages.
+	class ReservedMemory
+	{
+	public:
+		static const size_t kCommitChunkSize = 64 * 1024;
+
+		ReservedMemory() : _allocation{}, _chunkSize(0), _bottomCommittedSize(0), _topCommittedSize(0)
+		{
+		}
+
+		// size is rounded up to whole pages
+		bool Reserve(size_t size)
+		{
+			IL2CPP_ASSERT(!_allocation.ptr);
+			Baselib_Memory_PageSizeInfo pageSizeInfo;
+			Baselib_Memory_GetPageSizeInfo(&pageSizeInfo);
+			size_t pageSize = (size_t)pageSizeInfo.defaultPageSize;
+			Baselib_ErrorState errorState = Baselib_ErrorState_Create();
+			Baselib_Memory_PageAllocation allocation = Baselib_Memory_AllocatePages(pageSize, (size + pageSize - 1) / pageSize, 1, Baselib_Memory_PageState_Reserved, &errorState);
+			if (Baselib_ErrorState_ErrorRaised(&errorState))
+			{
+				return false;
+			}
+			_allocation = allocation;
+			_chunkSize = AlignSize(kCommitChunkSize, pageSize);
+			_bottomCommittedSize = 0;
+			_topCommittedSize = 0;
+			return true;
+		}
+
+		void Release()
+		{
+			if (_allocation.ptr)
+			{
+				Baselib_ErrorState errorState = Baselib_ErrorState_Create();
+				Baselib_Memory_ReleasePages(_allocation, &errorState);
+				_allocation = {};
+			}
+		}
+
+		byte* GetBase() const
+		{
+			return (byte*)_allocation.ptr;
+		}
+
+		size_t GetSize() const
+		{
+			return (size_t)(_allocation.pageSize * _allocation.pageCount);
+		}
+
+		size_t GetBottomCommittedSize() const
+		{
+			return _bottomCommittedSize;
+		}
+
+		size_t GetTopCommittedSize() const
+		{
+			return _topCommittedSize;
+		}
+
+		// commits at least the first size bytes. returns false if out of memory
+		bool CommitBottom(size_t size)
+		{
+			if (size <= _bottomCommittedSize)
+			{
+				return true;
+			}
+			size_t newSize = std::min(AlignSize(size, _chunkSize), GetSize());
+			// pages already committed by the other end are left alone, committing them again may zero them
+			size_t end = std::min(newSize, GetSize() - _topCommittedSize);
+			if (end > _bottomCommittedSize && !SetReadWrite(_bottomCommittedSize, end - _bottomCommittedSize))
+			{
+				return false;
+			}
+			_bottomCommittedSize = newSize;
+			return true;
+		}
+
+		// commits at least the last size bytes. returns false if out of memory
+		bool CommitTop(size_t size)
+		{
+			if (size <= _topCommittedSize)
+			{
+				return true;
+			}
+			size_t newSize = std::min(AlignSize(size, _chunkSize), GetSize());
+			size_t begin = std::max(GetSize() - newSize, _bottomCommittedSize);
+			size_t end = GetSize() - _topCommittedSize;
+			if (end > begin && !SetReadWrite(begin, end - begin))
+			{
+				return false;
+			}
+			_topCommittedSize = newSize;
+			return true;
+		}
+
+	private:
+		static size_t AlignSize(size_t size, size_t alignment)
+		{
+			return (size + alignment - 1) / alignment * alignment;
+		}
+
+		bool SetReadWrite(size_t offset, size_t size)
+		{
+			Baselib_ErrorState errorState = Baselib_ErrorState_Create();
+			Baselib_Memory_SetPageState(GetBase() + offset, _allocation.pageSize, size / _allocation.pageSize, Baselib_Memory_PageState_ReadWrite, &errorState);
+			return !Baselib_ErrorState_ErrorRaised(&errorState);
+		}
+
+		Baselib_Memory_PageAllocation _allocation;
+		size_t _chunkSize;
+		size_t _bottomCommittedSize;
+		size_t _topCommittedSize;
+	};
 }
 }
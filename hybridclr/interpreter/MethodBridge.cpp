@@ -213,6 +213,23 @@ namespace interpreter
 		}
 	}
 
+	SignatureId ComputeSignatureId(const char* signature)
+	{
+		// FNV-1a and a multiplicative hash finished by the splitmix64 mixer, they share no constant
+		uint64_t hash = 0xCBF29CE484222325ULL;
+		uint64_t check = 0x2545F4914F6CDD1DULL;
+		size_t length = 0;
+		for (const char* p = signature; *p; ++p, ++length)
+		{
+			hash = (hash ^ (uint8_t)*p) * 0x100000001B3ULL;
+			check = (check + (uint8_t)*p) * 0xD6E8FEB86659FD93ULL;
+		}
+		check ^= length;
+		check = (check ^ (check >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		check = (check ^ (check >> 27)) * 0x94D049BB133111EBULL;
+		return { hash, check ^ (check >> 31) };
+	}
+
 	bool ComputeSignature(const Il2CppType* ret, const il2cpp::utils::dynamic_array<const Il2CppType*>& params, bool instanceCall, char* sigBuf, size_t bufferSize)
 	{
 		size_t pos = 0;
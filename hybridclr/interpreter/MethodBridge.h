@@ -1,5 +1,9 @@
 #pragma once
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "../CommonDef.h"
 #include "InterpreterDefs.h"
 
@@ -80,6 +84,158 @@ namespace interpreter
 	bool ComputeSignature(const MethodInfo* method, bool call, char* sigBuf, size_t bufferSize);
 	bool ComputeSignature(const Il2CppMethodDefinition* method, bool call, char* sigBuf, size_t bufferSize);
 	bool ComputeSignature(const Il2CppType* ret, const il2cpp::utils::dynamic_array<const Il2CppType*>& params, bool instanceCall, char* sigBuf, size_t bufferSize);
+
+	// a signature is identified by two independent 64 bit hashes of its text, which are cheap to cache per method and to compare.
+	// tables are keyed by the FNV-1a hash, the second hash detects a collision of two different signatures on it.
+	struct SignatureId
+	{
+		uint64_t hash;
+		uint64_t check;
+
+		bool operator==(const SignatureId& o) const { return hash == o.hash && check == o.check; }
+		bool operator!=(const SignatureId& o) const { return !(*this == o); }
+	};
+
+	struct SignatureIdHash
+	{
+		size_t operator()(const SignatureId& id) const { return (size_t)id.hash; }
+	};
+
+	SignatureId ComputeSignatureId(const char* signature);
+
+	inline uint64_t MixSignatureId(SignatureId id, uint64_t seed)
+	{
+		uint64_t x = id.hash ^ (seed * 0x9E3779B97F4A7C15ULL);
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+		return x ^ (x >> 31);
+	}
+
+	// minimal perfect hash over the signature ids of a stub table, built by hash and displace.
+	// keys are grouped into buckets, each bucket gets the first seed that maps all its keys to free slots.
+	// buckets with one key are put directly into the remaining free slots.
+	// a lookup costs one displacement read, one slot read and one id compare.
+	// two different signatures with the same hash are a collision, it asserts and only the first one is kept,
+	// so the other one is reported as not found instead of being bound to a stub of another signature.
+	template<typename T>
+	class SignatureIdTable
+	{
+	public:
+		// duplicated ids keep the first entry, as the generated tables did with the former hash maps
+		void Build(std::vector<std::pair<SignatureId, T>>& entries)
+		{
+			std::stable_sort(entries.begin(), entries.end(), [](const std::pair<SignatureId, T>& a, const std::pair<SignatureId, T>& b) { return a.first.hash < b.first.hash; });
+			entries.erase(std::unique(entries.begin(), entries.end(), [](const std::pair<SignatureId, T>& a, const std::pair<SignatureId, T>& b)
+				{
+					IL2CPP_ASSERT(a.first.hash != b.first.hash || a.first.check == b.first.check);
+					return a.first.hash == b.first.hash;
+				}), entries.end());
+
+			_displacements.clear();
+			_ids.clear();
+			_values.clear();
+			if (entries.empty())
+			{
+				return;
+			}
+			for (size_t bucketCount = std::max<size_t>(1, entries.size() / 4); !TryBuild(entries, bucketCount); bucketCount *= 2)
+			{
+			}
+		}
+
+		T Find(SignatureId id, T notFoundValue) const
+		{
+			if (_ids.empty())
+			{
+				return notFoundValue;
+			}
+			int32_t displacement = _displacements[MixSignatureId(id, 0) % _displacements.size()];
+			size_t slot = displacement < 0 ? (size_t)(-displacement - 1) : (size_t)(MixSignatureId(id, (uint64_t)displacement) % _ids.size());
+			if (_ids[slot].hash != id.hash)
+			{
+				return notFoundValue;
+			}
+			IL2CPP_ASSERT(_ids[slot].check == id.check);
+			return _ids[slot].check == id.check ? _values[slot] : notFoundValue;
+		}
+
+	private:
+		bool TryBuild(const std::vector<std::pair<SignatureId, T>>& entries, size_t bucketCount)
+		{
+			const uint32_t kMaxSeed = 1 << 16;
+			size_t slotCount = entries.size();
+			std::vector<std::vector<size_t>> buckets(bucketCount);
+			for (size_t i = 0; i < slotCount; i++)
+			{
+				buckets[MixSignatureId(entries[i].first, 0) % bucketCount].push_back(i);
+			}
+			std::vector<size_t> bucketOrder(bucketCount);
+			std::iota(bucketOrder.begin(), bucketOrder.end(), (size_t)0);
+			std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&buckets](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+			_displacements.assign(bucketCount, 0);
+			_ids.assign(slotCount, SignatureId{ 0, 0 });
+			_values.assign(slotCount, T());
+			std::vector<bool> usedSlots(slotCount, false);
+			std::vector<size_t> bucketSlots;
+			size_t nextFreeSlot = 0;
+			for (size_t bucketIdx : bucketOrder)
+			{
+				const std::vector<size_t>& bucket = buckets[bucketIdx];
+				if (bucket.empty())
+				{
+					break;
+				}
+				if (bucket.size() == 1)
+				{
+					while (usedSlots[nextFreeSlot])
+					{
+						++nextFreeSlot;
+					}
+					usedSlots[nextFreeSlot] = true;
+					_ids[nextFreeSlot] = entries[bucket[0]].first;
+					_values[nextFreeSlot] = entries[bucket[0]].second;
+					_displacements[bucketIdx] = -(int32_t)nextFreeSlot - 1;
+					continue;
+				}
+				uint32_t seed = 1;
+				for (; seed < kMaxSeed; seed++)
+				{
+					bucketSlots.clear();
+					for (size_t entryIdx : bucket)
+					{
+						size_t slot = (size_t)(MixSignatureId(entries[entryIdx].first, seed) % slotCount);
+						if (usedSlots[slot] || std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+						{
+							break;
+						}
+						bucketSlots.push_back(slot);
+					}
+					if (bucketSlots.size() == bucket.size())
+					{
+						break;
+					}
+				}
+				if (seed == kMaxSeed)
+				{
+					return false;
+				}
+				for (size_t i = 0; i < bucket.size(); i++)
+				{
+					size_t slot = bucketSlots[i];
+					usedSlots[slot] = true;
+					_ids[slot] = entries[bucket[i]].first;
+					_values[slot] = entries[bucket[i]].second;
+				}
+				_displacements[bucketIdx] = (int32_t)seed;
+			}
+			return true;
+		}
+
+		std::vector<int32_t> _displacements;
+		std::vector<SignatureId> _ids;
+		std::vector<T> _values;
+	};
 	
 	template<typename T> uint64_t N2MAsUint64ValueOrAddress(T& value)
 	{
@@ -0,0 +1,44 @@
+#include "OpcodeProfiler.h"
+
+#include <cstdio>
+
+namespace hybridclr
+{
+namespace interpreter
+{
+#if HYBRIDCLR_ENABLE_OPCODE_PROFILER
+
+	uint32_t* OpcodeProfiler::s_pairCounts = nullptr;
+
+	void OpcodeProfiler::Initialize()
+	{
+		s_pairCounts = (uint32_t*)HYBRIDCLR_CALLOC((size_t)g_instructionCount * g_instructionCount, sizeof(uint32_t));
+	}
+
+	bool OpcodeProfiler::DumpPairHistogram(const char* path)
+	{
+		FILE* fp = std::fopen(path, "w");
+		if (!fp)
+		{
+			return false;
+		}
+		std::fprintf(fp, "# opcodeCount=%u\n", g_instructionCount);
+		std::fprintf(fp, "prev,cur,count\n");
+		for (uint32_t prev = 0; prev < g_instructionCount; prev++)
+		{
+			const uint32_t* counts = s_pairCounts + (size_t)prev * g_instructionCount;
+			for (uint32_t cur = 0; cur < g_instructionCount; cur++)
+			{
+				if (counts[cur])
+				{
+					std::fprintf(fp, "%u,%u,%u\n", prev, cur, counts[cur]);
+				}
+			}
+		}
+		std::fclose(fp);
+		return true;
+	}
+
+#endif
+}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "../CommonDef.h"
+#include "Instruction.h"
+
+namespace hybridclr
+{
+namespace interpreter
+{
+#if HYBRIDCLR_ENABLE_OPCODE_PROFILER
+
+	// counts how often an instruction is directly followed by another one at runtime.
+	// the dumped histogram is the input of tools/superinstruction/gen_superinstructions.py.
+	class OpcodeProfiler
+	{
+	public:
+		static void Initialize();
+
+		static void RecordPair(HiOpcodeEnum prev, HiOpcodeEnum cur)
+		{
+			// counters are updated without synchronization, a few lost increments don't matter for a histogram.
+			++s_pairCounts[(uint32_t)prev * g_instructionCount + (uint32_t)cur];
+		}
+
+		static bool DumpPairHistogram(const char* path);
+	private:
+		static uint32_t* s_pairCounts;
+	};
+
+#endif
+}
+}
@@ -17,6 +17,7 @@
 #include "Image.h"
 #include "MetadataModule.h"
 #include "MetadataUtil.h"
+#include "ClassHierarchy.h"
 #include "ConsistentAOTHomologousImage.h"
 #include "SuperSetAOTHomologousImage.h"
 
@@ -99,15 +100,120 @@ namespace metadata
 
     Il2CppAssembly* Assembly::LoadFromBytes(const void* assemblyData, uint64_t length, const void* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength)
     {
-        Il2CppAssembly* ass = Create((const byte*)assemblyData, length, (const byte*)rawSymbolStoreBytes, rawSymbolStoreLength);
+        Il2CppAssembly* ass = Create((const byte*)assemblyData, length, (const byte*)rawSymbolStoreBytes, rawSymbolStoreLength, ImageDataOwnership::Copy);
         RunModuleInitializer(ass->image);
         return ass;
     }
 
-    Il2CppAssembly* Assembly::Create(const byte* assemblyData, uint64_t length, const byte* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength)
+    static const byte* MapReadOnlyFile(const char* path, uint64_t& length)
+    {
+        int error = 0;
+        il2cpp::os::FileHandle* handle = il2cpp::os::File::Open(path, kFileModeOpen, kFileAccessRead, kFileShareRead, kFileOptionsNone, &error);
+        if (error != 0)
+        {
+            TEMP_FORMAT(errMsg, "can't open file:%s", path);
+            il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetFileLoadException(errMsg));
+        }
+        int64_t fileLength = il2cpp::os::File::GetLength(handle, &error);
+        // an empty file can't be mapped, and isn't a valid image anyway
+        void* data = error == 0 && fileLength > 0 ? il2cpp::utils::MemoryMappedFile::Map(handle) : nullptr;
+        // the mapping stays valid after the handle is closed
+        il2cpp::os::File::Close(handle, &error);
+        if (!data)
+        {
+            TEMP_FORMAT(errMsg, "can't map file:%s", path);
+            il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetFileLoadException(errMsg));
+        }
+        length = (uint64_t)fileLength;
+        return (const byte*)data;
+    }
+
+    Il2CppAssembly* Assembly::LoadFromFile(const char* assemblyPath, const char* symbolStorePath)
+    {
+        if (!assemblyPath)
+        {
+            il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetArgumentNullException("assemblyPath is null"));
+        }
+        uint64_t length = 0;
+        const byte* assemblyData = MapReadOnlyFile(assemblyPath, length);
+        uint64_t rawSymbolStoreLength = 0;
+        const byte* rawSymbolStoreBytes = nullptr;
+        if (symbolStorePath)
+        {
+            try
+            {
+                rawSymbolStoreBytes = MapReadOnlyFile(symbolStorePath, rawSymbolStoreLength);
+            }
+            catch (Il2CppExceptionWrapper&)
+            {
+                il2cpp::utils::MemoryMappedFile::Unmap((void*)assemblyData, (int64_t)length);
+                throw;
+            }
+        }
+        Il2CppAssembly* ass = Create(assemblyData, length, rawSymbolStoreBytes, rawSymbolStoreLength, ImageDataOwnership::MappedFile);
+        RunModuleInitializer(ass->image);
+        return ass;
+    }
+
+    Il2CppAssembly* Assembly::LoadFromMappedView(const void* assemblyData, uint64_t length, const void* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength)
+    {
+        Il2CppAssembly* ass = Create((const byte*)assemblyData, length, (const byte*)rawSymbolStoreBytes, rawSymbolStoreLength, ImageDataOwnership::External);
+        RunModuleInitializer(ass->image);
+        return ass;
+    }
+
+    // releases image bytes when Create fails before an image took them over
+    class ImageDataGuard
+    {
+    public:
+        ImageDataGuard(const byte* data, uint64_t length, ImageDataOwnership ownership)
+            : _data(ownership == ImageDataOwnership::External ? nullptr : data), _length(length), _ownership(ownership)
+        {
+        }
+
+        ~ImageDataGuard()
+        {
+            if (!_data)
+            {
+                return;
+            }
+            if (_ownership == ImageDataOwnership::Copy)
+            {
+                HYBRIDCLR_FREE((void*)_data);
+            }
+            else
+            {
+                il2cpp::utils::MemoryMappedFile::Unmap((void*)_data, (int64_t)_length);
+            }
+        }
+
+        void Dismiss()
+        {
+            _data = nullptr;
+        }
+
+    private:
+        const byte* _data;
+        uint64_t _length;
+        ImageDataOwnership _ownership;
+    };
+
+    Il2CppAssembly* Assembly::Create(const byte* assemblyData, uint64_t length, const byte* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength, ImageDataOwnership ownership)
     {
         il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
 
+        if (ownership == ImageDataOwnership::Copy && assemblyData)
+        {
+            assemblyData = (const byte*)CopyBytes(assemblyData, length);
+            if (rawSymbolStoreBytes)
+            {
+                rawSymbolStoreBytes = (const byte*)CopyBytes(rawSymbolStoreBytes, rawSymbolStoreLength);
+            }
+        }
+        // the image owns the bytes only once they are loaded, until then every error path releases them here
+        ImageDataGuard assemblyDataGuard(assemblyData, length, ownership);
+        ImageDataGuard symbolStoreGuard(rawSymbolStoreBytes, rawSymbolStoreLength, ownership);
+
         if (!assemblyData)
         {
             il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetArgumentNullException("rawAssembly is null"));
@@ -120,25 +226,28 @@ namespace metadata
         }
         InterpreterImage* image = new InterpreterImage(imageId);
         
-        assemblyData = (const byte*)CopyBytes(assemblyData, length);
-        LoadImageErrorCode err = image->Load(assemblyData, (size_t)length);
+        LoadImageErrorCode err = image->Load(assemblyData, (size_t)length, ownership);
 
         if (err != LoadImageErrorCode::OK)
         {
+            // nothing references the image yet. its index is not reused, a bad image is a fatal error anyway.
+            delete image;
             TEMP_FORMAT(errMsg, "LoadImageErrorCode:%d", (int)err);
             il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetBadImageFormatException(errMsg));
-            // when load a bad image, mean a fatal error. we don't clean image on purpose.
         }
+        assemblyDataGuard.Dismiss();
 
         if (rawSymbolStoreBytes)
         {
-            rawSymbolStoreBytes = (const byte*)CopyBytes(rawSymbolStoreBytes, rawSymbolStoreLength);
-            err = image->LoadPDB(rawSymbolStoreBytes, (size_t)rawSymbolStoreLength);
+            err = image->LoadPDB(rawSymbolStoreBytes, (size_t)rawSymbolStoreLength, ownership);
             if (err != LoadImageErrorCode::OK)
             {
+                // releases the assembly bytes the image already owns
+                delete image;
                 TEMP_FORMAT(errMsg, "LoadPDB Error:%d", (int)err);
                 il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetBadImageFormatException(errMsg));
             }
+            symbolStoreGuard.Dismiss();
         }
 
         TbAssembly data = image->GetRawImage().ReadAssembly(1);
@@ -173,6 +282,8 @@ namespace metadata
 
         image->InitRuntimeMetadatas();
 
+        // methods devirtualized on a base class of the new types are invalidated before any of them can be instantiated
+        ClassHierarchy::RegisterImage(image);
         il2cpp::vm::MetadataCache::RegisterInterpreterAssembly(ass);
         return ass;
     }
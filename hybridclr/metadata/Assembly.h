@@ -15,9 +15,15 @@ namespace metadata
     public:
         static void InitializePlaceHolderAssemblies();
         static Il2CppAssembly* LoadFromBytes(const void* assemblyData, uint64_t length, const void* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength);
+        // maps the files read-only and reads metadata in place instead of copying them. the mappings live as long as the image.
+        // symbolStorePath may be null.
+        static Il2CppAssembly* LoadFromFile(const char* assemblyPath, const char* symbolStorePath);
+        // loads from memory owned by the caller without copying. the memory must stay valid and unchanged forever,
+        // because images are never unloaded.
+        static Il2CppAssembly* LoadFromMappedView(const void* assemblyData, uint64_t length, const void* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength);
         static LoadImageErrorCode LoadMetadataForAOTAssembly(const void* dllBytes, uint32_t dllSize, HomologousImageMode mode);
     private:
-        static Il2CppAssembly* Create(const byte* assemblyData, uint64_t length, const byte* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength);
+        static Il2CppAssembly* Create(const byte* assemblyData, uint64_t length, const byte* rawSymbolStoreBytes, uint64_t rawSymbolStoreLength, ImageDataOwnership ownership);
     };
 }
 }
\ No newline at end of file
@@ -351,7 +351,7 @@ namespace metadata
             fieldLayout.type = inflatedFieldType;
             if (isCurAssemblyType)
             {
-                int32_t offset = _image->GetFieldOffset(typeDef, i);
+                int32_t offset = _image->GetRawFieldOffset(typeDef, i);
                 fieldLayout.offset = offset;
                 fieldLayout.isNormalStatic = IsRawNormalStaticField(inflatedFieldType, offset);
                 fieldLayout.isThreadStatic = IsRawThreadStaticField(inflatedFieldType, offset);
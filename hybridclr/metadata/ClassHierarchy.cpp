@@ -0,0 +1,122 @@
+#include "ClassHierarchy.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Baselib.h"
+#include "os/Atomic.h"
+#include "os/Mutex.h"
+#include "vm/GlobalMetadata.h"
+
+#include "InterpreterImage.h"
+#include "MetadataUtil.h"
+#include "../interpreter/InterpreterDefs.h"
+
+namespace hybridclr
+{
+namespace metadata
+{
+	static baselib::ReentrantLock s_classHierarchyLock;
+	// if a type is in the set, all its interpreter ancestors are in the set too
+	static std::unordered_set<const Il2CppTypeDefinition*> s_typeDefsWithSubclass;
+	static std::unordered_map<const Il2CppTypeDefinition*, std::vector<const MethodInfo*>> s_noSubclassDependencies;
+
+	static const Il2CppTypeDefinition* GetParentTypeDefinition(const Il2CppTypeDefinition* typeDef)
+	{
+		if (typeDef->parentIndex == kInvalidIndex)
+		{
+			return nullptr;
+		}
+		return GetUnderlyingTypeDefinition(il2cpp::vm::GlobalMetadata::GetIl2CppTypeFromIndex(typeDef->parentIndex));
+	}
+
+	static void InvalidateDependentMethods(const Il2CppTypeDefinition* typeDef)
+	{
+		auto it = s_noSubclassDependencies.find(typeDef);
+		if (it == s_noSubclassDependencies.end())
+		{
+			return;
+		}
+		for (const MethodInfo* method : it->second)
+		{
+			// a method being transformed again keeps kTransformingInterpData, its owner checks the assumptions
+			// under s_classHierarchyLock before publishing, so it never publishes code that depends on this class.
+			if (!interpreter::IsTransformedInterpData(method->interpData))
+			{
+				continue;
+			}
+			// the old InterpMethodInfo is leaked on purpose, it may still be executed by other frames
+			il2cpp::os::Atomic::FullMemoryBarrier();
+			const_cast<MethodInfo*>(method)->interpData = nullptr;
+		}
+		s_noSubclassDependencies.erase(it);
+	}
+
+	void ClassHierarchy::RegisterImage(InterpreterImage* image)
+	{
+		il2cpp::os::FastAutoLock lock(&s_classHierarchyLock);
+		uint32_t typeCount = image->GetTypeCount();
+		for (uint32_t i = 0; i < typeCount; i++)
+		{
+			const Il2CppTypeDefinition* typeDef = image->GetTypeFromRawIndex(i);
+			if (IsInterface(typeDef->flags))
+			{
+				continue;
+			}
+			for (const Il2CppTypeDefinition* parentDef = GetParentTypeDefinition(typeDef); parentDef && IsInterpreterType(parentDef); parentDef = GetParentTypeDefinition(parentDef))
+			{
+				if (!s_typeDefsWithSubclass.insert(parentDef).second)
+				{
+					break;
+				}
+				InvalidateDependentMethods(parentDef);
+			}
+		}
+	}
+
+	static bool HasSubclassNoLock(const Il2CppClass* klass)
+	{
+		IL2CPP_ASSERT(IsInterpreterType(klass));
+		return s_typeDefsWithSubclass.find(GetUnderlyingTypeDefinition(&klass->byval_arg)) != s_typeDefsWithSubclass.end();
+	}
+
+	bool ClassHierarchy::HasSubclass(const Il2CppClass* klass)
+	{
+		il2cpp::os::FastAutoLock lock(&s_classHierarchyLock);
+		return HasSubclassNoLock(klass);
+	}
+
+	PublishInterpDataResult ClassHierarchy::PublishInterpData(const MethodInfo* method, void* interpData, const void* expectedInterpData,
+		const std::vector<const Il2CppClass*>& noSubclassAssumptions)
+	{
+		il2cpp::os::FastAutoLock lock(&s_classHierarchyLock);
+		if (method->interpData != expectedInterpData)
+		{
+			return PublishInterpDataResult::InterpDataChanged;
+		}
+		for (const Il2CppClass* klass : noSubclassAssumptions)
+		{
+			if (HasSubclassNoLock(klass))
+			{
+				return PublishInterpDataResult::SubclassLoaded;
+			}
+		}
+		for (const Il2CppClass* klass : noSubclassAssumptions)
+		{
+			std::vector<const MethodInfo*>& methods = s_noSubclassDependencies[GetUnderlyingTypeDefinition(&klass->byval_arg)];
+			if (std::find(methods.begin(), methods.end(), method) == methods.end())
+			{
+				methods.push_back(method);
+			}
+		}
+		// interpData is changed from kTransformingInterpData without s_classHierarchyLock only by the owner of the transform
+		if (il2cpp::os::Atomic::CompareExchangePointer<void>(&const_cast<MethodInfo*>(method)->interpData, interpData, const_cast<void*>(expectedInterpData)) != expectedInterpData)
+		{
+			return PublishInterpDataResult::InterpDataChanged;
+		}
+		return PublishInterpDataResult::Published;
+	}
+}
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+#include "../CommonDef.h"
+
+namespace hybridclr
+{
+namespace metadata
+{
+	class InterpreterImage;
+
+	enum class PublishInterpDataResult
+	{
+		Published,
+		// interpData was replaced meanwhile, e.g. by a nested transform or an invalidation
+		InterpDataChanged,
+		// a subclass of a class assumed to have none was loaded meanwhile
+		SubclassLoaded,
+	};
+
+	// tracks which interpreter types have subclasses, so that a virtual call on a class without subclass
+	// can be transformed to a direct call. aot types never derive from interpreter types, only interpreter
+	// images need to be tracked.
+	// a method transformed on such assumption registers a dependency. when a later loaded image adds a
+	// subclass, the method is invalidated and transformed again on next call. frames still running the old
+	// code keep it through InterpFrame::imi, so old code is never freed.
+	// the state has its own lock instead of g_MetadataLock, transformed methods are published without g_MetadataLock.
+	class ClassHierarchy
+	{
+	public:
+		static void RegisterImage(InterpreterImage* image);
+
+		static bool HasSubclass(const Il2CppClass* klass);
+
+		// publishes interpData of a method transformed on noSubclassAssumptions if methodInfo->interpData is still
+		// expectedInterpData. the dependencies are added together with publishing, so a subclass loaded at any time
+		// either fails the publishing or invalidates the published code.
+		static PublishInterpDataResult PublishInterpData(const MethodInfo* method, void* interpData, const void* expectedInterpData,
+			const std::vector<const Il2CppClass*>& noSubclassAssumptions);
+	};
+}
+}
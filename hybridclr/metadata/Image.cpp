@@ -909,13 +909,80 @@ namespace metadata
         }
     }
 
-    Il2CppClass* Image::GetClassFromToken(Token2RuntimeHandleMap& tokenCache, uint32_t token, const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, const Il2CppGenericContext* genericContext)
+    void* TokenResolutionCache::Find(const TokenGenericContextType& key)
+    {
+        Shard& shard = GetShard(key);
+        il2cpp::os::FastAutoLock lock(&shard.lock);
+        auto it = shard.handles.find(key);
+        return it != shard.handles.end() ? it->second : nullptr;
+    }
+
+    void TokenResolutionCache::Add(const TokenGenericContextType& key, void* handle)
+    {
+        Shard& shard = GetShard(key);
+        il2cpp::os::FastAutoLock lock(&shard.lock);
+        // another thread may have resolved the same token, both results are the same
+        shard.handles.insert({ key, handle });
+    }
+
+    size_t TokenResolutionCache::GetEntryCount()
+    {
+        size_t count = 0;
+        for (Shard& shard : _shards)
+        {
+            il2cpp::os::FastAutoLock lock(&shard.lock);
+            count += shard.handles.size();
+        }
+        return count;
+    }
+
+    size_t TokenResolutionCache::GetMemorySize()
+    {
+        size_t size = sizeof(TokenResolutionCache);
+        for (Shard& shard : _shards)
+        {
+            il2cpp::os::FastAutoLock lock(&shard.lock);
+            size += shard.handles.bucket_count() * sizeof(Token2RuntimeHandleMap::value_type);
+        }
+        return size;
+    }
+
+    static void* FindResolvedToken(Token2RuntimeHandleMap& tokenCache, TokenResolutionCache& sharedCache, const TokenGenericContextType& key,
+        const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer)
     {
-        TokenGenericContextType key(token, genericContext);
         auto it = tokenCache.find(key);
         if (it != tokenCache.end())
         {
-            return (Il2CppClass*)it->second;
+            return it->second;
+        }
+        if (!TokenResolutionCache::IsCacheable(klassGenericContainer, methodGenericContainer, std::get<1>(key)))
+        {
+            return nullptr;
+        }
+        void* handle = sharedCache.Find(key);
+        if (handle)
+        {
+            tokenCache.insert({ key, handle });
+        }
+        return handle;
+    }
+
+    static void AddResolvedToken(Token2RuntimeHandleMap& tokenCache, TokenResolutionCache& sharedCache, const TokenGenericContextType& key,
+        const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, void* handle)
+    {
+        tokenCache.insert({ key, handle });
+        if (TokenResolutionCache::IsCacheable(klassGenericContainer, methodGenericContainer, std::get<1>(key)))
+        {
+            sharedCache.Add(key, handle);
+        }
+    }
+
+    Il2CppClass* Image::GetClassFromToken(Token2RuntimeHandleMap& tokenCache, uint32_t token, const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, const Il2CppGenericContext* genericContext)
+    {
+        TokenGenericContextType key(token, genericContext);
+        if (void* cachedKlass = FindResolvedToken(tokenCache, _tokenResolutionCache, key, klassGenericContainer, methodGenericContainer))
+        {
+            return (Il2CppClass*)cachedKlass;
         }
 
         const Il2CppType* originType = ReadTypeFromToken(klassGenericContainer, methodGenericContainer, DecodeTokenTableType(token), DecodeTokenRowIndex(token));
@@ -926,7 +993,7 @@ namespace metadata
             TEMP_FORMAT(errMsg, "InterpreterImage::GetClassFromToken token:%u class not exists", token);
             il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetTypeLoadException(errMsg));
         }
-        tokenCache.insert({ key, (void*)klass });
+        AddResolvedToken(tokenCache, _tokenResolutionCache, key, klassGenericContainer, methodGenericContainer, (void*)klass);
         return klass;
     }
 
@@ -1063,10 +1130,9 @@ namespace metadata
     const FieldInfo* Image::GetFieldInfoFromToken(Token2RuntimeHandleMap& tokenCache, uint32_t token, const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, const Il2CppGenericContext* genericContext)
     {
         TokenGenericContextType key(token, genericContext);
-        auto it = tokenCache.find(key);
-        if (it != tokenCache.end())
+        if (void* cachedField = FindResolvedToken(tokenCache, _tokenResolutionCache, key, klassGenericContainer, methodGenericContainer))
         {
-            return (const FieldInfo*)it->second;
+            return (const FieldInfo*)cachedField;
         }
 
         FieldRefInfo fri;
@@ -1079,7 +1145,7 @@ namespace metadata
         const Il2CppType* resultType = genericContext != nullptr ? il2cpp::metadata::GenericMetadata::InflateIfNeeded(fri.containerType, genericContext, true) : fri.containerType;
         const FieldInfo* fieldInfo = GetFieldInfoFromFieldRef(*resultType, fri.field);
         il2cpp::vm::Class::Init(fieldInfo->parent);
-        tokenCache.insert({ key, (void*)fieldInfo });
+        AddResolvedToken(tokenCache, _tokenResolutionCache, key, klassGenericContainer, methodGenericContainer, (void*)fieldInfo);
         return fieldInfo;
     }
 
@@ -1145,11 +1211,10 @@ namespace metadata
 
     const MethodInfo* Image::GetMethodInfoFromToken(Token2RuntimeHandleMap& tokenCache, uint32_t token, const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, const Il2CppGenericContext* genericContext)
     {
-        auto key = std::tuple<uint32_t, const Il2CppGenericContext*>(token, genericContext);
-        auto it = tokenCache.find(key);
-        if (it != tokenCache.end())
+        TokenGenericContextType key(token, genericContext);
+        if (void* cachedMethod = FindResolvedToken(tokenCache, _tokenResolutionCache, key, klassGenericContainer, methodGenericContainer))
         {
-            return (const MethodInfo*)it->second;
+            return (const MethodInfo*)cachedMethod;
         }
 
         const MethodInfo* method = ReadMethodInfoFromToken(klassGenericContainer, methodGenericContainer, genericContext,
@@ -1158,7 +1223,7 @@ namespace metadata
         IL2CPP_ASSERT(method);
         il2cpp::vm::Class::Init(method->klass);
 
-        tokenCache.insert({ key, (void*)method });
+        AddResolvedToken(tokenCache, _tokenResolutionCache, key, klassGenericContainer, methodGenericContainer, (void*)method);
         return method;
     }
 
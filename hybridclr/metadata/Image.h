@@ -6,10 +6,13 @@
 
 #include "vm/GlobalMetadataFileInternals.h"
 #include "vm/Assembly.h"
+#include "vm/MetadataLock.h"
 #include "gc/GarbageCollector.h"
 #include "gc/Allocator.h"
 #include "gc/AppendOnlyGCHashMap.h"
 #include "utils/Il2CppHashMap.h"
+#include "Baselib.h"
+#include "os/Mutex.h"
 
 #include "RawImage.h"
 #include "VTableSetup.h"
@@ -39,6 +42,41 @@ namespace metadata
 
 	typedef Il2CppHashMap<std::tuple<uint32_t, const Il2CppGenericContext*>, void*, TokenGenericContextTypeHash, TokenGenericContextTypeEqual> Token2RuntimeHandleMap;
 
+	// classes, fields and methods resolved from tokens of an image, shared by transforms of all methods of the image.
+	// Token2RuntimeHandleMap of a transform is still checked first, it needs no lock.
+	// transforms run on multiple threads, the map is split to shards to reduce contention.
+	class TokenResolutionCache
+	{
+	public:
+		// without generic context, a token with generic parameters resolves differently in each generic container.
+		static bool IsCacheable(const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, const Il2CppGenericContext* genericContext)
+		{
+			return genericContext != nullptr || (klassGenericContainer == nullptr && methodGenericContainer == nullptr);
+		}
+
+		void* Find(const TokenGenericContextType& key);
+		void Add(const TokenGenericContextType& key, void* handle);
+
+		size_t GetEntryCount();
+		// approximate bytes used by the maps
+		size_t GetMemorySize();
+	private:
+		static constexpr uint32_t kShardCount = 16;
+
+		struct Shard
+		{
+			baselib::ReentrantLock lock;
+			Token2RuntimeHandleMap handles;
+		};
+
+		Shard& GetShard(const TokenGenericContextType& key)
+		{
+			return _shards[(TokenGenericContextTypeHash()(key) >> 8) % kShardCount];
+		}
+
+		Shard _shards[kShardCount];
+	};
+
 	class Image
 	{
 	public:
@@ -50,17 +88,26 @@ namespace metadata
 
 		LoadImageErrorCode InitRawImage(const void* imageData, size_t length);
 
+		// 16 bytes mvid of the module, changes whenever the assembly is rebuilt
+		const byte* GetModuleVersionId() const
+		{
+			return _rawImage->GetGuidFromRawIndex(_rawImage->ReadModule(1).mvid);
+		}
+
 		PDBImage* GetPDBImage() const
 		{
 			return _pdbImage;
 		}
 
-		LoadImageErrorCode LoadPDB(const void* pdbBytes, size_t pdbLength)
+		LoadImageErrorCode LoadPDB(const void* pdbBytes, size_t pdbLength, ImageDataOwnership ownership)
 		{
 			_pdbImage = new PDBImage();
+			_pdbImage->SetImageDataOwnership(ownership);
 			LoadImageErrorCode err = _pdbImage->Load(pdbBytes, pdbLength);
 			if (err != LoadImageErrorCode::OK)
 			{
+				// the bytes stay with the caller when loading fails
+				_pdbImage->SetImageDataOwnership(ImageDataOwnership::External);
 				delete _pdbImage;
 				_pdbImage = nullptr;
 				return LoadImageErrorCode::PDB_BAD_FILE;
@@ -108,6 +155,10 @@ namespace metadata
 		void ReadMethodBody(const Il2CppMethodDefinition& methodDef, const TbMethod& methodData, MethodBody& body);
 
 		Il2CppString* GetIl2CppUserStringFromRawIndex(StringIndex index);
+		TokenResolutionCache& GetTokenResolutionCache()
+		{
+			return _tokenResolutionCache;
+		}
 		Il2CppClass* GetClassFromToken(Token2RuntimeHandleMap& tokenCache, uint32_t token, const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, const Il2CppGenericContext* genericContext);
 		const FieldInfo* GetFieldInfoFromFieldRef(const Il2CppType& type, const Il2CppFieldDefinition* fieldDef);
 		const void* GetRuntimeHandleFromToken(Token2RuntimeHandleMap& tokenCache, uint32_t token, const Il2CppGenericContainer* klassGenericContainer, const Il2CppGenericContainer* methodGenericContainer, const Il2CppGenericContext* genericContext);
@@ -157,6 +208,8 @@ namespace metadata
 
 		const Il2CppAssembly* GetLoadedAssembly(const char* assemblyName)
 		{
+			// called by transform, which may run on any thread
+			il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
 			auto it = _nameToAssemblies.find(assemblyName);
 			if (it != _nameToAssemblies.end())
 			{
@@ -180,6 +233,7 @@ namespace metadata
 		PDBImage* _pdbImage;
 		Il2CppHashMap<const char*, const Il2CppAssembly*, CStringHash, CStringEqualTo> _nameToAssemblies;
 		il2cpp::gc::AppendOnlyGCHashMap<uint32_t, Il2CppString*, il2cpp::utils::PassThroughHash<uint32_t>> _il2cppStringCache;
+		TokenResolutionCache _tokenResolutionCache;
 	};
 }
 }
\ No newline at end of file
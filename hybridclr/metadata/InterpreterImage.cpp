@@ -30,6 +30,7 @@
 #include "MetadataUtil.h"
 #include "ClassFieldLayoutCalculator.h"
 #include "MetadataPool.h"
+#include "MetadataWorkerPool.h"
 
 #include "../interpreter/Engine.h"
 #include "../interpreter/InterpreterModule.h"
@@ -155,26 +156,34 @@ namespace metadata
 
 		InitGenericParamConstraintDefs();
 
+		// passes below only need type and method definitions. the ones that just decode raw tables into their own
+		// arrays run on workers, the others resolve types, may take g_MetadataLock and stay on this thread.
+		MetadataTaskGroup parallelPasses;
+		parallelPasses.Run([this]() { InitMethodImpls0(); });
+		parallelPasses.Run([this]() {
+			InitProperties();
+			InitEvents();
+			InitMethodSemantics();
+		});
+		parallelPasses.Run([this]() {
+			InitModuleRefs();
+			InitImplMaps();
+		});
+		parallelPasses.Run([this]() { InitInterfaces(); });
+
 		InitParamDefs();
 		InitMethodDefs();
 		InitFieldDefs();
 		InitFieldLayouts();
 		InitFieldRVAs();
 		InitBlittables();
-		InitMethodImpls0();
-		InitProperties();
-		InitEvents();
-		InitMethodSemantics();
 		InitConsts();
 		InitCustomAttributes();
-		InitModuleRefs();
-		InitImplMaps();
 		InitClassLayouts0();
 		InitTypeDefs_2();
-		InitClassLayouts();
-		InitInterfaces();
 		InitClass();
-		InitVTables();
+
+		parallelPasses.Wait();
 
 		Il2CppHashMap<const Il2CppType*, uint32_t, Il2CppTypeHashShallow, Il2CppTypeEqualityComparerShallow> temp;
 		_type2Indexs.swap(temp);
@@ -188,6 +197,7 @@ namespace metadata
 		const Table& typeDefTb = _rawImage->GetTable(TableType::TYPEDEF);
 		_typesDefines.resize(typeDefTb.rowNum);
 		_typeDetails.resize(typeDefTb.rowNum);
+		_classLayoutInited = std::vector<std::atomic<bool>>(typeDefTb.rowNum);
 		for (uint32_t i = 0, n = typeDefTb.rowNum; i < n; i++)
 		{
 			Il2CppTypeDefinition& cur = _typesDefines[i];
@@ -378,6 +388,7 @@ namespace metadata
 			FieldDetail& fd = _fieldDetails[i];
 			Il2CppFieldDefinition& cur = fd.fieldDef;
 
+			fd.rawOffset = 0;
 			fd.offset = 0;
 			fd.defaultValueIndex = kDefaultValueIndexNull;
 
@@ -407,7 +418,7 @@ namespace metadata
 		for (uint32_t i = 0; i < tb.rowNum; i++)
 		{
 			TbFieldLayout data = _rawImage->ReadFieldLayout(i + 1);
-			_fieldDetails[data.field - 1].offset = sizeof(Il2CppObject) + data.offset;
+			_fieldDetails[data.field - 1].rawOffset = sizeof(Il2CppObject) + data.offset;
 		}
 	}
 
@@ -709,7 +720,7 @@ namespace metadata
 				if (ctorMethodToken == threadStaticMethodToken)
 				{
 					IL2CPP_ASSERT(threadStaticMethodToken != 0);
-					_fieldDetails[parentRowIndex - 1].offset = THREAD_LOCAL_STATIC_MASK;
+					_fieldDetails[parentRowIndex - 1].rawOffset = THREAD_LOCAL_STATIC_MASK;
 				}
 			}
 
@@ -1778,58 +1789,55 @@ namespace metadata
 		}
 	}
 
-	void InterpreterImage::InitClassLayouts()
+	void InterpreterImage::ComputeClassLayout(uint32_t typeIndex)
 	{
-		ClassFieldLayoutCalculator calculator(this);
-		for (Il2CppTypeDefinition& type : _typesDefines)
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		TypeDefinitionDetail& type = _typeDetails[typeIndex];
+		if (_classLayoutInited[typeIndex].load(std::memory_order_relaxed))
 		{
-			const Il2CppType* il2cppType = GetIl2CppTypeFromTypeDefinition(&type);
-			calculator.CalcClassNotStaticFields(il2cppType);
+			return;
 		}
+		// layouts of parents and value type fields are computed again by the calculator. they are cheap
+		// compared with computing layouts of all types at load.
+		ClassFieldLayoutCalculator calculator(this);
+		const Il2CppTypeDefinition* typeDef = &_typesDefines[typeIndex];
+		const Il2CppType* il2cppType = GetIl2CppTypeFromTypeDefinition(typeDef);
+		calculator.CalcClassNotStaticFields(il2cppType);
+		calculator.CalcClassStaticFields(il2cppType);
+		ClassLayoutInfo* layout = calculator.GetClassLayoutInfo(il2cppType);
 
-		for (TypeDefinitionDetail& type : _typeDetails)
+		auto& sizes = type.typeSizes;
+		sizes.native_size = layout->nativeSize;
+		if (typeDef->genericContainerIndex == kGenericContainerIndexInvalid)
 		{
-			const Il2CppTypeDefinition* typeDef = GetTypeDefinitionByTypeDetail(&type);
-			const Il2CppType* il2cppType = GetIl2CppTypeFromTypeDefinition(typeDef);
-			calculator.CalcClassStaticFields(il2cppType);
-			ClassLayoutInfo* layout = calculator.GetClassLayoutInfo(il2cppType);
-
-			auto& sizes = type.typeSizes;
-			sizes.native_size = layout->nativeSize;
-			if (typeDef->genericContainerIndex == kGenericContainerIndexInvalid)
+			sizes.static_fields_size = layout->staticFieldsSize;
+			sizes.thread_static_fields_size = layout->threadStaticFieldsSize;
+		}
+		else
+		{
+			sizes.static_fields_size = 0;
+			sizes.thread_static_fields_size = 0;
+		}
+		if (sizes.instance_size == 0)
+		{
+			sizes.instance_size = layout->instanceSize;
+		}
+		int32_t fieldStart = DecodeMetadataIndex(typeDef->fieldStart);
+		for (int32_t i = 0, end = typeDef->field_count; i < end ; i++)
+		{
+			FieldDetail& fd = _fieldDetails[fieldStart + i];
+			FieldLayout& fieldLayout = layout->fields[i];
+			if (fd.rawOffset == 0 || fd.rawOffset == THREAD_LOCAL_STATIC_MASK)
 			{
-				sizes.static_fields_size = layout->staticFieldsSize;
-				sizes.thread_static_fields_size = layout->threadStaticFieldsSize;
+				fd.offset = fieldLayout.offset;
 			}
 			else
 			{
-				sizes.static_fields_size = 0;
-				sizes.thread_static_fields_size = 0;
-			}
-			if (sizes.instance_size == 0)
-			{
-				sizes.instance_size = layout->instanceSize;
-			}
-			int32_t fieldStart = DecodeMetadataIndex(typeDef->fieldStart);
-			for (int32_t i = 0, end = typeDef->field_count; i < end ; i++)
-			{
-				FieldDetail& fd = _fieldDetails[fieldStart + i];
-				FieldLayout& fieldLayout = layout->fields[i];
-				if (fd.offset == 0)
-				{
-					fd.offset = fieldLayout.offset;
-				}
-				else if (fd.offset == THREAD_LOCAL_STATIC_MASK)
-				{
-					fd.offset = fieldLayout.offset;
-				}
-				else
-				{
-					IL2CPP_ASSERT(fd.offset == fieldLayout.offset);
-					int a = 0;
-				}
+				IL2CPP_ASSERT(fd.rawOffset == fieldLayout.offset);
+				fd.offset = fd.rawOffset;
 			}
 		}
+		_classLayoutInited[typeIndex].store(true, std::memory_order_release);
 	}
 
 	uint32_t InterpreterImage::AddIl2CppTypeCache(const Il2CppType* type)
@@ -1872,6 +1880,7 @@ namespace metadata
 		{
 			return klass;
 		}
+		EnsureVTable(index);
 		klass = il2cpp::vm::GlobalMetadata::FromTypeDefinition(EncodeWithIndex(index));
 		IL2CPP_ASSERT(klass->interfaces_count <= klass->interface_offsets_count || _typesDefines[index].interfaceOffsetsStart == 0);
 		il2cpp::os::Atomic::FullMemoryBarrier();
@@ -1917,10 +1926,12 @@ namespace metadata
 
 	Il2CppInterfaceOffsetInfo InterpreterImage::GetInterfaceOffsetInfo(const Il2CppTypeDefinition* typeDefine, TypeInterfaceOffsetIndex index)
 	{
-		uint32_t globalIndex = DecodeMetadataIndex((uint32_t)(typeDefine->interfaceOffsetsStart + index));
-		IL2CPP_ASSERT(globalIndex < (uint32_t)_interfaceOffsets.size());
+		uint32_t typeIndex = GetTypeRawIndex(typeDefine);
+		EnsureVTable(typeIndex);
+		const TypeDefinitionDetail& tdd = _typeDetails[typeIndex];
+		IL2CPP_ASSERT(index >= 0 && index < (TypeInterfaceOffsetIndex)typeDefine->interface_offsets_count);
 
-		InterfaceOffsetInfo& offsetPair = _interfaceOffsets[globalIndex];
+		const InterfaceOffsetInfo& offsetPair = tdd.interfaceOffsets[index];
 		return { offsetPair.type, (int32_t)offsetPair.offset };
 	}
 
@@ -2129,7 +2140,7 @@ namespace metadata
 		}
 	}
 
-	void InterpreterImage::ComputeVTable(TypeDefinitionDetail* tdd)
+	void InterpreterImage::ComputeVTable(Il2CppType2TypeDeclaringTreeMap& cacheTrees, TypeDefinitionDetail* tdd)
 	{
 		Il2CppTypeDefinition& typeDef = *GetTypeDefinitionByTypeDetail(tdd);
 		if (IsInterface(typeDef.flags) || typeDef.interfaceOffsetsStart != 0)
@@ -2141,18 +2152,15 @@ namespace metadata
 		{
 			const Il2CppType* parentType = il2cpp::vm::GlobalMetadata::GetIl2CppTypeFromIndex(typeDef.parentIndex);
 			const Il2CppTypeDefinition* parentTypeDef = GetUnderlyingTypeDefinition(parentType);
-			if (IsInterpreterType(parentTypeDef) && parentTypeDef->interfaceOffsetsStart == 0)
+			if (IsInterpreterType(parentTypeDef) && parentTypeDef->interfaceOffsetsStart == 0 && DecodeImageIndex(parentTypeDef->byvalTypeIndex) == this->GetIndex())
 			{
-				IL2CPP_ASSERT(DecodeImageIndex(parentTypeDef->byvalTypeIndex) == this->GetIndex());
 				int32_t typeDefIndex = GetTypeRawIndexByEncodedIl2CppTypeIndex(parentTypeDef->byvalTypeIndex);
-				ComputeVTable(&_typeDetails[typeDefIndex]);
+				ComputeVTable(cacheTrees, &_typeDetails[typeDefIndex]);
 			}
 		}
 
 		const Il2CppType* type = GetIl2CppTypeFromRawIndex(DecodeMetadataIndex(typeDef.byvalTypeIndex));
-		VTableSetUp* typeTree = VTableSetUp::BuildByType(_cacheTrees, type);
-
-		uint32_t offsetsStart = (uint32_t)_interfaceOffsets.size();
+		VTableSetUp* typeTree = VTableSetUp::BuildByType(cacheTrees, type);
 
 		auto& vms = typeTree->GetVirtualMethodImpls();
 		if (vms.empty())
@@ -2167,37 +2175,47 @@ namespace metadata
 			std::memcpy(tdd->vtable, &vms[0], vms.size() * sizeof(VirtualMethodImpl));
 		}
 
+		// each type owns its interface offsets, so that they aren't moved when other types are computed later
 		auto& interfaceOffsetInfos = typeTree->GetInterfaceOffsetInfos();
-		for (auto ioi : interfaceOffsetInfos)
+		if (interfaceOffsetInfos.empty())
 		{
-			_interfaceOffsets.push_back({ ioi.type, ioi.offset });
+			tdd->interfaceOffsets = nullptr;
+		}
+		else
+		{
+			tdd->interfaceOffsets = (InterfaceOffsetInfo*)HYBRIDCLR_METADATA_CALLOC(interfaceOffsetInfos.size(), sizeof(InterfaceOffsetInfo));
+			for (size_t i = 0; i < interfaceOffsetInfos.size(); i++)
+			{
+				tdd->interfaceOffsets[i] = { interfaceOffsetInfos[i].type, interfaceOffsetInfos[i].offset };
+			}
 		}
 
 		typeDef.vtableStart = EncodeWithIndex(0);
 		typeDef.vtable_count = (uint16_t)vms.size();
-		typeDef.interfaceOffsetsStart = EncodeWithIndex(offsetsStart);
 		typeDef.interface_offsets_count = (uint16_t)interfaceOffsetInfos.size();
+		il2cpp::os::Atomic::FullMemoryBarrier();
+		// non zero interfaceOffsetsStart marks the vtable as computed
+		typeDef.interfaceOffsetsStart = EncodeWithIndex(0);
 
 		Il2CppClass* klass = _classList[GetTypeRawIndex(&typeDef)];
 		IL2CPP_ASSERT(!klass);
 	}
 
-	void InterpreterImage::InitVTables()
+	void InterpreterImage::EnsureVTable(uint32_t typeIndex)
 	{
-		const Table& typeDefTb = _rawImage->GetTable(TableType::TYPEDEF);
-
-		for (TypeDefinitionDetail& td : _typeDetails)
+		const Il2CppTypeDefinition& typeDef = _typesDefines[typeIndex];
+		if (IsInterface(typeDef.flags) || typeDef.interfaceOffsetsStart != 0)
 		{
-			ComputeVTable(&td);
+			return;
 		}
-
-		for (auto& e : _cacheTrees)
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		Il2CppType2TypeDeclaringTreeMap cacheTrees;
+		ComputeVTable(cacheTrees, &_typeDetails[typeIndex]);
+		for (auto& e : cacheTrees)
 		{
 			e.second->~VTableSetUp();
 			HYBRIDCLR_FREE(e.second);
 		}
-		Il2CppType2TypeDeclaringTreeMap temp;
-		_cacheTrees.swap(temp);
 	}
 
 	// index => MethodDefinition -> DeclaringClass -> index - klass->methodStart -> MethodInfo*
@@ -2225,6 +2243,7 @@ namespace metadata
 	{
 		uint32_t typeDefIndex = GetTypeRawIndex(typeDef);
 		IL2CPP_ASSERT(typeDefIndex < (uint32_t)_typeDetails.size());
+		EnsureVTable(typeDefIndex);
 		TypeDefinitionDetail& td = _typeDetails[typeDefIndex];
 
 		IL2CPP_ASSERT(vTableSlot >= 0 && vTableSlot < (int32_t)td.vtableCount);
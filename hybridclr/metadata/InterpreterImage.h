@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <unordered_map>
 
 #if HYBRIDCLR_UNITY_2021_OR_NEW
@@ -26,8 +27,10 @@ namespace metadata
 		uint32_t methodImplStart;
 		uint32_t methodImplCount;
 		uint32_t vtableCount;
+		// typeSizes and offsets of fields are computed when first used, see EnsureClassLayout
 		Il2CppTypeDefinitionSizes typeSizes;
 		VirtualMethodImpl* vtable;
+		InterfaceOffsetInfo* interfaceOffsets;
 	};
 
 	struct ParamDetail
@@ -41,6 +44,9 @@ namespace metadata
 	{
 		Il2CppFieldDefinition fieldDef;
 		uint32_t typeDefIndex;
+		// offset from FieldLayout or THREAD_LOCAL_STATIC_MASK, 0 if not specified
+		uint32_t rawOffset;
+		// valid after class layout of the declaring type is computed
 		uint32_t offset;
 		uint32_t defaultValueIndex; // -1 for invalid
 	};
@@ -131,7 +137,7 @@ namespace metadata
 
 		}
 
-		LoadImageErrorCode Load(const void* imageData, size_t length)
+		LoadImageErrorCode Load(const void* imageData, size_t length, ImageDataOwnership ownership)
 		{
 			if (_inited)
 			{
@@ -143,9 +149,12 @@ namespace metadata
 			{
 				return err;
 			}
+			_rawImage->SetImageDataOwnership(ownership);
 			err = _rawImage->Load(imageData, length);
 			if (err != LoadImageErrorCode::OK)
 			{
+				// the bytes stay with the caller when loading fails
+				_rawImage->SetImageDataOwnership(ImageDataOwnership::External);
 				delete _rawImage;
 				_rawImage = nullptr;
 				return err;
@@ -212,6 +221,7 @@ namespace metadata
 		const Il2CppTypeDefinitionSizes* GetTypeDefinitionSizesFromRawIndex(TypeDefinitionIndex index)
 		{
 			IL2CPP_ASSERT((size_t)index < _typeDetails.size());
+			EnsureClassLayout(index);
 			return &_typeDetails[index].typeSizes;
 		}
 
@@ -243,6 +253,11 @@ namespace metadata
 			return &_typesDefines[index];
 		}
 
+		uint32_t GetTypeCount() const
+		{
+			return (uint32_t)_typesDefines.size();
+		}
+
 		const Il2CppType* GetIl2CppTypeFromRawIndex(uint32_t index) const
 		{
 			IL2CPP_ASSERT((size_t)index < _types.size());
@@ -373,9 +388,18 @@ namespace metadata
 		{
 			uint32_t fieldActualIndex = DecodeMetadataIndex(typeDef->fieldStart) + fieldIndexInType;
 			IL2CPP_ASSERT(fieldActualIndex < (uint32_t)_fieldDetails.size());
+			EnsureClassLayout(GetTypeRawIndex(typeDef));
 			return _fieldDetails[fieldActualIndex].offset;
 		}
 
+		// offset before class layout, used by ClassFieldLayoutCalculator
+		uint32_t GetRawFieldOffset(const Il2CppTypeDefinition* typeDef, int32_t fieldIndexInType) const
+		{
+			uint32_t fieldActualIndex = DecodeMetadataIndex(typeDef->fieldStart) + fieldIndexInType;
+			IL2CPP_ASSERT(fieldActualIndex < (uint32_t)_fieldDetails.size());
+			return _fieldDetails[fieldActualIndex].rawOffset;
+		}
+
 		uint32_t GetFieldOffset(TypeDefinitionIndex typeIndex, int32_t fieldIndexInType)
 		{
 			Il2CppTypeDefinition* typeDef = &_typesDefines[typeIndex];
@@ -669,7 +693,6 @@ namespace metadata
 		void InitMethodImpls0();
 		void InitNestedClass();
 		void InitClassLayouts0();
-		void InitClassLayouts();
 		void InitCustomAttributes();
 		void InitModuleRefs();
 		void InitImplMaps();
@@ -677,10 +700,21 @@ namespace metadata
 		void InitEvents();
 		void InitMethodSemantics();
 		void InitInterfaces();
-		void InitVTables();
+
+		// class layouts and vtables are computed when a type is first used instead of at load,
+		// most types of a large assembly are never used.
+		void EnsureClassLayout(uint32_t typeIndex)
+		{
+			if (!_classLayoutInited[typeIndex].load(std::memory_order_acquire))
+			{
+				ComputeClassLayout(typeIndex);
+			}
+		}
+		void EnsureVTable(uint32_t typeIndex);
 
 		void ComputeBlittable(Il2CppTypeDefinition* def, std::vector<bool>& computFlags);
-		void ComputeVTable(TypeDefinitionDetail* tdd);
+		void ComputeClassLayout(uint32_t typeIndex);
+		void ComputeVTable(Il2CppType2TypeDeclaringTreeMap& cacheTrees, TypeDefinitionDetail* tdd);
 
 		void SetIl2CppImage(Il2CppImage* image)
 		{
@@ -705,13 +739,15 @@ namespace metadata
 		const uint32_t _index;
 
 		std::vector<TypeDefinitionDetail> _typeDetails;
+		// read without lock by EnsureClassLayout, set with release order after the layout is written.
+		// kept out of TypeDefinitionDetail because atomics can't be moved by vector resize.
+		std::vector<std::atomic<bool>> _classLayoutInited;
 		std::vector<Il2CppTypeDefinition> _typesDefines;
 		std::vector<Il2CppTypeDefinition> _exportedTypeDefines;
 
 		std::vector<const Il2CppType*> _types;
 		Il2CppHashMap<const Il2CppType*, uint32_t, Il2CppTypeHashShallow, Il2CppTypeEqualityComparerShallow> _type2Indexs;
 		std::vector<TypeIndex> _interfaceDefines;
-		std::vector<InterfaceOffsetInfo> _interfaceOffsets;
 
 		std::vector<Il2CppMethodDefinition> _methodDefines;
 
@@ -731,7 +767,6 @@ namespace metadata
 
 		// runtime data 
 		std::vector<Il2CppClass*> _classList;
-		Il2CppType2TypeDeclaringTreeMap _cacheTrees;
 #if HYBRIDCLR_UNITY_2021_OR_NEW
 		CustomAttributeDataWriter _constValues;
 #endif
@@ -0,0 +1,153 @@
+#include "MetadataWorkerPool.h"
+
+#include <deque>
+
+#include "Baselib.h"
+#include "os/Mutex.h"
+#include "os/Thread.h"
+#include "os/Environment.h"
+
+namespace hybridclr
+{
+namespace metadata
+{
+	struct MetadataTask
+	{
+		std::function<void()> func;
+		MetadataTaskGroup* group;
+	};
+
+	struct MetadataWorker
+	{
+		il2cpp::os::Thread* thread;
+		// auto reset, a Set before Wait isn't lost
+		il2cpp::os::Event wakeEvent;
+	};
+
+	// there are only a few passes to run in parallel
+	constexpr int32_t kMaxMetadataWorkerCount = 4;
+
+	static baselib::ReentrantLock s_taskQueueLock;
+	static std::deque<MetadataTask> s_taskQueue;
+	static MetadataWorker* s_workers[kMaxMetadataWorkerCount];
+	static int32_t s_workerCount = -1;
+
+	static bool TryPopTask(MetadataTask& task)
+	{
+		il2cpp::os::FastAutoLock lock(&s_taskQueueLock);
+		if (s_taskQueue.empty())
+		{
+			return false;
+		}
+		task = std::move(s_taskQueue.front());
+		s_taskQueue.pop_front();
+		return true;
+	}
+
+	static void RunTask(MetadataTask& task)
+	{
+		task.func();
+		task.group->OnTaskFinished();
+	}
+
+	static void MetadataWorkerMain(void* arg)
+	{
+		MetadataWorker* worker = (MetadataWorker*)arg;
+		for (;;)
+		{
+			MetadataTask task;
+			while (TryPopTask(task))
+			{
+				RunTask(task);
+			}
+			worker->wakeEvent.Wait();
+		}
+	}
+
+	// called with s_taskQueueLock held. workers are created on first use and never destroyed.
+	static void EnsureWorkers()
+	{
+		if (s_workerCount >= 0)
+		{
+			return;
+		}
+		// the loading thread runs tasks as well
+		int32_t workerCount = std::min(il2cpp::os::Environment::GetProcessorCount() - 1, kMaxMetadataWorkerCount);
+		workerCount = std::max(workerCount, 0);
+		for (int32_t i = 0; i < workerCount; i++)
+		{
+			MetadataWorker* worker = new (HYBRIDCLR_MALLOC(sizeof(MetadataWorker))) MetadataWorker();
+			worker->thread = new il2cpp::os::Thread();
+			s_workers[i] = worker;
+			worker->thread->Run(MetadataWorkerMain, worker);
+		}
+		s_workerCount = workerCount;
+	}
+
+	MetadataTaskGroup::MetadataTaskGroup() : _pendingTaskCount(0), _finishedEvent(true, false)
+	{
+	}
+
+	MetadataTaskGroup::~MetadataTaskGroup()
+	{
+		Wait();
+	}
+
+	void MetadataTaskGroup::Run(std::function<void()>&& task)
+	{
+		int32_t workerCount;
+		{
+			il2cpp::os::FastAutoLock lock(&s_taskQueueLock);
+			EnsureWorkers();
+			workerCount = s_workerCount;
+			if (workerCount > 0)
+			{
+				++_pendingTaskCount;
+				_finishedEvent.Reset();
+				s_taskQueue.push_back({ std::move(task), this });
+			}
+		}
+		if (workerCount == 0)
+		{
+			task();
+			return;
+		}
+		for (int32_t i = 0; i < workerCount; i++)
+		{
+			s_workers[i]->wakeEvent.Set();
+		}
+	}
+
+	void MetadataTaskGroup::Wait()
+	{
+		for (;;)
+		{
+			{
+				// the count is changed under the lock, a worker has left OnTaskFinished once the group is seen finished
+				il2cpp::os::FastAutoLock lock(&s_taskQueueLock);
+				if (_pendingTaskCount == 0)
+				{
+					return;
+				}
+			}
+			// tasks of other groups may be run here too, it's harmless
+			MetadataTask task;
+			if (TryPopTask(task))
+			{
+				RunTask(task);
+				continue;
+			}
+			_finishedEvent.Wait();
+		}
+	}
+
+	void MetadataTaskGroup::OnTaskFinished()
+	{
+		il2cpp::os::FastAutoLock lock(&s_taskQueueLock);
+		if (--_pendingTaskCount == 0)
+		{
+			_finishedEvent.Set();
+		}
+	}
+}
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <functional>
+
+#include "os/Event.h"
+
+#include "../CommonDef.h"
+
+namespace hybridclr
+{
+namespace metadata
+{
+	// runs independent passes of metadata initialization on worker threads.
+	// workers aren't attached to the runtime and the loading thread holds g_MetadataLock while waiting, so a task
+	// must only read raw tables and write data no other running pass touches. it must not take g_MetadataLock,
+	// allocate managed objects or raise managed exceptions.
+	class MetadataTaskGroup
+	{
+	public:
+		MetadataTaskGroup();
+		// waits for the tasks, so that they never outlive the image they write, even if the loading thread raises
+		~MetadataTaskGroup();
+
+		// runs at once on the calling thread if there are no workers
+		void Run(std::function<void()>&& task);
+		// runs queued tasks on the calling thread as well, then waits for the tasks taken by workers
+		void Wait();
+
+		void OnTaskFinished();
+	private:
+		// guarded by the lock of the task queue
+		int32_t _pendingTaskCount;
+		il2cpp::os::Event _finishedEvent;
+	};
+}
+}
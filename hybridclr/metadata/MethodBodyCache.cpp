@@ -7,6 +7,8 @@
 #include "Opcodes.h"
 #include "MetadataDef.h"
 
+#include "Baselib.h"
+#include "os/Mutex.h"
 #include "utils/HashUtils.h"
 #include "../RuntimeConfig.h"
 
@@ -52,7 +54,11 @@ namespace metadata
 	};
 
 	constexpr int32_t kMinShrinkMethodBodyCacheInterval = 256;
-	static bool s_enableShrinkMethodBodyCache = true;
+	// methods are transformed by multiple threads in parallel, all states of the cache are guarded by s_methodBodyCacheLock.
+	// a MethodBody returned by GetMethodBody is used without the lock, so the cache only shrinks when no transform is running.
+	static baselib::ReentrantLock s_methodBodyCacheLock;
+	static int32_t s_runningTransformCount = 0;
+	static bool s_pendingShrinkMethodBodyCache = false;
 	static int32_t s_methodBodyCacheVersion = 0;
 	static Il2CppHashMap<ImageTokenPair, MethodBodyCacheInfo*, ImageTokenPairHash, ImageTokenPairEqualTo> s_methodBodyCache;
 
@@ -74,6 +80,7 @@ namespace metadata
 
 	MethodBody* MethodBodyCache::GetMethodBody(hybridclr::metadata::Image* image, uint32_t token)
 	{
+		il2cpp::os::FastAutoLock lock(&s_methodBodyCacheLock);
 		MethodBodyCacheInfo* ci = GetOrInitMethodBodyCache(image, token);
 		ci->accessVersion = s_methodBodyCacheVersion;
 		++ci->accessCount;
@@ -112,16 +119,26 @@ namespace metadata
 
 	void MethodBodyCache::EnableShrinkMethodBodyCache(bool shrink)
 	{
-		s_enableShrinkMethodBodyCache = shrink;
-		if (shrink)
+		il2cpp::os::FastAutoLock lock(&s_methodBodyCacheLock);
+		if (!shrink)
 		{
-			++s_methodBodyCacheVersion;
+			++s_runningTransformCount;
+			return;
+		}
+		IL2CPP_ASSERT(s_runningTransformCount > 0);
+		--s_runningTransformCount;
+		++s_methodBodyCacheVersion;
 
-			int32_t shrinkMethodBodyCacheInterval = std::max(RuntimeConfig::GetMaxMethodBodyCacheSize() / 2, kMinShrinkMethodBodyCacheInterval);
-			if (s_methodBodyCacheVersion % shrinkMethodBodyCacheInterval == 0)
-			{
-				ShrinkMethodBodyCache(shrinkMethodBodyCacheInterval);
-			}
+		int32_t shrinkMethodBodyCacheInterval = std::max(RuntimeConfig::GetMaxMethodBodyCacheSize() / 2, kMinShrinkMethodBodyCacheInterval);
+		if (s_methodBodyCacheVersion % shrinkMethodBodyCacheInterval == 0)
+		{
+			s_pendingShrinkMethodBodyCache = true;
+		}
+		// delay shrinking until the last running transform finishes
+		if (s_pendingShrinkMethodBodyCache && s_runningTransformCount == 0)
+		{
+			s_pendingShrinkMethodBodyCache = false;
+			ShrinkMethodBodyCache(shrinkMethodBodyCacheInterval);
 		}
 	}
 
@@ -139,11 +156,15 @@ namespace metadata
 			int32_t nextOffset = (int32_t)(ip - ilcodeStart);
 			IL2CPP_ASSERT(nextOffset >= 0 && nextOffset <= (int32_t)codeSize);
 
-			switch (oc->flow)
+			// branches and throws are inlined as basic blocks of the calling method. switch keeps its
+			// targets in resolve datas and leave clears the exception flow of the calling frame, so
+			// methods using them are not inlined. rethrow, endfinally and endfilter only appear in
+			// exception handlers, which are rejected by ComputeInlinable.
+			switch (oc->baseOpValue)
 			{
-			case FlowType::Branch:
-			case FlowType::CondBranch:
-			case FlowType::Throw:
+			case OpcodeValue::SWITCH:
+			case OpcodeValue::LEAVE:
+			case OpcodeValue::LEAVE_S:
 			{
 				return false;
 			}
@@ -176,6 +197,7 @@ namespace metadata
 
 		metadata::Image* image = MetadataModule::GetUnderlyingInterpreterImage(methodInfo);
 		IL2CPP_ASSERT(image);
+		il2cpp::os::FastAutoLock lock(&s_methodBodyCacheLock);
 		MethodBodyCacheInfo* ci = GetOrInitMethodBodyCache(image, methodInfo->token);
 		ci->accessVersion = s_methodBodyCacheVersion;
 		++ci->accessCount;
@@ -193,6 +215,7 @@ namespace metadata
 		IL2CPP_ASSERT(methodInfo->isInterpterImpl);
 		metadata::Image* image = MetadataModule::GetUnderlyingInterpreterImage(methodInfo);
 		IL2CPP_ASSERT(image);
+		il2cpp::os::FastAutoLock lock(&s_methodBodyCacheLock);
 		MethodBodyCacheInfo* ci = GetOrInitMethodBodyCache(image, methodInfo->token);
 		ci->inlineMode = InlineMode::NotInlineable;
 	}
@@ -112,7 +112,11 @@ namespace metadata
 		const SymbolMethodInfoData* methodInfoData = it->second;
 		const SymbolMethodDefData* methodData = methodInfoData->methodData;
 		const hybridclr::interpreter::InterpMethodInfo* imi = (const hybridclr::interpreter::InterpMethodInfo*)method->interpData;
-		IL2CPP_ASSERT(ip >= imi->codes && ip < imi->codes + imi->codeLength);
+		// the frame may still run code of a method invalidated by class hierarchy changes, whose il mapper is gone
+		if (!hybridclr::interpreter::IsTransformedInterpData(imi) || ip < imi->codes || ip >= imi->codes + imi->codeLength)
+		{
+			return;
+		}
 		const byte* actualIp = (const byte*)ip;
 
 		uint32_t irOffset = (uint32_t)((uintptr_t)actualIp - (uintptr_t)imi->codes);
@@ -138,7 +142,14 @@ namespace metadata
 
 	void PDBImage::SetMethodDebugInfo(const MethodInfo* method, const il2cpp::utils::dynamic_array<ILMapper>& ilMapper)
 	{
-		IL2CPP_ASSERT(_methodInfos.find(method) == _methodInfos.end());
+		il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+		auto it = _methodInfos.find(method);
+		if (it != _methodInfos.end())
+		{
+			// the method is transformed again after being invalidated by ClassHierarchy
+			it->second->ilMapper = ilMapper;
+			return;
+		}
 		SymbolMethodDefData* methodData = GetMethodDataFromCache(method->token);
 		if (!methodData)
 		{
@@ -3,6 +3,7 @@
 #include "../CommonDef.h"
 
 #include "vm/String.h"
+#include "utils/MemoryMappedFile.h"
 
 #include "MetadataDef.h"
 #include "BlobReader.h"
@@ -27,10 +28,21 @@ namespace metadata
 		UNMATCH_FORMAT_VARIANT,
 	};
 
+	// who owns the bytes an image reads from. metadata and method bodies are read in place, so the bytes must live as long as the image.
+	enum class ImageDataOwnership
+	{
+		// heap copy, freed with the image
+		Copy,
+		// read-only view of a file mapping, unmapped with the image
+		MappedFile,
+		// owned by the caller, never freed by the image
+		External,
+	};
+
 	class RawImageBase
 	{
 	public:
-		RawImageBase() : _imageData(nullptr), _imageLength(0), _ptrRawDataEnd(nullptr),
+		RawImageBase() : _imageData(nullptr), _imageLength(0), _ptrRawDataEnd(nullptr), _imageDataOwnership(ImageDataOwnership::Copy),
 			_streamStringHeap{}, _streamUS{}, _streamBlobHeap{}, _streamGuidHeap{}, _streamTables{},
 			_4byteStringIndex(false), _4byteGUIDIndex(false), _4byteBlobIndex(false)
 		{
@@ -41,10 +53,31 @@ namespace metadata
 		{
 			if (_imageData)
 			{
-				HYBRIDCLR_FREE((void*)_imageData);
+				switch (_imageDataOwnership)
+				{
+				case ImageDataOwnership::Copy:
+					HYBRIDCLR_FREE((void*)_imageData);
+					break;
+				case ImageDataOwnership::MappedFile:
+					il2cpp::utils::MemoryMappedFile::Unmap((void*)_imageData, _imageLength);
+					break;
+				default:
+					break;
+				}
 				_imageData = nullptr;
 			}
 		}
+
+		// must be set before Load
+		void SetImageDataOwnership(ImageDataOwnership ownership)
+		{
+			_imageDataOwnership = ownership;
+		}
+
+		ImageDataOwnership GetImageDataOwnership() const
+		{
+			return _imageDataOwnership;
+		}
 		virtual LoadImageErrorCode Load(const void* imageData, size_t length);
 		virtual LoadImageErrorCode PostLoadStreams() { return LoadImageErrorCode::OK; }
 		virtual LoadImageErrorCode PostLoadTables() { return LoadImageErrorCode::OK; }
@@ -72,6 +105,13 @@ namespace metadata
 			return _streamBlobHeap.data + index;
 		}
 
+		// guid index is 1-based, every guid takes 16 bytes
+		const byte* GetGuidFromRawIndex(uint32_t index) const
+		{
+			IL2CPP_ASSERT(index > 0 && (size_t)index * 16 <= _streamGuidHeap.size);
+			return _streamGuidHeap.data + (index - 1) * 16;
+		}
+
 		const uint8_t* GetFieldOrParameterDefalutValueByRawIndex(uint32_t index) const
 		{
 			return _imageData + index;
@@ -400,6 +440,7 @@ TABLE_END
 		const byte* _imageData;
 		uint32_t _imageLength;
 		const byte* _ptrRawDataEnd;
+		ImageDataOwnership _imageDataOwnership;
 
 		std::vector<SectionHeader> _sections;
 
@@ -405,7 +405,7 @@ namespace metadata
             // 调试信息：显示 token 解析结果
             hybridclr::metadata::TableType tableType = DecodeTokenTableType(token);
             uint32_t rowIndex = DecodeTokenRowIndex(token);            
-            // 使用传入的 tokenCache，实现真正的缓存效果
+            // 先查传入的 tokenCache，再查 image 级的共享缓存 TokenResolutionCache
             const MethodInfo* result = image->GetMethodInfoFromToken(tokenCache, token, klassContainer, methodContainer, genericContext);
                       
             return result;
@@ -0,0 +1,302 @@
+#!/usr/bin/env python3
+"""
+Generate interpreter superinstructions from an opcode pair histogram.
+
+usage:
+    python gen_superinstructions.py <histogram.csv> [--max-pairs N] [--max-triples N] [--min-count N] [--placeholder]
+
+Collecting a histogram:
+    build il2cpp with HYBRIDCLR_ENABLE_OPCODE_PROFILER=1, run a representative workload, then call
+    HybridCLR.RuntimeApi.DumpOpcodePairHistogram(path). Each row is `prev,cur,count`. Opcodes are given
+    either by HiOpcodeEnum value or by name. Rows with three opcodes `a,b,c,count` are explicit triples.
+    Lines starting with '#' are comments.
+
+A histogram whose first line is `# placeholder` is not a measurement, such as placeholder_histogram.csv.
+It is only accepted with --placeholder, and the generated rules are marked as such.
+
+A superinstruction `SuperInst_A__B` keeps the code stream of A and B unchanged and only replaces the
+opcode of A, so its instruction size is the size of A. Its handler runs the body of A, advances ip past A
+and runs the body of B. Every instruction but the last one must therefore be a straight-line handler
+that ends with `ip += size; HI_DISPATCH_NEXT();`.
+
+The script rewrites the SUPERINSTRUCTION regions of
+    interpreter/Instruction.h
+    interpreter/Instruction.cpp
+    interpreter/Interpreter_Execute.cpp
+    transform/TransformContext_SuperInstruction.cpp
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+
+INSTRUCTION_H = os.path.join(ROOT, 'interpreter', 'Instruction.h')
+INSTRUCTION_CPP = os.path.join(ROOT, 'interpreter', 'Instruction.cpp')
+EXECUTE_CPP = os.path.join(ROOT, 'interpreter', 'Interpreter_Execute.cpp')
+RULES_CPP = os.path.join(ROOT, 'transform', 'TransformContext_SuperInstruction.cpp')
+
+SUPER_PREFIX = 'SuperInst_'
+
+# tokens that make a handler unsuitable as a non-last part of a superinstruction
+NOT_STRAIGHT_LINE_PATTERNS = [
+    r'\bip\s*=[^=]',
+    r'\bipBase\b',
+    r'\bframe\b',
+    r'\bgoto\b',
+    r'\breturn\b',
+    r'\bCALL_',
+    r'\bLEAVE',
+    r'THROW',
+    r'\bSAVE_CUR_FRAME\b',
+    r'\bPREPARE_',
+    r'\blocalVarBase\s*=[^=]',
+    r'\bimi\s*=[^=]',
+]
+
+
+def read(path):
+    with open(path, 'r', encoding='utf-8') as f:
+        return f.read()
+
+
+def write(path, content):
+    with open(path, 'w', encoding='utf-8', newline='\n') as f:
+        f.write(content)
+
+
+def strip_region(content, name):
+    begin = '//!!!{{%s\n' % name
+    end = '//!!!}}%s\n' % name
+    b = content.index(begin)
+    e = content.index(end, b)
+    return content[:b] + content[e:]
+
+
+def replace_region(content, name, body):
+    begin = '//!!!{{%s\n' % name
+    end = '//!!!}}%s\n' % name
+    b = content.index(begin) + len(begin)
+    e = content.index(end, b)
+    # keep the indentation of the end marker
+    line_start = content.rindex('\n', 0, e) + 1
+    return content[:b] + body + content[line_start:]
+
+
+def load_opcodes():
+    content = read(INSTRUCTION_H)
+    enum_body = content[content.index('enum class HiOpcodeEnum'):]
+    enum_body = enum_body[:enum_body.index('//!!!}}OPCODE')]
+    return re.findall(r'^\s*(\w+),\s*$', enum_body, re.M)
+
+
+def load_sizes(opcode_count):
+    content = read(INSTRUCTION_CPP)
+    region = content[content.index('//!!!{{INST_SIZE'):content.index('//!!!}}INST_SIZE')]
+    sizes = [0] + [int(x) for x in re.findall(r'^\s*(\d+),\s*$', region, re.M)]
+    if len(sizes) != opcode_count:
+        sys.exit('instruction size table has %d entries but HiOpcodeEnum has %d' % (len(sizes), opcode_count))
+    return sizes
+
+
+def load_handlers():
+    content = strip_region(read(EXECUTE_CPP), 'SUPERINSTRUCTION')
+    handlers = {}
+    for m in re.finditer(r'HI_OPCODE_CASE\((\w+)\)\n', content):
+        start = content.index('{', m.end())
+        depth = 0
+        for i in range(start, len(content)):
+            c = content[i]
+            if c == '{':
+                depth += 1
+            elif c == '}':
+                depth -= 1
+                if depth == 0:
+                    handlers[m.group(1)] = content[start + 1:i].strip('\n').rstrip()
+                    break
+    return handlers
+
+
+def is_straight_line(body, size):
+    if body.count('HI_DISPATCH_NEXT();') != 1:
+        return False
+    if not re.search(r'ip \+= %d;\s*HI_DISPATCH_NEXT\(\);\s*$' % size, body):
+        return False
+    return not any(re.search(p, body) for p in NOT_STRAIGHT_LINE_PATTERNS)
+
+
+def is_placeholder_histogram(path):
+    with open(path, 'r', encoding='utf-8') as f:
+        return f.readline().strip().lower() == '# placeholder'
+
+
+def load_histogram(path, opcodes):
+    name2op = {name: name for name in opcodes}
+
+    def to_name(token):
+        token = token.strip()
+        if token.isdigit():
+            idx = int(token)
+            if idx >= len(opcodes):
+                sys.exit('opcode %d out of range, histogram was taken with another instruction set' % idx)
+            return opcodes[idx]
+        if token not in name2op:
+            sys.exit('unknown opcode %s' % token)
+        return token
+
+    pairs = {}
+    triples = {}
+    with open(path, 'r', encoding='utf-8') as f:
+        for line in f:
+            line = line.strip()
+            if not line or line.startswith('#') or line.startswith('prev,'):
+                continue
+            cols = line.split(',')
+            count = int(cols[-1])
+            names = tuple(to_name(c) for c in cols[:-1])
+            if any(n == 'None' or n.startswith(SUPER_PREFIX) for n in names):
+                continue
+            if len(names) == 2:
+                pairs[names] = pairs.get(names, 0) + count
+            elif len(names) == 3:
+                triples[names] = triples.get(names, 0) + count
+            else:
+                sys.exit('bad histogram line: %s' % line)
+    return pairs, triples
+
+
+def select(pairs, triples, straight_line, args):
+    selected_pairs = []
+    for names, count in sorted(pairs.items(), key=lambda x: -x[1]):
+        if len(selected_pairs) >= args.max_pairs or count < args.min_count:
+            break
+        if names[0] in straight_line:
+            selected_pairs.append(names)
+
+    # the runtime profiler only records pairs. without explicit triples, estimate the frequency of
+    # a triple by the rarer of its two pairs.
+    candidates = dict(triples)
+    if not candidates:
+        for (a, b), c1 in pairs.items():
+            if a not in straight_line or b not in straight_line:
+                continue
+            for (b2, c), c2 in pairs.items():
+                if b2 == b:
+                    candidates[(a, b, c)] = min(c1, c2)
+    selected_triples = []
+    for names, count in sorted(candidates.items(), key=lambda x: -x[1]):
+        if len(selected_triples) >= args.max_triples or count < args.min_count:
+            break
+        if names[0] in straight_line and names[1] in straight_line:
+            selected_triples.append(names)
+    return selected_triples + selected_pairs
+
+
+def super_name(names):
+    return SUPER_PREFIX + '__'.join(names)
+
+
+def indent(text, tabs):
+    return '\n'.join(('\t' * tabs + line) if line.strip() else line for line in text.split('\n'))
+
+
+def gen_handler(names, handlers):
+    lines = ['\t\t\t\tHI_OPCODE_CASE(%s)' % super_name(names), '\t\t\t\t{']
+    for i, name in enumerate(names):
+        body = handlers[name]
+        if i != len(names) - 1:
+            body = re.sub(r'\n\s*HI_DISPATCH_NEXT\(\);\s*$', '', body)
+        lines.append('\t\t\t\t\t{')
+        lines.append(indent(body, 1))
+        lines.append('\t\t\t\t\t}')
+    lines.append('\t\t\t\t}')
+    return '\n'.join(lines) + '\n'
+
+
+def gen_rules(supers, placeholder):
+    by_first = {}
+    for names in supers:
+        by_first.setdefault(names[0], []).append(names)
+    if not by_first:
+        return ''
+    out = []
+    if placeholder:
+        out.append('\t\t// generated from a placeholder histogram, not a measurement. regenerate from a profiled workload.')
+    out += ['\t\tswitch (insts[0]->type)', '\t\t{']
+    for first, group in by_first.items():
+        out.append('\t\tcase HiOpcodeEnum::%s:' % first)
+        out.append('\t\t{')
+        for names in [g for g in group if len(g) == 3]:
+            out.append('\t\t\tif (count >= 3 && insts[1]->type == HiOpcodeEnum::%s && insts[2]->type == HiOpcodeEnum::%s)' % (names[1], names[2]))
+            out.append('\t\t\t{')
+            out.append('\t\t\t\tmergedInstCount = 3;')
+            out.append('\t\t\t\treturn HiOpcodeEnum::%s;' % super_name(names))
+            out.append('\t\t\t}')
+        pairs = [g for g in group if len(g) == 2]
+        if pairs:
+            out.append('\t\t\tswitch (insts[1]->type)')
+            out.append('\t\t\t{')
+            for names in pairs:
+                out.append('\t\t\tcase HiOpcodeEnum::%s:' % names[1])
+                out.append('\t\t\t{')
+                out.append('\t\t\t\tmergedInstCount = 2;')
+                out.append('\t\t\t\treturn HiOpcodeEnum::%s;' % super_name(names))
+                out.append('\t\t\t}')
+            out.append('\t\t\tdefault: break;')
+            out.append('\t\t\t}')
+        out.append('\t\t\tbreak;')
+        out.append('\t\t}')
+    out.append('\t\tdefault: break;')
+    out.append('\t\t}')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    parser = argparse.ArgumentParser(description='generate interpreter superinstructions from an opcode pair histogram')
+    parser.add_argument('histogram')
+    parser.add_argument('--max-pairs', type=int, default=24)
+    parser.add_argument('--max-triples', type=int, default=8)
+    parser.add_argument('--min-count', type=int, default=1)
+    parser.add_argument('--placeholder', action='store_true', help='accept a histogram marked as placeholder')
+    args = parser.parse_args()
+
+    placeholder = is_placeholder_histogram(args.histogram)
+    if placeholder and not args.placeholder:
+        sys.exit('%s is a placeholder, not a measured histogram. pass --placeholder to use it anyway' % args.histogram)
+
+    opcodes = load_opcodes()
+    sizes = load_sizes(len(opcodes))
+    handlers = load_handlers()
+    for name in opcodes:
+        if name not in handlers:
+            sys.exit('handler of %s not found in Interpreter_Execute.cpp' % name)
+    op_size = dict(zip(opcodes, sizes))
+    straight_line = set(n for n in opcodes if n != 'None' and is_straight_line(handlers[n], op_size[n]))
+
+    pairs, triples = load_histogram(args.histogram, opcodes)
+    supers = select(pairs, triples, straight_line, args)
+
+    opcode_region = ''.join('\t\t%s,\n' % super_name(names) for names in supers)
+    size_region = ''.join('\t\t%d,\n' % op_size[names[0]] for names in supers)
+    table_region = ''.join('\t\t\t&&HI_LABEL_%s,\n' % super_name(names) for names in supers)
+    handler_region = ''.join(gen_handler(names, handlers) for names in supers)
+
+    write(INSTRUCTION_H, replace_region(read(INSTRUCTION_H), 'SUPERINSTRUCTION_OPCODE', opcode_region))
+    write(INSTRUCTION_CPP, replace_region(read(INSTRUCTION_CPP), 'SUPERINSTRUCTION_INST_SIZE', size_region))
+    content = read(EXECUTE_CPP)
+    content = replace_region(content, 'SUPERINSTRUCTION_DISPATCH_TABLE', table_region)
+    content = replace_region(content, 'SUPERINSTRUCTION', handler_region)
+    write(EXECUTE_CPP, content)
+    write(RULES_CPP, replace_region(read(RULES_CPP), 'SUPERINSTRUCTION_RULES', gen_rules(supers, placeholder)))
+
+    for names in supers:
+        print(super_name(names))
+    print('%d superinstructions generated' % len(supers))
+    if placeholder:
+        print('warning: generated from a placeholder histogram, not a measurement')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,283 @@
+#include "PreJitScheduler.h"
+
+#include <deque>
+#include <unordered_map>
+
+#include "Baselib.h"
+#include "os/Mutex.h"
+#include "os/Event.h"
+#include "os/Thread.h"
+#include "os/Atomic.h"
+#include "os/Environment.h"
+#include "vm/Thread.h"
+#include "vm/Domain.h"
+
+#include "../interpreter/InterpreterModule.h"
+#include "../RuntimeConfig.h"
+
+namespace hybridclr
+{
+namespace transform
+{
+	struct PreJitTask
+	{
+		int32_t id;
+		int32_t methodCount;
+		volatile int32_t finishedMethodCount;
+	};
+
+	struct PreJitWorkItem
+	{
+		const MethodInfo* method;
+		// null for tier up
+		PreJitTask* task;
+	};
+
+	struct PreJitWorker
+	{
+		il2cpp::os::Thread* thread;
+		int32_t index;
+		// set by Shutdown, the worker exits once it finishes the running item
+		volatile bool stopping;
+		// auto reset. a Set before Wait isn't lost, so items pushed while the worker is going to sleep are always run.
+		il2cpp::os::Event wakeEvent;
+		// the owner pops from back, thieves steal from front
+		baselib::ReentrantLock queueLock;
+		std::deque<PreJitWorkItem> queue;
+	};
+
+	constexpr int32_t kMaxPreJitWorkerCount = 64;
+
+	static baselib::ReentrantLock s_schedulerLock;
+	// unfinished tasks, a task is freed by the worker that finishes its last method
+	static std::unordered_map<int32_t, PreJitTask*> s_tasks;
+	static int32_t s_nextTaskId = 0;
+	// workers are only destroyed by Shutdown, s_workers[i] is valid for i < s_workerCount
+	static PreJitWorker* s_workers[kMaxPreJitWorkerCount];
+	static volatile int32_t s_workerCount = 0;
+	static int32_t s_nextTierUpWorkerIndex = 0;
+	static bool s_shutdown = false;
+
+	static bool TryPopWorkItem(PreJitWorker* worker, PreJitWorkItem& item)
+	{
+		il2cpp::os::FastAutoLock lock(&worker->queueLock);
+		if (worker->queue.empty())
+		{
+			return false;
+		}
+		item = worker->queue.back();
+		worker->queue.pop_back();
+		return true;
+	}
+
+	static bool TryStealWorkItem(PreJitWorker* thief, PreJitWorkItem& item)
+	{
+		int32_t workerCount = s_workerCount;
+		// start from the next worker so that thieves don't all contend on the same queue
+		for (int32_t i = 1; i < workerCount; i++)
+		{
+			PreJitWorker* victim = s_workers[(thief->index + i) % workerCount];
+			il2cpp::os::FastAutoLock lock(&victim->queueLock);
+			if (!victim->queue.empty())
+			{
+				item = victim->queue.front();
+				victim->queue.pop_front();
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static void FinishWorkItem(PreJitTask* task)
+	{
+		if (il2cpp::os::Atomic::Increment(&task->finishedMethodCount) != task->methodCount)
+		{
+			return;
+		}
+		il2cpp::os::FastAutoLock lock(&s_schedulerLock);
+		s_tasks.erase(task->id);
+		HYBRIDCLR_FREE(task);
+	}
+
+	static void RunWorkItem(const PreJitWorkItem& item)
+	{
+		try
+		{
+			interpreter::InterpreterModule::GetInterpMethodInfo(item.method, interpreter::ExecutionTier::Optimized);
+		}
+		catch (...)
+		{
+			// the failed transform is not published, the exception is raised again when the method is called.
+			// baseline code that fails to tier up just keeps running, its countdowns never request again.
+			// nothing may escape the thread function.
+		}
+		if (item.task)
+		{
+			FinishWorkItem(item.task);
+		}
+	}
+
+	static void PreJitWorkerMain(void* arg)
+	{
+		PreJitWorker* worker = (PreJitWorker*)arg;
+		// transform may allocate managed objects and raise managed exceptions.
+		// background, so that the runtime doesn't wait for an idle worker when it shuts down.
+		Il2CppThread* thread = il2cpp::vm::Thread::Attach(il2cpp::vm::Domain::GetRoot());
+		il2cpp::vm::Thread::SetState(thread, kThreadStateBackground);
+		while (!worker->stopping)
+		{
+			PreJitWorkItem item;
+			while (!worker->stopping && (TryPopWorkItem(worker, item) || TryStealWorkItem(worker, item)))
+			{
+				RunWorkItem(item);
+			}
+			if (!worker->stopping)
+			{
+				worker->wakeEvent.Wait();
+			}
+		}
+		il2cpp::vm::Thread::Detach(thread);
+	}
+
+	static int32_t GetExpectedWorkerCount()
+	{
+		int32_t workerCount = RuntimeConfig::GetPreJitWorkerCount();
+		if (workerCount <= 0)
+		{
+			// leave one core to the main thread
+			workerCount = il2cpp::os::Environment::GetProcessorCount() - 1;
+		}
+		return std::min(std::max(workerCount, 1), kMaxPreJitWorkerCount);
+	}
+
+	static void EnsureWorkers()
+	{
+		if (s_shutdown)
+		{
+			return;
+		}
+		int32_t expectedWorkerCount = GetExpectedWorkerCount();
+		for (int32_t i = s_workerCount; i < expectedWorkerCount; i++)
+		{
+			PreJitWorker* worker = new (HYBRIDCLR_MALLOC(sizeof(PreJitWorker))) PreJitWorker();
+			worker->index = i;
+			worker->stopping = false;
+			worker->thread = new il2cpp::os::Thread();
+			s_workers[i] = worker;
+			il2cpp::os::Atomic::FullMemoryBarrier();
+			s_workerCount = i + 1;
+			worker->thread->Run(PreJitWorkerMain, worker);
+		}
+	}
+
+	int32_t PreJitScheduler::Schedule(const std::vector<const MethodInfo*>& methods)
+	{
+		il2cpp::os::FastAutoLock lock(&s_schedulerLock);
+		int32_t taskId = s_nextTaskId++;
+		EnsureWorkers();
+		int32_t workerCount = s_workerCount;
+		// an empty task is finished at once, a task scheduled after shutdown is never run
+		if (methods.empty() || workerCount == 0)
+		{
+			return taskId;
+		}
+		PreJitTask* task = (PreJitTask*)HYBRIDCLR_MALLOC_ZERO(sizeof(PreJitTask));
+		task->id = taskId;
+		task->methodCount = (int32_t)methods.size();
+		s_tasks[taskId] = task;
+
+		for (int32_t i = 0; i < workerCount; i++)
+		{
+			PreJitWorker* worker = s_workers[i];
+			{
+				il2cpp::os::FastAutoLock queueLock(&worker->queueLock);
+				for (size_t j = i; j < methods.size(); j += workerCount)
+				{
+					worker->queue.push_back({ methods[j], task });
+				}
+			}
+			worker->wakeEvent.Set();
+		}
+		return taskId;
+	}
+
+	void PreJitScheduler::ScheduleTierUp(const MethodInfo* method)
+	{
+		il2cpp::os::FastAutoLock lock(&s_schedulerLock);
+		EnsureWorkers();
+		if (s_workerCount == 0)
+		{
+			return;
+		}
+		// a duplicated request finds the method optimized, or waits for the worker that claimed the tier up
+		PreJitWorker* worker = s_workers[s_nextTierUpWorkerIndex++ % s_workerCount];
+		{
+			il2cpp::os::FastAutoLock queueLock(&worker->queueLock);
+			worker->queue.push_back({ method, nullptr });
+		}
+		worker->wakeEvent.Set();
+	}
+
+	bool PreJitScheduler::GetTaskProgress(int32_t taskId, int32_t& finishedMethodCount, int32_t& methodCount)
+	{
+		il2cpp::os::FastAutoLock lock(&s_schedulerLock);
+		if (taskId < 0 || taskId >= s_nextTaskId)
+		{
+			return false;
+		}
+		auto it = s_tasks.find(taskId);
+		if (it == s_tasks.end())
+		{
+			// finished and freed
+			finishedMethodCount = methodCount = 0;
+			return true;
+		}
+		finishedMethodCount = it->second->finishedMethodCount;
+		methodCount = it->second->methodCount;
+		return true;
+	}
+
+	void PreJitScheduler::Shutdown()
+	{
+		int32_t workerCount;
+		{
+			il2cpp::os::FastAutoLock lock(&s_schedulerLock);
+			if (s_shutdown)
+			{
+				return;
+			}
+			s_shutdown = true;
+			workerCount = s_workerCount;
+			// nothing is queued or stolen any more
+			s_workerCount = 0;
+		}
+		for (int32_t i = 0; i < workerCount; i++)
+		{
+			s_workers[i]->stopping = true;
+			s_workers[i]->wakeEvent.Set();
+		}
+		// joined without s_schedulerLock, a running item may finish a task.
+		// all are joined before any is freed, a stopping worker may still look into the queue of another.
+		for (int32_t i = 0; i < workerCount; i++)
+		{
+			s_workers[i]->thread->Join();
+		}
+		for (int32_t i = 0; i < workerCount; i++)
+		{
+			PreJitWorker* worker = s_workers[i];
+			delete worker->thread;
+			worker->~PreJitWorker();
+			HYBRIDCLR_FREE(worker);
+			s_workers[i] = nullptr;
+		}
+
+		il2cpp::os::FastAutoLock lock(&s_schedulerLock);
+		// unfinished tasks never finish, queued items were dropped with the workers
+		for (auto& e : s_tasks)
+		{
+			HYBRIDCLR_FREE(e.second);
+		}
+		s_tasks.clear();
+	}
+}
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+
+#include "../CommonDef.h"
+
+namespace hybridclr
+{
+namespace transform
+{
+	// transforms methods on background worker threads, so that a whole hot update assembly can be
+	// transformed on spare cores instead of the first call of each method.
+	// methods of a task are distributed evenly to the worker queues, a worker that runs out of work
+	// steals from the queues of others. methods are always transformed to optimized code.
+	class PreJitScheduler
+	{
+	public:
+		// returns id of the task
+		static int32_t Schedule(const std::vector<const MethodInfo*>& methods);
+
+		// returns false if taskId is invalid
+		static bool GetTaskProgress(int32_t taskId, int32_t& finishedMethodCount, int32_t& methodCount);
+
+		// replaces the baseline code of a hot method with optimized code, see ExecutionTier
+		static void ScheduleTierUp(const MethodInfo* method);
+
+		// stops and joins the workers, they detach from the runtime. queued methods are dropped and
+		// methods scheduled later are never transformed in background.
+		static void Shutdown();
+	};
+}
+}
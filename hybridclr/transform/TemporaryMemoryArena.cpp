@@ -4,6 +4,7 @@ namespace hybridclr
 {
 namespace transform
 {
+	il2cpp::os::ThreadLocalValue TemporaryMemoryArena::s_threadLocalArena;
 
 	TemporaryMemoryArena::Block TemporaryMemoryArena::AllocBlock(size_t size)
 	{
@@ -16,21 +17,129 @@ namespace transform
 		IL2CPP_ASSERT(_buf == nullptr);
 		IL2CPP_ASSERT(_size == 0);
 		IL2CPP_ASSERT(_pos == 0);
-		RequireSize(kMinBlockSize);
+		IL2CPP_ASSERT(_blocks.empty());
+		Block block = AllocBlock(kMinBlockSize);
+		_blocks.push_back(block);
+		_curBlockIndex = 0;
+		_buf = (byte*)block.data;
+		_size = block.size;
 	}
 
 	void TemporaryMemoryArena::End()
 	{
-		if (_buf)
+		for (auto& block : _blocks)
 		{
-			HYBRIDCLR_FREE(_buf);
-			//_buf = nullptr;
-			//_size = _pos = 0;
+			HYBRIDCLR_FREE(block.data);
 		}
-		for (auto& block : _useOuts)
+		_blocks.clear();
+		_curBlockIndex = 0;
+		_buf = nullptr;
+		_size = _pos = 0;
+		_usedSizeOfPrevBlocks = 0;
+	}
+
+	void TemporaryMemoryArena::RequireSize(size_t size)
+	{
+		_usedSizeOfPrevBlocks += _pos;
+		size_t nextBlockIndex = _curBlockIndex + 1;
+		if (nextBlockIndex == _blocks.size())
 		{
-			HYBRIDCLR_FREE(block.data);
+			_blocks.push_back(AllocBlock(std::max(size, kMinBlockSize)));
+		}
+		else if (_blocks[nextBlockIndex].size < size)
+		{
+			// the pooled block is too small, replace it so that blocks keep their order
+			HYBRIDCLR_FREE(_blocks[nextBlockIndex].data);
+			_blocks[nextBlockIndex] = AllocBlock(std::max(size, kMinBlockSize));
+		}
+		Block& block = _blocks[nextBlockIndex];
+		_curBlockIndex = nextBlockIndex;
+		_buf = (byte*)block.data;
+		_size = block.size;
+		_pos = 0;
+	}
+
+	void TemporaryMemoryArena::Reset()
+	{
+		IL2CPP_ASSERT(!_blocks.empty());
+		_peakUsedSize = GetPeakUsedSize();
+		_usedSizeOfPrevBlocks = 0;
+		_curBlockIndex = 0;
+		_buf = (byte*)_blocks[0].data;
+		_size = _blocks[0].size;
+		_pos = 0;
+	}
+
+	void TemporaryMemoryArena::ShrinkPooledBlocks()
+	{
+		IL2CPP_ASSERT(_curBlockIndex == 0 && _pos == 0);
+		size_t reservedSize = _blocks[0].size;
+		size_t keepBlockCount = 1;
+		for (; keepBlockCount < _blocks.size(); keepBlockCount++)
+		{
+			reservedSize += _blocks[keepBlockCount].size;
+			if (reservedSize > kMaxPooledArenaSize)
+			{
+				break;
+			}
+		}
+		for (size_t i = keepBlockCount; i < _blocks.size(); i++)
+		{
+			HYBRIDCLR_FREE(_blocks[i].data);
+		}
+		_blocks.resize(keepBlockCount);
+	}
+
+	size_t TemporaryMemoryArena::GetReservedSize() const
+	{
+		size_t reservedSize = 0;
+		for (const Block& block : _blocks)
+		{
+			reservedSize += block.size;
+		}
+		return reservedSize;
+	}
+
+	TemporaryMemoryArena* TemporaryMemoryArena::AcquireThreadLocalArena()
+	{
+		TemporaryMemoryArena* arena = nullptr;
+		s_threadLocalArena.GetValue((void**)&arena);
+		if (arena)
+		{
+			s_threadLocalArena.SetValue(nullptr);
+			return arena;
 		}
+		return new TemporaryMemoryArena();
 	}
+
+	void TemporaryMemoryArena::ReleaseThreadLocalArena(TemporaryMemoryArena* arena)
+	{
+		arena->Reset();
+		arena->ShrinkPooledBlocks();
+		TemporaryMemoryArena* pooledArena = nullptr;
+		s_threadLocalArena.GetValue((void**)&pooledArena);
+		if (pooledArena)
+		{
+			// released by a nested transform, keep the one with more blocks
+			if (pooledArena->GetReservedSize() >= arena->GetReservedSize())
+			{
+				delete arena;
+				return;
+			}
+			delete pooledArena;
+		}
+		s_threadLocalArena.SetValue(arena);
+	}
+
+	void TemporaryMemoryArena::FreeThreadLocalArena()
+	{
+		TemporaryMemoryArena* arena = nullptr;
+		s_threadLocalArena.GetValue((void**)&arena);
+		if (arena)
+		{
+			delete arena;
+			s_threadLocalArena.SetValue(nullptr);
+		}
+	}
+}
 }
-}
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include <stack>
 #include <cmath>
 #include <vector>
+#include <cstddef>
+
+#include "os/ThreadLocalValue.h"
 
 #include "../CommonDef.h"
 
@@ -11,12 +14,14 @@ namespace hybridclr
 	namespace transform
 	{
 		const size_t kMinBlockSize = 8 * 1024;
+		// blocks beyond this size are freed when a pooled arena is released, a huge method doesn't pin its memory forever
+		const size_t kMaxPooledArenaSize = 1024 * 1024;
 
 		class TemporaryMemoryArena
 		{
 		public:
 
-			TemporaryMemoryArena() : _buf(nullptr), _size(0), _pos(0)
+			TemporaryMemoryArena() : _curBlockIndex(0), _buf(nullptr), _size(0), _pos(0), _usedSizeOfPrevBlocks(0), _peakUsedSize(0)
 			{
 				Begin();
 			}
@@ -90,10 +95,37 @@ namespace hybridclr
 				}
 			}
 
+			// uninitialized memory, used by TemporaryMemoryArenaAllocator
+			void* Alloc(size_t size)
+			{
+				size_t bytes = AligndSize(size);
+				if (_pos + bytes > _size)
+				{
+					RequireSize(bytes);
+				}
+				void* ret = _buf + _pos;
+				_pos += bytes;
+				return ret;
+			}
+
 			void Begin();
 
 			void End();
 
+			// discards all allocations but keeps the blocks for next use
+			void Reset();
+
+			size_t GetUsedSize() const { return _usedSizeOfPrevBlocks + _pos; }
+			// max used size since the arena was created, including the current use
+			size_t GetPeakUsedSize() const { return std::max(_peakUsedSize, GetUsedSize()); }
+			size_t GetReservedSize() const;
+
+			// a transform may run another transform on the same thread, e.g. by running a class constructor.
+			// the nested one gets a new arena, only one arena per thread is pooled.
+			static TemporaryMemoryArena* AcquireThreadLocalArena();
+			static void ReleaseThreadLocalArena(TemporaryMemoryArena* arena);
+			static void FreeThreadLocalArena();
+
 		private:
 			struct Block
 			{
@@ -101,26 +133,97 @@ namespace hybridclr
 				size_t size;
 			};
 
-			void RequireSize(size_t size)
-			{
-				if (_buf)
-				{
-					_useOuts.push_back({ (void*)_buf, _size});
-				}
-
-				Block newBlock = AllocBlock(std::max(size, kMinBlockSize));
-				_buf = (byte*)newBlock.data;
-				_size = newBlock.size;
-				_pos = 0;
-			}
+			void RequireSize(size_t size);
+			void ShrinkPooledBlocks();
 
 			static Block AllocBlock(size_t size);
 
-			std::vector<Block> _useOuts;
+			static il2cpp::os::ThreadLocalValue s_threadLocalArena;
+
+			// _blocks[0, _curBlockIndex) are used out, the blocks after the current one are pooled
+			std::vector<Block> _blocks;
+			size_t _curBlockIndex;
 
 			byte* _buf;
 			size_t _size;
 			size_t _pos;
+
+			size_t _usedSizeOfPrevBlocks;
+			size_t _peakUsedSize;
+		};
+
+		// borrows the pooled arena of current thread. the arena is reset and returned when the scope ends.
+		class ThreadLocalTemporaryMemoryArenaScope
+		{
+		public:
+			ThreadLocalTemporaryMemoryArenaScope() : _arena(TemporaryMemoryArena::AcquireThreadLocalArena())
+			{
+			}
+
+			~ThreadLocalTemporaryMemoryArenaScope()
+			{
+				TemporaryMemoryArena::ReleaseThreadLocalArena(_arena);
+			}
+
+			TemporaryMemoryArena& GetArena() { return *_arena; }
+		private:
+			TemporaryMemoryArena* _arena;
+		};
+
+		// stl allocator of temporary containers, memory is released with the arena
+		template<typename T>
+		class TemporaryMemoryArenaAllocator
+		{
+		public:
+			typedef T value_type;
+			typedef T* pointer;
+			typedef const T* const_pointer;
+			typedef T& reference;
+			typedef const T& const_reference;
+			typedef size_t size_type;
+			typedef std::ptrdiff_t difference_type;
+
+			template<typename U>
+			struct rebind
+			{
+				typedef TemporaryMemoryArenaAllocator<U> other;
+			};
+
+			explicit TemporaryMemoryArenaAllocator(TemporaryMemoryArena& arena) : _arena(&arena)
+			{
+			}
+
+			template<typename U>
+			TemporaryMemoryArenaAllocator(const TemporaryMemoryArenaAllocator<U>& other) : _arena(other._arena)
+			{
+			}
+
+			T* allocate(size_t n)
+			{
+				return (T*)_arena->Alloc(sizeof(T) * n);
+			}
+
+			void deallocate(T* p, size_t n)
+			{
+			}
+
+			size_t max_size() const
+			{
+				return SIZE_MAX / sizeof(T);
+			}
+
+			template<typename U>
+			bool operator==(const TemporaryMemoryArenaAllocator<U>& other) const { return _arena == other._arena; }
+			template<typename U>
+			bool operator!=(const TemporaryMemoryArenaAllocator<U>& other) const { return _arena != other._arena; }
+		private:
+			template<typename U>
+			friend class TemporaryMemoryArenaAllocator;
+
+			TemporaryMemoryArena* _arena;
 		};
+
+		template<typename T>
+		using TemporaryVector = std::vector<T, TemporaryMemoryArenaAllocator<T>>;
 	}
-}
\ No newline at end of file
+}
@@ -1,38 +1,167 @@
-
 #include "Transform.h"
 
 #include <unordered_set>
 
+#include "vm/MetadataLock.h"
+#include "os/Atomic.h"
+
 #include "TransformContext.h"
+#include "TransformCache.h"
 
 #include "../metadata/MethodBodyCache.h"
+#include "../metadata/ClassHierarchy.h"
 
 namespace hybridclr
 {
 namespace transform
 {
 
-	InterpMethodInfo* HiTransform::Transform(const MethodInfo* methodInfo)
+	static bool IsNoSubclassAssumptionsValid(const std::vector<const Il2CppClass*>& assumptions)
 	{
-		TemporaryMemoryArena pool;
+		for (const Il2CppClass* klass : assumptions)
+		{
+			if (metadata::ClassHierarchy::HasSubclass(klass))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
 
-		metadata::Image* image = metadata::MetadataModule::GetUnderlyingInterpreterImage(methodInfo);
-		IL2CPP_ASSERT(image);
+	// frees a result that was never published. published results are never freed, frames may still run them.
+	static void FreeInterpMethodInfo(InterpMethodInfo* imi)
+	{
+		HYBRIDCLR_FREE(imi->codes);
+		HYBRIDCLR_FREE(imi->args);
+		HYBRIDCLR_FREE(imi->resolveDatas);
+		HYBRIDCLR_FREE(const_cast<InterpExceptionClause*>(imi->exClauses));
+		HYBRIDCLR_FREE(const_cast<OsrEntry*>(imi->osrEntries));
+		HYBRIDCLR_FREE(const_cast<uint8_t*>(imi->refSlotMap));
+		imi->~InterpMethodInfo();
+		HYBRIDCLR_FREE(imi);
+	}
 
+	HiTransform::HiTransform(const MethodInfo* methodInfo, interpreter::ExecutionTier tier)
+		: _methodInfo(methodInfo), _image(metadata::MetadataModule::GetUnderlyingInterpreterImage(methodInfo)), _tier(tier),
+		_cacheable(false), _serialize(false), _lowered(false), _published(false), _resolveDataSymbols(), _ctx(nullptr), _result(nullptr), _runtimeHash(0)
+	{
+		IL2CPP_ASSERT(_image);
+		// il mappers are registered per method, frames of baseline code would be mapped by il mappers of optimized code
+		if (_image->GetPDBImage())
+		{
+			_tier = interpreter::ExecutionTier::Optimized;
+		}
+		// method bodies in the cache must not be freed while any transform is using them
 		metadata::MethodBodyCache::EnableShrinkMethodBodyCache(false);
-		metadata::MethodBody* methodBody = metadata::MethodBodyCache::GetMethodBody(image, methodInfo->token);
+	}
+
+	HiTransform::~HiTransform()
+	{
+		if (_result && !_published)
+		{
+			FreeInterpMethodInfo(_result);
+		}
+		delete _ctx;
+		metadata::MethodBodyCache::EnableShrinkMethodBodyCache(true);
+	}
+
+	void HiTransform::Translate()
+	{
+		IL2CPP_ASSERT(_result == nullptr);
+		// only optimized code is cached. a cached method skips the baseline tier.
+		_cacheable = TransformCache::IsCacheable(_image);
+		if (_cacheable)
+		{
+			_result = TransformCache::TryLoad(_methodInfo, _noSubclassAssumptions);
+			if (_result && IsNoSubclassAssumptionsValid(_noSubclassAssumptions))
+			{
+				_lowered = true;
+				return;
+			}
+			// the subclass was loaded in a previous run or meanwhile
+			if (_result)
+			{
+				FreeInterpMethodInfo(_result);
+				_result = nullptr;
+			}
+			_noSubclassAssumptions.clear();
+		}
+
+		metadata::MethodBody* methodBody = metadata::MethodBodyCache::GetMethodBody(_image, _methodInfo->token);
 		if (methodBody == nullptr || methodBody->ilcodes == nullptr)
 		{
-			TEMP_FORMAT(errMsg, "Method body is null. %s.%s::%s", methodInfo->klass->namespaze, methodInfo->klass->name, methodInfo->name);
+			TEMP_FORMAT(errMsg, "Method body is null. %s.%s::%s", _methodInfo->klass->namespaze, _methodInfo->klass->name, _methodInfo->name);
 			il2cpp::vm::Exception::Raise(il2cpp::vm::Exception::GetExecutionEngineException(errMsg));
 		}
-		InterpMethodInfo* result = new (HYBRIDCLR_METADATA_MALLOC(sizeof(InterpMethodInfo))) InterpMethodInfo;
-		il2cpp::utils::dynamic_array<uint64_t> resolveDatas;
-		TransformContext ctx(image, methodInfo, *methodBody, pool, resolveDatas);
+		// zeroed, a result that failed to lower is freed
+		_result = new (HYBRIDCLR_MALLOC(sizeof(InterpMethodInfo))) InterpMethodInfo();
+		// blocks of the arena are reused by the next transform on this thread
+		_ctx = new TransformContext(_image, _methodInfo, *methodBody, _poolScope.GetArena(), _resolveDatas);
+		_ctx->SetExecutionTier(_tier);
+		_serialize = _cacheable && _tier == interpreter::ExecutionTier::Optimized;
+		if (_serialize)
+		{
+			_runtimeHash = TransformCache::GetRuntimeHash(_methodInfo);
+			_ctx->SetResolveDataSymbols(&_resolveDataSymbols);
+		}
 
-		ctx.TransformBody(0, 0, *result);
-		metadata::MethodBodyCache::EnableShrinkMethodBodyCache(true);
-		return result;
+		_ctx->TranslateBody(*_result);
+		_noSubclassAssumptions = _ctx->GetNoSubclassAssumptions();
+
+		if (_serialize || _image->GetPDBImage())
+		{
+			Lower();
+		}
+	}
+
+	void HiTransform::Lower()
+	{
+		_ctx->LowerBody(*_result);
+		_lowered = true;
+		if (_serialize)
+		{
+			_cacheEntry = TransformCache::Serialize(_methodInfo, _runtimeHash, *_result, (uint32_t)_resolveDatas.size(), _resolveDataSymbols, _noSubclassAssumptions);
+		}
+	}
+
+	metadata::PublishInterpDataResult HiTransform::Publish(const void* expectedInterpData)
+	{
+		IL2CPP_ASSERT(_result);
+		if (!_lowered)
+		{
+			Lower();
+		}
+		// an image loaded since Translate may have added a subclass to a devirtualized class
+		metadata::PublishInterpDataResult ret = metadata::ClassHierarchy::PublishInterpData(_methodInfo, _result, expectedInterpData, _noSubclassAssumptions);
+		_published = ret == metadata::PublishInterpDataResult::Published;
+		if (_published && !_cacheEntry.empty())
+		{
+			TransformCache::Add(_methodInfo, std::move(_cacheEntry));
+		}
+		return ret;
+	}
+
+	InterpMethodInfo* HiTransform::Transform(const MethodInfo* methodInfo, interpreter::ExecutionTier tier, const void* expectedInterpData)
+	{
+		for (;;)
+		{
+			HiTransform transform(methodInfo, tier);
+			{
+				il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+				transform.Translate();
+			}
+			switch (transform.Publish(expectedInterpData))
+			{
+			case metadata::PublishInterpDataResult::Published:
+				return transform.GetResult();
+			case metadata::PublishInterpDataResult::InterpDataChanged:
+				// the baseline code was replaced by others or reset by ClassHierarchy while tiering up
+				return nullptr;
+			default:
+				// it's rare, transform again
+				break;
+			}
+		}
 	}
 }
 
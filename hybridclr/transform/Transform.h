@@ -1,8 +1,14 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "BasicBlockSpliter.h"
+#include "TemporaryMemoryArena.h"
+#include "TransformCache.h"
 
 #include "../metadata/Image.h"
+#include "../metadata/ClassHierarchy.h"
 #include "../interpreter/Instruction.h"
 #include "../interpreter/Engine.h"
 #include "../interpreter/InterpreterDefs.h"
@@ -11,10 +17,49 @@ namespace hybridclr
 {
 namespace transform
 {
+	class TransformContext;
+
+	// transform of one method, in two steps.
+	// Translate reads metadata through image caches that are only guarded by g_MetadataLock, it must be called with it held.
+	// Publish optimizes and lays out the translated IR and publishes it, it never takes g_MetadataLock. methods with
+	// debug info or saved to the transform cache are laid out by Translate already, registering il mappers and
+	// serializing symbols read metadata.
 	class HiTransform
 	{
 	public:
-		static interpreter::InterpMethodInfo* Transform(const MethodInfo* methodInfo);
+		HiTransform(const MethodInfo* methodInfo, interpreter::ExecutionTier tier);
+		~HiTransform();
+
+		void Translate();
+
+		// publishes the result to methodInfo->interpData if it's still expectedInterpData and no assumption was broken meanwhile.
+		// an unpublished result is freed with the transform.
+		metadata::PublishInterpDataResult Publish(const void* expectedInterpData);
+
+		// owned by the transform until published
+		interpreter::InterpMethodInfo* GetResult() const { return _result; }
+
+		// translates under g_MetadataLock and publishes, transforms again if a subclass was loaded meanwhile.
+		// returns null if methodInfo->interpData is no longer expectedInterpData.
+		static interpreter::InterpMethodInfo* Transform(const MethodInfo* methodInfo, interpreter::ExecutionTier tier, const void* expectedInterpData);
+	private:
+		void Lower();
+
+		const MethodInfo* _methodInfo;
+		metadata::Image* _image;
+		interpreter::ExecutionTier _tier;
+		bool _cacheable;
+		bool _serialize;
+		bool _lowered;
+		bool _published;
+		ThreadLocalTemporaryMemoryArenaScope _poolScope;
+		il2cpp::utils::dynamic_array<uint64_t> _resolveDatas;
+		ResolveDataSymbols _resolveDataSymbols;
+		TransformContext* _ctx;
+		interpreter::InterpMethodInfo* _result;
+		std::vector<const Il2CppClass*> _noSubclassAssumptions;
+		uint64_t _runtimeHash;
+		std::string _cacheEntry;
 	};
 }
-}
\ No newline at end of file
+}
@@ -0,0 +1,1148 @@
+#include "TransformCache.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Baselib.h"
+#include "os/Mutex.h"
+#include "vm/Assembly.h"
+#include "vm/Class.h"
+#include "vm/Field.h"
+#include "vm/GenericClass.h"
+#include "vm/MetadataCache.h"
+#include "vm/MetadataLock.h"
+#include "metadata/GenericMetadata.h"
+
+#include "../metadata/Image.h"
+#include "../metadata/MetadataModule.h"
+#include "../metadata/MetadataUtil.h"
+#include "../metadata/UnifiedMetadataProvider.h"
+#include "../interpreter/Instruction.h"
+#include "../interpreter/InterpreterModule.h"
+#include "../RuntimeConfig.h"
+
+namespace hybridclr
+{
+namespace transform
+{
+	using interpreter::InterpMethodInfo;
+	using interpreter::InterpExceptionClause;
+	using interpreter::MethodArgDesc;
+	using interpreter::OsrEntry;
+
+	constexpr uint32_t kTransformCacheMagic = 0x52494348; // "HCIR"
+	constexpr uint32_t kTransformCacheFormatVersion = 4;
+
+	struct TransformCacheFileHeader
+	{
+		uint32_t magic;
+		uint32_t formatVersion;
+		uint8_t mvid[16];
+		uint32_t entryCount;
+		uint32_t reserved;
+	};
+
+	// an entry is laid out as header, method key, codes, resolve datas, args, exception clauses, osr entries,
+	// ref slot map and symbols. every section starts at 8 bytes aligned offset, so args, osr entries and
+	// ref slot map can be used in place. the ref slot map has (evalStackBaseOffset + 7) / 8 bytes.
+	// contentHash covers the rest of the entry, runtimeHash is the runtime the method was transformed with.
+	struct TransformCacheEntryHeader
+	{
+		uint64_t contentHash;
+		uint64_t runtimeHash;
+		uint32_t entrySize;
+		uint32_t methodKeySize;
+		uint32_t codeLength;
+		uint32_t resolveDataCount;
+		uint32_t argCount;
+		uint32_t exClauseCount;
+		uint32_t argStackObjectSize;
+		uint32_t retStackObjectSize;
+		uint32_t initLocals;
+		uint32_t localStackSize;
+		uint32_t maxStackSize;
+		uint32_t localVarBaseOffset;
+		uint32_t evalStackBaseOffset;
+		uint32_t osrEntryCount;
+		uint32_t reserved;
+	};
+
+	static_assert(sizeof(TransformCacheFileHeader) % 8 == 0, "require 8 bytes aligned");
+	static_assert(sizeof(TransformCacheEntryHeader) % 8 == 0, "require 8 bytes aligned");
+
+	static const uint64_t kZeroResolveData = 0;
+
+	static size_t AlignSize(size_t size)
+	{
+		return (size + 7) & ~(size_t)7;
+	}
+
+#pragma region symbol
+
+	// classes are written as assembly name and full type name instead of metadata indexes, which change
+	// with the load order of assemblies.
+	class SymbolWriter
+	{
+	public:
+		SymbolWriter(std::string& buf) : _buf(buf) {}
+
+		void WriteBytes(const void* data, size_t size)
+		{
+			_buf.append((const char*)data, size);
+		}
+
+		void WriteU8(uint8_t value)
+		{
+			_buf.push_back((char)value);
+		}
+
+		void WriteU32(uint32_t value)
+		{
+			WriteBytes(&value, sizeof(value));
+		}
+
+		// null terminated, so it can be read in place
+		void WriteString(const char* str)
+		{
+			uint32_t len = (uint32_t)std::strlen(str);
+			WriteU32(len);
+			WriteBytes(str, len + 1);
+		}
+
+		void Align()
+		{
+			_buf.resize(AlignSize(_buf.size()), '\0');
+		}
+
+		bool WriteTypeDefinition(Il2CppClass* klass)
+		{
+			Il2CppClass* declaringType = il2cpp::vm::Class::GetDeclaringType(klass);
+			if (declaringType)
+			{
+				WriteU8(1);
+				if (!WriteTypeDefinition(declaringType))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				WriteU8(0);
+				WriteString(klass->image->assembly->aname.name);
+				WriteString(klass->namespaze);
+			}
+			WriteString(klass->name);
+			return true;
+		}
+
+		bool WriteGenericInst(const Il2CppGenericInst* inst)
+		{
+			if (!inst)
+			{
+				WriteU32(0);
+				return true;
+			}
+			WriteU32(inst->type_argc);
+			for (uint32_t i = 0; i < inst->type_argc; i++)
+			{
+				if (!WriteType(inst->type_argv[i]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		bool WriteType(const Il2CppType* type)
+		{
+			WriteU8((uint8_t)type->type);
+			WriteU8((uint8_t)type->byref);
+			switch (type->type)
+			{
+			case IL2CPP_TYPE_CLASS:
+			case IL2CPP_TYPE_VALUETYPE:
+			{
+				return WriteTypeDefinition(il2cpp::vm::Class::FromIl2CppType(type));
+			}
+			case IL2CPP_TYPE_GENERICINST:
+			{
+				Il2CppGenericClass* genericClass = type->data.generic_class;
+				return WriteTypeDefinition(il2cpp::vm::GenericClass::GetTypeDefinition(genericClass)) && WriteGenericInst(genericClass->context.class_inst);
+			}
+			case IL2CPP_TYPE_SZARRAY:
+			case IL2CPP_TYPE_PTR:
+			{
+				return WriteType(type->data.type);
+			}
+			case IL2CPP_TYPE_ARRAY:
+			{
+				if (!WriteType(type->data.array->etype))
+				{
+					return false;
+				}
+				WriteU8(type->data.array->rank);
+				return true;
+			}
+			case IL2CPP_TYPE_VAR:
+			case IL2CPP_TYPE_MVAR:
+			case IL2CPP_TYPE_FNPTR:
+			{
+				return false;
+			}
+			default:
+			{
+				return true;
+			}
+			}
+		}
+
+		bool WriteClass(const Il2CppClass* klass)
+		{
+			return WriteType(&klass->byval_arg);
+		}
+
+		bool WriteMethod(const MethodInfo* method)
+		{
+			const MethodInfo* methodDef = method->is_inflated ? method->genericMethod->methodDefinition : method;
+			Il2CppClass* defKlass = methodDef->klass;
+			il2cpp::vm::Class::Init(defKlass);
+			uint32_t index = 0;
+			while (index < defKlass->method_count && defKlass->methods[index] != methodDef)
+			{
+				++index;
+			}
+			if (index == defKlass->method_count || !WriteTypeDefinition(defKlass))
+			{
+				return false;
+			}
+			WriteU32(index);
+			if (!method->is_inflated)
+			{
+				WriteU8(0);
+				return true;
+			}
+			WriteU8(1);
+			const Il2CppGenericContext& context = method->genericMethod->context;
+			return WriteGenericInst(context.class_inst) && WriteGenericInst(context.method_inst);
+		}
+
+		bool WriteField(const FieldInfo* field)
+		{
+			if (!WriteClass(field->parent))
+			{
+				return false;
+			}
+			WriteU32((uint32_t)(field - field->parent->fields));
+			return true;
+		}
+
+	private:
+		std::string& _buf;
+	};
+
+	// returns null when a symbol can't be resolved, e.g. the referenced type was removed by a hot update
+	class SymbolReader
+	{
+	public:
+		SymbolReader(const byte* data, const byte* end) : _cur(data), _end(end) {}
+
+		bool ReadU8(uint8_t& value)
+		{
+			if (_cur + 1 > _end)
+			{
+				return false;
+			}
+			value = *_cur++;
+			return true;
+		}
+
+		bool ReadU32(uint32_t& value)
+		{
+			if (_cur + sizeof(uint32_t) > _end)
+			{
+				return false;
+			}
+			std::memcpy(&value, _cur, sizeof(uint32_t));
+			_cur += sizeof(uint32_t);
+			return true;
+		}
+
+		const char* ReadString()
+		{
+			uint32_t len;
+			if (!ReadU32(len) || _cur + len + 1 > _end || _cur[len] != 0)
+			{
+				return nullptr;
+			}
+			const char* str = (const char*)_cur;
+			_cur += len + 1;
+			return str;
+		}
+
+		Il2CppClass* ReadTypeDefinition()
+		{
+			uint8_t nested;
+			if (!ReadU8(nested))
+			{
+				return nullptr;
+			}
+			if (nested)
+			{
+				Il2CppClass* declaringType = ReadTypeDefinition();
+				const char* name = ReadString();
+				if (!declaringType || !name)
+				{
+					return nullptr;
+				}
+				void* iter = nullptr;
+				while (Il2CppClass* nestedType = il2cpp::vm::Class::GetNestedTypes(declaringType, &iter))
+				{
+					if (std::strcmp(nestedType->name, name) == 0)
+					{
+						return nestedType;
+					}
+				}
+				return nullptr;
+			}
+			const char* assemblyName = ReadString();
+			const char* namespaze = ReadString();
+			const char* name = ReadString();
+			if (!assemblyName || !namespaze || !name)
+			{
+				return nullptr;
+			}
+			const Il2CppAssembly* ass = il2cpp::vm::Assembly::GetLoadedAssembly(assemblyName);
+			return ass ? il2cpp::vm::Class::FromName(il2cpp::vm::Assembly::GetImage(ass), namespaze, name) : nullptr;
+		}
+
+		bool ReadGenericInst(const Il2CppGenericInst*& inst)
+		{
+			uint32_t argc;
+			if (!ReadU32(argc) || argc > 32)
+			{
+				return false;
+			}
+			if (argc == 0)
+			{
+				inst = nullptr;
+				return true;
+			}
+			const Il2CppType* types[32];
+			for (uint32_t i = 0; i < argc; i++)
+			{
+				if (!(types[i] = ReadType()))
+				{
+					return false;
+				}
+			}
+			inst = il2cpp::vm::MetadataCache::GetGenericInst(types, argc);
+			return true;
+		}
+
+		const Il2CppType* ReadType()
+		{
+			uint8_t typeEnum;
+			uint8_t byref;
+			if (!ReadU8(typeEnum) || !ReadU8(byref))
+			{
+				return nullptr;
+			}
+			Il2CppClass* klass;
+			switch ((Il2CppTypeEnum)typeEnum)
+			{
+			case IL2CPP_TYPE_CLASS:
+			case IL2CPP_TYPE_VALUETYPE:
+			{
+				klass = ReadTypeDefinition();
+				break;
+			}
+			case IL2CPP_TYPE_GENERICINST:
+			{
+				Il2CppClass* genericTypeDef = ReadTypeDefinition();
+				const Il2CppGenericInst* classInst;
+				if (!genericTypeDef || !ReadGenericInst(classInst) || !classInst)
+				{
+					return nullptr;
+				}
+				Il2CppGenericClass* genericClass = il2cpp::metadata::GenericMetadata::GetGenericClass(&genericTypeDef->byval_arg, classInst);
+				klass = il2cpp::vm::GenericClass::GetClass(genericClass);
+				break;
+			}
+			case IL2CPP_TYPE_SZARRAY:
+			case IL2CPP_TYPE_ARRAY:
+			case IL2CPP_TYPE_PTR:
+			{
+				const Il2CppType* eleType = ReadType();
+				if (!eleType)
+				{
+					return nullptr;
+				}
+				Il2CppClass* eleKlass = il2cpp::vm::Class::FromIl2CppType(eleType);
+				if (typeEnum == IL2CPP_TYPE_SZARRAY)
+				{
+					klass = il2cpp::vm::Class::GetArrayClass(eleKlass, 1);
+				}
+				else if (typeEnum == IL2CPP_TYPE_PTR)
+				{
+					klass = il2cpp::vm::Class::GetPtrClass(eleKlass);
+				}
+				else
+				{
+					uint8_t rank;
+					if (!ReadU8(rank))
+					{
+						return nullptr;
+					}
+					klass = il2cpp::vm::Class::GetBoundedArrayClass(eleKlass, rank, true);
+				}
+				break;
+			}
+			default:
+			{
+				klass = il2cpp::vm::Class::FromIl2CppTypeEnum((Il2CppTypeEnum)typeEnum);
+				break;
+			}
+			}
+			if (!klass)
+			{
+				return nullptr;
+			}
+			return byref ? &klass->this_arg : &klass->byval_arg;
+		}
+
+		Il2CppClass* ReadClass()
+		{
+			const Il2CppType* type = ReadType();
+			if (!type)
+			{
+				return nullptr;
+			}
+			Il2CppClass* klass = il2cpp::vm::Class::FromIl2CppType(type);
+			il2cpp::vm::Class::Init(klass);
+			return klass;
+		}
+
+		const MethodInfo* ReadMethod()
+		{
+			Il2CppClass* defKlass = ReadTypeDefinition();
+			uint32_t index;
+			uint8_t inflated;
+			if (!defKlass || !ReadU32(index) || !ReadU8(inflated))
+			{
+				return nullptr;
+			}
+			il2cpp::vm::Class::Init(defKlass);
+			if (index >= defKlass->method_count)
+			{
+				return nullptr;
+			}
+			const MethodInfo* method = defKlass->methods[index];
+			if (inflated)
+			{
+				Il2CppGenericContext context;
+				if (!ReadGenericInst(context.class_inst) || !ReadGenericInst(context.method_inst))
+				{
+					return nullptr;
+				}
+				method = il2cpp::metadata::GenericMetadata::Inflate(method, &context);
+				il2cpp::vm::Class::Init(method->klass);
+			}
+			return method;
+		}
+
+		const FieldInfo* ReadField()
+		{
+			Il2CppClass* klass = ReadClass();
+			uint32_t index;
+			if (!klass || !ReadU32(index) || index >= klass->field_count)
+			{
+				return nullptr;
+			}
+			return klass->fields + index;
+		}
+
+	private:
+		const byte* _cur;
+		const byte* _end;
+	};
+
+	static bool WriteResolveDataSymbol(SymbolWriter& writer, const ResolveDataSymbol& symbol)
+	{
+		writer.WriteU8((uint8_t)symbol.type);
+		switch (symbol.type)
+		{
+		case ResolveDataSymbolType::RawData:
+		{
+			return true;
+		}
+		case ResolveDataSymbolType::Class:
+		{
+			return writer.WriteClass((const Il2CppClass*)symbol.target);
+		}
+		case ResolveDataSymbolType::Method:
+		case ResolveDataSymbolType::Managed2NativeMethod:
+		case ResolveDataSymbolType::StaticManaged2NativeMethod:
+		case ResolveDataSymbolType::VirtualCallInlineCache:
+		{
+			return writer.WriteMethod((const MethodInfo*)symbol.target);
+		}
+		case ResolveDataSymbolType::StaticFieldData:
+		{
+			return writer.WriteField((const FieldInfo*)symbol.target);
+		}
+		case ResolveDataSymbolType::UserString:
+		{
+			const metadata::Image* image = (const metadata::Image*)symbol.target;
+			writer.WriteString(image->GetIl2CppImage()->assembly->aname.name);
+			writer.WriteU32(symbol.userStringIndex);
+			return true;
+		}
+		default:
+		{
+			return false;
+		}
+		}
+	}
+
+	static bool ReadResolveData(SymbolReader& reader, uint64_t& data)
+	{
+		uint8_t symbolType;
+		if (!reader.ReadU8(symbolType))
+		{
+			return false;
+		}
+		const void* ptr;
+		switch ((ResolveDataSymbolType)symbolType)
+		{
+		case ResolveDataSymbolType::RawData:
+		{
+			return true;
+		}
+		case ResolveDataSymbolType::Class:
+		{
+			ptr = reader.ReadClass();
+			break;
+		}
+		case ResolveDataSymbolType::Method:
+		case ResolveDataSymbolType::VirtualCallInlineCache:
+		{
+			ptr = reader.ReadMethod();
+			break;
+		}
+		case ResolveDataSymbolType::Managed2NativeMethod:
+		case ResolveDataSymbolType::StaticManaged2NativeMethod:
+		{
+			const MethodInfo* method = reader.ReadMethod();
+			bool forceStatic = (ResolveDataSymbolType)symbolType == ResolveDataSymbolType::StaticManaged2NativeMethod;
+			ptr = method ? (const void*)interpreter::InterpreterModule::GetManaged2NativeMethodPointer(method, forceStatic) : nullptr;
+			break;
+		}
+		case ResolveDataSymbolType::StaticFieldData:
+		{
+			const FieldInfo* field = reader.ReadField();
+			ptr = field ? il2cpp::vm::Field::GetData(const_cast<FieldInfo*>(field)) : nullptr;
+			break;
+		}
+		case ResolveDataSymbolType::UserString:
+		{
+			const char* assemblyName = reader.ReadString();
+			uint32_t userStringIndex;
+			if (!assemblyName || !reader.ReadU32(userStringIndex))
+			{
+				return false;
+			}
+			const Il2CppAssembly* ass = il2cpp::vm::Assembly::GetLoadedAssembly(assemblyName);
+			metadata::Image* image = ass ? metadata::UnifiedMetadataProvider::GetImageForAssembly(ass) : nullptr;
+			ptr = image ? image->GetIl2CppUserStringFromRawIndex(userStringIndex) : nullptr;
+			break;
+		}
+		default:
+		{
+			return false;
+		}
+		}
+		data = (uint64_t)ptr;
+		return ptr != nullptr;
+	}
+
+#pragma endregion
+
+#pragma region cache
+
+	struct ImageTransformCache
+	{
+		std::string filePath;
+		// loaded entries point into it. freed with the cache, methods loaded from it own copies of their data.
+		byte* fileData;
+		// entries of any runtime hash are kept, they are checked when loaded
+		std::unordered_map<std::string, const TransformCacheEntryHeader*> loadedEntries;
+		// transformed in this run, replace loaded entries when saving
+		std::map<std::string, std::string> newEntries;
+		uint64_t dependencyHash;
+		// assemblies loaded when dependencyHash was computed, it's computed again if a reference was missing
+		size_t dependencyHashAssemblyCount;
+		bool dependencyHashComplete;
+	};
+
+	static baselib::ReentrantLock s_transformCacheLock;
+	static std::string s_cacheDirectory;
+	static std::unordered_map<const metadata::Image*, ImageTransformCache*> s_imageCaches;
+
+	static uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+	{
+		const byte* p = (const byte*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash = (hash ^ p[i]) * 0x100000001B3ULL;
+		}
+		return hash;
+	}
+
+	template<typename T>
+	static uint64_t HashValue(uint64_t hash, T value)
+	{
+		return HashBytes(hash, &value, sizeof(T));
+	}
+
+	static const uint64_t kHashSeed = 0xCBF29CE484222325ULL;
+
+	// interpreter assemblies are identified by mvid, aot assemblies by shape of their metadata
+	static uint64_t HashAssemblyIdentity(const Il2CppAssembly* ass)
+	{
+		const Il2CppImage* image = ass->image;
+		uint64_t hash = HashBytes(kHashSeed, image->name, std::strlen(image->name));
+		if (metadata::IsInterpreterImage(image))
+		{
+			return HashBytes(hash, metadata::MetadataModule::GetImage(image)->GetModuleVersionId(), 16);
+		}
+		hash = HashValue(hash, image->typeCount);
+		return HashValue(hash, image->codeGenModule ? image->codeGenModule->methodPointerCount : 0);
+	}
+
+	// the image and the assemblies its methods may refer to: its references and, through interpreter images,
+	// theirs. aot assemblies only change with a new build of the player, their references aren't followed.
+	// complete is false if a referenced assembly isn't loaded yet.
+	static uint64_t ComputeDependencyHash(metadata::Image* image, bool& complete)
+	{
+		complete = true;
+		const Il2CppAssembly* ass = image->GetIl2CppImage()->assembly;
+		std::unordered_set<std::string> visitedNames = { ass->image->nameNoExt };
+		std::vector<metadata::Image*> pendingImages = { image };
+		// independent of the order of references
+		uint64_t hash = HashAssemblyIdentity(ass);
+		while (!pendingImages.empty())
+		{
+			metadata::Image* curImage = pendingImages.back();
+			pendingImages.pop_back();
+			metadata::RawImageBase& rawImage = curImage->GetRawImage();
+			uint32_t refCount = rawImage.GetTableRowNum(metadata::TableType::ASSEMBLYREF);
+			for (uint32_t i = 1; i <= refCount; i++)
+			{
+				const char* refName = rawImage.GetStringFromRawIndex(rawImage.ReadAssemblyRef(i).name);
+				if (!visitedNames.insert(refName).second)
+				{
+					continue;
+				}
+				const Il2CppAssembly* refAss = curImage->GetLoadedAssembly(refName);
+				if (!refAss)
+				{
+					complete = false;
+					hash ^= HashBytes(kHashSeed, refName, std::strlen(refName));
+					continue;
+				}
+				hash ^= HashAssemblyIdentity(refAss);
+				if (metadata::IsInterpreterImage(refAss->image))
+				{
+					pendingImages.push_back(metadata::MetadataModule::GetImage(refAss->image));
+				}
+			}
+		}
+		return hash;
+	}
+
+	// every runtime option read by the transform. the tier up counts only change baseline code, which isn't
+	// cached, they are hashed anyway so that options the transform reads can't be missed.
+	static const RuntimeOptionId kTransformOptionIds[] =
+	{
+		RuntimeOptionId::MaxMethodInlineDepth,
+		RuntimeOptionId::MaxInlineableMethodBodySize,
+		RuntimeOptionId::EnableIROptimizer,
+		RuntimeOptionId::TierUpCallCount,
+		RuntimeOptionId::TierUpBackEdgeCount,
+	};
+
+	// read every time, options may be changed at any time by SetRuntimeOption
+	static uint64_t GetOptionsHash()
+	{
+		uint64_t hash = kHashSeed;
+		hash = HashValue(hash, kTransformCacheFormatVersion);
+		hash = HashValue(hash, (uint32_t)sizeof(void*));
+		hash = HashBytes(hash, interpreter::g_instructionSizes, interpreter::g_instructionCount * sizeof(uint16_t));
+		// build flags that change the IR emitted for the same opcode set
+		hash = HashValue(hash, (uint32_t)HYBRIDCLR_ENABLE_WRITE_BARRIERS);
+		hash = HashValue(hash, (uint32_t)HYBRIDCLR_ENABLE_OPCODE_PROFILER);
+		hash = HashValue(hash, (uint32_t)HYBRIDCLR_UNITY_VERSION);
+		for (RuntimeOptionId optionId : kTransformOptionIds)
+		{
+			hash = HashValue(hash, RuntimeConfig::GetRuntimeOption(optionId));
+		}
+		return hash;
+	}
+
+	// only the layout of entries is checked here, the content of an entry is checked when it's loaded
+	static bool ParseCacheFile(ImageTransformCache* cache, size_t fileSize, const metadata::Image* image)
+	{
+		const byte* data = cache->fileData;
+		if (fileSize < sizeof(TransformCacheFileHeader))
+		{
+			return false;
+		}
+		const TransformCacheFileHeader* header = (const TransformCacheFileHeader*)data;
+		if (header->magic != kTransformCacheMagic || header->formatVersion != kTransformCacheFormatVersion
+			|| std::memcmp(header->mvid, image->GetModuleVersionId(), 16) != 0)
+		{
+			return false;
+		}
+		size_t offset = sizeof(TransformCacheFileHeader);
+		for (uint32_t i = 0; i < header->entryCount; i++)
+		{
+			// sizes are compared with what's left of the file, so they can't overflow
+			size_t remainingSize = fileSize - offset;
+			if (remainingSize < sizeof(TransformCacheEntryHeader))
+			{
+				return false;
+			}
+			const TransformCacheEntryHeader* entry = (const TransformCacheEntryHeader*)(data + offset);
+			if (entry->entrySize % 8 != 0 || entry->entrySize > remainingSize || entry->entrySize < sizeof(TransformCacheEntryHeader)
+				|| entry->methodKeySize > entry->entrySize - sizeof(TransformCacheEntryHeader))
+			{
+				return false;
+			}
+			std::string methodKey((const char*)(entry + 1), entry->methodKeySize);
+			cache->loadedEntries[methodKey] = entry;
+			offset += entry->entrySize;
+		}
+		return true;
+	}
+
+	static void FreeImageCache(ImageTransformCache* cache)
+	{
+		HYBRIDCLR_FREE(cache->fileData);
+		delete cache;
+	}
+
+	static ImageTransformCache* GetOrLoadImageCache(const metadata::Image* image)
+	{
+		auto it = s_imageCaches.find(image);
+		if (it != s_imageCaches.end())
+		{
+			return it->second;
+		}
+		ImageTransformCache* cache = new ImageTransformCache();
+		cache->filePath = s_cacheDirectory + "/" + image->GetIl2CppImage()->nameNoExt + ".ircache";
+		cache->fileData = nullptr;
+		cache->dependencyHash = 0;
+		cache->dependencyHashAssemblyCount = 0;
+		cache->dependencyHashComplete = false;
+		s_imageCaches[image] = cache;
+
+		FILE* fp = std::fopen(cache->filePath.c_str(), "rb");
+		if (!fp)
+		{
+			return cache;
+		}
+		std::fseek(fp, 0, SEEK_END);
+		long fileSize = std::ftell(fp);
+		std::fseek(fp, 0, SEEK_SET);
+		if (fileSize > 0)
+		{
+			cache->fileData = (byte*)HYBRIDCLR_MALLOC(fileSize);
+			if (std::fread(cache->fileData, 1, fileSize, fp) != (size_t)fileSize || !ParseCacheFile(cache, (size_t)fileSize, image))
+			{
+				// corrupted or outdated, rewritten on next save
+				cache->loadedEntries.clear();
+				HYBRIDCLR_FREE(cache->fileData);
+				cache->fileData = nullptr;
+			}
+		}
+		std::fclose(fp);
+		return cache;
+	}
+
+	// cached IR is only valid for the same IR format and transform options, and the same assemblies the
+	// method may refer to. loading other assemblies doesn't change the hash of an image.
+	static uint64_t GetRuntimeHash(metadata::Image* image)
+	{
+		size_t assemblyCount;
+		{
+			il2cpp::os::FastAutoLock lock(&il2cpp::vm::g_MetadataLock);
+			assemblyCount = il2cpp::vm::Assembly::GetAllAssemblies()->size();
+		}
+		ImageTransformCache* cache;
+		bool upToDate;
+		uint64_t dependencyHash;
+		{
+			il2cpp::os::FastAutoLock lock(&s_transformCacheLock);
+			cache = GetOrLoadImageCache(image);
+			upToDate = cache->dependencyHashComplete || cache->dependencyHashAssemblyCount == assemblyCount;
+			dependencyHash = cache->dependencyHash;
+		}
+		if (!upToDate)
+		{
+			// computed without s_transformCacheLock, looking up assemblies takes g_MetadataLock
+			bool complete;
+			dependencyHash = ComputeDependencyHash(image, complete);
+			il2cpp::os::FastAutoLock lock(&s_transformCacheLock);
+			// the cache may have been dropped by SetCacheDirectory meanwhile
+			cache = GetOrLoadImageCache(image);
+			cache->dependencyHash = dependencyHash;
+			cache->dependencyHashAssemblyCount = assemblyCount;
+			cache->dependencyHashComplete = complete;
+		}
+		return HashValue(GetOptionsHash(), dependencyHash);
+	}
+
+	static uint64_t ComputeEntryContentHash(const TransformCacheEntryHeader* entry)
+	{
+		return HashBytes(kHashSeed, &entry->runtimeHash, entry->entrySize - offsetof(TransformCacheEntryHeader, runtimeHash));
+	}
+
+	// a section of count elements, padded to 8 bytes. fails if it doesn't fit in what's left of the entry.
+	static bool TakeSection(const byte*& cur, const byte* end, uint32_t count, size_t elementSize, const byte*& section)
+	{
+		size_t remainingSize = (size_t)(end - cur);
+		if (count > remainingSize / elementSize || AlignSize(count * elementSize) > remainingSize)
+		{
+			return false;
+		}
+		section = cur;
+		cur += AlignSize(count * elementSize);
+		return true;
+	}
+
+	// null for an empty section
+	static void* CopySection(const void* section, size_t size)
+	{
+		if (size == 0)
+		{
+			return nullptr;
+		}
+		void* data = HYBRIDCLR_MALLOC(size);
+		std::memcpy(data, section, size);
+		return data;
+	}
+
+	static InterpMethodInfo* LoadEntry(const TransformCacheEntryHeader* entry, std::vector<const Il2CppClass*>& noSubclassAssumptions)
+	{
+		const byte* entryEnd = (const byte*)entry + entry->entrySize;
+		const byte* cur = (const byte*)(entry + 1);
+		const byte* methodKey;
+		const byte* codes;
+		const byte* rawResolveDatas;
+		const byte* args;
+		const byte* rawExClauses;
+		const byte* osrEntries;
+		const byte* refSlotMap;
+		if (!TakeSection(cur, entryEnd, entry->methodKeySize, 1, methodKey)
+			|| !TakeSection(cur, entryEnd, entry->codeLength, 1, codes)
+			|| !TakeSection(cur, entryEnd, entry->resolveDataCount, sizeof(uint64_t), rawResolveDatas)
+			|| !TakeSection(cur, entryEnd, entry->argCount, sizeof(MethodArgDesc), args)
+			|| !TakeSection(cur, entryEnd, entry->exClauseCount, sizeof(InterpExceptionClause), rawExClauses)
+			|| !TakeSection(cur, entryEnd, entry->osrEntryCount, sizeof(OsrEntry), osrEntries)
+			|| !TakeSection(cur, entryEnd, entry->evalStackBaseOffset / 8 + (entry->evalStackBaseOffset % 8 != 0), 1, refSlotMap)
+			|| entry->codeLength == 0 || entry->evalStackBaseOffset > entry->maxStackSize
+			|| entry->localVarBaseOffset > entry->evalStackBaseOffset)
+		{
+			return nullptr;
+		}
+
+		SymbolReader reader(cur, entryEnd);
+		std::vector<uint64_t> resolveDatas((const uint64_t*)rawResolveDatas, (const uint64_t*)rawResolveDatas + entry->resolveDataCount);
+		for (uint64_t& data : resolveDatas)
+		{
+			if (!ReadResolveData(reader, data))
+			{
+				return nullptr;
+			}
+		}
+		std::vector<InterpExceptionClause> exClauses((const InterpExceptionClause*)rawExClauses, (const InterpExceptionClause*)rawExClauses + entry->exClauseCount);
+		for (InterpExceptionClause& clause : exClauses)
+		{
+			uint8_t hasExKlass;
+			if (!reader.ReadU8(hasExKlass) || (hasExKlass && !(clause.exKlass = reader.ReadClass())))
+			{
+				return nullptr;
+			}
+		}
+		uint32_t assumptionCount;
+		if (!reader.ReadU32(assumptionCount))
+		{
+			return nullptr;
+		}
+		for (uint32_t i = 0; i < assumptionCount; i++)
+		{
+			Il2CppClass* klass = reader.ReadClass();
+			if (!klass)
+			{
+				return nullptr;
+			}
+			noSubclassAssumptions.push_back(klass);
+		}
+
+		// every section is copied, an unpublished result is freed like a transformed one, see HiTransform.
+		// codes are quickened at runtime, the file data is kept untouched so it can be written back on save.
+		InterpMethodInfo* imi = new (HYBRIDCLR_MALLOC(sizeof(InterpMethodInfo))) InterpMethodInfo();
+		imi->codes = (byte*)CopySection(codes, entry->codeLength);
+		imi->codeLength = entry->codeLength;
+		imi->args = (MethodArgDesc*)CopySection(args, entry->argCount * sizeof(MethodArgDesc));
+		imi->argCount = entry->argCount;
+		imi->argStackObjectSize = entry->argStackObjectSize;
+		imi->retStackObjectSize = entry->retStackObjectSize;
+		imi->initLocals = entry->initLocals;
+		imi->localStackSize = entry->localStackSize;
+		imi->maxStackSize = entry->maxStackSize;
+		imi->localVarBaseOffset = entry->localVarBaseOffset;
+		imi->evalStackBaseOffset = entry->evalStackBaseOffset;
+		imi->resolveDatas = (uint64_t*)CopySection(resolveDatas.data(), resolveDatas.size() * sizeof(uint64_t));
+		imi->exClauses = (const InterpExceptionClause*)CopySection(exClauses.data(), exClauses.size() * sizeof(InterpExceptionClause));
+		imi->exClauseCount = entry->exClauseCount;
+		// only optimized code is cached
+		imi->tier = interpreter::ExecutionTier::Optimized;
+		imi->callCountdown = 0;
+		imi->backEdgeCountdown = 0;
+		imi->osrEntries = (const OsrEntry*)CopySection(osrEntries, entry->osrEntryCount * sizeof(OsrEntry));
+		imi->osrEntryCount = entry->osrEntryCount;
+		imi->refSlotMap = (const uint8_t*)CopySection(refSlotMap, (entry->evalStackBaseOffset + 7) / 8);
+		return imi;
+	}
+
+#pragma endregion
+
+	void TransformCache::SetCacheDirectory(const char* dir)
+	{
+		il2cpp::os::FastAutoLock lock(&s_transformCacheLock);
+		s_cacheDirectory = dir ? dir : "";
+		// loaded from the old directory. entries not saved yet are dropped.
+		for (auto& e : s_imageCaches)
+		{
+			FreeImageCache(e.second);
+		}
+		s_imageCaches.clear();
+	}
+
+	bool TransformCache::IsEnabled()
+	{
+		il2cpp::os::FastAutoLock lock(&s_transformCacheLock);
+		return !s_cacheDirectory.empty();
+	}
+
+	bool TransformCache::IsCacheable(metadata::Image* image)
+	{
+		// il mappers of pdb aren't saved, methods of images with pdb are always transformed to keep stack traces
+		return IsEnabled() && metadata::IsInterpreterImage(image->GetIl2CppImage()) && !image->GetPDBImage();
+	}
+
+	uint64_t TransformCache::GetRuntimeHash(const MethodInfo* methodInfo)
+	{
+		return transform::GetRuntimeHash(metadata::MetadataModule::GetUnderlyingInterpreterImage(methodInfo));
+	}
+
+	InterpMethodInfo* TransformCache::TryLoad(const MethodInfo* methodInfo, std::vector<const Il2CppClass*>& noSubclassAssumptions)
+	{
+		metadata::Image* image = metadata::MetadataModule::GetUnderlyingInterpreterImage(methodInfo);
+		std::string methodKey;
+		SymbolWriter keyWriter(methodKey);
+		if (!keyWriter.WriteMethod(methodInfo))
+		{
+			return nullptr;
+		}
+		uint64_t runtimeHash = transform::GetRuntimeHash(image);
+
+		// loaded under s_transformCacheLock, SetCacheDirectory frees the file data. symbols are resolved with
+		// g_MetadataLock, which the caller already holds, see HiTransform::Translate.
+		il2cpp::os::FastAutoLock lock(&s_transformCacheLock);
+		ImageTransformCache* cache = GetOrLoadImageCache(image);
+		auto it = cache->loadedEntries.find(methodKey);
+		if (it == cache->loadedEntries.end() || it->second->runtimeHash != runtimeHash)
+		{
+			return nullptr;
+		}
+		const TransformCacheEntryHeader* entry = it->second;
+		if (entry->contentHash != ComputeEntryContentHash(entry))
+		{
+			// corrupted, not written back on save
+			cache->loadedEntries.erase(it);
+			return nullptr;
+		}
+
+		try
+		{
+			return LoadEntry(entry, noSubclassAssumptions);
+		}
+		catch (Il2CppExceptionWrapper&)
+		{
+			// a referenced type fails to load, transform the method instead
+			noSubclassAssumptions.clear();
+			return nullptr;
+		}
+	}
+
+	std::string TransformCache::Serialize(const MethodInfo* methodInfo, uint64_t runtimeHash, const InterpMethodInfo& imi, uint32_t resolveDataCount, const ResolveDataSymbols& symbols, const std::vector<const Il2CppClass*>& noSubclassAssumptions)
+	{
+		IL2CPP_ASSERT(symbols.symbols.size() <= resolveDataCount);
+		if (symbols.hasUnsupportedData)
+		{
+			return std::string();
+		}
+		std::string entry(sizeof(TransformCacheEntryHeader), '\0');
+		SymbolWriter writer(entry);
+		if (!writer.WriteMethod(methodInfo))
+		{
+			return std::string();
+		}
+		uint32_t methodKeySize = (uint32_t)(entry.size() - sizeof(TransformCacheEntryHeader));
+		writer.Align();
+
+		writer.WriteBytes(imi.codes, imi.codeLength);
+		writer.Align();
+		// pointers are resolved again on load, zero them to keep the file deterministic
+		for (uint32_t i = 0; i < resolveDataCount; i++)
+		{
+			bool isRawData = i >= symbols.symbols.size() || symbols.symbols[i].type == ResolveDataSymbolType::RawData;
+			writer.WriteBytes(isRawData ? &imi.resolveDatas[i] : &kZeroResolveData, sizeof(uint64_t));
+		}
+		writer.WriteBytes(imi.args, imi.argCount * sizeof(MethodArgDesc));
+		writer.Align();
+		for (uint32_t i = 0; i < imi.exClauseCount; i++)
+		{
+			InterpExceptionClause clause = imi.exClauses[i];
+			clause.exKlass = nullptr;
+			writer.WriteBytes(&clause, sizeof(InterpExceptionClause));
+		}
+		writer.Align();
+		writer.WriteBytes(imi.osrEntries, imi.osrEntryCount * sizeof(OsrEntry));
+		writer.Align();
+		writer.WriteBytes(imi.refSlotMap, (imi.evalStackBaseOffset + 7) / 8);
+		writer.Align();
+
+		for (uint32_t i = 0; i < resolveDataCount; i++)
+		{
+			if (i >= symbols.symbols.size())
+			{
+				writer.WriteU8((uint8_t)ResolveDataSymbolType::RawData);
+			}
+			else if (!WriteResolveDataSymbol(writer, symbols.symbols[i]))
+			{
+				return std::string();
+			}
+		}
+		for (uint32_t i = 0; i < imi.exClauseCount; i++)
+		{
+			const Il2CppClass* exKlass = imi.exClauses[i].exKlass;
+			writer.WriteU8(exKlass != nullptr);
+			if (exKlass && !writer.WriteClass(exKlass))
+			{
+				return std::string();
+			}
+		}
+		writer.WriteU32((uint32_t)noSubclassAssumptions.size());
+		for (const Il2CppClass* klass : noSubclassAssumptions)
+		{
+			if (!writer.WriteClass(klass))
+			{
+				return std::string();
+			}
+		}
+		writer.Align();
+
+		TransformCacheEntryHeader* header = (TransformCacheEntryHeader*)&entry[0];
+		header->runtimeHash = runtimeHash;
+		header->entrySize = (uint32_t)entry.size();
+		header->methodKeySize = methodKeySize;
+		header->codeLength = imi.codeLength;
+		header->resolveDataCount = resolveDataCount;
+		header->argCount = imi.argCount;
+		header->exClauseCount = imi.exClauseCount;
+		header->argStackObjectSize = imi.argStackObjectSize;
+		header->retStackObjectSize = imi.retStackObjectSize;
+		header->initLocals = imi.initLocals;
+		header->localStackSize = imi.localStackSize;
+		header->maxStackSize = imi.maxStackSize;
+		header->localVarBaseOffset = imi.localVarBaseOffset;
+		header->evalStackBaseOffset = imi.evalStackBaseOffset;
+		header->osrEntryCount = imi.osrEntryCount;
+		header->contentHash = ComputeEntryContentHash(header);
+		return entry;
+	}
+
+	void TransformCache::Add(const MethodInfo* methodInfo, std::string&& entry)
+	{
+		const TransformCacheEntryHeader* header = (const TransformCacheEntryHeader*)entry.data();
+		std::string methodKey(entry.data() + sizeof(TransformCacheEntryHeader), header->methodKeySize);
+		const metadata::Image* image = metadata::MetadataModule::GetUnderlyingInterpreterImage(methodInfo);
+
+		il2cpp::os::FastAutoLock lock(&s_transformCacheLock);
+		ImageTransformCache* cache = GetOrLoadImageCache(image);
+		cache->newEntries[methodKey] = std::move(entry);
+	}
+
+	bool TransformCache::Save()
+	{
+		il2cpp::os::FastAutoLock lock(&s_transformCacheLock);
+		bool success = true;
+		for (auto& imageCache : s_imageCaches)
+		{
+			const metadata::Image* image = imageCache.first;
+			ImageTransformCache* cache = imageCache.second;
+			if (cache->newEntries.empty())
+			{
+				continue;
+			}
+			std::string tmpPath = cache->filePath + ".tmp";
+			FILE* fp = std::fopen(tmpPath.c_str(), "wb");
+			if (!fp)
+			{
+				success = false;
+				continue;
+			}
+			TransformCacheFileHeader header = {};
+			header.magic = kTransformCacheMagic;
+			header.formatVersion = kTransformCacheFormatVersion;
+			std::memcpy(header.mvid, image->GetModuleVersionId(), 16);
+			header.entryCount = (uint32_t)cache->newEntries.size();
+			// loaded entries of other runtime hashes are kept too, e.g. for another value of an option
+			for (auto& e : cache->loadedEntries)
+			{
+				if (cache->newEntries.find(e.first) == cache->newEntries.end())
+				{
+					++header.entryCount;
+				}
+			}
+			bool writeOk = std::fwrite(&header, sizeof(header), 1, fp) == 1;
+			for (auto& e : cache->loadedEntries)
+			{
+				if (cache->newEntries.find(e.first) == cache->newEntries.end())
+				{
+					writeOk = writeOk && std::fwrite(e.second, e.second->entrySize, 1, fp) == 1;
+				}
+			}
+			for (auto& e : cache->newEntries)
+			{
+				writeOk = writeOk && std::fwrite(e.second.data(), e.second.size(), 1, fp) == 1;
+			}
+			writeOk = std::fclose(fp) == 0 && writeOk;
+			std::remove(cache->filePath.c_str());
+			if (!writeOk || std::rename(tmpPath.c_str(), cache->filePath.c_str()) != 0)
+			{
+				std::remove(tmpPath.c_str());
+				success = false;
+			}
+		}
+		return success;
+	}
+}
+}
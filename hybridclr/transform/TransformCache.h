@@ -0,0 +1,74 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../CommonDef.h"
+#include "../interpreter/InterpreterDefs.h"
+
+namespace hybridclr
+{
+namespace metadata
+{
+	class Image;
+}
+
+namespace transform
+{
+	enum class ResolveDataSymbolType : uint8_t
+	{
+		// data only used by the interpreter itself, such as switch offsets and arg indexes. saved as is.
+		RawData,
+		Class,
+		Method,
+		StaticFieldData,
+		UserString,
+		Managed2NativeMethod,
+		StaticManaged2NativeMethod,
+		// the method is saved in the first slot, other slots are filled at runtime
+		VirtualCallInlineCache,
+	};
+
+	struct ResolveDataSymbol
+	{
+		ResolveDataSymbolType type;
+		// Il2CppClass, MethodInfo, FieldInfo or metadata::Image of user string
+		const void* target;
+		uint32_t userStringIndex;
+	};
+
+	// symbolic description of InterpMethodInfo::resolveDatas, filled by TransformContext when the transform cache is enabled.
+	// resolve datas without symbol are RawData.
+	struct ResolveDataSymbols
+	{
+		std::vector<ResolveDataSymbol> symbols;
+		// some runtime pointer can't be described by symbols, such as pinvoke method pointers. the method is not cached.
+		bool hasUnsupportedData;
+	};
+
+	// persistent cache of transformed methods, so that methods aren't transformed again on next start.
+	// there's one file per interpreter assembly, keyed by mvid of the assembly. every entry keeps a hash of
+	// the runtime it was transformed with, which covers the IR format, transform options and the assemblies
+	// the image may refer to, and a hash of its content. entries are checked against both when loaded.
+	// IR codes and arg descs are position independent and saved as is, pointers in resolve datas and
+	// exception clauses are saved as symbols and resolved again on load.
+	class TransformCache
+	{
+	public:
+		// empty or null dir disables the cache
+		static void SetCacheDirectory(const char* dir);
+		static bool IsEnabled();
+		static bool IsCacheable(metadata::Image* image);
+
+		// taken before the method is transformed, options may change meanwhile
+		static uint64_t GetRuntimeHash(const MethodInfo* methodInfo);
+		static interpreter::InterpMethodInfo* TryLoad(const MethodInfo* methodInfo, std::vector<const Il2CppClass*>& noSubclassAssumptions);
+		// returns empty string if the method can't be saved
+		static std::string Serialize(const MethodInfo* methodInfo, uint64_t runtimeHash, const interpreter::InterpMethodInfo& imi, uint32_t resolveDataCount, const ResolveDataSymbols& symbols, const std::vector<const Il2CppClass*>& noSubclassAssumptions);
+		static void Add(const MethodInfo* methodInfo, std::string&& entry);
+
+		// write all cached methods of loaded assemblies to files. returns false if any file fails to write.
+		static bool Save();
+	};
+}
+}
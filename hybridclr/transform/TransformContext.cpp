@@ -24,22 +24,6 @@ namespace transform
 	constexpr int32_t MAX_STACK_SIZE = (2 << 16) - 1;
 	constexpr int32_t MAX_VALUE_TYPE_SIZE = (2 << 16) - 1;
 
-	template<typename T>
-	void AllocResolvedData(il2cpp::utils::dynamic_array<uint64_t>& resolvedDatas, int32_t size, int32_t& index, T*& buf)
-	{
-		if (size > 0)
-		{
-			int32_t oldSize = index = (int32_t)resolvedDatas.size();
-			resolvedDatas.resize_initialized(oldSize + size);
-			buf = (T*)&resolvedDatas[oldSize];
-		}
-		else
-		{
-			index = 0;
-			buf = nullptr;
-		}
-	}
-
 	IRCommon* CreateInitLocals(TemporaryMemoryArena& pool, uint32_t size, int32_t offset)
 	{
 		if (size > 32)
@@ -1157,10 +1141,13 @@ namespace transform
 
 	TransformContext::TransformContext(hybridclr::metadata::Image* image, const MethodInfo* methodInfo, metadata::MethodBody& body, TemporaryMemoryArena& pool, il2cpp::utils::dynamic_array<uint64_t>& resolveDatas)
 		: image(image), methodInfo(methodInfo), body(body), pool(pool), resolveDatas(resolveDatas),
+		splitOffsets(std::less<uint32_t>(), TemporaryMemoryArenaAllocator<uint32_t>(pool)),
+		pendingFlows(TemporaryMemoryArenaAllocator<FlowInfo*>(pool)), irbbs(TemporaryMemoryArenaAllocator<IRBasicBlock*>(pool)),
 		actualParamCount(0), ip2bb(nullptr), curbb(nullptr), args(nullptr), locals(nullptr), evalStack(nullptr),
-		evalStackTop(0), evalStackBaseOffset(0), curStackSize(0), maxStackSize(0),
-		nextFlowIdx(0), ipBase(nullptr), ip(nullptr), ipOffset(0), ir2offsetMap(nullptr),
-		prefixFlags(0), shareMethod(nullptr), totalIRSize(0), totalArgSize(0), totalArgLocalSize(0), initLocals(false)
+		evalStackTop(0), evalStackBaseOffset(0), curStackSize(0), maxStackSize(0), maxBasicBlockEntryStackSize(0),
+		resolveDataSymbols(nullptr), nextFlowIdx(0), ipBase(nullptr), ip(nullptr), ipOffset(0), ir2offsetMap(nullptr),
+		prefixFlags(0), shareMethod(nullptr), totalIRSize(0), totalArgSize(0), totalArgLocalSize(0), initLocals(false),
+		executionTier(interpreter::ExecutionTier::Optimized), markLoopHeaders(false)
 	{
 
 	}
@@ -1177,7 +1164,21 @@ namespace transform
 		}
 	}
 
-	uint32_t TransformContext::GetOrAddResolveDataIndex(const void* ptr)
+	void TransformContext::SetResolveDataSymbol(uint32_t index, ResolveDataSymbolType symbolType, const void* symbolTarget, uint32_t userStringIndex)
+	{
+		if (!resolveDataSymbols)
+		{
+			return;
+		}
+		std::vector<ResolveDataSymbol>& symbols = resolveDataSymbols->symbols;
+		if (symbols.size() <= index)
+		{
+			symbols.resize(index + 1, { ResolveDataSymbolType::RawData, nullptr, 0 });
+		}
+		symbols[index] = { symbolType, symbolTarget, userStringIndex };
+	}
+
+	uint32_t TransformContext::GetOrAddResolveDataIndex(const void* ptr, ResolveDataSymbolType symbolType, const void* symbolTarget, uint32_t userStringIndex)
 	{
 		auto it = ptr2DataIdxs.find(ptr);
 		if (it != ptr2DataIdxs.end())
@@ -1189,10 +1190,66 @@ namespace transform
 			uint32_t newIndex = (uint32_t)resolveDatas.size();
 			resolveDatas.push_back((uint64_t)ptr);
 			ptr2DataIdxs.insert({ ptr, newIndex });
+			SetResolveDataSymbol(newIndex, symbolType, symbolTarget, userStringIndex);
 			return newIndex;
 		}
 	}
 
+	uint32_t TransformContext::GetOrAddResolveDataIndex(const void* ptr)
+	{
+		MarkNotCacheable();
+		return GetOrAddResolveDataIndex(ptr, ResolveDataSymbolType::RawData, nullptr, 0);
+	}
+
+	uint32_t TransformContext::GetOrAddResolveDataIndex(const Il2CppClass* klass)
+	{
+		return GetOrAddResolveDataIndex(klass, ResolveDataSymbolType::Class, klass, 0);
+	}
+
+	uint32_t TransformContext::GetOrAddResolveDataIndex(const MethodInfo* method)
+	{
+		return GetOrAddResolveDataIndex(method, ResolveDataSymbolType::Method, method, 0);
+	}
+
+	uint32_t TransformContext::GetOrAddUserStringResolveDataIndex(uint32_t userStringIndex)
+	{
+		Il2CppString* str = image->GetIl2CppUserStringFromRawIndex(userStringIndex);
+		return GetOrAddResolveDataIndex(str, ResolveDataSymbolType::UserString, image, userStringIndex);
+	}
+
+	uint32_t TransformContext::GetOrAddStaticFieldDataResolveDataIndex(const FieldInfo* field)
+	{
+		return GetOrAddResolveDataIndex(il2cpp::vm::Field::GetData(const_cast<FieldInfo*>(field)), ResolveDataSymbolType::StaticFieldData, field, 0);
+	}
+
+	uint32_t TransformContext::GetOrAddManaged2NativeResolveDataIndex(const MethodInfo* method, bool forceStatic)
+	{
+		Managed2NativeCallMethod managed2NativeMethod = InterpreterModule::GetManaged2NativeMethodPointer(method, forceStatic);
+		IL2CPP_ASSERT(managed2NativeMethod);
+		return GetOrAddResolveDataIndex((const void*)managed2NativeMethod,
+			forceStatic ? ResolveDataSymbolType::StaticManaged2NativeMethod : ResolveDataSymbolType::Managed2NativeMethod, method, 0);
+	}
+
+	uint32_t TransformContext::AllocVirtualCallInlineCache(const MethodInfo* method)
+	{
+		// never shared between call sites, so every site has its own cache.
+		int32_t index;
+		interpreter::VirtualCallInlineCache* cache;
+		AllocResolvedData(resolveDatas, interpreter::kVirtualCallInlineCacheResolveDataSlotCount, index, cache);
+		cache->method = method;
+		SetResolveDataSymbol((uint32_t)index, ResolveDataSymbolType::VirtualCallInlineCache, method, 0);
+		return (uint32_t)index;
+	}
+
+	uint32_t TransformContext::AllocArrayStoreTypeCheckCache()
+	{
+		// filled at runtime, the zeroed slots are saved as raw data
+		int32_t index;
+		interpreter::ArrayStoreTypeCheckCache* cache;
+		AllocResolvedData(resolveDatas, interpreter::kArrayStoreTypeCheckCacheResolveDataSlotCount, index, cache);
+		return (uint32_t)index;
+	}
+
 	void TransformContext::PushStackByType(const Il2CppType* type)
 	{
 		int32_t byteSize = GetTypeValueSize(type);
@@ -1200,6 +1257,8 @@ namespace transform
 		evalStack[evalStackTop].reduceType = GetEvalStackReduceDataType(type);
 		evalStack[evalStackTop].byteSize = byteSize;
 		evalStack[evalStackTop].locOffset = GetEvalStackNewTopOffset();
+		evalStack[evalStackTop].type = type;
+		evalStack[evalStackTop].exactType = false;
 		evalStackTop++;
 		curStackSize += stackSize;
 		maxStackSize = std::max(curStackSize, maxStackSize);
@@ -1213,6 +1272,8 @@ namespace transform
 		evalStack[evalStackTop].reduceType = t;
 		evalStack[evalStackTop].byteSize = byteSize;
 		evalStack[evalStackTop].locOffset = GetEvalStackNewTopOffset();
+		evalStack[evalStackTop].type = nullptr;
+		evalStack[evalStackTop].exactType = false;
 		evalStackTop++; curStackSize += stackSize;
 		maxStackSize = std::max(curStackSize, maxStackSize);
 		IL2CPP_ASSERT(maxStackSize < MAX_STACK_SIZE);
@@ -1227,6 +1288,8 @@ namespace transform
 		newTop.reduceType = oldTop.reduceType;
 		newTop.byteSize = oldTop.byteSize;
 		newTop.locOffset = curStackSize;
+		newTop.type = oldTop.type;
+		newTop.exactType = oldTop.exactType;
 		curStackSize += stackSize;
 		maxStackSize = std::max(curStackSize, maxStackSize);
 		IL2CPP_ASSERT(maxStackSize < MAX_STACK_SIZE);
@@ -1303,13 +1366,17 @@ namespace transform
 	void TransformContext::PushOffset(int32_t* offsetPtr)
 	{
 		IL2CPP_ASSERT(splitOffsets.find(*(offsetPtr)) != splitOffsets.end());
-		relocationOffsets.push_back(offsetPtr);
+		relocationOffsets.push_back({ offsetPtr, ip2bb[*offsetPtr] });
 	}
 
 	void TransformContext::PushBranch(int32_t targetOffset)
 	{
 		IL2CPP_ASSERT(splitOffsets.find(targetOffset) != splitOffsets.end());
 		IRBasicBlock* targetBb = ip2bb[targetOffset];
+		if (markLoopHeaders && targetOffset <= (int32_t)ipOffset && evalStackTop == 0)
+		{
+			targetBb->loopHeader = true;
+		}
 		if (!targetBb->inPending)
 		{
 			targetBb->inPending = true;
@@ -1513,6 +1580,158 @@ namespace transform
 		PushBranch(targetOffset);
 	}
 
+	// `ldc; binop/compare/branch` => `xxxVarConst` when the constant is the second operand.
+	static HiOpcodeEnum GetVarConstOpcode(HiOpcodeEnum varVarOp)
+	{
+		switch (varVarOp)
+		{
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i4: return HiOpcodeEnum::BinOpVarVarConst_Add_i4;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i4: return HiOpcodeEnum::BinOpVarVarConst_Sub_i4;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i4: return HiOpcodeEnum::BinOpVarVarConst_Mul_i4;
+		case HiOpcodeEnum::BinOpVarVarVar_And_i4: return HiOpcodeEnum::BinOpVarVarConst_And_i4;
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i4: return HiOpcodeEnum::BinOpVarVarConst_Or_i4;
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i4: return HiOpcodeEnum::BinOpVarVarConst_Xor_i4;
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i8: return HiOpcodeEnum::BinOpVarVarConst_Add_i8;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i8: return HiOpcodeEnum::BinOpVarVarConst_Sub_i8;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i8: return HiOpcodeEnum::BinOpVarVarConst_Mul_i8;
+		case HiOpcodeEnum::BinOpVarVarVar_And_i8: return HiOpcodeEnum::BinOpVarVarConst_And_i8;
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i8: return HiOpcodeEnum::BinOpVarVarConst_Or_i8;
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i8: return HiOpcodeEnum::BinOpVarVarConst_Xor_i8;
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f4: return HiOpcodeEnum::BinOpVarVarConst_Add_f4;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f4: return HiOpcodeEnum::BinOpVarVarConst_Sub_f4;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f4: return HiOpcodeEnum::BinOpVarVarConst_Mul_f4;
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f8: return HiOpcodeEnum::BinOpVarVarConst_Add_f8;
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f8: return HiOpcodeEnum::BinOpVarVarConst_Sub_f8;
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f8: return HiOpcodeEnum::BinOpVarVarConst_Mul_f8;
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i4: return HiOpcodeEnum::CompOpVarVarConst_Ceq_i4;
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i8: return HiOpcodeEnum::CompOpVarVarConst_Ceq_i8;
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f4: return HiOpcodeEnum::CompOpVarVarConst_Ceq_f4;
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f8: return HiOpcodeEnum::CompOpVarVarConst_Ceq_f8;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i4: return HiOpcodeEnum::CompOpVarVarConst_Cgt_i4;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i8: return HiOpcodeEnum::CompOpVarVarConst_Cgt_i8;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f4: return HiOpcodeEnum::CompOpVarVarConst_Cgt_f4;
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f8: return HiOpcodeEnum::CompOpVarVarConst_Cgt_f8;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i4: return HiOpcodeEnum::CompOpVarVarConst_CgtUn_i4;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i8: return HiOpcodeEnum::CompOpVarVarConst_CgtUn_i8;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f4: return HiOpcodeEnum::CompOpVarVarConst_CgtUn_f4;
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f8: return HiOpcodeEnum::CompOpVarVarConst_CgtUn_f8;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i4: return HiOpcodeEnum::CompOpVarVarConst_Clt_i4;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i8: return HiOpcodeEnum::CompOpVarVarConst_Clt_i8;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f4: return HiOpcodeEnum::CompOpVarVarConst_Clt_f4;
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f8: return HiOpcodeEnum::CompOpVarVarConst_Clt_f8;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i4: return HiOpcodeEnum::CompOpVarVarConst_CltUn_i4;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i8: return HiOpcodeEnum::CompOpVarVarConst_CltUn_i8;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f4: return HiOpcodeEnum::CompOpVarVarConst_CltUn_f4;
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f8: return HiOpcodeEnum::CompOpVarVarConst_CltUn_f8;
+		case HiOpcodeEnum::BranchVarVar_Ceq_i4: return HiOpcodeEnum::BranchVarConst_Ceq_i4;
+		case HiOpcodeEnum::BranchVarVar_Ceq_i8: return HiOpcodeEnum::BranchVarConst_Ceq_i8;
+		case HiOpcodeEnum::BranchVarVar_Ceq_f4: return HiOpcodeEnum::BranchVarConst_Ceq_f4;
+		case HiOpcodeEnum::BranchVarVar_Ceq_f8: return HiOpcodeEnum::BranchVarConst_Ceq_f8;
+		case HiOpcodeEnum::BranchVarVar_CneUn_i4: return HiOpcodeEnum::BranchVarConst_CneUn_i4;
+		case HiOpcodeEnum::BranchVarVar_CneUn_i8: return HiOpcodeEnum::BranchVarConst_CneUn_i8;
+		case HiOpcodeEnum::BranchVarVar_CneUn_f4: return HiOpcodeEnum::BranchVarConst_CneUn_f4;
+		case HiOpcodeEnum::BranchVarVar_CneUn_f8: return HiOpcodeEnum::BranchVarConst_CneUn_f8;
+		case HiOpcodeEnum::BranchVarVar_Cgt_i4: return HiOpcodeEnum::BranchVarConst_Cgt_i4;
+		case HiOpcodeEnum::BranchVarVar_Cgt_i8: return HiOpcodeEnum::BranchVarConst_Cgt_i8;
+		case HiOpcodeEnum::BranchVarVar_Cgt_f4: return HiOpcodeEnum::BranchVarConst_Cgt_f4;
+		case HiOpcodeEnum::BranchVarVar_Cgt_f8: return HiOpcodeEnum::BranchVarConst_Cgt_f8;
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i4: return HiOpcodeEnum::BranchVarConst_CgtUn_i4;
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i8: return HiOpcodeEnum::BranchVarConst_CgtUn_i8;
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f4: return HiOpcodeEnum::BranchVarConst_CgtUn_f4;
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f8: return HiOpcodeEnum::BranchVarConst_CgtUn_f8;
+		case HiOpcodeEnum::BranchVarVar_Cge_i4: return HiOpcodeEnum::BranchVarConst_Cge_i4;
+		case HiOpcodeEnum::BranchVarVar_Cge_i8: return HiOpcodeEnum::BranchVarConst_Cge_i8;
+		case HiOpcodeEnum::BranchVarVar_Cge_f4: return HiOpcodeEnum::BranchVarConst_Cge_f4;
+		case HiOpcodeEnum::BranchVarVar_Cge_f8: return HiOpcodeEnum::BranchVarConst_Cge_f8;
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i4: return HiOpcodeEnum::BranchVarConst_CgeUn_i4;
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i8: return HiOpcodeEnum::BranchVarConst_CgeUn_i8;
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f4: return HiOpcodeEnum::BranchVarConst_CgeUn_f4;
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f8: return HiOpcodeEnum::BranchVarConst_CgeUn_f8;
+		case HiOpcodeEnum::BranchVarVar_Clt_i4: return HiOpcodeEnum::BranchVarConst_Clt_i4;
+		case HiOpcodeEnum::BranchVarVar_Clt_i8: return HiOpcodeEnum::BranchVarConst_Clt_i8;
+		case HiOpcodeEnum::BranchVarVar_Clt_f4: return HiOpcodeEnum::BranchVarConst_Clt_f4;
+		case HiOpcodeEnum::BranchVarVar_Clt_f8: return HiOpcodeEnum::BranchVarConst_Clt_f8;
+		case HiOpcodeEnum::BranchVarVar_CltUn_i4: return HiOpcodeEnum::BranchVarConst_CltUn_i4;
+		case HiOpcodeEnum::BranchVarVar_CltUn_i8: return HiOpcodeEnum::BranchVarConst_CltUn_i8;
+		case HiOpcodeEnum::BranchVarVar_CltUn_f4: return HiOpcodeEnum::BranchVarConst_CltUn_f4;
+		case HiOpcodeEnum::BranchVarVar_CltUn_f8: return HiOpcodeEnum::BranchVarConst_CltUn_f8;
+		case HiOpcodeEnum::BranchVarVar_Cle_i4: return HiOpcodeEnum::BranchVarConst_Cle_i4;
+		case HiOpcodeEnum::BranchVarVar_Cle_i8: return HiOpcodeEnum::BranchVarConst_Cle_i8;
+		case HiOpcodeEnum::BranchVarVar_Cle_f4: return HiOpcodeEnum::BranchVarConst_Cle_f4;
+		case HiOpcodeEnum::BranchVarVar_Cle_f8: return HiOpcodeEnum::BranchVarConst_Cle_f8;
+		case HiOpcodeEnum::BranchVarVar_CleUn_i4: return HiOpcodeEnum::BranchVarConst_CleUn_i4;
+		case HiOpcodeEnum::BranchVarVar_CleUn_i8: return HiOpcodeEnum::BranchVarConst_CleUn_i8;
+		case HiOpcodeEnum::BranchVarVar_CleUn_f4: return HiOpcodeEnum::BranchVarConst_CleUn_f4;
+		case HiOpcodeEnum::BranchVarVar_CleUn_f8: return HiOpcodeEnum::BranchVarConst_CleUn_f8;
+		default: return HiOpcodeEnum::None;
+		}
+	}
+
+	bool TransformContext::TryRemoveLastLdc(const EvalStackVarInfo& var, int64_t& value)
+	{
+		IRCommon* lastIR = GetLastInstrument();
+		if (lastIR == nullptr)
+		{
+			return false;
+		}
+		switch (lastIR->type)
+		{
+		case HiOpcodeEnum::LdcVarConst_4:
+		{
+			IRLdcVarConst_4* ldc = (IRLdcVarConst_4*)lastIR;
+			if (ldc->dst != var.locOffset || var.byteSize != 4)
+			{
+				return false;
+			}
+			value = (int32_t)ldc->src;
+			break;
+		}
+		case HiOpcodeEnum::LdcVarConst_8:
+		{
+			IRLdcVarConst_8* ldc = (IRLdcVarConst_8*)lastIR;
+			if (ldc->dst != var.locOffset || var.byteSize != 8)
+			{
+				return false;
+			}
+			value = (int64_t)ldc->src;
+			break;
+		}
+		default:
+			return false;
+		}
+		RemoveLastInstrument();
+		return true;
+	}
+
+	IRCommon* TransformContext::TryCreateVarVarConstIR(HiOpcodeEnum varVarOp, int32_t retOffset, const EvalStackVarInfo& op1, const EvalStackVarInfo& op2)
+	{
+		HiOpcodeEnum constOp = GetVarConstOpcode(varVarOp);
+		int64_t value;
+		if (constOp == HiOpcodeEnum::None || !TryRemoveLastLdc(op2, value))
+		{
+			return nullptr;
+		}
+		// BinOpVarVarConst and CompOpVarVarConst share the same layout, constant is stored after op1 at ip + 8.
+		if (op2.byteSize == 4)
+		{
+			CreateIR(ir, BinOpVarVarConst_Add_i4);
+			ir->type = constOp;
+			ir->ret = retOffset;
+			ir->op1 = op1.locOffset;
+			ir->op2 = (int32_t)value;
+			return ir;
+		}
+		else
+		{
+			CreateIR(ir, BinOpVarVarConst_Add_i8);
+			ir->type = constOp;
+			ir->ret = retOffset;
+			ir->op1 = op1.locOffset;
+			ir->op2 = value;
+			return ir;
+		}
+	}
+
 	void TransformContext::Add_bc(int32_t ipOffset, int32_t brOffset, int32_t opSize, HiOpcodeEnum opI4, HiOpcodeEnum opI8, HiOpcodeEnum opR4, HiOpcodeEnum opR8)
 	{
 		int32_t targetOffset = ipOffset + brOffset + opSize;
@@ -1523,7 +1742,6 @@ namespace transform
 		ir->op1 = op1.locOffset;
 		ir->op2 = op2.locOffset;
 		ir->offset = targetOffset;
-		PushOffset(&ir->offset);
 		switch (op1.reduceType)
 		{
 		case EvalStackReduceDataType::I4:
@@ -1595,7 +1813,36 @@ namespace transform
 			IL2CPP_ASSERT(false && "nothing match");
 		}
 		}
-		AddInst(ir);
+		HiOpcodeEnum constOp = GetVarConstOpcode(ir->type);
+		int64_t value;
+		if (constOp != HiOpcodeEnum::None && TryRemoveLastLdc(op2, value))
+		{
+			if (op2.byteSize == 4)
+			{
+				CreateIR(irConst, BranchVarConst_Ceq_i4);
+				irConst->type = constOp;
+				irConst->op1 = op1.locOffset;
+				irConst->op2 = (int32_t)value;
+				irConst->offset = targetOffset;
+				PushOffset(&irConst->offset);
+				AddInst(irConst);
+			}
+			else
+			{
+				CreateIR(irConst, BranchVarConst_Ceq_i8);
+				irConst->type = constOp;
+				irConst->op1 = op1.locOffset;
+				irConst->op2 = value;
+				irConst->offset = targetOffset;
+				PushOffset(&irConst->offset);
+				AddInst(irConst);
+			}
+		}
+		else
+		{
+			PushOffset(&ir->offset);
+			AddInst(ir);
+		}
 		PopStackN(2);
 		PushBranch(targetOffset);
 	}
@@ -1806,10 +2053,11 @@ namespace transform
 			break;
 		}
 		}
+		IRCommon* irConst = TryCreateVarVarConstIR(ir->type, op1.locOffset, op1, op2);
 		PopStack();
 		op1.reduceType = resultType;
 		op1.byteSize = GetSizeByReduceType(resultType);
-		AddInst(ir);
+		AddInst(irConst ? irConst : ir);
 		ip++;
 	}
 
@@ -1967,8 +2215,9 @@ namespace transform
 			break;
 		}
 		}
+		IRCommon* irConst = TryCreateVarVarConstIR(ir->type, op1.locOffset, op1, op2);
 		PopStackN(2);
-		AddInst(ir);
+		AddInst(irConst ? irConst : ir);
 		PushStackByReduceType(EvalStackReduceDataType::I4);
 	}
 
@@ -2006,6 +2255,68 @@ namespace transform
 		ip++;
 	}
 
+	// static class of a reference value, null if unknown
+	static Il2CppClass* GetStaticReferenceClass(const Il2CppType* type)
+	{
+		if (!type || type->byref)
+		{
+			return nullptr;
+		}
+		switch (type->type)
+		{
+		case IL2CPP_TYPE_CLASS:
+		case IL2CPP_TYPE_STRING:
+		case IL2CPP_TYPE_OBJECT:
+		case IL2CPP_TYPE_SZARRAY:
+		case IL2CPP_TYPE_ARRAY:
+		case IL2CPP_TYPE_GENERICINST:
+		{
+			Il2CppClass* klass = il2cpp::vm::Class::FromIl2CppType(type);
+			return klass && !klass->valuetype ? klass : nullptr;
+		}
+		default:
+		{
+			return nullptr;
+		}
+		}
+	}
+
+	// stelem.ref needs no element type check if the array is exactly T[] and the value is a T. the array is exactly T[]
+	// if it comes from newarr, or if no other array type converts to T[]: T is sealed, not an array and not generic,
+	// since generic delegates may be variant.
+	static bool IsArrayStoreTypeCheckRedundant(const EvalStackVarInfo& arr, const EvalStackVarInfo& ele)
+	{
+		if (!arr.type || arr.type->byref || arr.type->type != IL2CPP_TYPE_SZARRAY)
+		{
+			return false;
+		}
+		Il2CppClass* arrEleKlass = GetStaticReferenceClass(arr.type->data.type);
+		if (!arrEleKlass || arrEleKlass != GetStaticReferenceClass(ele.type))
+		{
+			return false;
+		}
+		return arr.exactType || ((arrEleKlass->flags & TYPE_ATTRIBUTE_SEALED) && arrEleKlass->rank == 0 && !arrEleKlass->generic_class);
+	}
+
+	void TransformContext::AddInst_stelem_ref(const EvalStackVarInfo& arr, const EvalStackVarInfo& index, const EvalStackVarInfo& ele)
+	{
+		if (IsArrayStoreTypeCheckRedundant(arr, ele))
+		{
+			CreateAddIR(ir, SetArrayElementVarVar_ref_NoTypeCheck);
+			ir->arr = arr.locOffset;
+			ir->index = index.locOffset;
+			ir->ele = ele.locOffset;
+		}
+		else
+		{
+			CreateAddIR(ir, SetArrayElementVarVar_ref);
+			ir->arr = arr.locOffset;
+			ir->index = index.locOffset;
+			ir->ele = ele.locOffset;
+			ir->typeCheckCache = AllocArrayStoreTypeCheckCache();
+		}
+	}
+
 	static int GetTypeSize(const Il2CppType* type)
 	{
 		if (type->byref)
@@ -2331,9 +2642,9 @@ else \
 		return nullptr;
 	}
 
-	static bool ShouldBeInlined(const MethodInfo* method, int32_t depth)
+	static bool ShouldBeInlined(const MethodInfo* method, int32_t depth, interpreter::ExecutionTier tier)
 	{
-		if (depth >= RuntimeConfig::GetMaxMethodInlineDepth())
+		if (tier == interpreter::ExecutionTier::Baseline || depth >= RuntimeConfig::GetMaxMethodInlineDepth())
 		{
 			return false;
 		}
@@ -2341,10 +2652,20 @@ else \
 	}
 
 
-	void TransformContext::TransformBody(int32_t depth, int32_t localVarOffset, interpreter::InterpMethodInfo& result)
+	void TransformContext::TranslateBody(interpreter::InterpMethodInfo& result)
+	{
+		TransformBodyImpl(0, 0);
+		BuildFrameInfo(result);
+	}
+
+	void TransformContext::LowerBody(interpreter::InterpMethodInfo& result)
 	{
-		TransformBodyImpl(depth, localVarOffset);
-		BuildInterpMethodInfo(result);
+		LayoutIR();
+		// opcode histogram must be collected on unmerged instructions
+#if !HYBRIDCLR_ENABLE_OPCODE_PROFILER
+		MergeSuperInstructions();
+#endif
+		BuildCode(result);
 	}
 
 	void TransformContext::TransformBodyImpl(int32_t depth, int32_t localVarOffset)
@@ -2361,7 +2682,8 @@ else \
 		bbc.SplitBasicBlocks();
 
 
-		splitOffsets = bbc.GetSplitOffsets();
+		const std::set<uint32_t>& bbSplitOffsets = bbc.GetSplitOffsets();
+		splitOffsets.insert(bbSplitOffsets.begin(), bbSplitOffsets.end());
 
 		ip2bb = pool.NewNAny<IRBasicBlock*>(body.codeSize + 1);
 		uint32_t lastSplitBegin = 0;
@@ -2438,6 +2760,7 @@ else \
 
 		maxStackSize = evalStackBaseOffset;
 		curStackSize = evalStackBaseOffset;
+		maxBasicBlockEntryStackSize = evalStackBaseOffset;
 
 
 
@@ -2458,6 +2781,7 @@ else \
 		Token2RuntimeHandleMap tokenCache(64);
 
 		bool inMethodInlining = depth > 0;
+		markLoopHeaders = !inMethodInlining;
 
 		hybridclr::metadata::PDBImage* pdbImage = image->GetPDBImage();
 		ir2offsetMap = pdbImage && !inMethodInlining ? new IR2OffsetMap(body.codeSize) : nullptr;
@@ -2478,6 +2802,7 @@ else \
 				{
 					CreateAddIR(irInitStaticCtor, InitClassStaticCtor);
 					irInitStaticCtor->klass = (uint64_t)methodInfo->klass;
+					MarkNotCacheable();
 				}
 			}
 		}
@@ -2591,6 +2916,13 @@ else \
 				{
 					curbb->visited = true;
 					lastBb = curbb;
+					maxBasicBlockEntryStackSize = std::max(maxBasicBlockEntryStackSize, curStackSize);
+					// other predecessors may push values of other types
+					for (int32_t i = 0; i < evalStackTop; i++)
+					{
+						evalStack[i].type = nullptr;
+						evalStack[i].exactType = false;
+					}
 				}
 				else
 				{
@@ -2944,7 +3276,7 @@ else \
 							}
 						}
 					}
-					else if (ShouldBeInlined(shareMethod, depth) && TransformSubMethodBody(*this, shareMethod, depth + 1, argBaseOffset))
+					else if (ShouldBeInlined(shareMethod, depth, executionTier) && TransformSubMethodBody(*this, shareMethod, depth + 1, argBaseOffset))
 					{
 
 					}
@@ -2983,9 +3315,7 @@ else \
 
 
 
-				Managed2NativeCallMethod managed2NativeMethod = InterpreterModule::GetManaged2NativeMethodPointer(shareMethod, false);
-				IL2CPP_ASSERT(managed2NativeMethod);
-				uint32_t managed2NativeMethodDataIdx = GetOrAddResolveDataIndex((void*)managed2NativeMethod);
+				uint32_t managed2NativeMethodDataIdx = GetOrAddManaged2NativeResolveDataIndex(shareMethod, false);
 
 				int32_t argIdxDataIndex;
 				uint16_t* __argIdxs;
@@ -3050,14 +3380,25 @@ else \
 			{
 				IL2CPP_ASSERT(shareMethod);
 				IL2CPP_ASSERT(hybridclr::metadata::IsInstanceMethod(shareMethod));
-				if ((!metadata::IsVirtualMethod(shareMethod->flags)) || metadata::IsSealed(shareMethod->flags))
+				bool needClassGuard = false;
+				if ((!metadata::IsVirtualMethod(shareMethod->flags)) || metadata::IsSealed(shareMethod->flags) || TryDevirtualizeCallVir(shareMethod, needClassGuard))
 				{
+					if (needClassGuard)
+					{
+						AddClassGuardedCall(shareMethod, depth);
+						continue;
+					}
+					if (IsInterpreterImplement(shareMethod) && !metadata::IsPInvokeMethod(shareMethod->flags) && ShouldBeInlined(shareMethod, depth, executionTier))
+					{
+						// callvirt throws on null this, an inlined body may never dereference it
+						CreateAddIR(ir, CheckThrowIfNullVar);
+						ir->obj = GetEvalStackOffset(evalStackTop - shareMethod->parameters_count - 1);
+					}
 					goto LabelCall;
 				}
 
 				int32_t resolvedTotalArgNum = shareMethod->parameters_count + 1;
 				int32_t callArgEvalStackIdxBase = evalStackTop - resolvedTotalArgNum;
-				uint32_t methodDataIndex = GetOrAddResolveDataIndex(shareMethod);
 
 				bool isMultiDelegate = IsChildTypeOfMulticastDelegate(shareMethod->klass);
 				if (!isMultiDelegate && IsInterpreterMethod(shareMethod) && !IsInterface(shareMethod->klass->flags))
@@ -3068,13 +3409,13 @@ else \
 					if (IsReturnVoidMethod(shareMethod))
 					{
 						CreateAddIR(ir, CallInterpVirtual_void);
-						ir->method = methodDataIndex;
+						ir->method = AllocVirtualCallInlineCache(shareMethod);
 						ir->argBase = argBaseOffset;
 					}
 					else
 					{
 						CreateAddIR(ir, CallInterpVirtual_ret);
-						ir->method = methodDataIndex;
+						ir->method = AllocVirtualCallInlineCache(shareMethod);
 						ir->argBase = argBaseOffset;
 						ir->ret = argBaseOffset;
 						PushStackByType(shareMethod->return_type);
@@ -3082,9 +3423,7 @@ else \
 					continue;
 				}
 
-				Managed2NativeCallMethod managed2NativeMethod = InterpreterModule::GetManaged2NativeMethodPointer(shareMethod, false);
-				IL2CPP_ASSERT(managed2NativeMethod);
-				uint32_t managed2NativeMethodDataIdx = GetOrAddResolveDataIndex((void*)managed2NativeMethod);
+				uint32_t managed2NativeMethodDataIdx = GetOrAddManaged2NativeResolveDataIndex(shareMethod, false);
 
 
 				int32_t needDataSlotNum = (resolvedTotalArgNum + 3) / 4;
@@ -3117,9 +3456,7 @@ else \
 				{
 					if (std::strcmp(shareMethod->name, "Invoke") == 0)
 					{
-						Managed2NativeCallMethod staticManaged2NativeMethod = InterpreterModule::GetManaged2NativeMethodPointer(shareMethod, true);
-						IL2CPP_ASSERT(staticManaged2NativeMethod);
-						uint32_t staticManaged2NativeMethodDataIdx = GetOrAddResolveDataIndex((void*)staticManaged2NativeMethod);
+						uint32_t staticManaged2NativeMethodDataIdx = GetOrAddManaged2NativeResolveDataIndex(shareMethod, true);
 						if (retIdx < 0)
 						{
 							CreateAddIR(ir, CallDelegateInvoke_void);
@@ -3155,6 +3492,7 @@ else \
 						continue;
 					}
 					Il2CppMethodPointer directlyCallMethodPointer = InitAndGetInterpreterDirectlyCallMethodPointer(shareMethod);
+					uint32_t methodDataIndex = GetOrAddResolveDataIndex(shareMethod);
 					if (std::strcmp(shareMethod->name, "BeginInvoke") == 0)
 					{
 						if (IsInterpreterMethod(shareMethod) || directlyCallMethodPointer == nullptr)
@@ -3192,7 +3530,7 @@ else \
 				{
 					CreateAddIR(ir, CallVirtual_void);
 					ir->managed2NativeMethod = managed2NativeMethodDataIdx;
-					ir->methodInfo = methodDataIndex;
+					ir->methodInfo = AllocVirtualCallInlineCache(shareMethod);
 					ir->argIdxs = argIdxDataIndex;
 				}
 				else
@@ -3202,7 +3540,7 @@ else \
 					{
 						CreateAddIR(ir, CallVirtual_ret_expand);
 						ir->managed2NativeMethod = managed2NativeMethodDataIdx;
-						ir->methodInfo = methodDataIndex;
+						ir->methodInfo = AllocVirtualCallInlineCache(shareMethod);
 						ir->argIdxs = argIdxDataIndex;
 						ir->ret = retIdx;
 						ir->retLocationType = (uint8_t)locDataType;
@@ -3211,7 +3549,7 @@ else \
 					{
 						CreateAddIR(ir, CallVirtual_ret);
 						ir->managed2NativeMethod = managed2NativeMethodDataIdx;
-						ir->methodInfo = methodDataIndex;
+						ir->methodInfo = AllocVirtualCallInlineCache(shareMethod);
 						ir->argIdxs = argIdxDataIndex;
 						ir->ret = retIdx;
 					}
@@ -3318,6 +3656,13 @@ else \
 							AddInst(ir);
 						}
 					}
+					if (ip + 1 != ipBase + body.codeSize)
+					{
+						// continue after the inlined body
+						CreateAddIR(ir, BranchUncondition_4);
+						ir->offset = body.codeSize;
+						PushOffset(&ir->offset);
+					}
 				}
 				else if (isVoidReturnType)
 				{
@@ -4131,8 +4476,7 @@ else \
 			case OpcodeValue::LDSTR:
 			{
 				uint32_t token = (uint32_t)GetI4LittleEndian(ip + 1);
-				Il2CppString* str = image->GetIl2CppUserStringFromRawIndex(DecodeTokenRowIndex(token));
-				uint32_t dataIdx = GetOrAddResolveDataIndex(str);
+				uint32_t dataIdx = GetOrAddUserStringResolveDataIndex(DecodeTokenRowIndex(token));
 
 				CreateAddIR(ir, LdstrVar);
 				ir->dst = GetEvalStackNewTopOffset();
@@ -4236,9 +4580,6 @@ else \
 				}
 
 				int32_t needDataSlotNum = (resolvedTotalArgNum + 3) / 4;
-				Managed2NativeCallMethod managed2NativeMethod = InterpreterModule::GetManaged2NativeMethodPointer(shareMethod, false);
-				IL2CPP_ASSERT((void*)managed2NativeMethod);
-				//uint32_t managed2NativeMethodDataIdx = GetOrAddResolveDataIndex(managed2NativeMethod);
 
 
 
@@ -4261,7 +4602,7 @@ else \
 				PushStackByType(&klass->byval_arg);
 				CreateAddIR(ir, NewClassVar);
 				ir->type = IS_CLASS_VALUE_TYPE(shareMethod->klass) ? HiOpcodeEnum::NewValueTypeVar : HiOpcodeEnum::NewClassVar;
-				ir->managed2NativeMethod = GetOrAddResolveDataIndex((void*)managed2NativeMethod);
+				ir->managed2NativeMethod = GetOrAddManaged2NativeResolveDataIndex(shareMethod, false);
 				ir->method = methodDataIndex;
 				ir->argIdxs = argIdxDataIndex;
 				ir->obj = objIdx;
@@ -4456,7 +4797,7 @@ else \
 							ldfldFromFieldData = true;
 							CreateAddIR(ir, LdsfldaFromFieldDataVarVar);
 							ir->dst = dstIdx;
-							ir->src = GetOrAddResolveDataIndex(il2cpp::vm::Field::GetData(fieldInfo));
+							ir->src = GetOrAddStaticFieldDataResolveDataIndex(fieldInfo);
 						}
 					}
 					if (!ldfldFromFieldData)
@@ -4690,6 +5031,8 @@ else \
 
 				PopStack();
 				PushStackByReduceType(NATIVE_INT_REDUCE_TYPE);
+				evalStack[evalStackTop - 1].type = &arrKlass->byval_arg;
+				evalStack[evalStackTop - 1].exactType = true;
 
 				ip += 5;
 				continue;
@@ -4838,7 +5181,10 @@ else \
 			}
 			case OpcodeValue::STELEM_REF:
 			{
-				CI_stele(ref);
+				IL2CPP_ASSERT(evalStackTop >= 3);
+				AddInst_stelem_ref(evalStack[evalStackTop - 3], evalStack[evalStackTop - 2], evalStack[evalStackTop - 1]);
+				PopStackN(3);
+				ip++;
 				continue;
 			}
 
@@ -4990,7 +5336,7 @@ ir->ele = ele.locOffset;
 				case LocationDescType::U2: { CI_stele0(u2); break; }
 				case LocationDescType::I4: { CI_stele0(i4); break; }
 				case LocationDescType::I8: { CI_stele0(i8); break; }
-				case LocationDescType::Ref: { CI_stele0(ref); break; }
+				case LocationDescType::Ref: { AddInst_stelem_ref(arr, index, ele); break; }
 				case LocationDescType::S:
 				{
 					uint32_t size = il2cpp::vm::Class::GetValueSize(objKlass, nullptr);
@@ -5330,6 +5676,7 @@ ir->ele = ele.locOffset;
 					CreateAddIR(ir, LdcVarConst_8);
 					ir->dst = GetEvalStackNewTopOffset();
 					ir->src = (uint64_t)methodInfo;
+					MarkNotCacheable();
 					PushStackByReduceType(NATIVE_INT_REDUCE_TYPE);
 					ip += 6;
 					continue;
@@ -5792,7 +6139,21 @@ ir->ele = ele.locOffset;
 			ip++;
 		}
 	finish_transform:
+		// the calling method of an inlined method splices the basic blocks, the method at depth 0 lays out
+		// instructions and resolves relocations in LowerBody.
+		return;
+	}
 
+	void TransformContext::LayoutIR()
+	{
+		if (executionTier == interpreter::ExecutionTier::Baseline)
+		{
+			AddLoopHeaders();
+		}
+		else if (RuntimeConfig::IsIROptimizerEnabled())
+		{
+			OptimizeIR();
+		}
 
 		totalIRSize = 0;
 		for (IRBasicBlock* bb : irbbs)
@@ -5803,13 +6164,12 @@ ir->ele = ele.locOffset;
 				totalIRSize += g_instructionSizes[(int)ir->type];
 			}
 		}
-		endBb->codeOffset = totalIRSize;
+		// the end basic block may have been removed from irbbs as unreachable
+		ip2bb[body.codeSize]->codeOffset = totalIRSize;
 
-		for (int32_t* relocOffsetPtr : relocationOffsets)
+		for (IRRelocation& reloc : relocationOffsets)
 		{
-			int32_t relocOffset = *relocOffsetPtr;
-			IL2CPP_ASSERT(splitOffsets.find(relocOffset) != splitOffsets.end());
-			*relocOffsetPtr = ip2bb[relocOffset]->codeOffset;
+			*reloc.offsetPtr = reloc.targetBb->codeOffset;
 		}
 
 		for (auto switchOffsetPair : switchOffsetsInResolveData)
@@ -5824,7 +6184,123 @@ ir->ele = ele.locOffset;
 		}
 	}
 
-	void TransformContext::BuildInterpMethodInfo(interpreter::InterpMethodInfo& result)
+	void TransformContext::AddLoopHeaders()
+	{
+		if (RuntimeConfig::GetTierUpBackEdgeCount() <= 0)
+		{
+			return;
+		}
+		for (IRBasicBlock* bb : irbbs)
+		{
+			if (bb->loopHeader)
+			{
+				CreateIR(ir, LoopHeader);
+				ir->ilOffset = bb->ilOffset;
+				bb->insts.insert(bb->insts.begin(), ir);
+				if (ir2offsetMap)
+				{
+					ir2offsetMap->add(ir, bb->ilOffset);
+				}
+			}
+		}
+	}
+
+	// false only for types whose values never contain a managed reference. pointers and native ints are
+	// kept as references, unsafe code may hold the address of a pinned object in them.
+	static bool MayHoldReference(const Il2CppType* type)
+	{
+		if (type->byref)
+		{
+			return true;
+		}
+		switch (type->type)
+		{
+		case IL2CPP_TYPE_BOOLEAN:
+		case IL2CPP_TYPE_CHAR:
+		case IL2CPP_TYPE_I1:
+		case IL2CPP_TYPE_U1:
+		case IL2CPP_TYPE_I2:
+		case IL2CPP_TYPE_U2:
+		case IL2CPP_TYPE_I4:
+		case IL2CPP_TYPE_U4:
+		case IL2CPP_TYPE_I8:
+		case IL2CPP_TYPE_U8:
+		case IL2CPP_TYPE_R4:
+		case IL2CPP_TYPE_R8:
+			return false;
+		case IL2CPP_TYPE_VALUETYPE:
+		case IL2CPP_TYPE_GENERICINST:
+		{
+			Il2CppClass* klass = il2cpp::vm::Class::FromIl2CppType(type);
+			return !IS_CLASS_VALUE_TYPE(klass) || (!klass->enumtype && klass->has_references);
+		}
+		default:
+			return true;
+		}
+	}
+
+	static void MarkRefSlots(uint8_t* refSlotMap, int32_t offset, const Il2CppType* type)
+	{
+		if (!MayHoldReference(type))
+		{
+			return;
+		}
+		for (int32_t i = 0, n = GetTypeValueStackObjectCount(type); i < n; i++)
+		{
+			refSlotMap[(offset + i) / 8] |= (uint8_t)(1 << ((offset + i) % 8));
+		}
+	}
+
+	void TransformContext::BuildFrameInfo(interpreter::InterpMethodInfo& result)
+	{
+		MethodArgDesc* argDescs;
+		if (actualParamCount > 0)
+		{
+			argDescs = (MethodArgDesc*)HYBRIDCLR_CALLOC(actualParamCount, sizeof(MethodArgDesc));
+			for (int32_t i = 0; i < actualParamCount; i++)
+			{
+				const Il2CppType* argType = args[i].type;
+				TypeDesc typeDesc = GetTypeArgDesc(argType);
+				MethodArgDesc& argDesc = argDescs[i];
+				argDesc.type = typeDesc.type;
+				IL2CPP_ASSERT(typeDesc.stackObjectSize < 0x10000);
+				argDesc.stackObjectSize = (uint16_t)typeDesc.stackObjectSize;
+				argDesc.passbyValWhenInvoke = argType->byref || !IsValueType(argType);
+			}
+		}
+		else
+		{
+			argDescs = nullptr;
+		}
+
+		result.args = argDescs;
+		result.argCount = actualParamCount;
+		result.argStackObjectSize = totalArgSize;
+		result.retStackObjectSize = IsVoidType(methodInfo->return_type) ? 0 : GetTypeArgDesc(methodInfo->return_type).stackObjectSize;
+		result.evalStackBaseOffset = evalStackBaseOffset;
+		result.localVarBaseOffset = totalArgSize;
+		result.localStackSize = totalArgLocalSize;
+		result.initLocals = initLocals;
+		if (evalStackBaseOffset > 0)
+		{
+			uint8_t* refSlotMap = (uint8_t*)HYBRIDCLR_CALLOC((evalStackBaseOffset + 7) / 8, 1);
+			for (int32_t i = 0; i < actualParamCount; i++)
+			{
+				MarkRefSlots(refSlotMap, args[i].argLocOffset, args[i].type);
+			}
+			for (size_t i = 0; i < body.localVars.size(); i++)
+			{
+				MarkRefSlots(refSlotMap, locals[i].locOffset, locals[i].type);
+			}
+			result.refSlotMap = refSlotMap;
+		}
+		else
+		{
+			result.refSlotMap = nullptr;
+		}
+	}
+
+	void TransformContext::BuildCode(interpreter::InterpMethodInfo& result)
 	{
 		il2cpp::utils::dynamic_array<hybridclr::metadata::ILMapper>* ilMappers;
 		if (ir2offsetMap)
@@ -5836,7 +6312,8 @@ ir->ele = ele.locOffset;
 		{
 			ilMappers = nullptr;
 		}
-		byte* tranCodes = (byte*)HYBRIDCLR_METADATA_MALLOC(totalIRSize);
+		// not metadata allocations, which need g_MetadataLock. an unpublished result is freed, see HiTransform.
+		byte* tranCodes = (byte*)HYBRIDCLR_MALLOC(totalIRSize);
 
 		uint32_t tranOffset = 0;
 		for (IRBasicBlock* bb : irbbs)
@@ -5867,38 +6344,42 @@ ir->ele = ele.locOffset;
 			fi->~FlowInfo();
 		}
 
-		MethodArgDesc* argDescs;
-		if (actualParamCount > 0)
+		result.codes = tranCodes;
+		result.codeLength = totalIRSize;
+		result.maxStackSize = maxStackSize;
+		result.tier = executionTier;
+		result.osrEntries = nullptr;
+		result.osrEntryCount = 0;
+		if (executionTier == interpreter::ExecutionTier::Baseline)
 		{
-			argDescs = (MethodArgDesc*)HYBRIDCLR_METADATA_CALLOC(actualParamCount, sizeof(MethodArgDesc));
-			for (int32_t i = 0; i < actualParamCount; i++)
-			{
-				const Il2CppType* argType = args[i].type;
-				TypeDesc typeDesc = GetTypeArgDesc(argType);
-				MethodArgDesc& argDesc = argDescs[i];
-				argDesc.type = typeDesc.type;
-				IL2CPP_ASSERT(typeDesc.stackObjectSize < 0x10000);
-				argDesc.stackObjectSize = (uint16_t)typeDesc.stackObjectSize;
-				argDesc.passbyValWhenInvoke = argType->byref || !IsValueType(argType);
-			}
+			result.callCountdown = RuntimeConfig::GetTierUpCallCount();
+			result.backEdgeCountdown = std::max(RuntimeConfig::GetTierUpBackEdgeCount(), 0);
 		}
 		else
 		{
-			argDescs = nullptr;
+			result.callCountdown = 0;
+			result.backEdgeCountdown = 0;
+			std::vector<interpreter::OsrEntry> osrEntries;
+			for (IRBasicBlock* bb : irbbs)
+			{
+				if (bb->loopHeader)
+				{
+					osrEntries.push_back({ bb->ilOffset, bb->codeOffset });
+				}
+			}
+			if (!osrEntries.empty())
+			{
+				// basic blocks of inlined methods are spliced in, irbbs isn't in il order
+				std::sort(osrEntries.begin(), osrEntries.end(),
+					[](const interpreter::OsrEntry& a, const interpreter::OsrEntry& b) { return a.ilOffset < b.ilOffset; });
+				size_t dataSize = osrEntries.size() * sizeof(interpreter::OsrEntry);
+				interpreter::OsrEntry* data = (interpreter::OsrEntry*)HYBRIDCLR_MALLOC(dataSize);
+				std::memcpy(data, osrEntries.data(), dataSize);
+				result.osrEntries = data;
+				result.osrEntryCount = (uint32_t)osrEntries.size();
+			}
 		}
 
-		result.args = argDescs;
-		result.argCount = actualParamCount;
-		result.argStackObjectSize = totalArgSize;
-		result.retStackObjectSize = IsVoidType(methodInfo->return_type) ? 0 : GetTypeArgDesc(methodInfo->return_type).stackObjectSize;
-		result.codes = tranCodes;
-		result.codeLength = totalIRSize;
-		result.evalStackBaseOffset = evalStackBaseOffset;
-		result.localVarBaseOffset = totalArgSize;
-		result.localStackSize = totalArgLocalSize;
-		result.maxStackSize = maxStackSize;
-		result.initLocals = initLocals;
-
 		if (resolveDatas.empty())
 		{
 			result.resolveDatas = nullptr;
@@ -5907,7 +6388,7 @@ ir->ele = ele.locOffset;
 		{
 			//result.resolveData = (uint8_t*)HYBRIDCLR_MALLOC(resolveDatas.size() * sizeof(uint8_t));
 			size_t dataSize = resolveDatas.size() * sizeof(uint64_t);
-			uint64_t* data = (uint64_t*)HYBRIDCLR_METADATA_MALLOC(dataSize);
+			uint64_t* data = (uint64_t*)HYBRIDCLR_MALLOC(dataSize);
 			std::memcpy(data, resolveDatas.data(), dataSize);
 			result.resolveDatas = data;
 		}
@@ -5919,7 +6400,7 @@ ir->ele = ele.locOffset;
 		else
 		{
 			size_t dataSize = exClauses.size() * sizeof(InterpExceptionClause);
-			InterpExceptionClause* data = (InterpExceptionClause*)HYBRIDCLR_METADATA_MALLOC(dataSize);
+			InterpExceptionClause* data = (InterpExceptionClause*)HYBRIDCLR_MALLOC(dataSize);
 			std::memcpy(data, exClauses.data(), dataSize);
 			result.exClauses = data;
 			result.exClauseCount = (uint32_t)exClauses.size();
@@ -5931,6 +6412,86 @@ ir->ele = ele.locOffset;
 		}
 	}
 
+	// the call of a method devirtualized by the assumption that no loaded class derives from its class.
+	// frames already running the method go on after a subclass is loaded, so the direct call, or the inlined
+	// body, is only taken when the receiver is an instance of that class. other receivers, null too, take
+	// the virtual call. the rest of the current basic block continues in a new basic block after both.
+	void TransformContext::AddClassGuardedCall(const MethodInfo* method, int32_t depth)
+	{
+		IL2CPP_ASSERT(IsInterpreterImplement(method) && !metadata::IsPInvokeMethod(method->flags));
+		int32_t resolvedTotalArgNum = method->parameters_count + 1;
+		int32_t callArgEvalStackIdxBase = evalStackTop - resolvedTotalArgNum;
+		uint16_t argBaseOffset = (uint16_t)GetEvalStackOffset(callArgEvalStackIdxBase);
+		bool isVoid = IsReturnVoidMethod(method);
+		// arguments are read after the end of the guard basic block
+		maxBasicBlockEntryStackSize = std::max(maxBasicBlockEntryStackSize, curStackSize);
+
+		IRBasicBlock* guardBb = curbb;
+		IRBasicBlock* fastBb = pool.NewAny<IRBasicBlock>();
+		*fastBb = { true, false, ipOffset, 0 };
+		IRBasicBlock* slowBb = pool.NewAny<IRBasicBlock>();
+		*slowBb = { true, false, ipOffset, 0 };
+		IRBasicBlock* joinBb = pool.NewAny<IRBasicBlock>();
+		*joinBb = { false, false, ipOffset, 0 };
+
+		CreateAddIR(guard, BranchClassNotEqualVar);
+		guard->obj = argBaseOffset;
+		guard->klass = GetOrAddResolveDataIndex(method->klass);
+		relocationOffsets.push_back({ &guard->offset, slowBb });
+
+		irbbs.insert(std::find(irbbs.begin(), irbbs.end(), guardBb) + 1, fastBb);
+		curbb = fastBb;
+		if (ShouldBeInlined(method, depth, executionTier) && TransformSubMethodBody(*this, method, depth + 1, argBaseOffset))
+		{
+
+		}
+		else if (isVoid)
+		{
+			CreateAddIR(ir, CallInterp_void);
+			ir->methodInfo = GetOrAddResolveDataIndex(method);
+			ir->argBase = argBaseOffset;
+		}
+		else
+		{
+			CreateAddIR(ir, CallInterp_ret);
+			ir->methodInfo = GetOrAddResolveDataIndex(method);
+			ir->argBase = argBaseOffset;
+			ir->ret = argBaseOffset;
+		}
+		CreateAddIR(jmp, BranchUncondition_4);
+		relocationOffsets.push_back({ &jmp->offset, joinBb });
+		// the inlined body may end in a basic block of its own
+		curbb->visited = true;
+		auto slowIt = irbbs.insert(std::find(irbbs.begin(), irbbs.end(), curbb) + 1, slowBb);
+		irbbs.insert(slowIt + 1, joinBb);
+
+		curbb = slowBb;
+		if (isVoid)
+		{
+			CreateAddIR(ir, CallInterpVirtual_void);
+			ir->method = AllocVirtualCallInlineCache(method);
+			ir->argBase = argBaseOffset;
+		}
+		else
+		{
+			CreateAddIR(ir, CallInterpVirtual_ret);
+			ir->method = AllocVirtualCallInlineCache(method);
+			ir->argBase = argBaseOffset;
+			ir->ret = argBaseOffset;
+		}
+
+		for (uint32_t offset = (uint32_t)(ip - ipBase); offset < body.codeSize && ip2bb[offset] == guardBb; offset++)
+		{
+			ip2bb[offset] = joinBb;
+		}
+		curbb = joinBb;
+		PopStackN(resolvedTotalArgNum);
+		if (!isVoid)
+		{
+			PushStackByType(method->return_type);
+		}
+	}
+
 	bool TransformContext::TransformSubMethodBody(TransformContext& callingCtx, const MethodInfo* methodInfo, int32_t depth, int32_t localVarOffset)
 	{
 		metadata::Image* image = metadata::MetadataModule::GetUnderlyingInterpreterImage(methodInfo);
@@ -5944,12 +6505,37 @@ ir->ele = ele.locOffset;
 		}
 
 		TransformContext ctx(image, methodInfo, *methodBody, callingCtx.pool, callingCtx.resolveDatas);
+		ctx.resolveDataSymbols = callingCtx.resolveDataSymbols;
 
 		try
 		{
 			ctx.TransformBodyImpl(depth, localVarOffset);
 			callingCtx.maxStackSize = std::max(callingCtx.maxStackSize, ctx.maxStackSize);
-			callingCtx.curbb->insts.insert(callingCtx.curbb->insts.end(), ctx.curbb->insts.begin(), ctx.curbb->insts.end());
+			callingCtx.maxBasicBlockEntryStackSize = std::max(callingCtx.maxBasicBlockEntryStackSize, ctx.maxBasicBlockEntryStackSize);
+			callingCtx.noSubclassAssumptions.insert(callingCtx.noSubclassAssumptions.end(), ctx.noSubclassAssumptions.begin(), ctx.noSubclassAssumptions.end());
+			if (ctx.relocationOffsets.empty())
+			{
+				callingCtx.curbb->insts.insert(callingCtx.curbb->insts.end(), ctx.curbb->insts.begin(), ctx.curbb->insts.end());
+				return true;
+			}
+
+			// the basic blocks of the inlined body are spliced after the current basic block.
+			// its end basic block, where all returns jump to, continues with the rest of the current basic block.
+			IL2CPP_ASSERT(ctx.switchOffsetsInResolveData.empty());
+			auto curIt = std::find(callingCtx.irbbs.begin(), callingCtx.irbbs.end(), callingCtx.curbb);
+			IL2CPP_ASSERT(curIt != callingCtx.irbbs.end());
+			callingCtx.irbbs.insert(curIt + 1, ctx.irbbs.begin(), ctx.irbbs.end());
+			callingCtx.relocationOffsets.insert(callingCtx.relocationOffsets.end(), ctx.relocationOffsets.begin(), ctx.relocationOffsets.end());
+
+			IRBasicBlock* continueBb = ctx.irbbs.back();
+			continueBb->visited = false;
+			for (uint32_t offset = (uint32_t)(callingCtx.ip - callingCtx.ipBase); offset < callingCtx.body.codeSize && callingCtx.ip2bb[offset] == callingCtx.curbb; offset++)
+			{
+				callingCtx.ip2bb[offset] = continueBb;
+			}
+			callingCtx.curbb = continueBb;
+			// basic blocks are owned by callingCtx now
+			ctx.irbbs.clear();
 			return true;
 		}
 		catch (Il2CppExceptionWrapper&)
@@ -16,6 +16,7 @@
 #include "../interpreter/InterpreterModule.h"
 
 #include "Transform.h"
+#include "TransformCache.h"
 
 namespace hybridclr
 {
@@ -31,6 +32,9 @@ namespace transform
 		uint32_t ilOffset;
 		uint32_t codeOffset;
 		std::vector<interpreter::IRCommon*> insts;
+		// target of a backward branch of the transformed method with empty eval stack.
+		// gets a LoopHeader instruction in baseline code and an OsrEntry in optimized code.
+		bool loopHeader;
 	};
 
 	struct ArgVarInfo
@@ -62,6 +66,10 @@ namespace transform
 		EvalStackReduceDataType reduceType;
 		int32_t byteSize;
 		int32_t locOffset;
+		// static type of the value, null if unknown. not kept across basic blocks.
+		const Il2CppType* type;
+		// the value is an instance of exactly type rather than of a subtype, such as the array of newarr
+		bool exactType;
 	};
 
 #if HYBRIDCLR_ARCH_64
@@ -72,6 +80,23 @@ namespace transform
 	constexpr EvalStackReduceDataType NATIVE_INT_REDUCE_TYPE = EvalStackReduceDataType::I4;
 #endif
 
+	// buf is valid until resolvedDatas grows again
+	template<typename T>
+	void AllocResolvedData(il2cpp::utils::dynamic_array<uint64_t>& resolvedDatas, int32_t size, int32_t& index, T*& buf)
+	{
+		if (size > 0)
+		{
+			int32_t oldSize = index = (int32_t)resolvedDatas.size();
+			resolvedDatas.resize_initialized(oldSize + size);
+			buf = (T*)&resolvedDatas[oldSize];
+		}
+		else
+		{
+			index = 0;
+			buf = nullptr;
+		}
+	}
+
 #define CreateIR(varName, typeName) IR##typeName* varName = pool.AllocIR<IR##typeName>(); varName->type = HiOpcodeEnum::typeName;
 #define CreateAddIR(varName, typeName) IR##typeName* varName = pool.AllocIR<IR##typeName>(); varName->type = HiOpcodeEnum::typeName; curbb->insts.push_back(varName); if (ir2offsetMap) { ir2offsetMap->add(varName, ipOffset); }
 
@@ -109,6 +134,14 @@ namespace transform
 		il2cpp::utils::dynamic_array<EvalStackVarInfo> evalStack;
 	};
 
+	// a code offset in an instruction or exception clause. it holds an il offset while transforming and is
+	// set to the code offset of targetBb once all instructions are laid out.
+	struct IRRelocation
+	{
+		int32_t* offsetPtr;
+		IRBasicBlock* targetBb;
+	};
+
 	typedef Il2CppHashMap<IRCommon*, uint32_t, il2cpp::utils::PointerHash<IRCommon>> IR2OffsetMap;
 
 	LocationDescInfo ComputLocationDescInfo(const Il2CppType* type);
@@ -125,7 +158,7 @@ namespace transform
 
 		int32_t actualParamCount;
 
-		std::set<uint32_t> splitOffsets;
+		std::set<uint32_t, std::less<uint32_t>, TemporaryMemoryArenaAllocator<uint32_t>> splitOffsets;
 		IRBasicBlock** ip2bb;
 		IRBasicBlock* curbb;
 
@@ -136,13 +169,16 @@ namespace transform
 		int32_t evalStackBaseOffset;
 		int32_t maxStackSize;
 		int32_t curStackSize;
+		int32_t maxBasicBlockEntryStackSize;
 
 		il2cpp::utils::dynamic_array<uint64_t>& resolveDatas;
 		Il2CppHashMap<uint32_t, uint32_t, il2cpp::utils::PassThroughHash<uint32_t>> token2DataIdxs;
 		Il2CppHashMap<const void*, uint32_t, il2cpp::utils::PassThroughHash<const void*>> ptr2DataIdxs;
-		std::vector<int32_t*> relocationOffsets;
+		// shared with inlined methods, null if transform cache is disabled
+		ResolveDataSymbols* resolveDataSymbols;
+		std::vector<IRRelocation> relocationOffsets;
 		std::vector<std::pair<int32_t, int32_t>> switchOffsetsInResolveData;
-		std::vector<FlowInfo*> pendingFlows;
+		TemporaryVector<FlowInfo*> pendingFlows;
 		int32_t nextFlowIdx;
 
 		const byte* ipBase;
@@ -154,13 +190,18 @@ namespace transform
 
 		const MethodInfo* shareMethod;
 
-		std::vector<IRBasicBlock*> irbbs;
+		TemporaryVector<IRBasicBlock*> irbbs;
 		il2cpp::utils::dynamic_array<InterpExceptionClause> exClauses;
+		// classes assumed to have no subclass by devirtualized calls, including calls of inlined methods
+		std::vector<const Il2CppClass*> noSubclassAssumptions;
 
 		uint32_t totalIRSize;
 		int32_t totalArgSize;
 		int32_t totalArgLocalSize;
 		bool initLocals;
+		interpreter::ExecutionTier executionTier;
+		// false in inlined methods, whose il offsets don't belong to the transformed method
+		bool markLoopHeaders;
 
 		// Token 缓存，用于优化方法解析性能
 		// 初始容量设为 64，避免频繁扩容，提升性能
@@ -173,7 +214,40 @@ namespace transform
 
 		static void InitializeInstinctHandlers();
 
+		// pointers without symbol prevent the method from being saved to TransformCache
 		uint32_t GetOrAddResolveDataIndex(const void* ptr);
+		uint32_t GetOrAddResolveDataIndex(const Il2CppClass* klass);
+		uint32_t GetOrAddResolveDataIndex(const MethodInfo* method);
+		uint32_t GetOrAddUserStringResolveDataIndex(uint32_t userStringIndex);
+		uint32_t GetOrAddStaticFieldDataResolveDataIndex(const FieldInfo* field);
+		uint32_t GetOrAddManaged2NativeResolveDataIndex(const MethodInfo* method, bool forceStatic);
+
+		uint32_t AllocVirtualCallInlineCache(const MethodInfo* method);
+		uint32_t AllocArrayStoreTypeCheckCache();
+
+		void SetResolveDataSymbols(ResolveDataSymbols* symbols)
+		{
+			resolveDataSymbols = symbols;
+		}
+
+		void SetExecutionTier(interpreter::ExecutionTier tier)
+		{
+			executionTier = tier;
+		}
+
+		// called when runtime pointers are embedded in IR codes
+		void MarkNotCacheable()
+		{
+			if (resolveDataSymbols)
+			{
+				resolveDataSymbols->hasUnsupportedData = true;
+			}
+		}
+
+		const std::vector<const Il2CppClass*>& GetNoSubclassAssumptions() const
+		{
+			return noSubclassAssumptions;
+		}
 
 		TemporaryMemoryArena& GetPool() const
 		{
@@ -310,6 +384,10 @@ namespace transform
 
 		void Add_brtruefalse(bool c, int32_t targetOffset);
 
+		bool TryRemoveLastLdc(const EvalStackVarInfo& var, int64_t& value);
+
+		IRCommon* TryCreateVarVarConstIR(HiOpcodeEnum varVarOp, int32_t retOffset, const EvalStackVarInfo& op1, const EvalStackVarInfo& op2);
+
 		void Add_bc(int32_t ipOffset, int32_t brOffset, int32_t opSize, HiOpcodeEnum opI4, HiOpcodeEnum opI8, HiOpcodeEnum opR4, HiOpcodeEnum opR8);
 
 		void Add_conv(int32_t dstTypeSize, EvalStackReduceDataType dstReduceType, HiOpcodeEnum opI4, HiOpcodeEnum opI8, HiOpcodeEnum opR4, HiOpcodeEnum opR8);
@@ -324,6 +402,7 @@ namespace transform
 
 		void Add_ldelem(EvalStackReduceDataType resultType, HiOpcodeEnum opI4);
 		void Add_stelem(HiOpcodeEnum opI4);
+		void AddInst_stelem_ref(const EvalStackVarInfo& arr, const EvalStackVarInfo& index, const EvalStackVarInfo& ele);
 
 		bool FindFirstLeaveHandlerIndex(const std::vector<ExceptionClause>& exceptionClauses, uint32_t leaveOffset, uint32_t targetOffset, uint16_t& index);
 
@@ -363,15 +442,39 @@ namespace transform
 
 		bool TryAddCallCommonInstanceInstruments(const MethodInfo* method, uint32_t methodDataIndex);
 		bool TryAddCallCommonStaticInstruments(const MethodInfo* method, uint32_t methodDataIndex);
+		bool TryDevirtualizeCallVir(const MethodInfo* method, bool& needClassGuard);
+		void AddClassGuardedCall(const MethodInfo* method, int32_t depth);
 
 
 		HiOpcodeEnum CalcGetMdArrElementVarVarOpcode(const Il2CppType* type);
 
-		void TransformBody(int32_t depth, int32_t localVarOffset, interpreter::InterpMethodInfo& result);
+		// translates il to IR and fills the frame layout of result. reads metadata, must be called with g_MetadataLock held.
+		void TranslateBody(interpreter::InterpMethodInfo& result);
+		// optimizes and lays out the IR and fills the code of result. works on the IR only and never takes g_MetadataLock,
+		// except registering debug info of images with symbols.
+		void LowerBody(interpreter::InterpMethodInfo& result);
 
 	private:
+		uint32_t GetOrAddResolveDataIndex(const void* ptr, ResolveDataSymbolType symbolType, const void* symbolTarget, uint32_t userStringIndex);
+		void SetResolveDataSymbol(uint32_t index, ResolveDataSymbolType symbolType, const void* symbolTarget, uint32_t userStringIndex);
 		void TransformBodyImpl(int32_t depth, int32_t localVarOffset);
-		void BuildInterpMethodInfo(interpreter::InterpMethodInfo& result);
+		void LayoutIR();
+		void OptimizeIR();
+		void AddLoopHeaders();
+		void PropagateConstantsAndCopies(bool frameAddressTaken);
+		void ThreadBranches();
+		void RemoveUnreachableBasicBlocks();
+		void RemoveDeadStores(bool frameAddressTaken);
+		void CoalesceEvalStackMoves(bool frameAddressTaken);
+		bool LowerSwitchLadders();
+		void EliminateRedundantChecks();
+		void CompactEvalStackSlots(bool frameAddressTaken);
+		void ReplaceIR(std::vector<IRCommon*>& insts, size_t index, IRCommon* newIr);
+		IRBasicBlock* RemoveRelocationOffset(int32_t* offsetPtr);
+		IRCommon* CreateLdcIR(uint16_t dst, uint64_t bits, int32_t size);
+		void MergeSuperInstructions();
+		void BuildFrameInfo(interpreter::InterpMethodInfo& result);
+		void BuildCode(interpreter::InterpMethodInfo& result);
 		static bool TransformSubMethodBody(TransformContext& callingCtx, const MethodInfo* subMethod, int32_t depth, int32_t localVarOffset);
 	};
 }
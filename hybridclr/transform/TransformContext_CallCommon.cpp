@@ -1,6 +1,9 @@
 #include "TransformContext.h"
 
+#include "vm/MetadataLock.h"
+
 #include "../interpreter/MethodBridge.h"
+#include "../metadata/ClassHierarchy.h"
 
 namespace hybridclr
 {
@@ -666,5 +669,40 @@ default:\
 		}
 		return false;
 	}
+
+	// callvirt calls the method directly when the receiver can only be an instance of its declaring class:
+	// the class is sealed, or it is an interpreter class that no loaded type derives from. the latter is an
+	// assumption recorded for the transformed method, which is invalidated once a subclass is loaded.
+	// frames running the method may outlive the assumption, so such calls need a guard on the receiver class.
+	bool TransformContext::TryDevirtualizeCallVir(const MethodInfo* method, bool& needClassGuard)
+	{
+		needClassGuard = false;
+		Il2CppClass* klass = method->klass;
+		if (IsInterface(klass->flags) || klass->valuetype || klass->rank || IsChildTypeOfMulticastDelegate(klass)
+			|| (method->flags & METHOD_ATTRIBUTE_ABSTRACT))
+		{
+			return false;
+		}
+		if (!IsInterpreterImplement(method) && !InitAndGetInterpreterDirectlyCallMethodPointer(method))
+		{
+			return false;
+		}
+		if (klass->flags & TYPE_ATTRIBUTE_SEALED)
+		{
+			return true;
+		}
+		if (!metadata::IsInterpreterType(klass) || !IsInterpreterImplement(method) || metadata::IsPInvokeMethod(method->flags))
+		{
+			return false;
+		}
+		// checked again when the result is published, see ClassHierarchy::PublishInterpData
+		if (metadata::ClassHierarchy::HasSubclass(klass))
+		{
+			return false;
+		}
+		noSubclassAssumptions.push_back(klass);
+		needClassGuard = true;
+		return true;
+	}
 }
 }
\ No newline at end of file
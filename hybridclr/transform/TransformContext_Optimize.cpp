@@ -0,0 +1,2895 @@
+#include "TransformContext.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace hybridclr
+{
+namespace transform
+{
+	// the optimizer works on the basic blocks built by TransformBodyImpl before code offsets are assigned.
+	// branch and exception clause offsets still hold il offsets, so instructions can be replaced or removed freely.
+	//
+	// only instructions listed in GetIROperandSlots are looked through. their handlers access the frame only
+	// by the listed operands and read all operands before writing the result. any other instruction is treated
+	// as reading and writing every slot.
+	//
+	// an eval stack slot is dead at the end of a basic block unless it is below the deepest eval stack of any
+	// basic block entry. args and locals are always live because exception handlers may read them.
+
+	struct IROperandSlots
+	{
+		uint16_t* reads[3];
+		int32_t readCount;
+		uint16_t* write;
+	};
+
+	static bool GetIROperandSlots(IRCommon* ir, bool frameAddressTaken, IROperandSlots& slots)
+	{
+		slots.readCount = 0;
+		slots.write = nullptr;
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::LdlocVarVar:
+		case HiOpcodeEnum::LdlocExpandVarVar_i1:
+		case HiOpcodeEnum::LdlocExpandVarVar_u1:
+		case HiOpcodeEnum::LdlocExpandVarVar_i2:
+		case HiOpcodeEnum::LdlocExpandVarVar_u2:
+		case HiOpcodeEnum::ConvertVarVar_i4_i1:
+		case HiOpcodeEnum::ConvertVarVar_i4_u1:
+		case HiOpcodeEnum::ConvertVarVar_i4_i2:
+		case HiOpcodeEnum::ConvertVarVar_i4_u2:
+		case HiOpcodeEnum::ConvertVarVar_i4_i4:
+		case HiOpcodeEnum::ConvertVarVar_i4_u4:
+		case HiOpcodeEnum::ConvertVarVar_i4_i8:
+		case HiOpcodeEnum::ConvertVarVar_i4_u8:
+		case HiOpcodeEnum::ConvertVarVar_i4_f4:
+		case HiOpcodeEnum::ConvertVarVar_i4_f8:
+		case HiOpcodeEnum::ConvertVarVar_u4_i1:
+		case HiOpcodeEnum::ConvertVarVar_u4_u1:
+		case HiOpcodeEnum::ConvertVarVar_u4_i2:
+		case HiOpcodeEnum::ConvertVarVar_u4_u2:
+		case HiOpcodeEnum::ConvertVarVar_u4_i4:
+		case HiOpcodeEnum::ConvertVarVar_u4_u4:
+		case HiOpcodeEnum::ConvertVarVar_u4_i8:
+		case HiOpcodeEnum::ConvertVarVar_u4_u8:
+		case HiOpcodeEnum::ConvertVarVar_u4_f4:
+		case HiOpcodeEnum::ConvertVarVar_u4_f8:
+		case HiOpcodeEnum::ConvertVarVar_i8_i1:
+		case HiOpcodeEnum::ConvertVarVar_i8_u1:
+		case HiOpcodeEnum::ConvertVarVar_i8_i2:
+		case HiOpcodeEnum::ConvertVarVar_i8_u2:
+		case HiOpcodeEnum::ConvertVarVar_i8_i4:
+		case HiOpcodeEnum::ConvertVarVar_i8_u4:
+		case HiOpcodeEnum::ConvertVarVar_i8_i8:
+		case HiOpcodeEnum::ConvertVarVar_i8_u8:
+		case HiOpcodeEnum::ConvertVarVar_i8_f4:
+		case HiOpcodeEnum::ConvertVarVar_i8_f8:
+		case HiOpcodeEnum::ConvertVarVar_u8_i1:
+		case HiOpcodeEnum::ConvertVarVar_u8_u1:
+		case HiOpcodeEnum::ConvertVarVar_u8_i2:
+		case HiOpcodeEnum::ConvertVarVar_u8_u2:
+		case HiOpcodeEnum::ConvertVarVar_u8_i4:
+		case HiOpcodeEnum::ConvertVarVar_u8_u4:
+		case HiOpcodeEnum::ConvertVarVar_u8_i8:
+		case HiOpcodeEnum::ConvertVarVar_u8_u8:
+		case HiOpcodeEnum::ConvertVarVar_u8_f4:
+		case HiOpcodeEnum::ConvertVarVar_u8_f8:
+		case HiOpcodeEnum::ConvertVarVar_f4_i1:
+		case HiOpcodeEnum::ConvertVarVar_f4_u1:
+		case HiOpcodeEnum::ConvertVarVar_f4_i2:
+		case HiOpcodeEnum::ConvertVarVar_f4_u2:
+		case HiOpcodeEnum::ConvertVarVar_f4_i4:
+		case HiOpcodeEnum::ConvertVarVar_f4_u4:
+		case HiOpcodeEnum::ConvertVarVar_f4_i8:
+		case HiOpcodeEnum::ConvertVarVar_f4_u8:
+		case HiOpcodeEnum::ConvertVarVar_f4_f4:
+		case HiOpcodeEnum::ConvertVarVar_f4_f8:
+		case HiOpcodeEnum::ConvertVarVar_f8_i1:
+		case HiOpcodeEnum::ConvertVarVar_f8_u1:
+		case HiOpcodeEnum::ConvertVarVar_f8_i2:
+		case HiOpcodeEnum::ConvertVarVar_f8_u2:
+		case HiOpcodeEnum::ConvertVarVar_f8_i4:
+		case HiOpcodeEnum::ConvertVarVar_f8_u4:
+		case HiOpcodeEnum::ConvertVarVar_f8_i8:
+		case HiOpcodeEnum::ConvertVarVar_f8_u8:
+		case HiOpcodeEnum::ConvertVarVar_f8_f4:
+		case HiOpcodeEnum::ConvertVarVar_f8_f8:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_i4:
+		case HiOpcodeEnum::UnaryOpVarVar_Not_i4:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_i8:
+		case HiOpcodeEnum::UnaryOpVarVar_Not_i8:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_f4:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_f8:
+		{
+			IRLdlocVarVar* x = (IRLdlocVarVar*)ir;
+			slots.reads[slots.readCount++] = &x->src;
+			slots.write = &x->dst;
+			return true;
+		}
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_MulUn_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_DivUn_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_RemUn_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_And_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_MulUn_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_DivUn_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_RemUn_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_And_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Div_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Rem_f8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_i8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_i8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_i8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u4:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Add_u8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Sub_u8:
+		case HiOpcodeEnum::BinOpOverflowVarVarVar_Mul_u8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i4_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i4_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i4_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i4:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shl_i8_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_Shr_i8_i8:
+		case HiOpcodeEnum::BitShiftBinOpVarVarVar_ShrUn_i8_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f8:
+		{
+			IRBinOpVarVarVar_Add_i4* x = (IRBinOpVarVarVar_Add_i4*)ir;
+			slots.reads[slots.readCount++] = &x->op1;
+			slots.reads[slots.readCount++] = &x->op2;
+			slots.write = &x->ret;
+			return true;
+		}
+		case HiOpcodeEnum::BinOpVarVarConst_Add_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_And_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Or_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Xor_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Add_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_And_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Or_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Xor_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Add_f4:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_f4:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_f4:
+		case HiOpcodeEnum::BinOpVarVarConst_Add_f8:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_f8:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_f8:
+		{
+			IRBinOpVarVarConst_Add_i4* x = (IRBinOpVarVarConst_Add_i4*)ir;
+			slots.reads[slots.readCount++] = &x->op1;
+			slots.write = &x->ret;
+			return true;
+		}
+		case HiOpcodeEnum::BranchVarVar_Ceq_i4:
+		case HiOpcodeEnum::BranchVarVar_Ceq_i8:
+		case HiOpcodeEnum::BranchVarVar_Ceq_f4:
+		case HiOpcodeEnum::BranchVarVar_Ceq_f8:
+		case HiOpcodeEnum::BranchVarVar_CneUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CneUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CneUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CneUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i8:
+		case HiOpcodeEnum::BranchVarVar_Cgt_f4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_f8:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cge_i4:
+		case HiOpcodeEnum::BranchVarVar_Cge_i8:
+		case HiOpcodeEnum::BranchVarVar_Cge_f4:
+		case HiOpcodeEnum::BranchVarVar_Cge_f8:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Clt_i4:
+		case HiOpcodeEnum::BranchVarVar_Clt_i8:
+		case HiOpcodeEnum::BranchVarVar_Clt_f4:
+		case HiOpcodeEnum::BranchVarVar_Clt_f8:
+		case HiOpcodeEnum::BranchVarVar_CltUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CltUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CltUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CltUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cle_i4:
+		case HiOpcodeEnum::BranchVarVar_Cle_i8:
+		case HiOpcodeEnum::BranchVarVar_Cle_f4:
+		case HiOpcodeEnum::BranchVarVar_Cle_f8:
+		case HiOpcodeEnum::BranchVarVar_CleUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CleUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CleUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CleUn_f8:
+		{
+			IRBranchVarVar_Ceq_i4* x = (IRBranchVarVar_Ceq_i4*)ir;
+			slots.reads[slots.readCount++] = &x->op1;
+			slots.reads[slots.readCount++] = &x->op2;
+			return true;
+		}
+		case HiOpcodeEnum::BranchVarConst_Ceq_i4:
+		case HiOpcodeEnum::BranchVarConst_Ceq_i8:
+		case HiOpcodeEnum::BranchVarConst_Ceq_f4:
+		case HiOpcodeEnum::BranchVarConst_Ceq_f8:
+		case HiOpcodeEnum::BranchVarConst_CneUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CneUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CneUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CneUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Cgt_i4:
+		case HiOpcodeEnum::BranchVarConst_Cgt_i8:
+		case HiOpcodeEnum::BranchVarConst_Cgt_f4:
+		case HiOpcodeEnum::BranchVarConst_Cgt_f8:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Cge_i4:
+		case HiOpcodeEnum::BranchVarConst_Cge_i8:
+		case HiOpcodeEnum::BranchVarConst_Cge_f4:
+		case HiOpcodeEnum::BranchVarConst_Cge_f8:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Clt_i4:
+		case HiOpcodeEnum::BranchVarConst_Clt_i8:
+		case HiOpcodeEnum::BranchVarConst_Clt_f4:
+		case HiOpcodeEnum::BranchVarConst_Clt_f8:
+		case HiOpcodeEnum::BranchVarConst_CltUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CltUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CltUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CltUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Cle_i4:
+		case HiOpcodeEnum::BranchVarConst_Cle_i8:
+		case HiOpcodeEnum::BranchVarConst_Cle_f4:
+		case HiOpcodeEnum::BranchVarConst_Cle_f8:
+		case HiOpcodeEnum::BranchVarConst_CleUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CleUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CleUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CleUn_f8:
+		case HiOpcodeEnum::BranchTrueVar_i4:
+		case HiOpcodeEnum::BranchTrueVar_i8:
+		case HiOpcodeEnum::BranchFalseVar_i4:
+		case HiOpcodeEnum::BranchFalseVar_i8:
+		{
+			IRBranchVarConst_Ceq_i4* x = (IRBranchVarConst_Ceq_i4*)ir;
+			slots.reads[slots.readCount++] = &x->op1;
+			return true;
+		}
+		case HiOpcodeEnum::GetArrayElementVarVar_i1:
+		case HiOpcodeEnum::GetArrayElementVarVar_u1:
+		case HiOpcodeEnum::GetArrayElementVarVar_i2:
+		case HiOpcodeEnum::GetArrayElementVarVar_u2:
+		case HiOpcodeEnum::GetArrayElementVarVar_i4:
+		case HiOpcodeEnum::GetArrayElementVarVar_u4:
+		case HiOpcodeEnum::GetArrayElementVarVar_i8:
+		case HiOpcodeEnum::GetArrayElementVarVar_u8:
+		case HiOpcodeEnum::GetArrayElementVarVar_i1_NoCheck:
+		case HiOpcodeEnum::GetArrayElementVarVar_u1_NoCheck:
+		case HiOpcodeEnum::GetArrayElementVarVar_i2_NoCheck:
+		case HiOpcodeEnum::GetArrayElementVarVar_u2_NoCheck:
+		case HiOpcodeEnum::GetArrayElementVarVar_i4_NoCheck:
+		case HiOpcodeEnum::GetArrayElementVarVar_u4_NoCheck:
+		case HiOpcodeEnum::GetArrayElementVarVar_i8_NoCheck:
+		case HiOpcodeEnum::GetArrayElementVarVar_u8_NoCheck:
+		{
+			IRGetArrayElementVarVar_i4* x = (IRGetArrayElementVarVar_i4*)ir;
+			slots.reads[slots.readCount++] = &x->arr;
+			slots.reads[slots.readCount++] = &x->index;
+			slots.write = &x->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdfldVarVar_i1:
+		case HiOpcodeEnum::LdfldVarVar_u1:
+		case HiOpcodeEnum::LdfldVarVar_i2:
+		case HiOpcodeEnum::LdfldVarVar_u2:
+		case HiOpcodeEnum::LdfldVarVar_i4:
+		case HiOpcodeEnum::LdfldVarVar_u4:
+		case HiOpcodeEnum::LdfldVarVar_i8:
+		case HiOpcodeEnum::LdfldVarVar_u8:
+		case HiOpcodeEnum::LdfldVarVar_i1_NoCheck:
+		case HiOpcodeEnum::LdfldVarVar_u1_NoCheck:
+		case HiOpcodeEnum::LdfldVarVar_i2_NoCheck:
+		case HiOpcodeEnum::LdfldVarVar_u2_NoCheck:
+		case HiOpcodeEnum::LdfldVarVar_i4_NoCheck:
+		case HiOpcodeEnum::LdfldVarVar_u4_NoCheck:
+		case HiOpcodeEnum::LdfldVarVar_i8_NoCheck:
+		case HiOpcodeEnum::LdfldVarVar_u8_NoCheck:
+		{
+			IRLdfldVarVar_i4* x = (IRLdfldVarVar_i4*)ir;
+			slots.reads[slots.readCount++] = &x->obj;
+			slots.write = &x->dst;
+			return true;
+		}
+		case HiOpcodeEnum::SetArrayElementVarVar_i1:
+		case HiOpcodeEnum::SetArrayElementVarVar_u1:
+		case HiOpcodeEnum::SetArrayElementVarVar_i2:
+		case HiOpcodeEnum::SetArrayElementVarVar_u2:
+		case HiOpcodeEnum::SetArrayElementVarVar_i4:
+		case HiOpcodeEnum::SetArrayElementVarVar_u4:
+		case HiOpcodeEnum::SetArrayElementVarVar_i8:
+		case HiOpcodeEnum::SetArrayElementVarVar_u8:
+		case HiOpcodeEnum::SetArrayElementVarVar_ref:
+		case HiOpcodeEnum::SetArrayElementVarVar_ref_NoTypeCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_i1_NoCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_u1_NoCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_i2_NoCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_u2_NoCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_i4_NoCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_u4_NoCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_i8_NoCheck:
+		case HiOpcodeEnum::SetArrayElementVarVar_u8_NoCheck:
+		{
+			IRSetArrayElementVarVar_i4* x = (IRSetArrayElementVarVar_i4*)ir;
+			slots.reads[slots.readCount++] = &x->arr;
+			slots.reads[slots.readCount++] = &x->index;
+			slots.reads[slots.readCount++] = &x->ele;
+			return true;
+		}
+		case HiOpcodeEnum::StfldVarVar_i1:
+		case HiOpcodeEnum::StfldVarVar_u1:
+		case HiOpcodeEnum::StfldVarVar_i2:
+		case HiOpcodeEnum::StfldVarVar_u2:
+		case HiOpcodeEnum::StfldVarVar_i4:
+		case HiOpcodeEnum::StfldVarVar_u4:
+		case HiOpcodeEnum::StfldVarVar_i8:
+		case HiOpcodeEnum::StfldVarVar_u8:
+		case HiOpcodeEnum::StfldVarVar_ref:
+		case HiOpcodeEnum::StfldVarVar_i1_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_u1_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_i2_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_u2_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_i4_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_u4_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_i8_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_u8_NoCheck:
+		case HiOpcodeEnum::StfldVarVar_ref_NoCheck:
+		{
+			// obj may point to an arg or local once its address is taken
+			if (frameAddressTaken)
+			{
+				return false;
+			}
+			IRStfldVarVar_i4* x = (IRStfldVarVar_i4*)ir;
+			slots.reads[slots.readCount++] = &x->obj;
+			slots.reads[slots.readCount++] = &x->data;
+			return true;
+		}
+		case HiOpcodeEnum::BranchSwitch:
+		{
+			slots.reads[slots.readCount++] = &((IRBranchSwitch*)ir)->value;
+			return true;
+		}
+		case HiOpcodeEnum::BranchSwitchBinarySearch:
+		{
+			slots.reads[slots.readCount++] = &((IRBranchSwitchBinarySearch*)ir)->value;
+			return true;
+		}
+		case HiOpcodeEnum::BranchClassNotEqualVar:
+		{
+			slots.reads[slots.readCount++] = &((IRBranchClassNotEqualVar*)ir)->obj;
+			return true;
+		}
+		case HiOpcodeEnum::GetArrayLengthVarVar:
+		{
+			IRGetArrayLengthVarVar* x = (IRGetArrayLengthVarVar*)ir;
+			slots.reads[slots.readCount++] = &x->arr;
+			slots.write = &x->len;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_1:
+		{
+			slots.write = &((IRLdcVarConst_1*)ir)->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_2:
+		{
+			slots.write = &((IRLdcVarConst_2*)ir)->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_4:
+		{
+			slots.write = &((IRLdcVarConst_4*)ir)->dst;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_8:
+		{
+			slots.write = &((IRLdcVarConst_8*)ir)->dst;
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	// the handler has no side effect but writing its result
+	static bool IsPureIR(IRCommon* ir)
+	{
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::LdlocVarVar:
+		case HiOpcodeEnum::LdlocExpandVarVar_i1:
+		case HiOpcodeEnum::LdlocExpandVarVar_u1:
+		case HiOpcodeEnum::LdlocExpandVarVar_i2:
+		case HiOpcodeEnum::LdlocExpandVarVar_u2:
+		case HiOpcodeEnum::LdcVarConst_1:
+		case HiOpcodeEnum::LdcVarConst_2:
+		case HiOpcodeEnum::LdcVarConst_4:
+		case HiOpcodeEnum::LdcVarConst_8:
+		case HiOpcodeEnum::ConvertVarVar_i4_i1:
+		case HiOpcodeEnum::ConvertVarVar_i4_u1:
+		case HiOpcodeEnum::ConvertVarVar_i4_i2:
+		case HiOpcodeEnum::ConvertVarVar_i4_u2:
+		case HiOpcodeEnum::ConvertVarVar_i4_i4:
+		case HiOpcodeEnum::ConvertVarVar_i4_u4:
+		case HiOpcodeEnum::ConvertVarVar_i4_i8:
+		case HiOpcodeEnum::ConvertVarVar_i4_u8:
+		case HiOpcodeEnum::ConvertVarVar_i4_f4:
+		case HiOpcodeEnum::ConvertVarVar_i4_f8:
+		case HiOpcodeEnum::ConvertVarVar_u4_i1:
+		case HiOpcodeEnum::ConvertVarVar_u4_u1:
+		case HiOpcodeEnum::ConvertVarVar_u4_i2:
+		case HiOpcodeEnum::ConvertVarVar_u4_u2:
+		case HiOpcodeEnum::ConvertVarVar_u4_i4:
+		case HiOpcodeEnum::ConvertVarVar_u4_u4:
+		case HiOpcodeEnum::ConvertVarVar_u4_i8:
+		case HiOpcodeEnum::ConvertVarVar_u4_u8:
+		case HiOpcodeEnum::ConvertVarVar_u4_f4:
+		case HiOpcodeEnum::ConvertVarVar_u4_f8:
+		case HiOpcodeEnum::ConvertVarVar_i8_i1:
+		case HiOpcodeEnum::ConvertVarVar_i8_u1:
+		case HiOpcodeEnum::ConvertVarVar_i8_i2:
+		case HiOpcodeEnum::ConvertVarVar_i8_u2:
+		case HiOpcodeEnum::ConvertVarVar_i8_i4:
+		case HiOpcodeEnum::ConvertVarVar_i8_u4:
+		case HiOpcodeEnum::ConvertVarVar_i8_i8:
+		case HiOpcodeEnum::ConvertVarVar_i8_u8:
+		case HiOpcodeEnum::ConvertVarVar_i8_f4:
+		case HiOpcodeEnum::ConvertVarVar_i8_f8:
+		case HiOpcodeEnum::ConvertVarVar_u8_i1:
+		case HiOpcodeEnum::ConvertVarVar_u8_u1:
+		case HiOpcodeEnum::ConvertVarVar_u8_i2:
+		case HiOpcodeEnum::ConvertVarVar_u8_u2:
+		case HiOpcodeEnum::ConvertVarVar_u8_i4:
+		case HiOpcodeEnum::ConvertVarVar_u8_u4:
+		case HiOpcodeEnum::ConvertVarVar_u8_i8:
+		case HiOpcodeEnum::ConvertVarVar_u8_u8:
+		case HiOpcodeEnum::ConvertVarVar_u8_f4:
+		case HiOpcodeEnum::ConvertVarVar_u8_f8:
+		case HiOpcodeEnum::ConvertVarVar_f4_i1:
+		case HiOpcodeEnum::ConvertVarVar_f4_u1:
+		case HiOpcodeEnum::ConvertVarVar_f4_i2:
+		case HiOpcodeEnum::ConvertVarVar_f4_u2:
+		case HiOpcodeEnum::ConvertVarVar_f4_i4:
+		case HiOpcodeEnum::ConvertVarVar_f4_u4:
+		case HiOpcodeEnum::ConvertVarVar_f4_i8:
+		case HiOpcodeEnum::ConvertVarVar_f4_u8:
+		case HiOpcodeEnum::ConvertVarVar_f4_f4:
+		case HiOpcodeEnum::ConvertVarVar_f4_f8:
+		case HiOpcodeEnum::ConvertVarVar_f8_i1:
+		case HiOpcodeEnum::ConvertVarVar_f8_u1:
+		case HiOpcodeEnum::ConvertVarVar_f8_i2:
+		case HiOpcodeEnum::ConvertVarVar_f8_u2:
+		case HiOpcodeEnum::ConvertVarVar_f8_i4:
+		case HiOpcodeEnum::ConvertVarVar_f8_u4:
+		case HiOpcodeEnum::ConvertVarVar_f8_i8:
+		case HiOpcodeEnum::ConvertVarVar_f8_u8:
+		case HiOpcodeEnum::ConvertVarVar_f8_f4:
+		case HiOpcodeEnum::ConvertVarVar_f8_f8:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_i4:
+		case HiOpcodeEnum::UnaryOpVarVar_Not_i4:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_i8:
+		case HiOpcodeEnum::UnaryOpVarVar_Not_i8:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_f4:
+		case HiOpcodeEnum::UnaryOpVarVar_Neg_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_MulUn_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_And_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i4:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_MulUn_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_And_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Or_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Xor_i8:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f4:
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Sub_f8:
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f8:
+		case HiOpcodeEnum::BinOpVarVarConst_Add_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_And_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Or_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Xor_i4:
+		case HiOpcodeEnum::BinOpVarVarConst_Add_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_And_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Or_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Xor_i8:
+		case HiOpcodeEnum::BinOpVarVarConst_Add_f4:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_f4:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_f4:
+		case HiOpcodeEnum::BinOpVarVarConst_Add_f8:
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_f8:
+		case HiOpcodeEnum::BinOpVarVarConst_Mul_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Ceq_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Cgt_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_CgtUn_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_f8:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i4:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_i8:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f4:
+		case HiOpcodeEnum::CompOpVarVarVar_CltUn_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_Ceq_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_Cgt_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_CgtUn_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_Clt_f8:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_i4:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_i8:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_f4:
+		case HiOpcodeEnum::CompOpVarVarConst_CltUn_f8:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	static bool IsNoFallthroughIR(IRCommon* ir)
+	{
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::BranchUncondition_4:
+		case HiOpcodeEnum::RetVar_ret_1:
+		case HiOpcodeEnum::RetVar_ret_2:
+		case HiOpcodeEnum::RetVar_ret_4:
+		case HiOpcodeEnum::RetVar_ret_8:
+		case HiOpcodeEnum::RetVar_ret_12:
+		case HiOpcodeEnum::RetVar_ret_16:
+		case HiOpcodeEnum::RetVar_ret_20:
+		case HiOpcodeEnum::RetVar_ret_24:
+		case HiOpcodeEnum::RetVar_ret_28:
+		case HiOpcodeEnum::RetVar_ret_32:
+		case HiOpcodeEnum::RetVar_ret_n:
+		case HiOpcodeEnum::RetVar_void:
+		case HiOpcodeEnum::ThrowEx:
+		case HiOpcodeEnum::RethrowEx:
+		case HiOpcodeEnum::LeaveEx:
+		case HiOpcodeEnum::LeaveEx_Directly:
+		case HiOpcodeEnum::EndFilterEx:
+		case HiOpcodeEnum::EndFinallyEx:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	static int32_t* GetBranchTargetOffset(IRCommon* ir)
+	{
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::BranchUncondition_4:
+			return &((IRBranchUncondition_4*)ir)->offset;
+		case HiOpcodeEnum::BranchTrueVar_i4:
+		case HiOpcodeEnum::BranchTrueVar_i8:
+		case HiOpcodeEnum::BranchFalseVar_i4:
+		case HiOpcodeEnum::BranchFalseVar_i8:
+			return &((IRBranchTrueVar_i4*)ir)->offset;
+		case HiOpcodeEnum::BranchVarVar_Ceq_i4:
+		case HiOpcodeEnum::BranchVarVar_Ceq_i8:
+		case HiOpcodeEnum::BranchVarVar_Ceq_f4:
+		case HiOpcodeEnum::BranchVarVar_Ceq_f8:
+		case HiOpcodeEnum::BranchVarVar_CneUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CneUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CneUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CneUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i8:
+		case HiOpcodeEnum::BranchVarVar_Cgt_f4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_f8:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cge_i4:
+		case HiOpcodeEnum::BranchVarVar_Cge_i8:
+		case HiOpcodeEnum::BranchVarVar_Cge_f4:
+		case HiOpcodeEnum::BranchVarVar_Cge_f8:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Clt_i4:
+		case HiOpcodeEnum::BranchVarVar_Clt_i8:
+		case HiOpcodeEnum::BranchVarVar_Clt_f4:
+		case HiOpcodeEnum::BranchVarVar_Clt_f8:
+		case HiOpcodeEnum::BranchVarVar_CltUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CltUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CltUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CltUn_f8:
+		case HiOpcodeEnum::BranchVarVar_Cle_i4:
+		case HiOpcodeEnum::BranchVarVar_Cle_i8:
+		case HiOpcodeEnum::BranchVarVar_Cle_f4:
+		case HiOpcodeEnum::BranchVarVar_Cle_f8:
+		case HiOpcodeEnum::BranchVarVar_CleUn_i4:
+		case HiOpcodeEnum::BranchVarVar_CleUn_i8:
+		case HiOpcodeEnum::BranchVarVar_CleUn_f4:
+		case HiOpcodeEnum::BranchVarVar_CleUn_f8:
+			return &((IRBranchVarVar_Ceq_i4*)ir)->offset;
+		case HiOpcodeEnum::BranchVarConst_Ceq_i4:
+		case HiOpcodeEnum::BranchVarConst_Ceq_i8:
+		case HiOpcodeEnum::BranchVarConst_Ceq_f4:
+		case HiOpcodeEnum::BranchVarConst_Ceq_f8:
+		case HiOpcodeEnum::BranchVarConst_CneUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CneUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CneUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CneUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Cgt_i4:
+		case HiOpcodeEnum::BranchVarConst_Cgt_i8:
+		case HiOpcodeEnum::BranchVarConst_Cgt_f4:
+		case HiOpcodeEnum::BranchVarConst_Cgt_f8:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Cge_i4:
+		case HiOpcodeEnum::BranchVarConst_Cge_i8:
+		case HiOpcodeEnum::BranchVarConst_Cge_f4:
+		case HiOpcodeEnum::BranchVarConst_Cge_f8:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Clt_i4:
+		case HiOpcodeEnum::BranchVarConst_Clt_i8:
+		case HiOpcodeEnum::BranchVarConst_Clt_f4:
+		case HiOpcodeEnum::BranchVarConst_Clt_f8:
+		case HiOpcodeEnum::BranchVarConst_CltUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CltUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CltUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CltUn_f8:
+		case HiOpcodeEnum::BranchVarConst_Cle_i4:
+		case HiOpcodeEnum::BranchVarConst_Cle_i8:
+		case HiOpcodeEnum::BranchVarConst_Cle_f4:
+		case HiOpcodeEnum::BranchVarConst_Cle_f8:
+		case HiOpcodeEnum::BranchVarConst_CleUn_i4:
+		case HiOpcodeEnum::BranchVarConst_CleUn_i8:
+		case HiOpcodeEnum::BranchVarConst_CleUn_f4:
+		case HiOpcodeEnum::BranchVarConst_CleUn_f8:
+			return &((IRBranchVarConst_Ceq_i4*)ir)->offset;
+		case HiOpcodeEnum::BranchClassNotEqualVar:
+			return &((IRBranchClassNotEqualVar*)ir)->offset;
+		default:
+			return nullptr;
+		}
+	}
+
+	static bool GetLdcValue(IRCommon* ir, uint64_t& bits, int32_t& size)
+	{
+		bits = 0;
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::LdcVarConst_1:
+		{
+			*(int32_t*)&bits = ((IRLdcVarConst_1*)ir)->src;
+			size = 4;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_2:
+		{
+			*(int32_t*)&bits = ((IRLdcVarConst_2*)ir)->src;
+			size = 4;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_4:
+		{
+			*(int32_t*)&bits = ((IRLdcVarConst_4*)ir)->src;
+			size = 4;
+			return true;
+		}
+		case HiOpcodeEnum::LdcVarConst_8:
+		{
+			bits = ((IRLdcVarConst_8*)ir)->src;
+			size = 8;
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	// same expressions as the handlers. float sources are not folded, their casts depend on the platform.
+	// returns the byte size of the result, or 0 if not foldable.
+	static int32_t FoldConvert(HiOpcodeEnum op, uint64_t src, int32_t srcSize, uint64_t& dst)
+	{
+		dst = 0;
+		switch (op)
+		{
+		case HiOpcodeEnum::ConvertVarVar_i4_i1:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int8_t)((*(int32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_u1:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint8_t)(uint32_t)((*(int32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_i2:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int16_t)((*(int32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_u2:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint16_t)(uint32_t)((*(int32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_i4:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int32_t)((*(int32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_u4:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint32_t)(uint32_t)((*(int32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_i8:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (int64_t)((*(int32_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_u8:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (uint64_t)(uint32_t)((*(int32_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_f4:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(float*)&dst = (float)((*(int32_t*)&src));
+			return sizeof(float);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i4_f8:
+		{
+			if (srcSize != (int32_t)sizeof(int32_t))
+			{
+				return 0;
+			}
+			*(double*)&dst = (double)((*(int32_t*)&src));
+			return sizeof(double);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_i1:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int8_t)((*(uint32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_u1:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint8_t)((*(uint32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_i2:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int16_t)((*(uint32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_u2:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint16_t)((*(uint32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_i4:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int32_t)((*(uint32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_u4:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint32_t)((*(uint32_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_i8:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (int64_t)((*(uint32_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_u8:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (uint64_t)((*(uint32_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_f4:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(float*)&dst = (float)((*(uint32_t*)&src));
+			return sizeof(float);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u4_f8:
+		{
+			if (srcSize != (int32_t)sizeof(uint32_t))
+			{
+				return 0;
+			}
+			*(double*)&dst = (double)((*(uint32_t*)&src));
+			return sizeof(double);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_i1:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int8_t)((*(int64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_u1:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint8_t)(uint64_t)((*(int64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_i2:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int16_t)((*(int64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_u2:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint16_t)(uint64_t)((*(int64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_i4:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int32_t)((*(int64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_u4:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint32_t)(uint64_t)((*(int64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_i8:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (int64_t)((*(int64_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_u8:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (uint64_t)(uint64_t)((*(int64_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_f4:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(float*)&dst = (float)((*(int64_t*)&src));
+			return sizeof(float);
+		}
+		case HiOpcodeEnum::ConvertVarVar_i8_f8:
+		{
+			if (srcSize != (int32_t)sizeof(int64_t))
+			{
+				return 0;
+			}
+			*(double*)&dst = (double)((*(int64_t*)&src));
+			return sizeof(double);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_i1:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int8_t)((*(uint64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_u1:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint8_t)((*(uint64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_i2:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int16_t)((*(uint64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_u2:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint16_t)((*(uint64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_i4:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (int32_t)((*(uint64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_u4:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int32_t*)&dst = (uint32_t)((*(uint64_t*)&src));
+			return sizeof(int32_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_i8:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (int64_t)((*(uint64_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_u8:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(int64_t*)&dst = (uint64_t)((*(uint64_t*)&src));
+			return sizeof(int64_t);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_f4:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(float*)&dst = (float)((*(uint64_t*)&src));
+			return sizeof(float);
+		}
+		case HiOpcodeEnum::ConvertVarVar_u8_f8:
+		{
+			if (srcSize != (int32_t)sizeof(uint64_t))
+			{
+				return 0;
+			}
+			*(double*)&dst = (double)((*(uint64_t*)&src));
+			return sizeof(double);
+		}
+		default:
+			return 0;
+		}
+	}
+
+	static bool IsFrameAddressTaken(const TemporaryVector<IRBasicBlock*>& irbbs)
+	{
+		for (IRBasicBlock* bb : irbbs)
+		{
+			for (IRCommon* ir : bb->insts)
+			{
+				if (ir->type == HiOpcodeEnum::LdlocVarAddress)
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	// irbbs is in layout order but not sorted by il offset once inlined bodies are spliced in,
+	// so basic blocks are located by pointer.
+	typedef std::unordered_map<IRBasicBlock*, size_t> BasicBlockIndexMap;
+
+	static void BuildBasicBlockIndexMap(const TemporaryVector<IRBasicBlock*>& irbbs, BasicBlockIndexMap& bbIndexes)
+	{
+		for (size_t i = 0; i < irbbs.size(); i++)
+		{
+			bbIndexes[irbbs[i]] = i;
+		}
+	}
+
+	static size_t GetBasicBlockIndex(const BasicBlockIndexMap& bbIndexes, IRBasicBlock* bb)
+	{
+		auto it = bbIndexes.find(bb);
+		IL2CPP_ASSERT(it != bbIndexes.end());
+		return it->second;
+	}
+
+	typedef std::unordered_map<int32_t*, IRRelocation*> RelocationMap;
+
+	static void BuildRelocationMap(std::vector<IRRelocation>& relocationOffsets, RelocationMap& relocs)
+	{
+		for (IRRelocation& reloc : relocationOffsets)
+		{
+			relocs[reloc.offsetPtr] = &reloc;
+		}
+	}
+
+	static IRRelocation& GetRelocation(const RelocationMap& relocs, int32_t* offsetPtr)
+	{
+		auto it = relocs.find(offsetPtr);
+		IL2CPP_ASSERT(it != relocs.end());
+		return *it->second;
+	}
+
+	static size_t SkipEmptyBasicBlocks(const TemporaryVector<IRBasicBlock*>& irbbs, size_t index)
+	{
+		while (index + 1 < irbbs.size() && irbbs[index]->insts.empty())
+		{
+			++index;
+		}
+		return index;
+	}
+
+	enum class SlotValueKind : uint8_t
+	{
+		Unknown,
+		Const,
+		Copy,
+	};
+
+	struct SlotValue
+	{
+		SlotValueKind kind;
+		uint16_t src;
+		int32_t size;
+		uint64_t bits;
+	};
+
+	// values of slots known at the current instruction of a basic block
+	class SlotValueTracker
+	{
+	public:
+		SlotValueTracker(int32_t slotCount) : _values(slotCount)
+		{
+		}
+
+		const SlotValue& Get(uint16_t slot) const
+		{
+			return _values[slot];
+		}
+
+		void SetConst(uint16_t slot, uint64_t bits, int32_t size)
+		{
+			Set(slot, { SlotValueKind::Const, 0, size, bits });
+		}
+
+		void SetCopy(uint16_t slot, uint16_t src)
+		{
+			Set(slot, { SlotValueKind::Copy, src, 0, 0 });
+		}
+
+		// slot is written, forget its value and all copies of it
+		void Kill(uint16_t slot)
+		{
+			for (uint16_t s : _knownSlots)
+			{
+				SlotValue& v = _values[s];
+				if (s == slot || (v.kind == SlotValueKind::Copy && v.src == slot))
+				{
+					v.kind = SlotValueKind::Unknown;
+				}
+			}
+		}
+
+		void Clear()
+		{
+			for (uint16_t s : _knownSlots)
+			{
+				_values[s].kind = SlotValueKind::Unknown;
+			}
+			_knownSlots.clear();
+		}
+
+	private:
+		void Set(uint16_t slot, const SlotValue& value)
+		{
+			if (_values[slot].kind == SlotValueKind::Unknown)
+			{
+				_knownSlots.push_back(slot);
+			}
+			_values[slot] = value;
+		}
+
+		std::vector<SlotValue> _values;
+		std::vector<uint16_t> _knownSlots;
+	};
+
+	static bool IsSlotRead(const IROperandSlots& slots, uint16_t slot)
+	{
+		for (int32_t i = 0; i < slots.readCount; i++)
+		{
+			if (*slots.reads[i] == slot)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static bool IsSlotLiveAfter(const std::vector<IRCommon*>& insts, size_t index, uint16_t slot, bool frameAddressTaken, int32_t liveOutStackSize)
+	{
+		for (size_t i = index + 1; i < insts.size(); i++)
+		{
+			IROperandSlots slots;
+			if (!GetIROperandSlots(insts[i], frameAddressTaken, slots) || IsSlotRead(slots, slot))
+			{
+				return true;
+			}
+			if (slots.write && *slots.write == slot)
+			{
+				return false;
+			}
+		}
+		return slot < liveOutStackSize;
+	}
+
+	// tmp = ldloc src; ... ; consumer(tmp)  =>  ... ; consumer(src)
+	// src and tmp must be untouched in between and tmp must be dead after the consumer.
+	static bool TryForwardMoveSource(std::vector<IRCommon*>& insts, size_t index, bool frameAddressTaken, int32_t liveOutStackSize)
+	{
+		IRLdlocVarVar* mov = (IRLdlocVarVar*)insts[index];
+		uint16_t tmp = mov->dst;
+		uint16_t src = mov->src;
+		for (size_t i = index + 1; i < insts.size(); i++)
+		{
+			IROperandSlots slots;
+			if (!GetIROperandSlots(insts[i], frameAddressTaken, slots))
+			{
+				return false;
+			}
+			if (IsSlotRead(slots, tmp))
+			{
+				bool overwritten = slots.write && *slots.write == tmp;
+				if (!overwritten && IsSlotLiveAfter(insts, i, tmp, frameAddressTaken, liveOutStackSize))
+				{
+					return false;
+				}
+				for (int32_t j = 0; j < slots.readCount; j++)
+				{
+					if (*slots.reads[j] == tmp)
+					{
+						*slots.reads[j] = src;
+					}
+				}
+				return true;
+			}
+			if (slots.write && (*slots.write == tmp || *slots.write == src))
+			{
+				return false;
+			}
+		}
+		return false;
+	}
+
+	// producer -> tmp; dst = ldloc tmp  =>  producer -> dst
+	// tmp must be dead after the move.
+	static bool TryRetargetMoveProducer(std::vector<IRCommon*>& insts, size_t index, bool frameAddressTaken, int32_t liveOutStackSize)
+	{
+		IRLdlocVarVar* mov = (IRLdlocVarVar*)insts[index];
+		IROperandSlots slots;
+		if (index == 0 || !GetIROperandSlots(insts[index - 1], frameAddressTaken, slots) || !slots.write || *slots.write != mov->src)
+		{
+			return false;
+		}
+		if (IsSlotLiveAfter(insts, index, mov->src, frameAddressTaken, liveOutStackSize))
+		{
+			return false;
+		}
+		*slots.write = mov->dst;
+		return true;
+	}
+
+	void TransformContext::CoalesceEvalStackMoves(bool frameAddressTaken)
+	{
+		for (IRBasicBlock* bb : irbbs)
+		{
+			std::vector<IRCommon*>& insts = bb->insts;
+			for (size_t i = 0; i < insts.size(); )
+			{
+				IRLdlocVarVar* mov = (IRLdlocVarVar*)insts[i];
+				if (mov->type == HiOpcodeEnum::LdlocVarVar && mov->dst >= evalStackBaseOffset && mov->dst != mov->src
+					&& TryForwardMoveSource(insts, i, frameAddressTaken, maxBasicBlockEntryStackSize))
+				{
+					insts.erase(insts.begin() + i);
+				}
+				else
+				{
+					++i;
+				}
+			}
+			for (size_t i = 0; i < insts.size(); )
+			{
+				IRLdlocVarVar* mov = (IRLdlocVarVar*)insts[i];
+				if (mov->type == HiOpcodeEnum::LdlocVarVar && (mov->dst == mov->src
+					|| (mov->src >= evalStackBaseOffset && TryRetargetMoveProducer(insts, i, frameAddressTaken, maxBasicBlockEntryStackSize))))
+				{
+					insts.erase(insts.begin() + i);
+				}
+				else
+				{
+					++i;
+				}
+			}
+		}
+	}
+
+	void TransformContext::ReplaceIR(std::vector<IRCommon*>& insts, size_t index, IRCommon* newIr)
+	{
+		if (ir2offsetMap)
+		{
+			auto it = ir2offsetMap->find(insts[index]);
+			if (it != ir2offsetMap->end())
+			{
+				uint32_t ilOffset = it->second;
+				ir2offsetMap->insert({ newIr, ilOffset });
+			}
+		}
+		insts[index] = newIr;
+	}
+
+	IRBasicBlock* TransformContext::RemoveRelocationOffset(int32_t* offsetPtr)
+	{
+		auto it = std::find_if(relocationOffsets.begin(), relocationOffsets.end(), [offsetPtr](const IRRelocation& reloc) { return reloc.offsetPtr == offsetPtr; });
+		IL2CPP_ASSERT(it != relocationOffsets.end());
+		IRBasicBlock* targetBb = it->targetBb;
+		relocationOffsets.erase(it);
+		return targetBb;
+	}
+
+	IRCommon* TransformContext::CreateLdcIR(uint16_t dst, uint64_t bits, int32_t size)
+	{
+		if (size == 8)
+		{
+			CreateIR(ir, LdcVarConst_8);
+			ir->dst = dst;
+			ir->src = bits;
+			return ir;
+		}
+		else
+		{
+			IL2CPP_ASSERT(size == 4);
+			CreateIR(ir, LdcVarConst_4);
+			ir->dst = dst;
+			ir->src = *(uint32_t*)&bits;
+			return ir;
+		}
+	}
+
+	// local copy propagation and constant folding. a read of an eval stack slot holding a copy reads the
+	// source instead, copies and conversions of constants become ldc, and branches on constants are resolved.
+	void TransformContext::PropagateConstantsAndCopies(bool frameAddressTaken)
+	{
+		SlotValueTracker tracker(maxStackSize);
+		for (IRBasicBlock* bb : irbbs)
+		{
+			tracker.Clear();
+			std::vector<IRCommon*>& insts = bb->insts;
+			for (size_t i = 0; i < insts.size(); )
+			{
+				IRCommon* ir = insts[i];
+				IROperandSlots slots;
+				if (!GetIROperandSlots(ir, frameAddressTaken, slots))
+				{
+					tracker.Clear();
+					++i;
+					continue;
+				}
+				for (int32_t j = 0; j < slots.readCount; j++)
+				{
+					const SlotValue& v = tracker.Get(*slots.reads[j]);
+					if (v.kind == SlotValueKind::Copy)
+					{
+						*slots.reads[j] = v.src;
+					}
+				}
+
+				switch (ir->type)
+				{
+				case HiOpcodeEnum::BranchTrueVar_i4:
+				case HiOpcodeEnum::BranchTrueVar_i8:
+				case HiOpcodeEnum::BranchFalseVar_i4:
+				case HiOpcodeEnum::BranchFalseVar_i8:
+				{
+					IRBranchTrueVar_i4* br = (IRBranchTrueVar_i4*)ir;
+					const SlotValue& v = tracker.Get(br->op);
+					bool is64 = ir->type == HiOpcodeEnum::BranchTrueVar_i8 || ir->type == HiOpcodeEnum::BranchFalseVar_i8;
+					if (v.kind != SlotValueKind::Const || v.size < (is64 ? 8 : 4))
+					{
+						break;
+					}
+					bool nonZero = is64 ? v.bits != 0 : *(const int32_t*)&v.bits != 0;
+					bool taken = (ir->type == HiOpcodeEnum::BranchTrueVar_i4 || ir->type == HiOpcodeEnum::BranchTrueVar_i8) == nonZero;
+					IRBasicBlock* targetBb = RemoveRelocationOffset(&br->offset);
+					if (taken)
+					{
+						CreateIR(jmp, BranchUncondition_4);
+						jmp->offset = br->offset;
+						relocationOffsets.push_back({ &jmp->offset, targetBb });
+						ReplaceIR(insts, i, jmp);
+						++i;
+					}
+					else
+					{
+						insts.erase(insts.begin() + i);
+					}
+					continue;
+				}
+				default:
+				{
+					if (slots.readCount != 1 || !slots.write)
+					{
+						break;
+					}
+					const SlotValue& v = tracker.Get(*slots.reads[0]);
+					if (v.kind != SlotValueKind::Const)
+					{
+						break;
+					}
+					uint64_t bits = v.bits;
+					int32_t size = v.size;
+					if (ir->type != HiOpcodeEnum::LdlocVarVar)
+					{
+						size = FoldConvert(ir->type, v.bits, v.size, bits);
+					}
+					if (size)
+					{
+						ir = CreateLdcIR(*slots.write, bits, size);
+						ReplaceIR(insts, i, ir);
+						GetIROperandSlots(ir, frameAddressTaken, slots);
+					}
+					break;
+				}
+				}
+
+				if (slots.write)
+				{
+					uint16_t dst = *slots.write;
+					tracker.Kill(dst);
+					uint64_t bits;
+					int32_t size;
+					if (GetLdcValue(ir, bits, size))
+					{
+						tracker.SetConst(dst, bits, size);
+					}
+					else if (ir->type == HiOpcodeEnum::LdlocVarVar && dst >= evalStackBaseOffset && ((IRLdlocVarVar*)ir)->src != dst)
+					{
+						tracker.SetCopy(dst, ((IRLdlocVarVar*)ir)->src);
+					}
+				}
+				++i;
+			}
+		}
+	}
+
+	// a branch to a basic block that only jumps elsewhere goes there directly.
+	// an unconditional branch to the next instruction is removed.
+	void TransformContext::ThreadBranches()
+	{
+		const int32_t kMaxThreadingHops = 8;
+		BasicBlockIndexMap bbIndexes;
+		BuildBasicBlockIndexMap(irbbs, bbIndexes);
+		RelocationMap relocs;
+		BuildRelocationMap(relocationOffsets, relocs);
+		std::unordered_set<int32_t*> removedOffsets;
+		for (size_t bbIdx = 0; bbIdx < irbbs.size(); bbIdx++)
+		{
+			std::vector<IRCommon*>& insts = irbbs[bbIdx]->insts;
+			for (IRCommon* ir : insts)
+			{
+				int32_t* targetOffset = GetBranchTargetOffset(ir);
+				if (!targetOffset)
+				{
+					continue;
+				}
+				IRRelocation& reloc = GetRelocation(relocs, targetOffset);
+				for (int32_t hop = 0; hop < kMaxThreadingHops; hop++)
+				{
+					IRBasicBlock* target = irbbs[SkipEmptyBasicBlocks(irbbs, GetBasicBlockIndex(bbIndexes, reloc.targetBb))];
+					if (target->insts.size() != 1 || target->insts[0]->type != HiOpcodeEnum::BranchUncondition_4)
+					{
+						break;
+					}
+					reloc.targetBb = GetRelocation(relocs, &((IRBranchUncondition_4*)target->insts[0])->offset).targetBb;
+				}
+			}
+			if (!insts.empty() && insts.back()->type == HiOpcodeEnum::BranchUncondition_4)
+			{
+				IRBranchUncondition_4* jmp = (IRBranchUncondition_4*)insts.back();
+				size_t targetIdx = SkipEmptyBasicBlocks(irbbs, GetBasicBlockIndex(bbIndexes, GetRelocation(relocs, &jmp->offset).targetBb));
+				if (targetIdx > bbIdx && targetIdx == SkipEmptyBasicBlocks(irbbs, bbIdx + 1))
+				{
+					removedOffsets.insert(&jmp->offset);
+					insts.pop_back();
+				}
+			}
+		}
+		// relocations are erased at last, relocs points into relocationOffsets
+		if (!removedOffsets.empty())
+		{
+			relocationOffsets.erase(std::remove_if(relocationOffsets.begin(), relocationOffsets.end(),
+				[&removedOffsets](const IRRelocation& reloc) { return removedOffsets.find(reloc.offsetPtr) != removedOffsets.end(); }),
+				relocationOffsets.end());
+		}
+	}
+
+	// basic blocks are reached from the entry, by fall through, by branches, and by every il offset kept in
+	// relocations of other instructions (leave, switch, exception clauses), which are taken as roots.
+	// loop headers are roots too, frames of baseline code enter there by on stack replacement.
+	void TransformContext::RemoveUnreachableBasicBlocks()
+	{
+		BasicBlockIndexMap bbIndexes;
+		BuildBasicBlockIndexMap(irbbs, bbIndexes);
+		RelocationMap relocs;
+		BuildRelocationMap(relocationOffsets, relocs);
+		std::unordered_set<int32_t*> branchOffsets;
+		for (IRBasicBlock* bb : irbbs)
+		{
+			for (IRCommon* ir : bb->insts)
+			{
+				int32_t* targetOffset = GetBranchTargetOffset(ir);
+				if (targetOffset)
+				{
+					branchOffsets.insert(targetOffset);
+				}
+			}
+		}
+
+		std::vector<bool> reachable(irbbs.size(), false);
+		std::vector<size_t> pendingBbs;
+		auto markReachable = [&](size_t index)
+		{
+			if (!reachable[index])
+			{
+				reachable[index] = true;
+				pendingBbs.push_back(index);
+			}
+		};
+
+		markReachable(0);
+		for (size_t i = 0; i < irbbs.size(); i++)
+		{
+			if (irbbs[i]->loopHeader)
+			{
+				markReachable(i);
+			}
+		}
+		for (IRRelocation& reloc : relocationOffsets)
+		{
+			if (branchOffsets.find(reloc.offsetPtr) == branchOffsets.end())
+			{
+				markReachable(GetBasicBlockIndex(bbIndexes, reloc.targetBb));
+			}
+		}
+		for (auto switchOffsetPair : switchOffsetsInResolveData)
+		{
+			int32_t* offsetStartPtr = (int32_t*)&resolveDatas[switchOffsetPair.first];
+			for (int32_t i = 0; i < switchOffsetPair.second; i++)
+			{
+				markReachable(GetBasicBlockIndex(bbIndexes, ip2bb[offsetStartPtr[i]]));
+			}
+		}
+
+		while (!pendingBbs.empty())
+		{
+			size_t index = pendingBbs.back();
+			pendingBbs.pop_back();
+			std::vector<IRCommon*>& insts = irbbs[index]->insts;
+			for (IRCommon* ir : insts)
+			{
+				int32_t* targetOffset = GetBranchTargetOffset(ir);
+				if (targetOffset)
+				{
+					markReachable(GetBasicBlockIndex(bbIndexes, GetRelocation(relocs, targetOffset).targetBb));
+				}
+			}
+			if (index + 1 < irbbs.size() && (insts.empty() || !IsNoFallthroughIR(insts.back())))
+			{
+				markReachable(index + 1);
+			}
+		}
+
+		for (size_t i = 0; i < irbbs.size(); i++)
+		{
+			if (!reachable[i])
+			{
+				irbbs[i]->insts.clear();
+			}
+		}
+	}
+
+	// removes pure instructions whose result is an eval stack slot that is never read
+	void TransformContext::RemoveDeadStores(bool frameAddressTaken)
+	{
+		std::vector<bool> live(maxStackSize);
+		for (IRBasicBlock* bb : irbbs)
+		{
+			std::vector<IRCommon*>& insts = bb->insts;
+			for (int32_t slot = 0; slot < maxStackSize; slot++)
+			{
+				live[slot] = slot < maxBasicBlockEntryStackSize;
+			}
+			for (size_t i = insts.size(); i-- > 0; )
+			{
+				IRCommon* ir = insts[i];
+				IROperandSlots slots;
+				if (!GetIROperandSlots(ir, frameAddressTaken, slots))
+				{
+					std::fill(live.begin(), live.end(), true);
+					continue;
+				}
+				if (slots.write)
+				{
+					uint16_t dst = *slots.write;
+					IL2CPP_ASSERT(dst < maxStackSize);
+					if (!live[dst] && dst >= evalStackBaseOffset && IsPureIR(ir))
+					{
+						insts.erase(insts.begin() + i);
+						continue;
+					}
+					live[dst] = false;
+				}
+				for (int32_t j = 0; j < slots.readCount; j++)
+				{
+					live[*slots.reads[j]] = true;
+				}
+			}
+		}
+	}
+
+	// facts proven by the checks and branches executed before an instruction, used to drop null and bounds checks.
+	// integer facts are about the i4 value of a slot, the way array indexes and i4 branches read it.
+	struct SlotPair
+	{
+		uint16_t slot;
+		uint16_t arr;
+	};
+
+	class CheckFacts
+	{
+	public:
+		CheckFacts() : _reached(false)
+		{
+		}
+
+		bool IsReached() const
+		{
+			return _reached;
+		}
+
+		void SetReached()
+		{
+			_reached = true;
+		}
+
+		bool IsNonNull(uint16_t slot) const
+		{
+			return std::find(_nonNullSlots.begin(), _nonNullSlots.end(), slot) != _nonNullSlots.end();
+		}
+
+		bool IsNonNegative(uint16_t slot) const
+		{
+			return std::find(_nonNegativeSlots.begin(), _nonNegativeSlots.end(), slot) != _nonNegativeSlots.end();
+		}
+
+		bool IsInArrayRange(uint16_t index, uint16_t arr) const
+		{
+			return IsNonNegative(index) && ContainsPair(_belowArrayLengths, index, arr);
+		}
+
+		void AddNonNull(uint16_t slot)
+		{
+			if (!IsNonNull(slot))
+			{
+				_nonNullSlots.push_back(slot);
+			}
+		}
+
+		void AddNonNegative(uint16_t slot)
+		{
+			if (!IsNonNegative(slot))
+			{
+				_nonNegativeSlots.push_back(slot);
+			}
+		}
+
+		// slot holds the length of arr
+		void AddArrayLength(uint16_t slot, uint16_t arr)
+		{
+			AddNonNegative(slot);
+			AddPair(_arrayLengths, slot, arr);
+		}
+
+		// slot is less than the length of arr
+		void AddBelowArrayLength(uint16_t slot, uint16_t arr)
+		{
+			AddPair(_belowArrayLengths, slot, arr);
+		}
+
+		void AddInArrayRange(uint16_t index, uint16_t arr)
+		{
+			AddNonNegative(index);
+			AddPair(_belowArrayLengths, index, arr);
+		}
+
+		// lhs < rhs
+		void AddLessThan(uint16_t lhs, uint16_t rhs, bool unsignedCompare)
+		{
+			for (size_t i = 0; i < _arrayLengths.size(); i++)
+			{
+				if (_arrayLengths[i].slot == rhs)
+				{
+					uint16_t arr = _arrayLengths[i].arr;
+					// an unsigned compare with a length rejects negative values too
+					unsignedCompare ? AddInArrayRange(lhs, arr) : AddBelowArrayLength(lhs, arr);
+				}
+			}
+		}
+
+		// lhs >= rhs, signed
+		void AddGreaterOrEqual(uint16_t lhs, uint16_t rhs)
+		{
+			if (IsNonNegative(rhs))
+			{
+				AddNonNegative(lhs);
+			}
+		}
+
+		// copies facts of src to dst, which has been killed
+		void CopyIntFacts(uint16_t dst, uint16_t src)
+		{
+			if (IsNonNegative(src))
+			{
+				AddNonNegative(dst);
+			}
+			CopyPairs(_arrayLengths, dst, src);
+			CopyPairs(_belowArrayLengths, dst, src);
+		}
+
+		void CopyFacts(uint16_t dst, uint16_t src)
+		{
+			if (IsNonNull(src))
+			{
+				AddNonNull(dst);
+			}
+			CopyIntFacts(dst, src);
+		}
+
+		void CollectBelowArrayLengths(uint16_t slot, std::vector<uint16_t>& arrs) const
+		{
+			for (const SlotPair& p : _belowArrayLengths)
+			{
+				if (p.slot == slot)
+				{
+					arrs.push_back(p.arr);
+				}
+			}
+		}
+
+		void CollectArrayLengths(uint16_t slot, std::vector<uint16_t>& arrs) const
+		{
+			for (const SlotPair& p : _arrayLengths)
+			{
+				if (p.slot == slot)
+				{
+					arrs.push_back(p.arr);
+				}
+			}
+		}
+
+		void KillNonNull(uint16_t slot)
+		{
+			_nonNullSlots.erase(std::remove(_nonNullSlots.begin(), _nonNullSlots.end(), slot), _nonNullSlots.end());
+		}
+
+		// slot is written, forget every fact about it
+		void Kill(uint16_t slot)
+		{
+			KillSlots(slot, slot + 1);
+		}
+
+		void KillSlots(uint32_t begin, uint32_t end)
+		{
+			auto inRange = [begin, end](uint16_t slot) { return slot >= begin && slot < end; };
+			_nonNullSlots.erase(std::remove_if(_nonNullSlots.begin(), _nonNullSlots.end(), inRange), _nonNullSlots.end());
+			_nonNegativeSlots.erase(std::remove_if(_nonNegativeSlots.begin(), _nonNegativeSlots.end(), inRange), _nonNegativeSlots.end());
+			auto pairInRange = [&inRange](const SlotPair& p) { return inRange(p.slot) || inRange(p.arr); };
+			_arrayLengths.erase(std::remove_if(_arrayLengths.begin(), _arrayLengths.end(), pairInRange), _arrayLengths.end());
+			_belowArrayLengths.erase(std::remove_if(_belowArrayLengths.begin(), _belowArrayLengths.end(), pairInRange), _belowArrayLengths.end());
+		}
+
+		// keeps facts that also hold in other. returns true if this changed.
+		bool Intersect(const CheckFacts& other)
+		{
+			if (!_reached)
+			{
+				*this = other;
+				_reached = true;
+				return true;
+			}
+			size_t oldCount = _nonNullSlots.size() + _nonNegativeSlots.size() + _arrayLengths.size() + _belowArrayLengths.size();
+			_nonNullSlots.erase(std::remove_if(_nonNullSlots.begin(), _nonNullSlots.end(), [&other](uint16_t s) { return !other.IsNonNull(s); }), _nonNullSlots.end());
+			_nonNegativeSlots.erase(std::remove_if(_nonNegativeSlots.begin(), _nonNegativeSlots.end(), [&other](uint16_t s) { return !other.IsNonNegative(s); }), _nonNegativeSlots.end());
+			_arrayLengths.erase(std::remove_if(_arrayLengths.begin(), _arrayLengths.end(), [&other](const SlotPair& p) { return !ContainsPair(other._arrayLengths, p.slot, p.arr); }), _arrayLengths.end());
+			_belowArrayLengths.erase(std::remove_if(_belowArrayLengths.begin(), _belowArrayLengths.end(), [&other](const SlotPair& p) { return !ContainsPair(other._belowArrayLengths, p.slot, p.arr); }), _belowArrayLengths.end());
+			return oldCount != _nonNullSlots.size() + _nonNegativeSlots.size() + _arrayLengths.size() + _belowArrayLengths.size();
+		}
+
+	private:
+		static bool ContainsPair(const std::vector<SlotPair>& pairs, uint16_t slot, uint16_t arr)
+		{
+			for (const SlotPair& p : pairs)
+			{
+				if (p.slot == slot && p.arr == arr)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		static void AddPair(std::vector<SlotPair>& pairs, uint16_t slot, uint16_t arr)
+		{
+			if (!ContainsPair(pairs, slot, arr))
+			{
+				pairs.push_back({ slot, arr });
+			}
+		}
+
+		static void CopyPairs(std::vector<SlotPair>& pairs, uint16_t dst, uint16_t src)
+		{
+			for (size_t i = 0, n = pairs.size(); i < n; i++)
+			{
+				SlotPair p = pairs[i];
+				if (p.slot == src)
+				{
+					AddPair(pairs, dst, p.arr);
+				}
+				if (p.arr == src)
+				{
+					AddPair(pairs, p.slot, dst);
+				}
+			}
+		}
+
+		bool _reached;
+		std::vector<uint16_t> _nonNullSlots;
+		std::vector<uint16_t> _nonNegativeSlots;
+		std::vector<SlotPair> _arrayLengths;
+		std::vector<SlotPair> _belowArrayLengths;
+	};
+
+	static HiOpcodeEnum GetNoCheckOpcode(HiOpcodeEnum op)
+	{
+		switch (op)
+		{
+		case HiOpcodeEnum::GetArrayElementVarVar_i1: return HiOpcodeEnum::GetArrayElementVarVar_i1_NoCheck;
+		case HiOpcodeEnum::GetArrayElementVarVar_u1: return HiOpcodeEnum::GetArrayElementVarVar_u1_NoCheck;
+		case HiOpcodeEnum::GetArrayElementVarVar_i2: return HiOpcodeEnum::GetArrayElementVarVar_i2_NoCheck;
+		case HiOpcodeEnum::GetArrayElementVarVar_u2: return HiOpcodeEnum::GetArrayElementVarVar_u2_NoCheck;
+		case HiOpcodeEnum::GetArrayElementVarVar_i4: return HiOpcodeEnum::GetArrayElementVarVar_i4_NoCheck;
+		case HiOpcodeEnum::GetArrayElementVarVar_u4: return HiOpcodeEnum::GetArrayElementVarVar_u4_NoCheck;
+		case HiOpcodeEnum::GetArrayElementVarVar_i8: return HiOpcodeEnum::GetArrayElementVarVar_i8_NoCheck;
+		case HiOpcodeEnum::GetArrayElementVarVar_u8: return HiOpcodeEnum::GetArrayElementVarVar_u8_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_i1: return HiOpcodeEnum::SetArrayElementVarVar_i1_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_u1: return HiOpcodeEnum::SetArrayElementVarVar_u1_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_i2: return HiOpcodeEnum::SetArrayElementVarVar_i2_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_u2: return HiOpcodeEnum::SetArrayElementVarVar_u2_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_i4: return HiOpcodeEnum::SetArrayElementVarVar_i4_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_u4: return HiOpcodeEnum::SetArrayElementVarVar_u4_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_i8: return HiOpcodeEnum::SetArrayElementVarVar_i8_NoCheck;
+		case HiOpcodeEnum::SetArrayElementVarVar_u8: return HiOpcodeEnum::SetArrayElementVarVar_u8_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_i1: return HiOpcodeEnum::LdfldVarVar_i1_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_u1: return HiOpcodeEnum::LdfldVarVar_u1_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_i2: return HiOpcodeEnum::LdfldVarVar_i2_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_u2: return HiOpcodeEnum::LdfldVarVar_u2_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_i4: return HiOpcodeEnum::LdfldVarVar_i4_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_u4: return HiOpcodeEnum::LdfldVarVar_u4_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_i8: return HiOpcodeEnum::LdfldVarVar_i8_NoCheck;
+		case HiOpcodeEnum::LdfldVarVar_u8: return HiOpcodeEnum::LdfldVarVar_u8_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_i1: return HiOpcodeEnum::StfldVarVar_i1_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_u1: return HiOpcodeEnum::StfldVarVar_u1_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_i2: return HiOpcodeEnum::StfldVarVar_i2_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_u2: return HiOpcodeEnum::StfldVarVar_u2_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_i4: return HiOpcodeEnum::StfldVarVar_i4_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_u4: return HiOpcodeEnum::StfldVarVar_u4_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_i8: return HiOpcodeEnum::StfldVarVar_i8_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_u8: return HiOpcodeEnum::StfldVarVar_u8_NoCheck;
+		case HiOpcodeEnum::StfldVarVar_ref: return HiOpcodeEnum::StfldVarVar_ref_NoCheck;
+		default: return HiOpcodeEnum::None;
+		}
+	}
+
+	// conversions between 4 and 8 byte integers keep the low 4 bytes, so the i4 value of the result is the source's
+	static bool IsI4PreservingConvert(HiOpcodeEnum op)
+	{
+		switch (op)
+		{
+		case HiOpcodeEnum::ConvertVarVar_i4_i4:
+		case HiOpcodeEnum::ConvertVarVar_i4_u4:
+		case HiOpcodeEnum::ConvertVarVar_i4_i8:
+		case HiOpcodeEnum::ConvertVarVar_i4_u8:
+		case HiOpcodeEnum::ConvertVarVar_u4_i4:
+		case HiOpcodeEnum::ConvertVarVar_u4_u4:
+		case HiOpcodeEnum::ConvertVarVar_u4_i8:
+		case HiOpcodeEnum::ConvertVarVar_u4_u8:
+		case HiOpcodeEnum::ConvertVarVar_i8_i4:
+		case HiOpcodeEnum::ConvertVarVar_i8_u4:
+		case HiOpcodeEnum::ConvertVarVar_i8_i8:
+		case HiOpcodeEnum::ConvertVarVar_i8_u8:
+		case HiOpcodeEnum::ConvertVarVar_u8_i4:
+		case HiOpcodeEnum::ConvertVarVar_u8_u4:
+		case HiOpcodeEnum::ConvertVarVar_u8_i8:
+		case HiOpcodeEnum::ConvertVarVar_u8_u8:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// ret = op1 + delta
+	static void UpdateCheckFactsForAddConst(CheckFacts& facts, uint16_t ret, uint16_t op1, int32_t delta)
+	{
+		bool nonNegative = false;
+		std::vector<uint16_t> belowArrs;
+		if (delta == 0)
+		{
+			if (ret != op1)
+			{
+				facts.Kill(ret);
+				facts.CopyIntFacts(ret, op1);
+			}
+			return;
+		}
+		if (delta == 1)
+		{
+			// op1 < length <= INT32_MAX, so op1 + 1 doesn't overflow
+			std::vector<uint16_t> arrs;
+			facts.CollectBelowArrayLengths(op1, arrs);
+			nonNegative = facts.IsNonNegative(op1) && !arrs.empty();
+		}
+		else if (delta < 0 && delta != INT32_MIN)
+		{
+			// a non negative value minus a positive value doesn't overflow and stays below any bound of it
+			if (facts.IsNonNegative(op1))
+			{
+				facts.CollectBelowArrayLengths(op1, belowArrs);
+				facts.CollectArrayLengths(op1, belowArrs);
+			}
+		}
+		facts.Kill(ret);
+		if (nonNegative)
+		{
+			facts.AddNonNegative(ret);
+		}
+		for (uint16_t arr : belowArrs)
+		{
+			if (arr != ret)
+			{
+				facts.AddBelowArrayLength(ret, arr);
+			}
+		}
+	}
+
+	static void AddBranchVarVarFacts(CheckFacts& facts, HiOpcodeEnum op, uint16_t a, uint16_t b, bool taken)
+	{
+		switch (op)
+		{
+		case HiOpcodeEnum::BranchVarVar_Clt_i4:
+			taken ? facts.AddLessThan(a, b, false) : facts.AddGreaterOrEqual(a, b);
+			break;
+		case HiOpcodeEnum::BranchVarVar_CltUn_i4:
+			if (taken)
+			{
+				facts.AddLessThan(a, b, true);
+			}
+			break;
+		case HiOpcodeEnum::BranchVarVar_Cge_i4:
+			taken ? facts.AddGreaterOrEqual(a, b) : facts.AddLessThan(a, b, false);
+			break;
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i4:
+			if (!taken)
+			{
+				facts.AddLessThan(a, b, true);
+			}
+			break;
+		case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+			if (taken)
+			{
+				facts.AddLessThan(b, a, false);
+				facts.AddGreaterOrEqual(a, b);
+			}
+			else
+			{
+				facts.AddGreaterOrEqual(b, a);
+			}
+			break;
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i4:
+			if (taken)
+			{
+				facts.AddLessThan(b, a, true);
+			}
+			break;
+		case HiOpcodeEnum::BranchVarVar_Cle_i4:
+			if (taken)
+			{
+				facts.AddGreaterOrEqual(b, a);
+			}
+			else
+			{
+				facts.AddLessThan(b, a, false);
+				facts.AddGreaterOrEqual(a, b);
+			}
+			break;
+		case HiOpcodeEnum::BranchVarVar_CleUn_i4:
+			if (!taken)
+			{
+				facts.AddLessThan(b, a, true);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	static void AddBranchVarConstFacts(CheckFacts& facts, HiOpcodeEnum op, uint16_t a, int32_t c, bool taken)
+	{
+		bool nonNegative;
+		switch (op)
+		{
+		case HiOpcodeEnum::BranchVarConst_Cge_i4:
+			nonNegative = taken && c >= 0;
+			break;
+		case HiOpcodeEnum::BranchVarConst_Cgt_i4:
+			nonNegative = taken && c >= -1;
+			break;
+		case HiOpcodeEnum::BranchVarConst_Clt_i4:
+			nonNegative = !taken && c >= 0;
+			break;
+		case HiOpcodeEnum::BranchVarConst_Cle_i4:
+			nonNegative = !taken && c >= -1;
+			break;
+		default:
+			nonNegative = false;
+			break;
+		}
+		if (nonNegative)
+		{
+			facts.AddNonNegative(a);
+		}
+	}
+
+	static void AddBranchFacts(CheckFacts& facts, IRCommon* ir, bool taken)
+	{
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::BranchVarVar_Clt_i4:
+		case HiOpcodeEnum::BranchVarVar_CltUn_i4:
+		case HiOpcodeEnum::BranchVarVar_Cge_i4:
+		case HiOpcodeEnum::BranchVarVar_CgeUn_i4:
+		case HiOpcodeEnum::BranchVarVar_Cgt_i4:
+		case HiOpcodeEnum::BranchVarVar_CgtUn_i4:
+		case HiOpcodeEnum::BranchVarVar_Cle_i4:
+		case HiOpcodeEnum::BranchVarVar_CleUn_i4:
+		{
+			IRBranchVarVar_Clt_i4* br = (IRBranchVarVar_Clt_i4*)ir;
+			AddBranchVarVarFacts(facts, ir->type, br->op1, br->op2, taken);
+			break;
+		}
+		case HiOpcodeEnum::BranchVarConst_Cge_i4:
+		case HiOpcodeEnum::BranchVarConst_Cgt_i4:
+		case HiOpcodeEnum::BranchVarConst_Clt_i4:
+		case HiOpcodeEnum::BranchVarConst_Cle_i4:
+		{
+			IRBranchVarConst_Cge_i4* br = (IRBranchVarConst_Cge_i4*)ir;
+			AddBranchVarConstFacts(facts, ir->type, br->op1, br->op2, taken);
+			break;
+		}
+		default:
+			break;
+		}
+	}
+
+	// updates facts by the instruction. checks that are proven to pass are removed if removeChecks is set.
+	// args and locals are only written by instructions listed in GetIROperandSlots and by LdlocVarVarSize
+	// while the frame address isn't taken, so any other instruction only kills facts about eval stack slots.
+	static void UpdateCheckFacts(CheckFacts& facts, IRCommon* ir, int32_t evalStackBaseOffset, bool removeChecks)
+	{
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::GetArrayElementVarVar_i1:
+		case HiOpcodeEnum::GetArrayElementVarVar_u1:
+		case HiOpcodeEnum::GetArrayElementVarVar_i2:
+		case HiOpcodeEnum::GetArrayElementVarVar_u2:
+		case HiOpcodeEnum::GetArrayElementVarVar_i4:
+		case HiOpcodeEnum::GetArrayElementVarVar_u4:
+		case HiOpcodeEnum::GetArrayElementVarVar_i8:
+		case HiOpcodeEnum::GetArrayElementVarVar_u8:
+		{
+			IRGetArrayElementVarVar_i4* x = (IRGetArrayElementVarVar_i4*)ir;
+			if (removeChecks && facts.IsNonNull(x->arr) && facts.IsInArrayRange(x->index, x->arr))
+			{
+				ir->type = GetNoCheckOpcode(ir->type);
+			}
+			facts.AddNonNull(x->arr);
+			facts.AddInArrayRange(x->index, x->arr);
+			facts.Kill(x->dst);
+			return;
+		}
+		case HiOpcodeEnum::SetArrayElementVarVar_i1:
+		case HiOpcodeEnum::SetArrayElementVarVar_u1:
+		case HiOpcodeEnum::SetArrayElementVarVar_i2:
+		case HiOpcodeEnum::SetArrayElementVarVar_u2:
+		case HiOpcodeEnum::SetArrayElementVarVar_i4:
+		case HiOpcodeEnum::SetArrayElementVarVar_u4:
+		case HiOpcodeEnum::SetArrayElementVarVar_i8:
+		case HiOpcodeEnum::SetArrayElementVarVar_u8:
+		case HiOpcodeEnum::SetArrayElementVarVar_ref:
+		case HiOpcodeEnum::SetArrayElementVarVar_ref_NoTypeCheck:
+		{
+			IRSetArrayElementVarVar_i4* x = (IRSetArrayElementVarVar_i4*)ir;
+			// stores to ref arrays have no check-free variant
+			bool isRef = ir->type == HiOpcodeEnum::SetArrayElementVarVar_ref || ir->type == HiOpcodeEnum::SetArrayElementVarVar_ref_NoTypeCheck;
+			if (removeChecks && !isRef && facts.IsNonNull(x->arr) && facts.IsInArrayRange(x->index, x->arr))
+			{
+				ir->type = GetNoCheckOpcode(ir->type);
+			}
+			facts.AddNonNull(x->arr);
+			facts.AddInArrayRange(x->index, x->arr);
+			return;
+		}
+		case HiOpcodeEnum::LdfldVarVar_i1:
+		case HiOpcodeEnum::LdfldVarVar_u1:
+		case HiOpcodeEnum::LdfldVarVar_i2:
+		case HiOpcodeEnum::LdfldVarVar_u2:
+		case HiOpcodeEnum::LdfldVarVar_i4:
+		case HiOpcodeEnum::LdfldVarVar_u4:
+		case HiOpcodeEnum::LdfldVarVar_i8:
+		case HiOpcodeEnum::LdfldVarVar_u8:
+		{
+			IRLdfldVarVar_i4* x = (IRLdfldVarVar_i4*)ir;
+			if (removeChecks && facts.IsNonNull(x->obj))
+			{
+				ir->type = GetNoCheckOpcode(ir->type);
+			}
+			facts.AddNonNull(x->obj);
+			facts.Kill(x->dst);
+			return;
+		}
+		case HiOpcodeEnum::StfldVarVar_i1:
+		case HiOpcodeEnum::StfldVarVar_u1:
+		case HiOpcodeEnum::StfldVarVar_i2:
+		case HiOpcodeEnum::StfldVarVar_u2:
+		case HiOpcodeEnum::StfldVarVar_i4:
+		case HiOpcodeEnum::StfldVarVar_u4:
+		case HiOpcodeEnum::StfldVarVar_i8:
+		case HiOpcodeEnum::StfldVarVar_u8:
+		case HiOpcodeEnum::StfldVarVar_ref:
+		{
+			IRStfldVarVar_i4* x = (IRStfldVarVar_i4*)ir;
+			if (removeChecks && facts.IsNonNull(x->obj))
+			{
+				ir->type = GetNoCheckOpcode(ir->type);
+			}
+			facts.AddNonNull(x->obj);
+			return;
+		}
+		case HiOpcodeEnum::GetArrayLengthVarVar:
+		{
+			IRGetArrayLengthVarVar* x = (IRGetArrayLengthVarVar*)ir;
+			uint16_t arr = x->arr;
+			facts.AddNonNull(arr);
+			facts.Kill(x->len);
+			if (x->len != arr)
+			{
+				facts.AddArrayLength(x->len, arr);
+			}
+			return;
+		}
+		case HiOpcodeEnum::LdcVarConst_4:
+		{
+			IRLdcVarConst_4* x = (IRLdcVarConst_4*)ir;
+			facts.Kill(x->dst);
+			if ((int32_t)x->src >= 0)
+			{
+				facts.AddNonNegative(x->dst);
+			}
+			return;
+		}
+		case HiOpcodeEnum::LdlocVarVar:
+		{
+			IRLdlocVarVar* x = (IRLdlocVarVar*)ir;
+			if (x->dst != x->src)
+			{
+				facts.Kill(x->dst);
+				facts.CopyFacts(x->dst, x->src);
+			}
+			return;
+		}
+		case HiOpcodeEnum::LdlocVarVarSize:
+		{
+			IRLdlocVarVarSize* x = (IRLdlocVarVarSize*)ir;
+			facts.KillSlots(x->dst, x->dst + (x->size + 7) / 8);
+			return;
+		}
+		case HiOpcodeEnum::BinOpVarVarConst_Add_i4:
+		{
+			IRBinOpVarVarConst_Add_i4* x = (IRBinOpVarVarConst_Add_i4*)ir;
+			UpdateCheckFactsForAddConst(facts, x->ret, x->op1, x->op2);
+			return;
+		}
+		case HiOpcodeEnum::BinOpVarVarConst_Sub_i4:
+		{
+			IRBinOpVarVarConst_Sub_i4* x = (IRBinOpVarVarConst_Sub_i4*)ir;
+			if (x->op2 != INT32_MIN)
+			{
+				UpdateCheckFactsForAddConst(facts, x->ret, x->op1, -x->op2);
+			}
+			else
+			{
+				facts.Kill(x->ret);
+			}
+			return;
+		}
+		default:
+			break;
+		}
+
+		IROperandSlots slots;
+		if (!GetIROperandSlots(ir, false, slots))
+		{
+			facts.KillSlots(evalStackBaseOffset, UINT16_MAX + 1);
+			return;
+		}
+		if (!slots.write)
+		{
+			return;
+		}
+		uint16_t dst = *slots.write;
+		if (!IsI4PreservingConvert(ir->type))
+		{
+			facts.Kill(dst);
+		}
+		else if (dst != *slots.reads[0])
+		{
+			facts.Kill(dst);
+			facts.CopyIntFacts(dst, *slots.reads[0]);
+		}
+		else
+		{
+			facts.KillNonNull(dst);
+		}
+	}
+
+	static bool IsSwitchLadderBranch(IRCommon* ir)
+	{
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::BranchVarConst_Ceq_i4:
+		case HiOpcodeEnum::BranchVarConst_CneUn_i4:
+		case HiOpcodeEnum::BranchVarConst_Cgt_i4:
+		case HiOpcodeEnum::BranchVarConst_CgtUn_i4:
+		case HiOpcodeEnum::BranchVarConst_Cge_i4:
+		case HiOpcodeEnum::BranchVarConst_CgeUn_i4:
+		case HiOpcodeEnum::BranchVarConst_Clt_i4:
+		case HiOpcodeEnum::BranchVarConst_CltUn_i4:
+		case HiOpcodeEnum::BranchVarConst_Cle_i4:
+		case HiOpcodeEnum::BranchVarConst_CleUn_i4:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// returns true if the branch is taken
+	static bool EvalSwitchLadderBranch(const IRBranchVarConst_Ceq_i4* ir, int32_t value)
+	{
+		int32_t c = ir->op2;
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::BranchVarConst_Ceq_i4: return value == c;
+		case HiOpcodeEnum::BranchVarConst_CneUn_i4: return value != c;
+		case HiOpcodeEnum::BranchVarConst_Cgt_i4: return value > c;
+		case HiOpcodeEnum::BranchVarConst_CgtUn_i4: return (uint32_t)value > (uint32_t)c;
+		case HiOpcodeEnum::BranchVarConst_Cge_i4: return value >= c;
+		case HiOpcodeEnum::BranchVarConst_CgeUn_i4: return (uint32_t)value >= (uint32_t)c;
+		case HiOpcodeEnum::BranchVarConst_Clt_i4: return value < c;
+		case HiOpcodeEnum::BranchVarConst_CltUn_i4: return (uint32_t)value < (uint32_t)c;
+		case HiOpcodeEnum::BranchVarConst_Cle_i4: return value <= c;
+		case HiOpcodeEnum::BranchVarConst_CleUn_i4: return (uint32_t)value <= (uint32_t)c;
+		default:
+		{
+			IL2CPP_ASSERT(false);
+			return false;
+		}
+		}
+	}
+
+	struct SwitchCaseRange
+	{
+		int32_t low;
+		int32_t high;
+		size_t targetBbIdx;
+	};
+
+	// c# compiles sparse integer switches, and the hash part of string switches, to trees of compare-and-branch
+	// on one variable. a tree node is a basic block holding only a BranchVarConst_*_i4 of the variable, the root is
+	// the last instruction of any basic block. the root is replaced by a BranchSwitchBinarySearch over the value
+	// ranges that reach each leaf, followed by a jump to the leaf of all other values.
+	// the nodes only compare the variable with their constants, so all values between two adjacent constants take
+	// the same path. walking the tree for every constant and for one value of every gap gives the leaf of any value.
+	// the nodes are left alone, they may have other predecessors. returns true if any tree is lowered.
+	bool TransformContext::LowerSwitchLadders()
+	{
+		const size_t kMinLadderNodeCount = 4;
+		const size_t kMaxLadderNodeCount = 1024;
+		BasicBlockIndexMap bbIndexes;
+		BuildBasicBlockIndexMap(irbbs, bbIndexes);
+		RelocationMap relocs;
+		BuildRelocationMap(relocationOffsets, relocs);
+
+		auto getTargetBbIdx = [&](IRCommon* ir)
+		{
+			return SkipEmptyBasicBlocks(irbbs, GetBasicBlockIndex(bbIndexes, GetRelocation(relocs, GetBranchTargetOffset(ir)).targetBb));
+		};
+		// follows jumps. returns false if they loop
+		auto skipJumps = [&](size_t& bbIdx)
+		{
+			for (size_t hop = 0; hop <= irbbs.size(); hop++)
+			{
+				std::vector<IRCommon*>& insts = irbbs[bbIdx]->insts;
+				if (insts.size() != 1 || insts[0]->type != HiOpcodeEnum::BranchUncondition_4)
+				{
+					return true;
+				}
+				bbIdx = getTargetBbIdx(insts[0]);
+			}
+			return false;
+		};
+		auto getNode = [&](size_t bbIdx, uint16_t slot) -> IRBranchVarConst_Ceq_i4*
+		{
+			std::vector<IRCommon*>& insts = irbbs[bbIdx]->insts;
+			if (insts.size() != 1 || !IsSwitchLadderBranch(insts[0]) || ((IRBranchVarConst_Ceq_i4*)insts[0])->op1 != slot)
+			{
+				return nullptr;
+			}
+			return (IRBranchVarConst_Ceq_i4*)insts[0];
+		};
+		// returns false if the branch falls through the last basic block or jumps loop
+		auto getSuccessor = [&](IRBranchVarConst_Ceq_i4* node, size_t nodeBbIdx, bool taken, size_t& succBbIdx)
+		{
+			if (taken)
+			{
+				succBbIdx = getTargetBbIdx(node);
+			}
+			else
+			{
+				if (nodeBbIdx + 1 >= irbbs.size())
+				{
+					return false;
+				}
+				succBbIdx = SkipEmptyBasicBlocks(irbbs, nodeBbIdx + 1);
+			}
+			return skipJumps(succBbIdx);
+		};
+		// a case target is kept in resolve datas as il offset, so it must be a basic block of this method
+		auto isSwitchTarget = [&](size_t bbIdx)
+		{
+			IRBasicBlock* bb = irbbs[bbIdx];
+			return bb->ilOffset <= body.codeSize && ip2bb[bb->ilOffset] == bb && splitOffsets.find(bb->ilOffset) != splitOffsets.end();
+		};
+
+		std::vector<bool> loweredNodes(irbbs.size(), false);
+		std::unordered_set<int32_t*> removedOffsets;
+		std::vector<IRRelocation> newRelocations;
+		for (size_t rootBbIdx = 0; rootBbIdx < irbbs.size(); rootBbIdx++)
+		{
+			std::vector<IRCommon*>& rootInsts = irbbs[rootBbIdx]->insts;
+			if (loweredNodes[rootBbIdx] || rootInsts.empty() || !IsSwitchLadderBranch(rootInsts.back()))
+			{
+				continue;
+			}
+			IRBranchVarConst_Ceq_i4* root = (IRBranchVarConst_Ceq_i4*)rootInsts.back();
+			uint16_t slot = root->op1;
+
+			std::vector<std::pair<IRBranchVarConst_Ceq_i4*, size_t>> nodes = { { root, rootBbIdx } };
+			std::unordered_map<IRBranchVarConst_Ceq_i4*, size_t> nodeBbIdxs = { { root, rootBbIdx } };
+			std::vector<int32_t> points = { INT32_MIN, -1, 0, INT32_MAX };
+			bool valid = true;
+			for (size_t i = 0; i < nodes.size() && valid; i++)
+			{
+				points.push_back(nodes[i].first->op2);
+				for (bool taken : { true, false })
+				{
+					size_t succBbIdx;
+					if (!getSuccessor(nodes[i].first, nodes[i].second, taken, succBbIdx))
+					{
+						valid = false;
+						break;
+					}
+					IRBranchVarConst_Ceq_i4* succ = getNode(succBbIdx, slot);
+					if (succ && nodeBbIdxs.insert({ succ, succBbIdx }).second)
+					{
+						nodes.push_back({ succ, succBbIdx });
+					}
+				}
+				valid = valid && nodes.size() <= kMaxLadderNodeCount;
+			}
+			if (!valid || nodes.size() < kMinLadderNodeCount)
+			{
+				continue;
+			}
+
+			// returns false if the walk loops or leaves the method
+			auto walk = [&](int32_t value, size_t& leafBbIdx)
+			{
+				IRBranchVarConst_Ceq_i4* node = root;
+				size_t nodeBbIdx = rootBbIdx;
+				for (size_t step = 0; step < nodes.size(); step++)
+				{
+					size_t succBbIdx;
+					if (!getSuccessor(node, nodeBbIdx, EvalSwitchLadderBranch(node, value), succBbIdx))
+					{
+						return false;
+					}
+					IRBranchVarConst_Ceq_i4* succ = getNode(succBbIdx, slot);
+					if (!succ)
+					{
+						leafBbIdx = succBbIdx;
+						return true;
+					}
+					node = succ;
+					nodeBbIdx = nodeBbIdxs[succ];
+				}
+				return false;
+			};
+
+			std::sort(points.begin(), points.end());
+			points.erase(std::unique(points.begin(), points.end()), points.end());
+			std::vector<SwitchCaseRange> ranges;
+			std::unordered_map<size_t, uint64_t> leafValueCounts;
+			for (size_t i = 0; i < points.size() && valid; i++)
+			{
+				// the point itself, then the gap before the next point
+				int64_t low = points[i];
+				int64_t high = points[i];
+				for (int32_t part = 0; part < 2; part++)
+				{
+					if (part == 1)
+					{
+						if (i + 1 == points.size() || (int64_t)points[i + 1] == (int64_t)points[i] + 1)
+						{
+							break;
+						}
+						low = (int64_t)points[i] + 1;
+						high = (int64_t)points[i + 1] - 1;
+					}
+					size_t leafBbIdx;
+					if (!walk((int32_t)low, leafBbIdx))
+					{
+						valid = false;
+						break;
+					}
+					leafValueCounts[leafBbIdx] += (uint64_t)(high - low + 1);
+					if (!ranges.empty() && ranges.back().targetBbIdx == leafBbIdx)
+					{
+						ranges.back().high = (int32_t)high;
+					}
+					else
+					{
+						ranges.push_back({ (int32_t)low, (int32_t)high, leafBbIdx });
+					}
+				}
+			}
+			if (!valid)
+			{
+				continue;
+			}
+
+			// the leaf of most values, usually the default label, is left to the jump
+			size_t defaultBbIdx = ranges[0].targetBbIdx;
+			for (auto& leaf : leafValueCounts)
+			{
+				if (leaf.second > leafValueCounts[defaultBbIdx])
+				{
+					defaultBbIdx = leaf.first;
+				}
+			}
+			ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+				[defaultBbIdx](const SwitchCaseRange& range) { return range.targetBbIdx == defaultBbIdx; }), ranges.end());
+			if (ranges.empty() || std::any_of(ranges.begin(), ranges.end(), [&](const SwitchCaseRange& range) { return !isSwitchTarget(range.targetBbIdx); }))
+			{
+				continue;
+			}
+
+			uint32_t caseNum = (uint32_t)ranges.size();
+			int32_t caseRangesIndex;
+			int32_t caseOffsetsIndex;
+			int32_t* caseRanges;
+			int32_t* caseOffsets;
+			AllocResolvedData(resolveDatas, (int32_t)caseNum, caseRangesIndex, caseRanges);
+			AllocResolvedData(resolveDatas, (int32_t)(caseNum + 1) / 2, caseOffsetsIndex, caseOffsets);
+			// the first pointer is stale once resolveDatas grows again
+			caseRanges = (int32_t*)&resolveDatas[caseRangesIndex];
+			for (uint32_t i = 0; i < caseNum; i++)
+			{
+				caseRanges[i * 2] = ranges[i].low;
+				caseRanges[i * 2 + 1] = ranges[i].high;
+				caseOffsets[i] = (int32_t)irbbs[ranges[i].targetBbIdx]->ilOffset;
+			}
+			switchOffsetsInResolveData.push_back({ caseOffsetsIndex, (int32_t)caseNum });
+
+			CreateIR(ir, BranchSwitchBinarySearch);
+			ir->value = slot;
+			ir->caseNum = caseNum;
+			ir->caseRanges = (uint32_t)caseRangesIndex;
+			ir->caseOffsets = (uint32_t)caseOffsetsIndex;
+			removedOffsets.insert(&root->offset);
+			rootInsts.back() = ir;
+			if (rootBbIdx + 1 >= irbbs.size() || SkipEmptyBasicBlocks(irbbs, rootBbIdx + 1) != defaultBbIdx)
+			{
+				CreateIR(jmp, BranchUncondition_4);
+				jmp->offset = (int32_t)irbbs[defaultBbIdx]->ilOffset;
+				rootInsts.push_back(jmp);
+				newRelocations.push_back({ &jmp->offset, irbbs[defaultBbIdx] });
+			}
+			for (auto& node : nodes)
+			{
+				loweredNodes[node.second] = true;
+			}
+		}
+
+		// relocations are changed at last, relocs points into relocationOffsets
+		if (!removedOffsets.empty())
+		{
+			relocationOffsets.erase(std::remove_if(relocationOffsets.begin(), relocationOffsets.end(),
+				[&removedOffsets](const IRRelocation& reloc) { return removedOffsets.find(reloc.offsetPtr) != removedOffsets.end(); }),
+				relocationOffsets.end());
+		}
+		relocationOffsets.insert(relocationOffsets.end(), newRelocations.begin(), newRelocations.end());
+		return !removedOffsets.empty();
+	}
+
+	// a must-analysis over the basic blocks. blocks start with every fact assumed and lose the ones that don't
+	// hold on some incoming edge, until nothing changes. only facts about args and locals cross basic blocks.
+	// blocks entered by exception handling, leave or switch have unknown predecessors and start with no fact.
+	// loop headers are also entered from baseline frames by on stack replacement, but the args and locals of such
+	// frames hold the values the il code computes, so facts proven for them hold there as well.
+	void TransformContext::EliminateRedundantChecks()
+	{
+		BasicBlockIndexMap bbIndexes;
+		BuildBasicBlockIndexMap(irbbs, bbIndexes);
+		RelocationMap relocs;
+		BuildRelocationMap(relocationOffsets, relocs);
+		std::unordered_set<int32_t*> branchOffsets;
+		for (IRBasicBlock* bb : irbbs)
+		{
+			for (IRCommon* ir : bb->insts)
+			{
+				int32_t* targetOffset = GetBranchTargetOffset(ir);
+				if (targetOffset)
+				{
+					branchOffsets.insert(targetOffset);
+				}
+			}
+		}
+
+		std::vector<CheckFacts> entryFacts(irbbs.size());
+		entryFacts[0].SetReached();
+		for (IRRelocation& reloc : relocationOffsets)
+		{
+			if (branchOffsets.find(reloc.offsetPtr) == branchOffsets.end())
+			{
+				entryFacts[GetBasicBlockIndex(bbIndexes, reloc.targetBb)].SetReached();
+			}
+		}
+		for (auto switchOffsetPair : switchOffsetsInResolveData)
+		{
+			int32_t* offsetStartPtr = (int32_t*)&resolveDatas[switchOffsetPair.first];
+			for (int32_t i = 0; i < switchOffsetPair.second; i++)
+			{
+				entryFacts[GetBasicBlockIndex(bbIndexes, ip2bb[offsetStartPtr[i]])].SetReached();
+			}
+		}
+
+		auto flowTo = [&](size_t index, const CheckFacts& facts)
+		{
+			CheckFacts edgeFacts = facts;
+			edgeFacts.KillSlots(evalStackBaseOffset, UINT16_MAX + 1);
+			return entryFacts[index].Intersect(edgeFacts);
+		};
+		// returns true if the entry facts of any successor changed
+		auto runBasicBlock = [&](size_t bbIdx, bool removeChecks)
+		{
+			bool changed = false;
+			CheckFacts facts = entryFacts[bbIdx];
+			std::vector<IRCommon*>& insts = irbbs[bbIdx]->insts;
+			for (IRCommon* ir : insts)
+			{
+				int32_t* targetOffset = GetBranchTargetOffset(ir);
+				if (!targetOffset)
+				{
+					UpdateCheckFacts(facts, ir, evalStackBaseOffset, removeChecks);
+					continue;
+				}
+				CheckFacts takenFacts = facts;
+				AddBranchFacts(takenFacts, ir, true);
+				changed |= flowTo(GetBasicBlockIndex(bbIndexes, GetRelocation(relocs, targetOffset).targetBb), takenFacts);
+				if (ir == insts.back())
+				{
+					AddBranchFacts(facts, ir, false);
+				}
+			}
+			if (bbIdx + 1 < irbbs.size() && (insts.empty() || !IsNoFallthroughIR(insts.back())))
+			{
+				changed |= flowTo(bbIdx + 1, facts);
+			}
+			return changed;
+		};
+
+		for (bool changed = true; changed; )
+		{
+			changed = false;
+			for (size_t bbIdx = 0; bbIdx < irbbs.size(); bbIdx++)
+			{
+				if (entryFacts[bbIdx].IsReached())
+				{
+					changed |= runBasicBlock(bbIdx, false);
+				}
+			}
+		}
+		for (size_t bbIdx = 0; bbIdx < irbbs.size(); bbIdx++)
+		{
+			if (entryFacts[bbIdx].IsReached())
+			{
+				runBasicBlock(bbIdx, true);
+			}
+		}
+	}
+
+	// like GetIROperandSlots, but also accepts the instructions that touch no eval stack slot or only the returned one
+	static bool GetIREvalStackSlots(IRCommon* ir, bool frameAddressTaken, IROperandSlots& slots)
+	{
+		switch (ir->type)
+		{
+		case HiOpcodeEnum::InitLocals_n_2:
+		case HiOpcodeEnum::InitLocals_n_4:
+		case HiOpcodeEnum::InitLocals_size_8:
+		case HiOpcodeEnum::InitLocals_size_16:
+		case HiOpcodeEnum::InitLocals_size_24:
+		case HiOpcodeEnum::InitLocals_size_32:
+		case HiOpcodeEnum::BranchUncondition_4:
+		case HiOpcodeEnum::RetVar_void:
+		{
+			slots.readCount = 0;
+			slots.write = nullptr;
+			return true;
+		}
+		case HiOpcodeEnum::RetVar_ret_1:
+		case HiOpcodeEnum::RetVar_ret_2:
+		case HiOpcodeEnum::RetVar_ret_4:
+		case HiOpcodeEnum::RetVar_ret_8:
+		{
+			slots.readCount = 0;
+			slots.write = nullptr;
+			slots.reads[slots.readCount++] = &((IRRetVar_ret_4*)ir)->ret;
+			return true;
+		}
+		default:
+			return GetIROperandSlots(ir, frameAddressTaken, slots);
+		}
+	}
+
+	// coalescing leaves holes in the eval stack, the slots still used are renumbered densely and the frame shrinks.
+	// it's only done when every instruction names all slots it touches: calls use the slots above their args as
+	// the frame of the callee, and the runtime writes the exception object of a catch handler to the first slot.
+	void TransformContext::CompactEvalStackSlots(bool frameAddressTaken)
+	{
+		int32_t evalStackSize = maxStackSize - evalStackBaseOffset;
+		if (evalStackSize <= 0 || !body.exceptionClauses.empty())
+		{
+			return;
+		}
+		std::vector<bool> used(evalStackSize);
+		IROperandSlots slots;
+		auto markUsed = [&](uint16_t slot)
+		{
+			if (slot >= evalStackBaseOffset)
+			{
+				IL2CPP_ASSERT(slot < maxStackSize);
+				used[slot - evalStackBaseOffset] = true;
+			}
+		};
+		for (IRBasicBlock* bb : irbbs)
+		{
+			for (IRCommon* ir : bb->insts)
+			{
+				if (!GetIREvalStackSlots(ir, frameAddressTaken, slots))
+				{
+					return;
+				}
+				for (int32_t k = 0; k < slots.readCount; k++)
+				{
+					markUsed(*slots.reads[k]);
+				}
+				if (slots.write)
+				{
+					markUsed(*slots.write);
+				}
+			}
+		}
+
+		std::vector<uint16_t> newSlots(evalStackSize);
+		int32_t usedStackSize = 0;
+		for (int32_t i = 0; i < evalStackSize; i++)
+		{
+			if (used[i])
+			{
+				newSlots[i] = (uint16_t)(evalStackBaseOffset + usedStackSize++);
+			}
+		}
+		if (usedStackSize == evalStackSize)
+		{
+			return;
+		}
+		auto renumber = [&](uint16_t* slot)
+		{
+			if (*slot >= evalStackBaseOffset)
+			{
+				*slot = newSlots[*slot - evalStackBaseOffset];
+			}
+		};
+		for (IRBasicBlock* bb : irbbs)
+		{
+			for (IRCommon* ir : bb->insts)
+			{
+				GetIREvalStackSlots(ir, frameAddressTaken, slots);
+				for (int32_t k = 0; k < slots.readCount; k++)
+				{
+					renumber(slots.reads[k]);
+				}
+				if (slots.write)
+				{
+					renumber(slots.write);
+				}
+			}
+		}
+		maxStackSize = evalStackBaseOffset + usedStackSize;
+		maxBasicBlockEntryStackSize = std::min(maxBasicBlockEntryStackSize, maxStackSize);
+	}
+
+	void TransformContext::OptimizeIR()
+	{
+		bool frameAddressTaken = IsFrameAddressTaken(irbbs);
+		PropagateConstantsAndCopies(frameAddressTaken);
+		ThreadBranches();
+		RemoveUnreachableBasicBlocks();
+		RemoveDeadStores(frameAddressTaken);
+		if (LowerSwitchLadders())
+		{
+			RemoveUnreachableBasicBlocks();
+		}
+		CoalesceEvalStackMoves(frameAddressTaken);
+		// stores through the frame address may change args and locals behind the facts
+		if (!frameAddressTaken)
+		{
+			EliminateRedundantChecks();
+		}
+		// after all passes sizing their tables by maxStackSize
+		CompactEvalStackSlots(frameAddressTaken);
+	}
+}
+}
@@ -0,0 +1,203 @@
+#include "TransformContext.h"
+
+namespace hybridclr
+{
+namespace transform
+{
+	// a superinstruction keeps the operands of all merged instructions unchanged in the code stream,
+	// only the opcode of the first instruction is replaced. its handler executes the bodies of the
+	// merged instructions one after another, so one dispatch is saved for every instruction merged.
+	// because code size and offsets don't change, branch targets, exception clauses and il mappers
+	// need no relocation.
+	static HiOpcodeEnum FindSuperInstruction(IRCommon* const* insts, size_t count, int32_t& mergedInstCount)
+	{
+		IL2CPP_ASSERT(count >= 2);
+		//!!!{{SUPERINSTRUCTION_RULES
+		// generated from a placeholder histogram, not a measurement. regenerate from a profiled workload.
+		switch (insts[0]->type)
+		{
+		case HiOpcodeEnum::LdlocVarVar:
+		{
+			if (count >= 3 && insts[1]->type == HiOpcodeEnum::BinOpVarVarConst_Add_i4 && insts[2]->type == HiOpcodeEnum::LdlocVarVar)
+			{
+				mergedInstCount = 3;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4__LdlocVarVar;
+			}
+			if (count >= 3 && insts[1]->type == HiOpcodeEnum::LdlocVarVar && insts[2]->type == HiOpcodeEnum::BranchVarVar_Clt_i4)
+			{
+				mergedInstCount = 3;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__LdlocVarVar__BranchVarVar_Clt_i4;
+			}
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::LdlocVarVar:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__LdlocVarVar;
+			}
+			case HiOpcodeEnum::BinOpVarVarConst_Add_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__BinOpVarVarConst_Add_i4;
+			}
+			case HiOpcodeEnum::BranchVarVar_Clt_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__BranchVarVar_Clt_i4;
+			}
+			case HiOpcodeEnum::GetArrayElementVarVar_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__GetArrayElementVarVar_i4;
+			}
+			case HiOpcodeEnum::BranchVarConst_Clt_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__BranchVarConst_Clt_i4;
+			}
+			case HiOpcodeEnum::LdfldVarVar_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__LdfldVarVar_i4;
+			}
+			case HiOpcodeEnum::BranchTrueVar_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__BranchTrueVar_i4;
+			}
+			case HiOpcodeEnum::BranchFalseVar_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__BranchFalseVar_i4;
+			}
+			case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_LdlocVarVar__BinOpVarVarVar_Add_i4;
+			}
+			default: break;
+			}
+			break;
+		}
+		case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+		{
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::LdlocVarVar:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_BinOpVarVarVar_Add_i4__LdlocVarVar;
+			}
+			default: break;
+			}
+			break;
+		}
+		case HiOpcodeEnum::BinOpVarVarConst_Add_i4:
+		{
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::LdlocVarVar:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_BinOpVarVarConst_Add_i4__LdlocVarVar;
+			}
+			default: break;
+			}
+			break;
+		}
+		case HiOpcodeEnum::GetArrayElementVarVar_i4:
+		{
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_GetArrayElementVarVar_i4__BinOpVarVarVar_Add_i4;
+			}
+			default: break;
+			}
+			break;
+		}
+		case HiOpcodeEnum::GetArrayElementVarVar_i4_NoCheck:
+		{
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::BinOpVarVarVar_Add_i4:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_GetArrayElementVarVar_i4_NoCheck__BinOpVarVarVar_Add_i4;
+			}
+			default: break;
+			}
+			break;
+		}
+		case HiOpcodeEnum::CompOpVarVarVar_Clt_i4:
+		{
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::LdlocVarVar:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_CompOpVarVarVar_Clt_i4__LdlocVarVar;
+			}
+			default: break;
+			}
+			break;
+		}
+		case HiOpcodeEnum::BinOpVarVarVar_Add_f4:
+		{
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::LdlocVarVar:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_BinOpVarVarVar_Add_f4__LdlocVarVar;
+			}
+			default: break;
+			}
+			break;
+		}
+		case HiOpcodeEnum::BinOpVarVarVar_Mul_f4:
+		{
+			switch (insts[1]->type)
+			{
+			case HiOpcodeEnum::LdlocVarVar:
+			{
+				mergedInstCount = 2;
+				return HiOpcodeEnum::SuperInst_BinOpVarVarVar_Mul_f4__LdlocVarVar;
+			}
+			default: break;
+			}
+			break;
+		}
+		default: break;
+		}
+		//!!!}}SUPERINSTRUCTION_RULES
+		mergedInstCount = 0;
+		return HiOpcodeEnum::None;
+	}
+
+	void TransformContext::MergeSuperInstructions()
+	{
+		for (IRBasicBlock* bb : irbbs)
+		{
+			std::vector<IRCommon*>& insts = bb->insts;
+			for (size_t i = 0; i + 1 < insts.size(); )
+			{
+				int32_t mergedInstCount;
+				HiOpcodeEnum superOpcode = FindSuperInstruction(insts.data() + i, insts.size() - i, mergedInstCount);
+				if (superOpcode != HiOpcodeEnum::None)
+				{
+					IL2CPP_ASSERT(g_instructionSizes[(int)superOpcode] == g_instructionSizes[(int)insts[i]->type]);
+					insts[i]->type = superOpcode;
+					i += mergedInstCount;
+				}
+				else
+				{
+					++i;
+				}
+			}
+		}
+	}
+}
+}
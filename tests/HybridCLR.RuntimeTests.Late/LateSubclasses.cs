@@ -0,0 +1,21 @@
+namespace HybridCLR.RuntimeTests.Late
+{
+    // subclasses of classes of HybridCLR.RuntimeTests, loaded after methods calling them were devirtualized
+    public class LateDog : DevirtualizationTests.Animal
+    {
+        public override string Speak()
+        {
+            return "woof";
+        }
+
+        public override int Legs
+        {
+            get { return 4; }
+        }
+    }
+
+    // overrides nothing, calls of it still reach the methods of Animal
+    public class LateFish : DevirtualizationTests.Animal
+    {
+    }
+}
@@ -0,0 +1,185 @@
+using System;
+using System.Threading;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // stores of references into arrays skip the type check when the array can't be covariant, and otherwise cache
+    // the last accepted array and element class per store site.
+    [TestFixture]
+    public class ArrayStoreCheckTests
+    {
+        class Base { }
+        class Derived : Base { }
+        sealed class Leaf { }
+
+        static class Subjects
+        {
+            public static void Store(object[] array, object value)
+            {
+                array[0] = value;
+            }
+
+            // only called by CachedPairDoesntAcceptOtherArrays
+            public static void StoreCached(object[] array, object value)
+            {
+                array[0] = value;
+            }
+
+            public static void StoreComparable(IComparable[] array, IComparable value)
+            {
+                array[0] = value;
+            }
+
+            public static void StoreArray(object[][] array, object[] value)
+            {
+                array[0] = value;
+            }
+
+            // sealed, but generic delegates are variant
+            public static void StoreFunc(Func<object>[] array, Func<object> value)
+            {
+                array[0] = value;
+            }
+
+            public static void StoreLeaf(Leaf[] array, Leaf value)
+            {
+                array[0] = value;
+            }
+
+            public static Base StoreIntoNew(Base value)
+            {
+                var array = new Base[1];
+                array[0] = value;
+                return array[0];
+            }
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Subjects));
+        }
+
+        [Test]
+        public void RefStoreIntoCovariantArray()
+        {
+            object[] strings = new string[1];
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.Store(strings, new object()));
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.Store(strings, 1));
+            Subjects.Store(strings, "a");
+            Assert.AreEqual("a", strings[0]);
+            Subjects.Store(strings, null);
+            Assert.IsNull(strings[0]);
+
+            object[] bases = new Base[1];
+            Subjects.Store(bases, new Derived());
+            Assert.AreEqual(typeof(Derived), bases[0].GetType());
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.Store(new Derived[1], new Base()));
+        }
+
+        [Test]
+        public void CachedPairDoesntAcceptOtherArrays()
+        {
+            // the first accepted pair of the site is cached
+            Subjects.StoreCached(new object[1], "cached");
+            Subjects.StoreCached(new object[1], "cached");
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.StoreCached(new Base[1], "cached"));
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.StoreCached(new Uri[1], "cached"));
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.StoreCached(new object[1][], new object()));
+            Subjects.StoreCached(new string[1], "cached");
+        }
+
+        [Test]
+        public void RefStoreIntoInterfaceArray()
+        {
+            IComparable[] strings = new string[1];
+            Subjects.StoreComparable(strings, "a");
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.StoreComparable(strings, 1));
+            IComparable[] comparables = new IComparable[1];
+            Subjects.StoreComparable(comparables, 1);
+            Assert.AreEqual(1, comparables[0]);
+        }
+
+        [Test]
+        public void RefStoreIntoArrayOfArrays()
+        {
+            object[][] arrays = new string[1][];
+            Subjects.StoreArray(arrays, new string[1]);
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.StoreArray(arrays, new object[1]));
+        }
+
+        [Test]
+        public void RefStoreIntoVariantDelegateArray()
+        {
+            Func<object>[] funcs = new Func<string>[1];
+            Func<string> ok = () => "a";
+            Subjects.StoreFunc(funcs, ok);
+            Assert.Throws<ArrayTypeMismatchException>(() => Subjects.StoreFunc(funcs, () => new object()));
+        }
+
+        [Test]
+        public void StoresWithoutTypeCheck()
+        {
+            var leaves = new Leaf[1];
+            var leaf = new Leaf();
+            Subjects.StoreLeaf(leaves, leaf);
+            Assert.AreSame(leaf, leaves[0]);
+            Subjects.StoreLeaf(leaves, null);
+            Assert.IsNull(leaves[0]);
+            Assert.AreEqual(typeof(Derived), Subjects.StoreIntoNew(new Derived()).GetType());
+            Assert.IsNull(Subjects.StoreIntoNew(null));
+        }
+
+        [Test]
+        public void ConcurrentStoresOfDifferentTypes()
+        {
+            int errors = 0;
+            var threads = new Thread[4];
+            for (int t = 0; t < threads.Length; t++)
+            {
+                int kind = t;
+                threads[t] = new Thread(() =>
+                {
+                    for (int i = 0; i < 2000; i++)
+                    {
+                        object[] array;
+                        object value;
+                        bool valid = i % 3 != 0;
+                        switch (kind)
+                        {
+                            case 0: array = new string[1]; value = valid ? (object)"s" : new object(); break;
+                            case 1: array = new Base[1]; value = valid ? new Derived() : (object)"s"; break;
+                            case 2: array = new Uri[1]; value = valid ? new Uri("http://a") : (object)new Base(); break;
+                            default: array = new IComparable[1]; value = valid ? (object)i : new object(); break;
+                        }
+                        try
+                        {
+                            Subjects.Store(array, value);
+                            if (!valid || array[0] != value)
+                            {
+                                Interlocked.Increment(ref errors);
+                            }
+                        }
+                        catch (ArrayTypeMismatchException)
+                        {
+                            if (valid)
+                            {
+                                Interlocked.Increment(ref errors);
+                            }
+                        }
+                    }
+                });
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Start();
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Join();
+            }
+            Assert.AreEqual(0, errors);
+        }
+    }
+}
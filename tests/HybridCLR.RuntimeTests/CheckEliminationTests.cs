@@ -0,0 +1,253 @@
+using System;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // null and bounds checks of array and field IR are dropped where branches or earlier accesses prove them.
+    // every case here looks proven but isn't, and must still throw.
+    [TestFixture]
+    public class CheckEliminationTests
+    {
+        class Node
+        {
+            public int value;
+            public Node next;
+        }
+
+        static class Subjects
+        {
+            // not taken, i < a.Length doesn't prove i >= 0
+            public static int GetUnlessTooBig(int[] a, int i)
+            {
+                if (i >= a.Length)
+                {
+                    return -1;
+                }
+                return a[i];
+            }
+
+            public static int GetIfLess(int[] a, int i)
+            {
+                if (i < a.Length)
+                {
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static void SetIfLess(int[] a, int i, int value)
+            {
+                if (i < a.Length)
+                {
+                    a[i] = value;
+                }
+            }
+
+            public static int GetIfUnsignedLess(int[] a, int i)
+            {
+                if ((uint)i < (uint)a.Length)
+                {
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static int GetIfInRange(int[] a, int i)
+            {
+                if (i >= 0 && i < a.Length)
+                {
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static int GetIfGreaterThan(int[] a, int i)
+            {
+                if (i > -2 && i < a.Length)
+                {
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static int GetIfAtLeastOne(int[] a, int i)
+            {
+                if (i >= 1)
+                {
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static int GetByLengthOfOther(int[] a, int[] b, int i)
+            {
+                if (i >= 0 && i < b.Length)
+                {
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static int GetAfterArrayChanged(int[] a, int[] other, int i)
+            {
+                if (i >= 0 && i < a.Length)
+                {
+                    a = other;
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static int GetAfterIndexChanged(int[] a, int i)
+            {
+                if (i >= 0 && i < a.Length)
+                {
+                    i++;
+                    return a[i];
+                }
+                return -1;
+            }
+
+            public static int SumInclusive(int[] a)
+            {
+                int sum = 0;
+                for (int i = 0; i <= a.Length; i++)
+                {
+                    sum += a[i];
+                }
+                return sum;
+            }
+
+            public static int SumWithCachedLength(int[] a)
+            {
+                int sum = 0;
+                int n = a.Length;
+                for (int i = 0; i < n; i++)
+                {
+                    sum += a[i];
+                    if (i == 1)
+                    {
+                        a = new int[1];
+                    }
+                }
+                return sum;
+            }
+
+            public static int Sum(int[] a)
+            {
+                int sum = 0;
+                for (int i = 0; i < a.Length; i++)
+                {
+                    sum += a[i];
+                }
+                return sum;
+            }
+
+            public static int ReadAfterNulled(Node node)
+            {
+                int first = node.value;
+                node = node.next;
+                return first + node.value;
+            }
+
+            public static int ReadAfterNullCheckAndReassign(Node node, Node other)
+            {
+                if (node != null)
+                {
+                    node = other;
+                    return node.value;
+                }
+                return -1;
+            }
+
+            public static int WriteThenReadOfOther(Node a, Node b)
+            {
+                a.value = 1;
+                return b.value;
+            }
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Subjects));
+        }
+
+        [Test]
+        public void NegativeIndexAfterCgeTest()
+        {
+            int[] a = { 10, 20, 30 };
+            Assert.AreEqual(30, Subjects.GetUnlessTooBig(a, 2));
+            Assert.AreEqual(-1, Subjects.GetUnlessTooBig(a, 3));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetUnlessTooBig(a, -1));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetUnlessTooBig(a, int.MinValue));
+        }
+
+        [Test]
+        public void NegativeIndexAfterCltTest()
+        {
+            int[] a = { 10, 20, 30 };
+            Assert.AreEqual(10, Subjects.GetIfLess(a, 0));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetIfLess(a, -1));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.SetIfLess(a, -3, 1));
+            Subjects.SetIfLess(a, 1, 21);
+            Assert.AreEqual(21, a[1]);
+        }
+
+        [Test]
+        public void ProvenRangesStillWork()
+        {
+            int[] a = { 10, 20, 30 };
+            Assert.AreEqual(20, Subjects.GetIfUnsignedLess(a, 1));
+            Assert.AreEqual(-1, Subjects.GetIfUnsignedLess(a, -1));
+            Assert.AreEqual(-1, Subjects.GetIfUnsignedLess(a, 3));
+            Assert.AreEqual(30, Subjects.GetIfInRange(a, 2));
+            Assert.AreEqual(-1, Subjects.GetIfInRange(a, -1));
+            Assert.AreEqual(60, Subjects.Sum(a));
+            Assert.AreEqual(0, Subjects.Sum(new int[0]));
+        }
+
+        [Test]
+        public void ConstantBoundsThatDontProveNonNegative()
+        {
+            int[] a = { 10, 20, 30 };
+            Assert.AreEqual(10, Subjects.GetIfGreaterThan(a, 0));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetIfGreaterThan(a, -1));
+            Assert.AreEqual(20, Subjects.GetIfAtLeastOne(a, 1));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetIfAtLeastOne(a, 3));
+        }
+
+        [Test]
+        public void FactsAreKilledByWrites()
+        {
+            int[] a = { 10, 20, 30 };
+            int[] shorter = { 1 };
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetByLengthOfOther(shorter, a, 2));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetAfterArrayChanged(a, shorter, 2));
+            Assert.Throws<NullReferenceException>(() => Subjects.GetAfterArrayChanged(a, null, 0));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.GetAfterIndexChanged(a, 2));
+            Assert.AreEqual(30, Subjects.GetAfterIndexChanged(a, 1));
+        }
+
+        [Test]
+        public void LoopBounds()
+        {
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.SumInclusive(new[] { 1, 2 }));
+            Assert.Throws<IndexOutOfRangeException>(() => Subjects.SumWithCachedLength(new[] { 1, 2, 3 }));
+            Assert.AreEqual(3, Subjects.SumWithCachedLength(new[] { 1, 2 }));
+        }
+
+        [Test]
+        public void NullChecksAfterReassignment()
+        {
+            var tail = new Node { value = 2 };
+            var head = new Node { value = 1, next = tail };
+            Assert.AreEqual(3, Subjects.ReadAfterNulled(head));
+            Assert.Throws<NullReferenceException>(() => Subjects.ReadAfterNulled(tail));
+            Assert.AreEqual(2, Subjects.ReadAfterNullCheckAndReassign(head, tail));
+            Assert.Throws<NullReferenceException>(() => Subjects.ReadAfterNullCheckAndReassign(head, null));
+            Assert.Throws<NullReferenceException>(() => Subjects.WriteThenReadOfOther(head, null));
+            Assert.Throws<NullReferenceException>(() => Subjects.WriteThenReadOfOther(null, head));
+        }
+    }
+}
@@ -0,0 +1,185 @@
+using System;
+using System.Reflection;
+using System.Threading;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // methods are transformed outside the metadata lock. the first thread calling a method transforms it, other
+    // threads calling it meanwhile wait for the result, and threads calling other methods aren't blocked.
+    [TestFixture]
+    public class ConcurrentTransformTests
+    {
+        // never called before the tests, each test uses its own class
+        static class FirstCalls
+        {
+            public static int M0(int x) { return Inner.Step(x, 0); }
+            public static int M1(int x) { return Inner.Step(M0(x), 1); }
+            public static int M2(int x) { return Inner.Step(M1(x), 2); }
+            public static int M3(int x) { return Inner.Step(M2(x), 3); }
+            public static int M4(int x) { return Inner.Step(M3(x), 4); }
+            public static int M5(int x) { return Inner.Step(M4(x), 5); }
+            public static int M6(int x) { return Inner.Step(M5(x), 6); }
+            public static int M7(int x) { return Inner.Step(M6(x), 7); }
+        }
+
+        static class Inner
+        {
+            public static int Step(int x, int k)
+            {
+                int r = x;
+                for (int i = 0; i <= k; i++)
+                {
+                    r = r * 31 + i;
+                }
+                return r;
+            }
+        }
+
+        static class RaceWithPreJit
+        {
+            public static int A(int x) { return x * 3 + B(x); }
+            public static int B(int x) { return x - C(x); }
+            public static int C(int x) { return x * x; }
+            public static int D(int x) { return A(x) + B(x) + C(x); }
+            public static int E(int x) { return D(x) ^ A(x); }
+        }
+
+        class Generic<T>
+        {
+            public static int Size(T[] values)
+            {
+                int n = 0;
+                foreach (T value in values)
+                {
+                    n += value == null ? 1 : value.GetHashCode() == 0 ? 2 : 3;
+                }
+                return n;
+            }
+        }
+
+        static int Step(int x, int k)
+        {
+            int r = x;
+            for (int i = 0; i <= k; i++)
+            {
+                r = r * 31 + i;
+            }
+            return r;
+        }
+
+        static int ExpectedFirstCall(int index, int x)
+        {
+            int r = x;
+            for (int k = 0; k <= index; k++)
+            {
+                r = Step(r, k);
+            }
+            return r;
+        }
+
+        static void RunThreads(int threadCount, Action<int> body)
+        {
+            var barrier = new Barrier(threadCount);
+            Exception failure = null;
+            var threads = new Thread[threadCount];
+            for (int t = 0; t < threadCount; t++)
+            {
+                int index = t;
+                threads[t] = new Thread(() =>
+                {
+                    barrier.SignalAndWait();
+                    try
+                    {
+                        body(index);
+                    }
+                    catch (Exception e)
+                    {
+                        Interlocked.CompareExchange(ref failure, e, null);
+                    }
+                });
+                threads[t].Start();
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Join();
+            }
+            if (failure != null)
+            {
+                Assert.Fail(failure.ToString());
+            }
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.IgnoreIfNotInterpreted();
+        }
+
+        [Test]
+        public void ConcurrentFirstCalls()
+        {
+            Func<int, int>[] methods = { FirstCalls.M0, FirstCalls.M1, FirstCalls.M2, FirstCalls.M3, FirstCalls.M4, FirstCalls.M5, FirstCalls.M6, FirstCalls.M7 };
+            // half of the threads start with the deepest call chain, the others with the leaf
+            RunThreads(8, t =>
+            {
+                for (int i = 0; i < methods.Length; i++)
+                {
+                    int index = t % 2 == 0 ? methods.Length - 1 - i : i;
+                    int actual = methods[index](t);
+                    if (actual != ExpectedFirstCall(index, t))
+                    {
+                        throw new Exception($"M{index}({t}) returned {actual}");
+                    }
+                }
+            });
+        }
+
+        [Test]
+        public void FirstCallsRaceWithPreJitWorkers()
+        {
+            MethodInfo[] methods = typeof(RaceWithPreJit).GetMethods(TestUtil.DeclaredMethods);
+            int taskId = RuntimeApi.PreJitMethodsAsync(methods);
+            RunThreads(4, t =>
+            {
+                for (int x = -2; x <= 2; x++)
+                {
+                    int c = x * x;
+                    int b = x - c;
+                    int a = x * 3 + b;
+                    int d = a + b + c;
+                    if (RaceWithPreJit.E(x) != (d ^ a) || RaceWithPreJit.D(x) != d || RaceWithPreJit.C(x) != c)
+                    {
+                        throw new Exception($"wrong result for {x}");
+                    }
+                }
+            });
+            for (int i = 0; i < 1000 && !RuntimeApi.IsPreJitTaskCompleted(taskId); i++)
+            {
+                Thread.Sleep(10);
+            }
+            Assert.IsTrue(RuntimeApi.IsPreJitTaskCompleted(taskId));
+            Assert.AreEqual(1.0f, RuntimeApi.GetPreJitTaskProgress(taskId));
+        }
+
+        [Test]
+        public void ConcurrentFirstCallsOfGenericInstantiations()
+        {
+            RunThreads(6, t =>
+            {
+                for (int round = 0; round < 3; round++)
+                {
+                    bool ok = Generic<int>.Size(new[] { 0, 1, 2 }) == 2 + 3 + 3
+                        && Generic<string>.Size(new[] { null, "a" }) == 1 + 3
+                        && Generic<long>.Size(new[] { 0L }) == 2
+                        && Generic<object>.Size(new object[] { null, null, 0 }) == 1 + 1 + 2
+                        && Generic<DateTime>.Size(new[] { default(DateTime) }) == 2;
+                    if (!ok)
+                    {
+                        throw new Exception("wrong result in thread " + t);
+                    }
+                }
+            });
+        }
+    }
+}
@@ -0,0 +1,108 @@
+using System;
+using System.IO;
+using System.Reflection;
+using NUnit.Framework;
+using UnityEngine;
+
+namespace HybridCLR.RuntimeTests
+{
+    // virtual calls of methods of classes without subclasses are devirtualized and may be inlined. the classes
+    // here get subclasses when HybridCLR.RuntimeTests.Late is loaded, after the calls were devirtualized.
+    [TestFixture]
+    public class DevirtualizationTests
+    {
+        public class Animal
+        {
+            public virtual string Speak()
+            {
+                return "...";
+            }
+
+            // small enough to be inlined
+            public virtual int Legs
+            {
+                get { return 2; }
+            }
+        }
+
+        static class Callers
+        {
+            public static string Speak(Animal animal)
+            {
+                return animal.Speak();
+            }
+
+            public static int Legs(Animal animal)
+            {
+                return animal.Legs;
+            }
+
+            // keeps running the devirtualized call while the subclass is loaded
+            public static string SpeakAll(Func<int, Animal> next, int count)
+            {
+                string result = "";
+                for (int i = 0; i < count; i++)
+                {
+                    Animal animal = next(i);
+                    result += animal.Speak() + animal.Legs + ";";
+                }
+                return result;
+            }
+        }
+
+        const string LateAssemblyFile = "HybridCLR.RuntimeTests.Late.dll.bytes";
+
+        static Assembly LoadLateAssembly()
+        {
+            string path = Path.Combine(Application.streamingAssetsPath, LateAssemblyFile);
+            if (!File.Exists(path))
+            {
+                Assert.Ignore(LateAssemblyFile + " isn't in StreamingAssets, see tests/README.md");
+            }
+            return Assembly.Load(File.ReadAllBytes(path));
+        }
+
+        static Animal Create(Assembly assembly, string name)
+        {
+            return (Animal)Activator.CreateInstance(assembly.GetType("HybridCLR.RuntimeTests.Late." + name, true));
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Callers));
+        }
+
+        [Test]
+        public void SubclassLoadedAfterDevirtualization()
+        {
+            var animal = new Animal();
+            Assert.AreEqual("...", Callers.Speak(animal));
+            Assert.AreEqual(2, Callers.Legs(animal));
+
+            Assembly late = null;
+            string result = Callers.SpeakAll(i =>
+            {
+                if (i < 2)
+                {
+                    return animal;
+                }
+                if (late == null)
+                {
+                    late = LoadLateAssembly();
+                }
+                return Create(late, i == 2 ? "LateDog" : "LateFish");
+            }, 4);
+            Assert.AreEqual("...2;...2;woof4;...2;", result);
+
+            Animal dog = Create(late, "LateDog");
+            Animal fish = Create(late, "LateFish");
+            Assert.AreEqual("woof", Callers.Speak(dog));
+            Assert.AreEqual(4, Callers.Legs(dog));
+            Assert.AreEqual("...", Callers.Speak(fish));
+            Assert.AreEqual(2, Callers.Legs(fish));
+            Assert.AreEqual("...", Callers.Speak(animal));
+            Assert.AreEqual(2, Callers.Legs(animal));
+        }
+    }
+}
@@ -0,0 +1,202 @@
+using System;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // moves between eval stack slots and locals are coalesced, and the frame of a method is shrunk to the eval stack
+    // slots that are still used
+    [TestFixture]
+    public class EvalStackCoalescingTests
+    {
+        struct Vector
+        {
+            public long x;
+            public double y;
+            public int z;
+        }
+
+        static class Subjects
+        {
+            // leaf methods, their frames are compacted
+            public static int Mix(int a, int b)
+            {
+                int t = a * 31 + b;
+                int u = t ^ (a - b);
+                return (t + u) * (u - b);
+            }
+
+            public static long MixLong(long a, int b)
+            {
+                long t = a << (b & 31);
+                return t - (a >> 3) + b;
+            }
+
+            public static double Lerp(double a, double b, float t)
+            {
+                return a + (b - a) * t;
+            }
+
+            // args of the calls are eval stack slots of the caller, the frames of the callees start at them
+            public static int NestedCalls(int a, int b)
+            {
+                return Mix(Mix(a, b) + Mix(b, a), Mix(a + 1, Mix(b, 2))) + (int)MixLong(a, Mix(a, a));
+            }
+
+            public static int SourceOverwrittenBeforeUse(int a)
+            {
+                int t = a;
+                a = 5;
+                int u = t;
+                t = a * 2;
+                return u * 100 + t + a;
+            }
+
+            public static int Swap(int a, int b)
+            {
+                int t = a;
+                a = b;
+                b = t;
+                return a * 10 + b;
+            }
+
+            public static int ChainedAssignment(int v)
+            {
+                int a, b, c;
+                a = b = c = v + 1;
+                c += 1;
+                b *= 3;
+                return a * 10000 + b * 100 + c;
+            }
+
+            public static long Fibonacci(int n)
+            {
+                long prev = 0;
+                long cur = 1;
+                for (int i = 0; i < n; i++)
+                {
+                    long next = prev + cur;
+                    prev = cur;
+                    cur = next;
+                }
+                return prev;
+            }
+
+            // values stay on the eval stack across the branches of the conditional operators
+            public static int Conditionals(int a, int b, int c)
+            {
+                return (a > b ? a : b) * 100 + (c > 0 ? c : -c) + (a == c ? 1000 : 0);
+            }
+
+            public static int ThroughRef(int a)
+            {
+                int t = a;
+                ref int r = ref a;
+                r = t + 1;
+                int u = a;
+                r = u * 2;
+                return t * 10000 + u * 100 + a;
+            }
+
+            public static Vector StructMoves(Vector v, int k)
+            {
+                Vector w = v;
+                v.x += k;
+                w.z = (int)v.x;
+                Vector copy = w;
+                copy.y *= 2;
+                return copy;
+            }
+
+            public static int DivideOrCatch(int a, int b)
+            {
+                int t = a + 1;
+                try
+                {
+                    return Mix(a, b) / (b - t + a + 1);
+                }
+                catch (DivideByZeroException e)
+                {
+                    return -t - (e != null ? 1 : 0);
+                }
+            }
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Subjects));
+        }
+
+        static int Mix(int a, int b)
+        {
+            int t = a * 31 + b;
+            int u = t ^ (a - b);
+            return (t + u) * (u - b);
+        }
+
+        [Test]
+        public void LeafMethods()
+        {
+            Assert.AreEqual(Mix(3, 4), Subjects.Mix(3, 4));
+            Assert.AreEqual(Mix(-7, int.MaxValue), Subjects.Mix(-7, int.MaxValue));
+            Assert.AreEqual((5L << 7) - (5L >> 3) + 7, Subjects.MixLong(5, 7));
+            Assert.AreEqual(1.5 + (3.5 - 1.5) * 0.25f, Subjects.Lerp(1.5, 3.5, 0.25f));
+        }
+
+        [Test]
+        public void CallsFromCompactedCallers()
+        {
+            for (int a = -3; a <= 3; a++)
+            {
+                for (int b = -3; b <= 3; b++)
+                {
+                    int expected = Mix(Mix(a, b) + Mix(b, a), Mix(a + 1, Mix(b, 2))) + (int)(((long)a << (Mix(a, a) & 31)) - ((long)a >> 3) + Mix(a, a));
+                    Assert.AreEqual(expected, Subjects.NestedCalls(a, b));
+                }
+            }
+        }
+
+        [Test]
+        public void MovesAreNotForwardedPastWritesOfTheirSource()
+        {
+            Assert.AreEqual(900 + 10 + 5, Subjects.SourceOverwrittenBeforeUse(9));
+            Assert.AreEqual(21, Subjects.Swap(1, 2));
+            Assert.AreEqual(80000 + 2400 + 9, Subjects.ChainedAssignment(7));
+            Assert.AreEqual(30000 + 400 + 8, Subjects.ThroughRef(3));
+        }
+
+        [Test]
+        public void LoopCarriedCopies()
+        {
+            Assert.AreEqual(0L, Subjects.Fibonacci(0));
+            Assert.AreEqual(1L, Subjects.Fibonacci(1));
+            Assert.AreEqual(55L, Subjects.Fibonacci(10));
+            Assert.AreEqual(12586269025L, Subjects.Fibonacci(50));
+        }
+
+        [Test]
+        public void ValuesLiveAcrossBranches()
+        {
+            Assert.AreEqual(500 + 3 + 0, Subjects.Conditionals(5, 2, -3));
+            Assert.AreEqual(700 + 3 + 1000, Subjects.Conditionals(3, 7, 3));
+            Assert.AreEqual(100 + 0 + 0, Subjects.Conditionals(1, 1, 0));
+        }
+
+        [Test]
+        public void StructCopiesStayIndependent()
+        {
+            Vector v = Subjects.StructMoves(new Vector { x = 10, y = 1.25, z = 3 }, 5);
+            Assert.AreEqual(10L, v.x);
+            Assert.AreEqual(2.5, v.y);
+            Assert.AreEqual(15, v.z);
+        }
+
+        [Test]
+        public void CatchHandlerOfMethodWithCoalescedMoves()
+        {
+            Assert.AreEqual(Mix(4, 9) / 9, Subjects.DivideOrCatch(4, 9));
+            // b - (a + 1) + a + 1 == b
+            Assert.AreEqual(-5 - 1, Subjects.DivideOrCatch(4, 0));
+        }
+    }
+}
@@ -0,0 +1,236 @@
+using System;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // constants and copies are propagated, conversions of constants folded, constant branches threaded,
+    // unreachable basic blocks and dead stores removed. the C# compiler doesn't fold through locals, these are
+    // folded by the IR optimizer.
+    [TestFixture]
+    public class IROptimizerTests
+    {
+        static class Subjects
+        {
+            public static int calls;
+
+            static int SideEffect(int value)
+            {
+                calls++;
+                return value;
+            }
+
+            public static int NarrowingConversions(int which)
+            {
+                int a = 300;
+                int b = 200;
+                int c = 70000;
+                int d = -1;
+                switch (which)
+                {
+                    case 0: return (byte)a;
+                    case 1: return (sbyte)b;
+                    case 2: return (short)c;
+                    default: return (ushort)d;
+                }
+            }
+
+            public static long WideningConversions(int which)
+            {
+                int negative = -1;
+                uint big = 0xFFFFFFFF;
+                long wide = 0x100000001L;
+                switch (which)
+                {
+                    case 0: return negative;
+                    case 1: return big;
+                    case 2: return (long)(ulong)(uint)negative;
+                    case 3: return (int)wide;
+                    case 4: return (long)(uint)wide;
+                    default: return (long)(ulong)negative;
+                }
+            }
+
+            public static double IntegerToFloat(int which)
+            {
+                int odd = 16777217;
+                long max = long.MaxValue;
+                uint top = 0x80000000;
+                switch (which)
+                {
+                    case 0: return (float)odd;
+                    case 1: return (double)odd;
+                    case 2: return (double)max;
+                    default: return (double)top;
+                }
+            }
+
+            public static int FloatToInteger(int which)
+            {
+                float f = 3.9f;
+                double d = -3.9;
+                return which == 0 ? (int)f : (int)d;
+            }
+
+            public static int ConstantBranches(int a)
+            {
+                bool enabled = true;
+                int zero = 0;
+                int result = a;
+                if (enabled)
+                {
+                    result += 10;
+                }
+                else
+                {
+                    result += 1000;
+                }
+                while (zero != 0)
+                {
+                    result = -1;
+                }
+                if (zero > 0 || !enabled)
+                {
+                    result = -2;
+                }
+                return result;
+            }
+
+            public static int CopiesMergedAtJoin(bool flag)
+            {
+                int x = 1;
+                if (flag)
+                {
+                    x = 2;
+                }
+                int y = x;
+                return y * 10 + x;
+            }
+
+            public static int CopyOverwrittenInLoop(int n)
+            {
+                int last = 0;
+                int sum = 0;
+                for (int i = 1; i <= n; i++)
+                {
+                    sum = sum * 10 + last;
+                    last = i;
+                }
+                return sum;
+            }
+
+            public static int DeadStoreOfCall()
+            {
+                int x = SideEffect(7);
+                x = 5;
+                return x;
+            }
+
+            public static int DivideByConstantZero(int a)
+            {
+                int zero = 0;
+                return a / zero;
+            }
+
+            public static int DivideOverflow()
+            {
+                int min = int.MinValue;
+                int minusOne = -1;
+                return min / minusOne;
+            }
+
+            public static int RemainderByConstant(int a)
+            {
+                int m = 7;
+                int n = -7;
+                return (a % m) * 100 + a % n;
+            }
+
+            public static long ShiftByConstants(long a)
+            {
+                int s = 65;
+                int t = 3;
+                return (a << s) + (a >> t) + (long)((ulong)a >> t);
+            }
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Subjects));
+        }
+
+        [Test]
+        public void FoldsNarrowingConversions()
+        {
+            Assert.AreEqual(44, Subjects.NarrowingConversions(0));
+            Assert.AreEqual(-56, Subjects.NarrowingConversions(1));
+            Assert.AreEqual(4464, Subjects.NarrowingConversions(2));
+            Assert.AreEqual(65535, Subjects.NarrowingConversions(3));
+        }
+
+        [Test]
+        public void FoldsWideningConversions()
+        {
+            Assert.AreEqual(-1L, Subjects.WideningConversions(0));
+            Assert.AreEqual(4294967295L, Subjects.WideningConversions(1));
+            Assert.AreEqual(4294967295L, Subjects.WideningConversions(2));
+            Assert.AreEqual(1L, Subjects.WideningConversions(3));
+            Assert.AreEqual(1L, Subjects.WideningConversions(4));
+            Assert.AreEqual(-1L, Subjects.WideningConversions(5));
+        }
+
+        [Test]
+        public void FoldsIntegerToFloatConversions()
+        {
+            Assert.AreEqual(16777216.0, Subjects.IntegerToFloat(0));
+            Assert.AreEqual(16777217.0, Subjects.IntegerToFloat(1));
+            Assert.AreEqual(9223372036854775807.0, Subjects.IntegerToFloat(2));
+            Assert.AreEqual(2147483648.0, Subjects.IntegerToFloat(3));
+        }
+
+        [Test]
+        public void FloatToIntegerTruncates()
+        {
+            Assert.AreEqual(3, Subjects.FloatToInteger(0));
+            Assert.AreEqual(-3, Subjects.FloatToInteger(1));
+        }
+
+        [Test]
+        public void ThreadsConstantBranches()
+        {
+            Assert.AreEqual(15, Subjects.ConstantBranches(5));
+        }
+
+        [Test]
+        public void DoesNotPropagateOverJoins()
+        {
+            Assert.AreEqual(11, Subjects.CopiesMergedAtJoin(false));
+            Assert.AreEqual(22, Subjects.CopiesMergedAtJoin(true));
+            Assert.AreEqual(0, Subjects.CopyOverwrittenInLoop(1));
+            Assert.AreEqual(123, Subjects.CopyOverwrittenInLoop(4));
+        }
+
+        [Test]
+        public void KeepsCallsOfDeadStores()
+        {
+            int calls = Subjects.calls;
+            Assert.AreEqual(5, Subjects.DeadStoreOfCall());
+            Assert.AreEqual(calls + 1, Subjects.calls);
+        }
+
+        [Test]
+        public void KeepsFaultingArithmetic()
+        {
+            Assert.Throws<DivideByZeroException>(() => Subjects.DivideByConstantZero(1));
+            Assert.Throws<OverflowException>(() => Subjects.DivideOverflow());
+            Assert.AreEqual(-300 - 3, Subjects.RemainderByConstant(-10));
+            Assert.AreEqual(300 + 3, Subjects.RemainderByConstant(10));
+        }
+
+        [Test]
+        public void ShiftCountsAreMasked()
+        {
+            Assert.AreEqual((-16L << 1) + (-16L >> 3) + (long)(0xFFFFFFFFFFFFFFF0UL >> 3), Subjects.ShiftByConstants(-16));
+        }
+    }
+}
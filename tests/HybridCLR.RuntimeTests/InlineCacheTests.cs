@@ -0,0 +1,289 @@
+using System;
+using System.Collections.Generic;
+using System.Threading;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // call sites of CallVirtual and CallInterpVirtual cache the targets of up to 4 receiver classes, and turn
+    // megamorphic after that
+    [TestFixture]
+    public class InlineCacheTests
+    {
+        public interface IShape
+        {
+            int Sides();
+        }
+
+        public class Shape : IShape
+        {
+            public virtual int Sides() { return 0; }
+            public virtual string Name() { return "shape"; }
+            public virtual T Echo<T>(T value) { return value; }
+        }
+
+        public class Triangle : Shape
+        {
+            public override int Sides() { return 3; }
+            public override string Name() { return "triangle"; }
+        }
+
+        // inherits Sides and Name of Triangle
+        public class RightTriangle : Triangle
+        {
+        }
+
+        public class Square : Shape
+        {
+            public override int Sides() { return 4; }
+            public override string Name() { return "square"; }
+            public override T Echo<T>(T value) { return default(T); }
+        }
+
+        public class Pentagon : Shape
+        {
+            public override int Sides() { return 5; }
+        }
+
+        public class Hexagon : Shape
+        {
+            public override int Sides() { return 6; }
+            public override string Name() { return "hexagon"; }
+        }
+
+        public class Circle : IShape
+        {
+            public int Sides() { return -1; }
+        }
+
+        public struct Line : IShape
+        {
+            public int length;
+
+            public int Sides() { return length; }
+        }
+
+        // every test uses its own call sites, the state of a cache depends on the receivers it has seen
+        static class Sites
+        {
+            public static int MonomorphicSides(Shape shape)
+            {
+                return shape.Sides();
+            }
+
+            public static string MonomorphicName(Shape shape)
+            {
+                return shape.Name();
+            }
+
+            public static int MegamorphicSides(Shape shape)
+            {
+                return shape.Sides();
+            }
+
+            public static int ConcurrentSides(Shape shape)
+            {
+                return shape.Sides();
+            }
+
+            public static int NullSides(Shape shape)
+            {
+                return shape.Sides();
+            }
+
+            public static int NullInterfaceSides(IShape shape)
+            {
+                return shape.Sides();
+            }
+
+            public static string Name(Shape shape)
+            {
+                return shape.Name();
+            }
+
+            public static int InterfaceSides(IShape shape)
+            {
+                return shape.Sides();
+            }
+
+            public static int EchoInt(Shape shape, int value)
+            {
+                return shape.Echo(value);
+            }
+
+            public static string EchoString(Shape shape, string value)
+            {
+                return shape.Echo(value);
+            }
+
+            public static string ToString(object obj)
+            {
+                return obj.ToString();
+            }
+
+            public static int SumSides(Shape[] shapes)
+            {
+                int sum = 0;
+                foreach (Shape shape in shapes)
+                {
+                    sum += shape.Sides();
+                }
+                return sum;
+            }
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Sites));
+        }
+
+        static int ExpectedSides(IShape shape)
+        {
+            if (shape is Circle)
+            {
+                return -1;
+            }
+            if (shape is Line)
+            {
+                return ((Line)shape).length;
+            }
+            if (shape is Triangle)
+            {
+                return 3;
+            }
+            if (shape is Square)
+            {
+                return 4;
+            }
+            if (shape is Pentagon)
+            {
+                return 5;
+            }
+            if (shape is Hexagon)
+            {
+                return 6;
+            }
+            return 0;
+        }
+
+        [Test]
+        public void MonomorphicSiteSwitchesToPolymorphic()
+        {
+            Shape triangle = new Triangle();
+            for (int i = 0; i < 10; i++)
+            {
+                Assert.AreEqual(3, Sites.MonomorphicSides(triangle));
+                Assert.AreEqual("triangle", Sites.MonomorphicName(triangle));
+            }
+            Assert.AreEqual(4, Sites.MonomorphicSides(new Square()));
+            Assert.AreEqual(3, Sites.MonomorphicSides(triangle));
+            Assert.AreEqual("square", Sites.MonomorphicName(new Square()));
+            Assert.AreEqual("triangle", Sites.MonomorphicName(new RightTriangle()));
+            Assert.AreEqual("shape", Sites.MonomorphicName(new Pentagon()));
+        }
+
+        [Test]
+        public void InheritedOverrideIsCachedPerReceiverClass()
+        {
+            Assert.AreEqual("triangle", Sites.Name(new Triangle()));
+            Assert.AreEqual("triangle", Sites.Name(new RightTriangle()));
+            Assert.AreEqual("shape", Sites.Name(new Pentagon()));
+            Assert.AreEqual("shape", Sites.Name(new Shape()));
+            Assert.AreEqual("hexagon", Sites.Name(new Hexagon()));
+            Assert.AreEqual("triangle", Sites.Name(new RightTriangle()));
+        }
+
+        [Test]
+        public void MegamorphicSiteDispatchesEveryClass()
+        {
+            // more receiver classes than entries of the cache, in changing order
+            Shape[] shapes = { new Shape(), new Triangle(), new RightTriangle(), new Square(), new Pentagon(), new Hexagon() };
+            for (int round = 0; round < 4; round++)
+            {
+                for (int i = 0; i < shapes.Length; i++)
+                {
+                    Shape shape = shapes[(i * (round + 1)) % shapes.Length];
+                    Assert.AreEqual(ExpectedSides(shape), Sites.MegamorphicSides(shape));
+                }
+            }
+            Assert.AreEqual(0 + 3 + 3 + 4 + 5 + 6, Sites.SumSides(shapes));
+        }
+
+        [Test]
+        public void InterfaceSiteWithClassesAndBoxedStructs()
+        {
+            IShape[] shapes = { new Circle(), new Triangle(), new Line { length = 1 }, new Square(), new Line { length = 7 }, new Hexagon(), new Circle() };
+            for (int round = 0; round < 3; round++)
+            {
+                foreach (IShape shape in shapes)
+                {
+                    Assert.AreEqual(ExpectedSides(shape), Sites.InterfaceSides(shape));
+                }
+            }
+        }
+
+        [Test]
+        public void GenericVirtualMethodsAreResolvedPerInstantiation()
+        {
+            Shape shape = new Shape();
+            Shape square = new Square();
+            Assert.AreEqual(5, Sites.EchoInt(shape, 5));
+            Assert.AreEqual(0, Sites.EchoInt(square, 5));
+            Assert.AreEqual("x", Sites.EchoString(shape, "x"));
+            Assert.IsNull(Sites.EchoString(square, "x"));
+            Assert.AreEqual(5, Sites.EchoInt(shape, 5));
+        }
+
+        [Test]
+        public void AotOverridesAndInterpretedOverridesShareSite()
+        {
+            object[] objs = { 1, "s", new Triangle(), 2.5, new Line { length = 2 }, 'c', new List<int>(), 7L };
+            foreach (object obj in objs)
+            {
+                Assert.AreEqual(obj.ToString(), Sites.ToString(obj));
+            }
+        }
+
+        [Test]
+        public void NullReceiverThrows()
+        {
+            Assert.AreEqual(3, Sites.NullSides(new Triangle()));
+            Assert.Throws<NullReferenceException>(() => Sites.NullSides(null));
+            Assert.AreEqual(-1, Sites.NullInterfaceSides(new Circle()));
+            Assert.Throws<NullReferenceException>(() => Sites.NullInterfaceSides(null));
+        }
+
+        [Test]
+        public void ConcurrentCallersFillSameSite()
+        {
+            Shape[] shapes = { new Shape(), new Triangle(), new Square(), new Pentagon(), new Hexagon(), new RightTriangle() };
+            int errors = 0;
+            var threads = new Thread[4];
+            for (int t = 0; t < threads.Length; t++)
+            {
+                int seed = t;
+                threads[t] = new Thread(() =>
+                {
+                    for (int i = 0; i < 10000; i++)
+                    {
+                        Shape shape = shapes[(i + seed) % shapes.Length];
+                        if (Sites.ConcurrentSides(shape) != ExpectedSides(shape))
+                        {
+                            Interlocked.Increment(ref errors);
+                        }
+                    }
+                });
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Start();
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Join();
+            }
+            Assert.AreEqual(0, errors);
+        }
+    }
+}
@@ -0,0 +1,252 @@
+using System;
+using System.Threading;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // Ldsfld, Stsfld, Ldsflda and InitClassStaticCtor rewrite themselves to variants without the class init check
+    // once they see the cctor finished
+    [TestFixture]
+    public class StaticFieldQuickeningTests
+    {
+        static class Log
+        {
+            public static string text = "";
+        }
+
+        class Lazy
+        {
+            public static int value;
+
+            static Lazy()
+            {
+                Log.text += "Lazy;";
+                value = 42;
+            }
+        }
+
+        class Throwing
+        {
+            public static int value;
+
+            static Throwing()
+            {
+                throw new InvalidOperationException("cctor");
+            }
+        }
+
+        class CycleA
+        {
+            public static int value;
+            public static int seenB;
+
+            static CycleA()
+            {
+                value = 1;
+                seenB = CycleB.value;
+            }
+        }
+
+        class CycleB
+        {
+            public static int value;
+            public static int seenA;
+
+            static CycleB()
+            {
+                value = 2;
+                seenA = CycleA.value;
+            }
+        }
+
+        class Slow
+        {
+            public static int value;
+            public static readonly long stamp;
+
+            static Slow()
+            {
+                Thread.Sleep(100);
+                stamp = 123456789012L;
+                value = 7;
+            }
+        }
+
+        class PerInstantiation<T>
+        {
+            public static int value;
+
+            static PerInstantiation()
+            {
+                value = typeof(T).Name.Length;
+            }
+        }
+
+        struct Point
+        {
+            public int x;
+            public int y;
+        }
+
+        class Statics
+        {
+            public static Point point;
+            public static decimal money = 1.5m;
+
+            [ThreadStatic]
+            public static int perThread;
+        }
+
+        static class Accessors
+        {
+            public static int ReadLazy()
+            {
+                return Lazy.value;
+            }
+
+            public static void WriteLazy(int value)
+            {
+                Lazy.value = value;
+            }
+
+            public static int ReadThrowing()
+            {
+                return Throwing.value;
+            }
+
+            public static void WriteThrowing(int value)
+            {
+                Throwing.value = value;
+            }
+
+            public static int ReadCycle()
+            {
+                return CycleA.value * 1000 + CycleA.seenB * 100 + CycleB.value * 10 + CycleB.seenA;
+            }
+
+            public static long ReadSlow()
+            {
+                return Slow.stamp + Slow.value;
+            }
+
+            public static int ReadPerInstantiation<T>()
+            {
+                return PerInstantiation<T>.value;
+            }
+
+            public static void MovePoint(int dx)
+            {
+                Statics.point.x += dx;
+                Statics.point.y -= dx;
+            }
+
+            public static decimal AddMoney(decimal m)
+            {
+                Statics.money += m;
+                return Statics.money;
+            }
+
+            public static int IncrementPerThread()
+            {
+                return ++Statics.perThread;
+            }
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Accessors));
+        }
+
+        [Test]
+        public void CctorRunsOnceBeforeFirstAccess()
+        {
+            Assert.AreEqual("", Log.text);
+            for (int i = 0; i < 5; i++)
+            {
+                Assert.AreEqual(42 + i, Accessors.ReadLazy());
+                Accessors.WriteLazy(43 + i);
+            }
+            Assert.AreEqual("Lazy;", Log.text);
+        }
+
+        [Test]
+        public void FailedCctorIsNeverQuickened()
+        {
+            for (int i = 0; i < 3; i++)
+            {
+                Assert.Throws<TypeInitializationException>(() => Accessors.ReadThrowing());
+                Assert.Throws<TypeInitializationException>(() => Accessors.WriteThrowing(i));
+            }
+        }
+
+        [Test]
+        public void RecursiveCctorSeesPartiallyInitializedClass()
+        {
+            // the cctor of CycleA runs the one of CycleB, which reads CycleA while its cctor is still running
+            Assert.AreEqual(1 * 1000 + 2 * 100 + 2 * 10 + 1, Accessors.ReadCycle());
+            Assert.AreEqual(1 * 1000 + 2 * 100 + 2 * 10 + 1, Accessors.ReadCycle());
+        }
+
+        [Test]
+        public void ConcurrentFirstAccessWaitsForCctor()
+        {
+            var results = new long[4];
+            var threads = new Thread[results.Length];
+            for (int t = 0; t < threads.Length; t++)
+            {
+                int index = t;
+                threads[t] = new Thread(() => results[index] = Accessors.ReadSlow());
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Start();
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Join();
+            }
+            foreach (long result in results)
+            {
+                Assert.AreEqual(123456789012L + 7, result);
+            }
+        }
+
+        [Test]
+        public void EveryInstantiationHasItsOwnStatics()
+        {
+            Assert.AreEqual("Int32".Length, Accessors.ReadPerInstantiation<int>());
+            Assert.AreEqual("String".Length, Accessors.ReadPerInstantiation<string>());
+            Assert.AreEqual("Int32".Length, Accessors.ReadPerInstantiation<int>());
+            Assert.AreEqual("DateTime".Length, Accessors.ReadPerInstantiation<DateTime>());
+        }
+
+        [Test]
+        public void StructAndDecimalStatics()
+        {
+            Accessors.MovePoint(3);
+            Accessors.MovePoint(4);
+            Assert.AreEqual(7, Statics.point.x);
+            Assert.AreEqual(-7, Statics.point.y);
+            Assert.AreEqual(2.0m, Accessors.AddMoney(0.5m));
+            Assert.AreEqual(2.25m, Accessors.AddMoney(0.25m));
+        }
+
+        [Test]
+        public void ThreadStaticsStayPerThread()
+        {
+            Assert.AreEqual(1, Accessors.IncrementPerThread());
+            Assert.AreEqual(2, Accessors.IncrementPerThread());
+            int other = 0;
+            var thread = new Thread(() =>
+            {
+                Accessors.IncrementPerThread();
+                other = Accessors.IncrementPerThread();
+            });
+            thread.Start();
+            thread.Join();
+            Assert.AreEqual(2, other);
+            Assert.AreEqual(3, Accessors.IncrementPerThread());
+        }
+    }
+}
@@ -0,0 +1,298 @@
+using System;
+using System.Collections.Generic;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // trees of compare-and-branch on one variable, which c# makes of sparse switches, are lowered to a binary search
+    // over value ranges. every value around the case constants and the ends of the int range is checked against a
+    // dictionary.
+    [TestFixture]
+    public class SwitchLoweringTests
+    {
+        static readonly Dictionary<int, int> SparseCases = new Dictionary<int, int>
+        {
+            { -1000000, 1 }, { -77, 2 }, { -1, 3 }, { 0, 4 }, { 3, 5 }, { 10, 6 }, { 11, 6 }, { 12, 6 },
+            { 500, 7 }, { 4096, 8 }, { 70000, 9 }, { 1 << 30, 10 },
+        };
+
+        static readonly Dictionary<int, int> EndCases = new Dictionary<int, int>
+        {
+            { int.MinValue, 1 }, { int.MinValue + 1, 2 }, { -5, 3 }, { 5, 4 }, { 100, 5 }, { int.MaxValue - 1, 6 }, { int.MaxValue, 7 },
+        };
+
+        static readonly Dictionary<uint, int> UnsignedCases = new Dictionary<uint, int>
+        {
+            { 0, 1 }, { 7, 2 }, { 300, 3 }, { 65536, 4 }, { 0x7fffffff, 5 }, { 0x80000000, 6 }, { 0xfffffff0, 7 },
+        };
+
+        static readonly Dictionary<long, int> LongCases = new Dictionary<long, int>
+        {
+            { long.MinValue, 1 }, { -3000000000, 2 }, { -3, 3 }, { 8, 4 }, { 900, 5 }, { 3000000000, 6 }, { long.MaxValue, 7 },
+        };
+
+        static readonly string[] Words = { "alpha", "beta", "gamma", "delta", "epsilon", "zeta", "eta", "theta", "iota", "kappa" };
+
+        static class Subjects
+        {
+            public static int Sparse(int x)
+            {
+                switch (x)
+                {
+                    case -1000000: return 1;
+                    case -77: return 2;
+                    case -1: return 3;
+                    case 0: return 4;
+                    case 3: return 5;
+                    case 10:
+                    case 11:
+                    case 12: return 6;
+                    case 500: return 7;
+                    case 4096: return 8;
+                    case 70000: return 9;
+                    case 1 << 30: return 10;
+                    default: return 0;
+                }
+            }
+
+            public static int Ends(int x)
+            {
+                switch (x)
+                {
+                    case int.MinValue: return 1;
+                    case int.MinValue + 1: return 2;
+                    case -5: return 3;
+                    case 5: return 4;
+                    case 100: return 5;
+                    case int.MaxValue - 1: return 6;
+                    case int.MaxValue: return 7;
+                    default: return 0;
+                }
+            }
+
+            public static int Unsigned(uint x)
+            {
+                switch (x)
+                {
+                    case 0: return 1;
+                    case 7: return 2;
+                    case 300: return 3;
+                    case 65536: return 4;
+                    case 0x7fffffff: return 5;
+                    case 0x80000000: return 6;
+                    case 0xfffffff0: return 7;
+                    default: return 0;
+                }
+            }
+
+            public static int Long(long x)
+            {
+                switch (x)
+                {
+                    case long.MinValue: return 1;
+                    case -3000000000: return 2;
+                    case -3: return 3;
+                    case 8: return 4;
+                    case 900: return 5;
+                    case 3000000000: return 6;
+                    case long.MaxValue: return 7;
+                    default: return 0;
+                }
+            }
+
+            // an if ladder on one variable makes the same tree
+            public static int Ladder(int x)
+            {
+                if (x < -100)
+                {
+                    return 1;
+                }
+                if (x < 0)
+                {
+                    return 2;
+                }
+                if (x == 0)
+                {
+                    return 3;
+                }
+                if (x <= 9)
+                {
+                    return 4;
+                }
+                if (x == 100 || x == 200 || x == 300)
+                {
+                    return 5;
+                }
+                if (x > 1000 && x < 2000)
+                {
+                    return 6;
+                }
+                return 7;
+            }
+
+            public static int Word(string s)
+            {
+                switch (s)
+                {
+                    case "alpha": return 1;
+                    case "beta": return 2;
+                    case "gamma": return 3;
+                    case "delta": return 4;
+                    case "epsilon": return 5;
+                    case "zeta": return 6;
+                    case "eta": return 7;
+                    case "theta": return 8;
+                    case "iota": return 9;
+                    case "kappa": return 10;
+                    default: return 0;
+                }
+            }
+
+            // the switch variable changes between iterations
+            public static int Walk(int x, int steps)
+            {
+                int trace = 0;
+                for (int i = 0; i < steps; i++)
+                {
+                    switch (x)
+                    {
+                        case 1: x = 40; break;
+                        case 40: x = -3; break;
+                        case -3: x = 900; break;
+                        case 900: x = 1; break;
+                        default: x = 1; trace += 1000; break;
+                    }
+                    trace = trace * 3 + (x & 0xff);
+                }
+                return trace;
+            }
+        }
+
+        static int Lookup<T>(Dictionary<T, int> cases, T value)
+        {
+            int result;
+            return cases.TryGetValue(value, out result) ? result : 0;
+        }
+
+        static IEnumerable<int> Probes(IEnumerable<int> constants)
+        {
+            var probes = new List<int> { int.MinValue, int.MinValue + 1, -2, -1, 0, 1, 2, int.MaxValue - 1, int.MaxValue };
+            foreach (int c in constants)
+            {
+                probes.Add(c);
+                probes.Add(unchecked(c - 1));
+                probes.Add(unchecked(c + 1));
+                probes.Add(c / 2);
+            }
+            return probes;
+        }
+
+        static int Walk(int x, int steps)
+        {
+            int trace = 0;
+            for (int i = 0; i < steps; i++)
+            {
+                if (x == 1) x = 40;
+                else if (x == 40) x = -3;
+                else if (x == -3) x = 900;
+                else if (x == 900) x = 1;
+                else { x = 1; trace += 1000; }
+                trace = trace * 3 + (x & 0xff);
+            }
+            return trace;
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.Optimize(typeof(Subjects));
+        }
+
+        [Test]
+        public void SparseSwitchWithOutOfRangeValues()
+        {
+            foreach (int x in Probes(SparseCases.Keys))
+            {
+                Assert.AreEqual(Lookup(SparseCases, x), Subjects.Sparse(x), "value " + x);
+            }
+        }
+
+        [Test]
+        public void CasesAtEndsOfIntRange()
+        {
+            foreach (int x in Probes(EndCases.Keys))
+            {
+                Assert.AreEqual(Lookup(EndCases, x), Subjects.Ends(x), "value " + x);
+            }
+        }
+
+        [Test]
+        public void UnsignedSwitch()
+        {
+            var constants = new List<int>();
+            foreach (uint c in UnsignedCases.Keys)
+            {
+                constants.Add(unchecked((int)c));
+            }
+            foreach (int x in Probes(constants))
+            {
+                uint u = unchecked((uint)x);
+                Assert.AreEqual(Lookup(UnsignedCases, u), Subjects.Unsigned(u), "value " + u);
+            }
+        }
+
+        [Test]
+        public void LongSwitch()
+        {
+            var probes = new List<long> { long.MinValue + 1, int.MinValue, -1, 0, int.MaxValue, (long)int.MaxValue + 1, long.MaxValue - 1 };
+            foreach (long c in LongCases.Keys)
+            {
+                probes.Add(c);
+                probes.Add(unchecked(c - 1));
+                probes.Add(unchecked(c + 1));
+                // same low 32 bits as the case
+                probes.Add(unchecked(c ^ (1L << 32)));
+            }
+            foreach (long x in probes)
+            {
+                Assert.AreEqual(Lookup(LongCases, x), Subjects.Long(x), "value " + x);
+            }
+        }
+
+        [Test]
+        public void IfLadder()
+        {
+            int[] probes = { int.MinValue, -101, -100, -99, -1, 0, 1, 9, 10, 99, 100, 101, 200, 300, 1000, 1001, 1999, 2000, int.MaxValue };
+            foreach (int x in probes)
+            {
+                int expected = x < -100 ? 1 : x < 0 ? 2 : x == 0 ? 3 : x <= 9 ? 4 : x == 100 || x == 200 || x == 300 ? 5 : x > 1000 && x < 2000 ? 6 : 7;
+                Assert.AreEqual(expected, Subjects.Ladder(x), "value " + x);
+            }
+        }
+
+        [Test]
+        public void StringSwitch()
+        {
+            for (int i = 0; i < Words.Length; i++)
+            {
+                Assert.AreEqual(i + 1, Subjects.Word(Words[i]), Words[i]);
+                // a new string object of the same value
+                Assert.AreEqual(i + 1, Subjects.Word(new string(Words[i].ToCharArray())), Words[i]);
+                Assert.AreEqual(0, Subjects.Word(Words[i].ToUpperInvariant()), Words[i]);
+                Assert.AreEqual(0, Subjects.Word(Words[i] + " "), Words[i]);
+            }
+            Assert.AreEqual(0, Subjects.Word(null));
+            Assert.AreEqual(0, Subjects.Word(""));
+            Assert.AreEqual(0, Subjects.Word("omega"));
+        }
+
+        [Test]
+        public void SwitchInLoop()
+        {
+            foreach (int x in new[] { 1, 40, -3, 900, 0, 2, int.MinValue })
+            {
+                Assert.AreEqual(Walk(x, 9), Subjects.Walk(x, 9), "value " + x);
+            }
+        }
+    }
+}
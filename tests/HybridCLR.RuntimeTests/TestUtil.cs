@@ -0,0 +1,52 @@
+using System;
+using System.Reflection;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // ids of RuntimeOptionId in RuntimeConfig.h that the enum of the package may not have yet
+    public static class RuntimeOptions
+    {
+        public const RuntimeOptionId MaxMethodInlineDepth = (RuntimeOptionId)5;
+        public const RuntimeOptionId MaxInlineableMethodBodySize = (RuntimeOptionId)6;
+        public const RuntimeOptionId EnableIROptimizer = (RuntimeOptionId)7;
+        public const RuntimeOptionId PreJitWorkerCount = (RuntimeOptionId)8;
+        public const RuntimeOptionId TierUpCallCount = (RuntimeOptionId)9;
+        public const RuntimeOptionId TierUpBackEdgeCount = (RuntimeOptionId)10;
+    }
+
+    public static class TestUtil
+    {
+        public const BindingFlags DeclaredMethods = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Static | BindingFlags.Instance | BindingFlags.DeclaredOnly;
+
+        public static void IgnoreIfNotInterpreted()
+        {
+#if UNITY_EDITOR
+            Assert.Ignore("runtime tests only run interpreted in il2cpp players");
+#endif
+        }
+
+        // transforms all methods of the type to optimized code before their first call, so the tests run the code
+        // of the IR optimizer instead of the baseline tier
+        public static void Optimize(Type type)
+        {
+            IgnoreIfNotInterpreted();
+            foreach (MethodInfo method in type.GetMethods(DeclaredMethods))
+            {
+                if (method.IsAbstract || method.ContainsGenericParameters)
+                {
+                    continue;
+                }
+                Assert.IsTrue(RuntimeApi.PreJitMethod(method), method.ToString());
+            }
+        }
+
+        public static void Optimize(params Type[] types)
+        {
+            foreach (Type type in types)
+            {
+                Optimize(type);
+            }
+        }
+    }
+}
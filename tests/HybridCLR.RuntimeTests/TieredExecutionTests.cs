@@ -0,0 +1,191 @@
+using System;
+using System.Threading;
+using NUnit.Framework;
+
+namespace HybridCLR.RuntimeTests
+{
+    // methods run baseline code first and are transformed again with the optimizer in background when they get hot.
+    // frames in hot loops switch to the optimized code at loop headers.
+    [TestFixture]
+    public class TieredExecutionTests
+    {
+        // low thresholds, so every subject tiers up during the tests. they are read when the baseline code is made.
+        const int CallCount = 2;
+        const int BackEdgeCount = 50;
+
+        int _oldCallCount;
+        int _oldBackEdgeCount;
+
+        static class Hot
+        {
+            public static int Compute(int x)
+            {
+                int r = x;
+                for (int i = 0; i < 8; i++)
+                {
+                    r = (r * 31 + i) ^ (r >> 3);
+                }
+                return r;
+            }
+
+            public static int Fib(int n)
+            {
+                return n < 2 ? n : Fib(n - 1) + Fib(n - 2);
+            }
+        }
+
+        static class Loops
+        {
+            public static long SumSquares(int n)
+            {
+                long sum = 0;
+                long last = -1;
+                for (int i = 0; i < n; i++)
+                {
+                    sum += (long)i * i;
+                    last = i;
+                }
+                return sum + last;
+            }
+
+            public static int NestedLoops(int n)
+            {
+                int count = 0;
+                for (int i = 0; i < n; i++)
+                {
+                    for (int j = 0; j < i; j++)
+                    {
+                        count += (i ^ j) & 1;
+                    }
+                }
+                return count;
+            }
+
+            public static int LoopInTry(int n, int[] finallyRuns)
+            {
+                int sum = 0;
+                try
+                {
+                    for (int i = 0; i < n; i++)
+                    {
+                        sum += i % 7;
+                    }
+                    if (sum > 0)
+                    {
+                        throw new InvalidOperationException(sum.ToString());
+                    }
+                }
+                finally
+                {
+                    finallyRuns[0]++;
+                }
+                return sum;
+            }
+        }
+
+        static int Compute(int x)
+        {
+            int r = x;
+            for (int i = 0; i < 8; i++)
+            {
+                r = (r * 31 + i) ^ (r >> 3);
+            }
+            return r;
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.IgnoreIfNotInterpreted();
+            _oldCallCount = RuntimeApi.GetRuntimeOption(RuntimeOptions.TierUpCallCount);
+            _oldBackEdgeCount = RuntimeApi.GetRuntimeOption(RuntimeOptions.TierUpBackEdgeCount);
+            RuntimeApi.SetRuntimeOption(RuntimeOptions.TierUpCallCount, CallCount);
+            RuntimeApi.SetRuntimeOption(RuntimeOptions.TierUpBackEdgeCount, BackEdgeCount);
+        }
+
+        [OneTimeTearDown]
+        public void TearDown()
+        {
+            RuntimeApi.SetRuntimeOption(RuntimeOptions.TierUpCallCount, _oldCallCount);
+            RuntimeApi.SetRuntimeOption(RuntimeOptions.TierUpBackEdgeCount, _oldBackEdgeCount);
+        }
+
+        [Test]
+        public void HotMethodTiersUpWhileCalledFromThreads()
+        {
+            int errors = 0;
+            var threads = new Thread[4];
+            for (int t = 0; t < threads.Length; t++)
+            {
+                int seed = t * 1000;
+                threads[t] = new Thread(() =>
+                {
+                    for (int i = 0; i < 5000; i++)
+                    {
+                        if (Hot.Compute(seed + i) != Compute(seed + i))
+                        {
+                            Interlocked.Increment(ref errors);
+                        }
+                    }
+                });
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Start();
+            }
+            foreach (Thread thread in threads)
+            {
+                thread.Join();
+            }
+            Assert.AreEqual(0, errors);
+        }
+
+        [Test]
+        public void RecursiveMethodTiersUpWithBaselineFramesOnStack()
+        {
+            for (int i = 0; i < 5; i++)
+            {
+                Assert.AreEqual(6765, Hot.Fib(20));
+            }
+        }
+
+        [Test]
+        public void LoopSwitchesToOptimizedCode()
+        {
+            const int n = 100000;
+            long expected = (long)(n - 1) * n * (2L * n - 1) / 6 + (n - 1);
+            Assert.AreEqual(expected, Loops.SumSquares(n));
+            Assert.AreEqual(expected, Loops.SumSquares(n));
+        }
+
+        [Test]
+        public void InnerLoopSwitchesToOptimizedCode()
+        {
+            int expected = 0;
+            for (int i = 0; i < 300; i++)
+            {
+                for (int j = 0; j < i; j++)
+                {
+                    expected += (i ^ j) & 1;
+                }
+            }
+            Assert.AreEqual(expected, Loops.NestedLoops(300));
+        }
+
+        [Test]
+        public void LoopInTryBlockKeepsItsHandlers()
+        {
+            var finallyRuns = new int[1];
+            int expected = 0;
+            for (int i = 0; i < 10000; i++)
+            {
+                expected += i % 7;
+            }
+            var e = Assert.Throws<InvalidOperationException>(() => Loops.LoopInTry(10000, finallyRuns));
+            Assert.AreEqual(expected.ToString(), e.Message);
+            Assert.AreEqual(1, finallyRuns[0]);
+            Assert.AreEqual(0, Loops.LoopInTry(0, finallyRuns));
+            Assert.AreEqual(2, finallyRuns[0]);
+        }
+    }
+}
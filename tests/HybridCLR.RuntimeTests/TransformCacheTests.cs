@@ -0,0 +1,264 @@
+using System;
+using System.IO;
+using NUnit.Framework;
+using UnityEngine;
+
+namespace HybridCLR.RuntimeTests
+{
+    // optimized code of interpreter methods is saved to <dir>/<assembly>.ircache and loaded again on the next start.
+    // a method is transformed once per run, so loading saved entries is tested by the next run of the tests, which
+    // finds the files the previous run saved.
+    [TestFixture]
+    public class TransformCacheTests
+    {
+        static class SavedSubjects
+        {
+            public static int Sum(int[] values)
+            {
+                int sum = 0;
+                foreach (int value in values)
+                {
+                    sum += value;
+                }
+                return sum;
+            }
+
+            public static string Describe(object obj)
+            {
+                return obj == null ? "null" : obj.GetType().Name + ":" + obj;
+            }
+        }
+
+        static class RoundTripSubjects
+        {
+            public static long Polynomial(long x)
+            {
+                return ((3 * x + 2) * x - 7) * x + 11;
+            }
+
+            public static string Join(string[] parts, char separator)
+            {
+                string result = "";
+                for (int i = 0; i < parts.Length; i++)
+                {
+                    result += i == 0 ? parts[i] : separator + parts[i];
+                }
+                return result;
+            }
+
+            public static int Classify(object obj)
+            {
+                switch (obj)
+                {
+                    case int i: return i;
+                    case string s: return s.Length * 100;
+                    default: return -1;
+                }
+            }
+        }
+
+        static class CorruptedEntrySubjects
+        {
+            public static double Average(double[] values)
+            {
+                double sum = 0;
+                foreach (double value in values)
+                {
+                    sum += value;
+                }
+                return sum / values.Length;
+            }
+
+            public static int Fold(int[] values)
+            {
+                int r = 17;
+                foreach (int value in values)
+                {
+                    r = r * 31 ^ value;
+                }
+                return r;
+            }
+        }
+
+        struct Tag0 { }
+        struct Tag1 { }
+        struct Tag2 { }
+        struct Tag3 { }
+
+        // every instantiation is a method that wasn't transformed before
+        static class CorruptedFileSubjects<T>
+        {
+            public static int Count(T[] values)
+            {
+                int n = 0;
+                foreach (T value in values)
+                {
+                    n += value.Equals(default(T)) ? 1 : 10;
+                }
+                return n;
+            }
+        }
+
+        static string CacheFileName
+        {
+            get { return typeof(TransformCacheTests).Assembly.GetName().Name + ".ircache"; }
+        }
+
+        static string CreateDirectory(string name, bool clear)
+        {
+            string dir = Path.Combine(Application.temporaryCachePath, "ircache-tests", name);
+            if (clear && Directory.Exists(dir))
+            {
+                Directory.Delete(dir, true);
+            }
+            Directory.CreateDirectory(dir);
+            return dir;
+        }
+
+        static void CheckRoundTripSubjects()
+        {
+            Assert.AreEqual(((3L * 5 + 2) * 5 - 7) * 5 + 11, RoundTripSubjects.Polynomial(5));
+            Assert.AreEqual("a,b,c", RoundTripSubjects.Join(new[] { "a", "b", "c" }, ','));
+            Assert.AreEqual(7, RoundTripSubjects.Classify(7));
+            Assert.AreEqual(300, RoundTripSubjects.Classify("abc"));
+            Assert.AreEqual(-1, RoundTripSubjects.Classify(1.5));
+        }
+
+        static void CheckCorruptedEntrySubjects()
+        {
+            Assert.AreEqual(2.5, CorruptedEntrySubjects.Average(new[] { 1.0, 2.0, 3.0, 4.0 }));
+            Assert.AreEqual(((17 * 31) ^ 1) * 31 ^ 2, CorruptedEntrySubjects.Fold(new[] { 1, 2 }));
+        }
+
+        [OneTimeSetUp]
+        public void SetUp()
+        {
+            TestUtil.IgnoreIfNotInterpreted();
+        }
+
+        [TearDown]
+        public void TearDown()
+        {
+            RuntimeApi.SetTransformCacheDirectory(null);
+        }
+
+        [Test]
+        public void SaveWritesCacheFile()
+        {
+            string dir = CreateDirectory("save", true);
+            RuntimeApi.SetTransformCacheDirectory(dir);
+            TestUtil.Optimize(typeof(SavedSubjects));
+            Assert.AreEqual(6, SavedSubjects.Sum(new[] { 1, 2, 3 }));
+            Assert.AreEqual("Int32:5", SavedSubjects.Describe(5));
+            Assert.AreEqual("null", SavedSubjects.Describe(null));
+            Assert.IsTrue(RuntimeApi.SaveTransformCache());
+            var file = new FileInfo(Path.Combine(dir, CacheFileName));
+            Assert.IsTrue(file.Exists);
+            Assert.Greater((int)file.Length, 0);
+        }
+
+        [Test]
+        public void RoundTripAcrossRuns()
+        {
+            // the file of the previous run is loaded
+            string dir = CreateDirectory("roundtrip", false);
+            RuntimeApi.SetTransformCacheDirectory(dir);
+            TestUtil.Optimize(typeof(RoundTripSubjects));
+            CheckRoundTripSubjects();
+            Assert.IsTrue(RuntimeApi.SaveTransformCache());
+            CheckRoundTripSubjects();
+        }
+
+        [Test]
+        public void CorruptedEntriesAcrossRuns()
+        {
+            string dir = CreateDirectory("corrupted-entries", false);
+            string path = Path.Combine(dir, CacheFileName);
+            if (File.Exists(path))
+            {
+                // the second half of the file is entries, the header stays valid
+                byte[] data = File.ReadAllBytes(path);
+                for (int i = data.Length / 2; i < data.Length; i += 7)
+                {
+                    data[i] ^= 0x5a;
+                }
+                File.WriteAllBytes(path, data);
+            }
+            RuntimeApi.SetTransformCacheDirectory(dir);
+            TestUtil.Optimize(typeof(CorruptedEntrySubjects));
+            CheckCorruptedEntrySubjects();
+            Assert.IsTrue(RuntimeApi.SaveTransformCache());
+        }
+
+        [Test]
+        public void CorruptedFilesAreIgnored()
+        {
+            // a valid file of this assembly to corrupt
+            string validDir = CreateDirectory("valid", true);
+            RuntimeApi.SetTransformCacheDirectory(validDir);
+            TestUtil.Optimize(typeof(CorruptedFileSubjects<Tag0>));
+            Assert.IsTrue(RuntimeApi.SaveTransformCache());
+            byte[] valid = File.ReadAllBytes(Path.Combine(validDir, CacheFileName));
+            Assert.Greater(valid.Length, 32);
+
+            Func<byte[], byte[]>[] corruptions =
+            {
+                data => new byte[0],
+                data =>
+                {
+                    var truncated = new byte[data.Length / 2];
+                    Array.Copy(data, truncated, truncated.Length);
+                    return truncated;
+                },
+                data =>
+                {
+                    var flipped = (byte[])data.Clone();
+                    for (int i = 0; i < flipped.Length; i += 3)
+                    {
+                        flipped[i] = (byte)~flipped[i];
+                    }
+                    return flipped;
+                },
+                data =>
+                {
+                    // magic, format version and mvid are kept, the entry count and the entries are garbage
+                    var garbage = (byte[])data.Clone();
+                    for (int i = 24; i < garbage.Length; i++)
+                    {
+                        garbage[i] = 0xff;
+                    }
+                    return garbage;
+                },
+            };
+            for (int i = 0; i < corruptions.Length; i++)
+            {
+                string dir = CreateDirectory("corrupted-" + i, true);
+                File.WriteAllBytes(Path.Combine(dir, CacheFileName), corruptions[i](valid));
+                RuntimeApi.SetTransformCacheDirectory(dir);
+                int count;
+                switch (i)
+                {
+                    case 0:
+                        TestUtil.Optimize(typeof(CorruptedFileSubjects<Tag1>));
+                        count = CorruptedFileSubjects<Tag1>.Count(new Tag1[2]);
+                        break;
+                    case 1:
+                        TestUtil.Optimize(typeof(CorruptedFileSubjects<Tag2>));
+                        count = CorruptedFileSubjects<Tag2>.Count(new Tag2[2]);
+                        break;
+                    case 2:
+                        TestUtil.Optimize(typeof(CorruptedFileSubjects<Tag3>));
+                        count = CorruptedFileSubjects<Tag3>.Count(new Tag3[2]);
+                        break;
+                    default:
+                        TestUtil.Optimize(typeof(CorruptedFileSubjects<int>));
+                        count = CorruptedFileSubjects<int>.Count(new[] { 0, 5 });
+                        break;
+                }
+                Assert.AreEqual(i == 3 ? 11 : 2, count, "corruption " + i);
+                // the corrupted file is replaced
+                Assert.IsTrue(RuntimeApi.SaveTransformCache(), "corruption " + i);
+            }
+        }
+    }
+}